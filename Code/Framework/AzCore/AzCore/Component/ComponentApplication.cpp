@@ -22,6 +22,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -54,6 +55,7 @@
 #include <AzCore/Debug/ProfilerDriller.h>
 #include <AzCore/Debug/EventTraceDriller.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/TimelineRecorder.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 
 #include <AzCore/Math/PolygonPrism.h>
@@ -649,6 +651,7 @@ namespace AZ
 
         m_currentTime = AZStd::chrono::system_clock::now();
         TickRequestBus::Handler::BusConnect();
+        m_parallelTickScheduler = AZStd::make_unique<ParallelTickScheduler>();
 
 #if defined(AZ_ENABLE_DEBUG_TOOLS)
         // Prior to loading more modules, we make sure SymbolStorage
@@ -744,6 +747,7 @@ namespace AZ
         // Disconnect from application and tick request buses
         ComponentApplicationBus::Handler::BusDisconnect();
         TickRequestBus::Handler::BusDisconnect();
+        m_parallelTickScheduler.reset();
 
         if (m_drillerManager)
         {
@@ -961,11 +965,16 @@ namespace AZ
         //!    3. <project_build_path>/bin/$<CONFIG>/Registry
         //! 3. MergeSettingsToRegistry_GemRegistries - Merges the settings registry files from each gem's <GemRoot>/Registry directory
 
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
-            AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+        //! 4. If a SnapshotPathKey is set, all of the above is merged from the snapshot instead while it's up to date
+        SettingsRegistryMergeUtils::MergeSettingsToRegistry_SnapshotOrFiles(registry, specializations,
+            [&registry, &specializations, &scratchBuffer]()
+            {
+                SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
+                    AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+                SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+                SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+                SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            });
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_O3deUserRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, false);
@@ -1396,6 +1405,12 @@ namespace AZ
             AZ_PROFILE_TIMER("System", "Component application simulation tick function");
             AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
+            // Frame arena memory is only valid for the duration of a tick.
+            if (AllocatorInstance<FrameArenaAllocator>::IsReady())
+            {
+                static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator()).ResetFrame();
+            }
+
             AZStd::chrono::system_clock::time_point now = AZStd::chrono::system_clock::now();
 
             m_deltaTime = 0.0f;
@@ -1415,11 +1430,18 @@ namespace AZ
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ComponentApplication::Tick:OnTick");
                 EBUS_EVENT(TickBus, OnTick, m_deltaTime, ScriptTimePoint(now));
             }
+            if (m_parallelTickScheduler)
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ComponentApplication::Tick:OnParallelTick");
+                m_parallelTickScheduler->Tick(m_deltaTime, ScriptTimePoint(now));
+            }
         }
         if (m_drillerManager)
         {
             m_drillerManager->FrameUpdate();
         }
+
+        Debug::TimelineRecorder::EndFrame();
     }
 
     //=========================================================================
@@ -10,6 +10,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/ParallelTickScheduler.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Debug/ProfileModuleInit.h>
 #include <AzCore/Memory/AllocationRecords.h>
@@ -419,6 +420,7 @@ namespace AZ
         AZ::CommandLine                             m_commandLine; // < Stores parsed command line supplied to the constructor
 
         AZStd::unique_ptr<AZ::Entity>               m_systemEntity; ///< Track the system entity to ensure we free it on shutdown.
+        AZStd::unique_ptr<ParallelTickScheduler>    m_parallelTickScheduler; ///< Runs the ParallelTickBus phase of Tick.
 
         // Created early to allow events to be logged before anything else. These will be kept in memory until
         // a file is associated with the logger. The internal buffer is limited to 64kb and once full unexpected
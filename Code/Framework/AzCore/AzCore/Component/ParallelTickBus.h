@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+/** @file
+ * Header file for the buses of the parallel tick phase, which ticks groups of handlers
+ * on job worker threads after AZ::TickBus::OnTick.
+ */
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    /**
+     * Describes a group of AZ::ParallelTickBus handlers and the services that the handlers of the group
+     * read or write while ticking. Two groups are dependent if one of them writes a service that the other
+     * one reads or writes. Dependent groups tick one after the other in ascending m_order, independent
+     * groups tick at the same time on different job worker threads.
+     * The handlers within a group always tick one after the other, in the order of their GetTickOrder.
+     */
+    struct ParallelTickGroupDescriptor
+    {
+        AZ::Crc32 m_id;
+        const char* m_name = ""; ///< Used for profiling and timing reports. Must outlive the registration, e.g. a string literal.
+        int m_order = TICK_DEFAULT; ///< Order relative to dependent groups, see the ComponentTickBus enum for recommended values.
+        AZStd::vector<ComponentServiceType> m_reads; ///< Services that are only read while ticking.
+        AZStd::vector<ComponentServiceType> m_writes; ///< Services that are modified while ticking.
+    };
+
+    /**
+     * Interface for AZ::ParallelTickBus, the opt-in parallel tick phase.
+     * OnParallelTick is called every frame after TickBus::OnTick, on a job worker thread (or on the main thread
+     * if there is no job manager). Handlers pick their group with GetTickGroup, the group is registered through
+     * AZ::ParallelTickRequestBus by the system that owns the handlers, typically in the Activate of its system component.
+     * Handlers of groups that are not registered tick in the default group, which is dependent on every other group.
+     *
+     * Handlers must not connect to or disconnect from the ParallelTickBus, or be destroyed, during the parallel tick
+     * phase. Use TickBus::QueueFunction to defer such work to the next frame.
+     */
+    class ParallelTickEvents
+        : public AZ::EBusTraits
+    {
+    public:
+        AZ_RTTI(ParallelTickEvents, "{CC35E6A0-0B73-42B4-857A-BC3E741A9650}");
+
+        virtual ~ParallelTickEvents() = default;
+
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static const AZ::EBusHandlerPolicy HandlerPolicy = EBusHandlerPolicy::MultipleAndOrdered;
+        /**
+         * Handlers may connect from any thread, e.g. from entities that are activated by a job.
+         */
+        using MutexType = AZStd::recursive_mutex;
+        /**
+         * The handlers are collected every frame, keep them in a contiguous array.
+         */
+        static constexpr bool EnableHandlerSnapshot = true;
+
+        struct BusHandlerOrderCompare
+        {
+            AZ_FORCE_INLINE bool operator()(ParallelTickEvents* left, ParallelTickEvents* right) const { return left->GetTickOrder() < right->GetTickOrder(); }
+        };
+        //////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Signals that the application has issued a tick, called from a job worker thread.
+         * Only the services declared by the group of the handler may be accessed.
+         * @param deltaTime The delta (in seconds) from the previous tick and the current time.
+         * @param time The current time.
+         */
+        virtual void OnParallelTick(float deltaTime, ScriptTimePoint time) = 0;
+
+        /**
+         * Returns the id of the group this handler ticks in, see ParallelTickGroupDescriptor.
+         * This value should not be changed while the handler is connected.
+         */
+        virtual AZ::Crc32 GetTickGroup() { return AZ::Crc32(); }
+
+        /**
+         * Specifies the order in which the handler ticks relative to the other handlers of its group.
+         * This value should not be changed while the handler is connected.
+         */
+        virtual int GetTickOrder() { return TICK_DEFAULT; }
+    };
+
+    /**
+     * The EBus for parallel tick notification events.
+     * The events are defined in the AZ::ParallelTickEvents class.
+     */
+    using ParallelTickBus = AZ::EBus<ParallelTickEvents>;
+
+    /**
+     * Interface for AZ::ParallelTickRequestBus, which is used to declare tick groups.
+     * It is handled by the AZ::ParallelTickScheduler of the ComponentApplication.
+     */
+    class ParallelTickRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        using MutexType = AZStd::recursive_mutex;
+
+        /**
+         * Registers a tick group, or updates it if a group with the same id was already registered.
+         */
+        virtual void RegisterTickGroup(const ParallelTickGroupDescriptor& group) = 0;
+
+        virtual void UnregisterTickGroup(AZ::Crc32 groupId) = 0;
+
+        /**
+         * Prints the duration of every group, the critical path through the groups, and the most expensive
+         * handlers of the last tick. Timing has to be enabled with the tick_parallelTimings console variable.
+         */
+        virtual void ReportTickTimings() = 0;
+    };
+
+    using ParallelTickRequestBus = AZ::EBus<ParallelTickRequests>;
+} // namespace AZ
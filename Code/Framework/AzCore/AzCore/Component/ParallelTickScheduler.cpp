@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ParallelTickScheduler.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/TimelineRecorder.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    AZ_CVAR(bool, tick_parallelEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Ticks independent ParallelTickBus groups at the same time on the job system. If false, all groups tick on the main thread.");
+    AZ_CVAR(bool, tick_parallelTimings, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Measures the cost of every ParallelTickBus group and handler, print them with tick_parallelReport.");
+
+    static void tick_parallelReport([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        ParallelTickRequestBus::Broadcast(&ParallelTickRequests::ReportTickTimings);
+    }
+
+    AZ_CONSOLEFREEFUNC(tick_parallelReport, AZ::ConsoleFunctorFlags::Null,
+        "Prints the cost of the ParallelTickBus groups and the most expensive handlers during the last tick, requires tick_parallelTimings.");
+
+    namespace
+    {
+        bool ContainsAny(const AZStd::vector<ComponentServiceType>& services, const AZStd::vector<ComponentServiceType>& other)
+        {
+            for (ComponentServiceType service : services)
+            {
+                if (AZStd::find(other.begin(), other.end(), service) != other.end())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    } // namespace
+
+    ParallelTickScheduler::ParallelTickScheduler()
+    {
+        Group& defaultGroup = m_groups.emplace_back();
+        defaultGroup.m_descriptor.m_name = "Default";
+        defaultGroup.m_isDefault = true;
+        m_groupIndices.emplace(static_cast<AZ::u32>(defaultGroup.m_descriptor.m_id), 0);
+
+        ParallelTickRequestBus::Handler::BusConnect();
+    }
+
+    ParallelTickScheduler::~ParallelTickScheduler()
+    {
+        ParallelTickRequestBus::Handler::BusDisconnect();
+    }
+
+    void ParallelTickScheduler::Tick(float deltaTime, ScriptTimePoint time)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        m_isTicking = true;
+        m_deltaTime = deltaTime;
+        m_time = time;
+        m_isTimingEnabled = tick_parallelTimings;
+
+        CollectHandlers();
+        const bool hasHandlers = AZStd::any_of(m_groups.begin(), m_groups.end(), [](const Group& group)
+        {
+            return !group.m_handlers.empty();
+        });
+        if (!hasHandlers)
+        {
+            m_isTicking = false;
+            return;
+        }
+
+        JobContext* context = tick_parallelEnabled ? JobContext::GetGlobalContext() : nullptr;
+        m_wasParallel = context != nullptr;
+        if (m_wasParallel)
+        {
+            if (!m_graph || m_graphContext != context)
+            {
+                BuildGraph(context);
+            }
+            m_graph->SetTimingEnabled(m_isTimingEnabled);
+            m_graph->SubmitAndWait();
+        }
+        else
+        {
+            // The groups are sorted by order, so ticking them one after the other respects all dependencies
+            for (Group& group : m_groups)
+            {
+                TickGroup(group);
+            }
+        }
+
+        m_isTicking = false;
+    }
+
+    AZStd::vector<ParallelTickScheduler::HandlerTiming> ParallelTickScheduler::GetHandlerTimings() const
+    {
+        AZStd::vector<HandlerTiming> timings;
+        if (m_isTimingEnabled)
+        {
+            for (const Group& group : m_groups)
+            {
+                for (size_t i = 0; i < group.m_handlerDurations.size(); ++i)
+                {
+                    HandlerTiming& timing = timings.emplace_back();
+                    timing.m_name = group.m_handlerNames[i];
+                    timing.m_groupName = group.m_descriptor.m_name;
+                    timing.m_duration = group.m_handlerDurations[i];
+                }
+            }
+            AZStd::sort(timings.begin(), timings.end(), [](const HandlerTiming& lhs, const HandlerTiming& rhs)
+            {
+                return lhs.m_duration > rhs.m_duration;
+            });
+        }
+        return timings;
+    }
+
+    void ParallelTickScheduler::RegisterTickGroup(const ParallelTickGroupDescriptor& group)
+    {
+        AZ_Assert(!m_isTicking, "Tick groups can't be registered during the parallel tick phase.");
+        if (group.m_id == AZ::Crc32())
+        {
+            AZ_Error("ParallelTick", false, "Tick group '%s' uses the id of the default group.", group.m_name);
+            return;
+        }
+
+        auto groupIt = AZStd::find_if(m_groups.begin(), m_groups.end(), [&group](const Group& existing)
+        {
+            return existing.m_descriptor.m_id == group.m_id;
+        });
+        if (groupIt != m_groups.end())
+        {
+            m_groups.erase(groupIt);
+        }
+
+        // Insert after all groups with the same order, so dependent groups with the same order tick in registration order
+        groupIt = AZStd::find_if(m_groups.begin(), m_groups.end(), [&group](const Group& existing)
+        {
+            return existing.m_descriptor.m_order > group.m_order;
+        });
+        Group newGroup;
+        newGroup.m_descriptor = group;
+        m_groups.insert(groupIt, AZStd::move(newGroup));
+
+        m_groupIndices.clear();
+        for (size_t i = 0; i < m_groups.size(); ++i)
+        {
+            m_groupIndices.emplace(static_cast<AZ::u32>(m_groups[i].m_descriptor.m_id), i);
+        }
+        m_graph.reset();
+    }
+
+    void ParallelTickScheduler::UnregisterTickGroup(AZ::Crc32 groupId)
+    {
+        AZ_Assert(!m_isTicking, "Tick groups can't be unregistered during the parallel tick phase.");
+        auto groupIt = AZStd::find_if(m_groups.begin(), m_groups.end(), [groupId](const Group& existing)
+        {
+            return !existing.m_isDefault && existing.m_descriptor.m_id == groupId;
+        });
+        if (groupIt == m_groups.end())
+        {
+            return;
+        }
+
+        m_groups.erase(groupIt);
+        m_groupIndices.clear();
+        for (size_t i = 0; i < m_groups.size(); ++i)
+        {
+            m_groupIndices.emplace(static_cast<AZ::u32>(m_groups[i].m_descriptor.m_id), i);
+        }
+        m_graph.reset();
+    }
+
+    void ParallelTickScheduler::ReportTickTimings()
+    {
+        if (!m_isTimingEnabled)
+        {
+            AZ_Warning("ParallelTick", false, "Timing of the last tick is not available, set tick_parallelTimings to true first.");
+            return;
+        }
+
+        const double ticksToMs = 1000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+        AZ_TracePrintf("ParallelTick", "Group                                     Handlers    Total (ms)\n");
+        for (const Group& group : m_groups)
+        {
+            AZStd::sys_time_t total = 0;
+            for (AZStd::sys_time_t duration : group.m_handlerDurations)
+            {
+                total += duration;
+            }
+            AZ_TracePrintf("ParallelTick", "%-40s  %8zu    %10.3f\n", group.m_descriptor.m_name, group.m_handlers.size(), total * ticksToMs);
+        }
+
+        if (m_wasParallel && m_graph)
+        {
+            m_graph->ReportTimings();
+        }
+
+        constexpr size_t MaxReportedHandlers = 20;
+        const AZStd::vector<HandlerTiming> timings = GetHandlerTimings();
+        AZ_TracePrintf("ParallelTick", "Most expensive handlers:\n");
+        for (size_t i = 0; i < timings.size() && i < MaxReportedHandlers; ++i)
+        {
+            AZ_TracePrintf("ParallelTick", "%-48s  %-24s  %10.3f ms\n", timings[i].m_name, timings[i].m_groupName, timings[i].m_duration * ticksToMs);
+        }
+    }
+
+    bool ParallelTickScheduler::AreDependent(const Group& first, const Group& second)
+    {
+        if (first.m_isDefault || second.m_isDefault)
+        {
+            return true;
+        }
+        const ParallelTickGroupDescriptor& lhs = first.m_descriptor;
+        const ParallelTickGroupDescriptor& rhs = second.m_descriptor;
+        return ContainsAny(lhs.m_writes, rhs.m_writes) || ContainsAny(lhs.m_writes, rhs.m_reads) || ContainsAny(lhs.m_reads, rhs.m_writes);
+    }
+
+    void ParallelTickScheduler::CollectHandlers()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        for (Group& group : m_groups)
+        {
+            group.m_handlers.clear();
+            group.m_handlerDurations.clear();
+            group.m_handlerNames.clear();
+        }
+
+        const size_t defaultGroupIndex = m_groupIndices.find(static_cast<AZ::u32>(AZ::Crc32()))->second;
+        ParallelTickBus::EnumerateHandlers([this, defaultGroupIndex](ParallelTickEvents* handler)
+        {
+            auto indexIt = m_groupIndices.find(static_cast<AZ::u32>(handler->GetTickGroup()));
+            const size_t groupIndex = indexIt != m_groupIndices.end() ? indexIt->second : defaultGroupIndex;
+            m_groups[groupIndex].m_handlers.push_back(handler);
+            return true;
+        });
+    }
+
+    void ParallelTickScheduler::BuildGraph(JobContext* context)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        m_graph = AZStd::make_unique<TaskGraph>(context);
+        for (size_t i = 0; i < m_groups.size(); ++i)
+        {
+            m_groups[i].m_task = m_graph->AddTask(m_groups[i].m_descriptor.m_name, [this, i]()
+            {
+                TickGroup(m_groups[i]);
+            });
+        }
+
+        // The groups are sorted by order, so dependencies always point from an earlier to a later group
+        for (size_t second = 1; second < m_groups.size(); ++second)
+        {
+            for (size_t first = 0; first < second; ++first)
+            {
+                if (AreDependent(m_groups[first], m_groups[second]))
+                {
+                    m_graph->AddDependency(m_groups[first].m_task, m_groups[second].m_task);
+                }
+            }
+        }
+
+        [[maybe_unused]] const bool isCompiled = m_graph->Compile();
+        AZ_Assert(isCompiled, "The dependencies between tick groups can't form a cycle.");
+        m_graphContext = context;
+    }
+
+    void ParallelTickScheduler::TickGroup(Group& group)
+    {
+        const size_t handlerCount = group.m_handlers.size();
+        if (m_isTimingEnabled)
+        {
+            group.m_handlerDurations.resize(handlerCount);
+            group.m_handlerNames.resize(handlerCount);
+        }
+
+        for (size_t i = 0; i < handlerCount; ++i)
+        {
+            ParallelTickEvents* handler = group.m_handlers[i];
+            if (m_isTimingEnabled || Debug::TimelineRecorder::IsRecording())
+            {
+                const char* name = handler->RTTI_GetTypeName();
+                const AZStd::sys_time_t start = AZStd::GetTimeNowTicks();
+                {
+                    AZ_TIMELINE_SCOPE("ParallelTick", name);
+                    handler->OnParallelTick(m_deltaTime, m_time);
+                }
+                if (m_isTimingEnabled)
+                {
+                    group.m_handlerDurations[i] = AZStd::GetTimeNowTicks() - start;
+                    group.m_handlerNames[i] = name;
+                }
+            }
+            else
+            {
+                handler->OnParallelTick(m_deltaTime, m_time);
+            }
+        }
+    }
+} // namespace AZ
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/ParallelTickBus.h>
+#include <AzCore/Jobs/TaskGraph.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class JobContext;
+
+    /**
+     * Runs the parallel tick phase: ticks the handlers of AZ::ParallelTickBus in their groups, running groups that
+     * don't access the same services at the same time on the job system. The dependencies between the groups are
+     * compiled into a TaskGraph, which is only rebuilt when groups are registered or unregistered.
+     * If there is no global JobContext or tick_parallelEnabled is false, the groups tick on the calling thread.
+     *
+     * When tick_parallelTimings is enabled, the cost of every group and every handler is measured, see ReportTickTimings.
+     */
+    class ParallelTickScheduler
+        : public ParallelTickRequestBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ParallelTickScheduler, SystemAllocator, 0);
+
+        //! Duration of the OnParallelTick of a handler during the last tick.
+        struct HandlerTiming
+        {
+            const char* m_name = nullptr; ///< RTTI name of the handler.
+            const char* m_groupName = nullptr;
+            AZStd::sys_time_t m_duration = 0; ///< In ticks, see AZStd::GetTimeTicksPerSecond.
+        };
+
+        ParallelTickScheduler();
+        ~ParallelTickScheduler() override;
+
+        //! Ticks all ParallelTickBus handlers and returns once they have completed. Called by ComponentApplication::Tick.
+        void Tick(float deltaTime, ScriptTimePoint time);
+
+        //! Returns the handler timings of the last tick, sorted from most to least expensive. Empty if timing is disabled.
+        AZStd::vector<HandlerTiming> GetHandlerTimings() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        // ParallelTickRequestBus
+        void RegisterTickGroup(const ParallelTickGroupDescriptor& group) override;
+        void UnregisterTickGroup(AZ::Crc32 groupId) override;
+        void ReportTickTimings() override;
+        //////////////////////////////////////////////////////////////////////////
+
+    private:
+        struct Group
+        {
+            ParallelTickGroupDescriptor m_descriptor;
+            bool m_isDefault = false; ///< The default group is dependent on every other group.
+            TaskGraph::TaskId m_task = TaskGraph::InvalidTaskId;
+            AZStd::vector<ParallelTickEvents*> m_handlers; ///< Collected every tick.
+            AZStd::vector<AZStd::sys_time_t> m_handlerDurations; ///< Filled if timing is enabled.
+            AZStd::vector<const char*> m_handlerNames; ///< Filled if timing is enabled.
+        };
+
+        static bool AreDependent(const Group& first, const Group& second);
+
+        void CollectHandlers();
+        void BuildGraph(JobContext* context);
+        void TickGroup(Group& group);
+
+        AZStd::vector<Group> m_groups; ///< Sorted by order, then by registration.
+        AZStd::unordered_map<AZ::u32, size_t> m_groupIndices;
+        AZStd::unique_ptr<TaskGraph> m_graph;
+        JobContext* m_graphContext = nullptr; ///< Context the jobs of m_graph were created for.
+        float m_deltaTime = 0.0f;
+        ScriptTimePoint m_time;
+        bool m_isTicking = false;
+        bool m_isTimingEnabled = false; ///< Whether the last tick was timed.
+        bool m_wasParallel = false; ///< Whether the last tick ran on the job system.
+    };
+} // namespace AZ
@@ -8,6 +8,7 @@
 #ifndef AZCORE_PROFILER_H
 #define AZCORE_PROFILER_H 1
 
+#include <AzCore/Debug/TimelineRecorder.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/function/function_fwd.h>
 
@@ -248,26 +249,28 @@ namespace AZ
 #   define AZ_INTERNAL_PROF_VERIFY_CAT(category) static_assert(category < AZ::Debug::ProfileCategory::Count, "Invalid profile category")
 #   define AZ_INTERNAL_PROF_CAT_NAME(category) AZ::Debug::ProfileCategoryNames[static_cast<AZ::u32>(category)]
 
+// Besides the profiler registers, scopes are recorded on the timeline (see AZ::Debug::TimelineRecorder) while it's running.
+// Dynamic scopes are recorded with their format string as name.
 #   define AZ_PROFILE_FUNCTION(category) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); AZ_TIMELINE_SCOPE(AZ_INTERNAL_PROF_CAT_NAME(category), AZ_FUNCTION_SIGNATURE)
 #   define AZ_PROFILE_FUNCTION_STALL(category) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); AZ_TIMELINE_SCOPE(AZ_INTERNAL_PROF_CAT_NAME(category), AZ_FUNCTION_SIGNATURE)
 #   define AZ_PROFILE_FUNCTION_IDLE(category) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); AZ_TIMELINE_SCOPE(AZ_INTERNAL_PROF_CAT_NAME(category), AZ_FUNCTION_SIGNATURE)
 
 #   define AZ_PROFILE_SCOPE(category, name) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); (void)(name)
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); AZ_TIMELINE_SCOPE(AZ_INTERNAL_PROF_CAT_NAME(category), name)
 #   define AZ_PROFILE_SCOPE_STALL(category, name) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); (void)(name)
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); AZ_TIMELINE_SCOPE(AZ_INTERNAL_PROF_CAT_NAME(category), name)
 #   define AZ_PROFILE_SCOPE_IDLE(category, name) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); (void)(name)
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); AZ_TIMELINE_SCOPE(AZ_INTERNAL_PROF_CAT_NAME(category), name)
 
 #   define AZ_PROFILE_SCOPE_DYNAMIC(category, ...) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); AZ_TIMELINE_SCOPE(AZ_INTERNAL_PROF_CAT_NAME(category), __VA_ARGS__)
 #   define AZ_PROFILE_SCOPE_STALL_DYNAMIC(category, ...) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); AZ_TIMELINE_SCOPE(AZ_INTERNAL_PROF_CAT_NAME(category), __VA_ARGS__)
 #   define AZ_PROFILE_SCOPE_IDLE_DYNAMIC(category, ...) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); AZ_TIMELINE_SCOPE(AZ_INTERNAL_PROF_CAT_NAME(category), __VA_ARGS__)
 #endif
 
 #ifndef AZ_PROFILE_EVENT_BEGIN
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/TimelineRecorder.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <cinttypes>
+
+namespace AZ
+{
+    AZ_CVAR(float, timeline_captureSeconds, 10.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of seconds of the timeline that timeline_capture and frame budget captures write.");
+    AZ_CVAR(float, timeline_frameBudgetMs, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If larger than 0 and the timeline is recording, a capture is written to @user@/Profiling whenever a frame takes longer than this. "
+        "At most one capture is written per timeline_captureSeconds.");
+
+    namespace Debug
+    {
+        namespace Internal
+        {
+            // Ring buffer with the events of a single thread. Only the owning thread writes to it. Readers copy the events
+            // without synchronizing with the writer and afterwards discard the events that may have been overwritten
+            // while copying, based on the write index.
+            struct TimelineThreadBuffer
+            {
+                AZStd::atomic<AZ::u64> m_writeIndex{ 0 };
+                TimelineEvent* m_events = nullptr;
+                AZ::u64 m_capacity = 0;
+                AZ::u32 m_threadIndex = 0;
+                AZStd::thread_id m_threadId;
+                TimelineThreadBuffer* m_next = nullptr;
+            };
+
+            struct TimelineThreadEvents
+            {
+                const TimelineThreadBuffer* m_buffer = nullptr;
+                AZStd::vector<TimelineEvent, AZ::OSStdAllocator> m_events;
+            };
+
+            // Thread buffers are allocated from the OS directly and never released, as threads may record at any
+            // point during their lifetime without checking if the buffer is still alive.
+            static AZStd::atomic<TimelineThreadBuffer*> s_threadBuffers{ nullptr };
+            static AZStd::atomic<AZ::u32> s_eventsPerThread{ TimelineRecorder::DefaultEventsPerThread };
+            static AZStd::atomic<AZ::u32> s_numThreadBuffers{ 0 };
+            static AZ_THREAD_LOCAL TimelineThreadBuffer* s_threadBuffer = nullptr;
+
+            static AZStd::sys_time_t s_lastFrameEndTicks = 0;
+            static AZStd::sys_time_t s_lastBudgetCaptureTicks = 0;
+
+            static TimelineThreadBuffer* CreateThreadBuffer()
+            {
+                const AZ::u32 capacity = s_eventsPerThread.load(AZStd::memory_order_relaxed);
+                void* memory = AZ_OS_MALLOC(sizeof(TimelineThreadBuffer), alignof(TimelineThreadBuffer));
+                TimelineThreadBuffer* buffer = new (memory) TimelineThreadBuffer();
+                buffer->m_events = reinterpret_cast<TimelineEvent*>(AZ_OS_MALLOC(sizeof(TimelineEvent) * capacity, alignof(TimelineEvent)));
+                buffer->m_capacity = capacity;
+                buffer->m_threadIndex = s_numThreadBuffers.fetch_add(1, AZStd::memory_order_relaxed);
+                buffer->m_threadId = AZStd::this_thread::get_id();
+
+                TimelineThreadBuffer* head = s_threadBuffers.load(AZStd::memory_order_relaxed);
+                do
+                {
+                    buffer->m_next = head;
+                } while (!s_threadBuffers.compare_exchange_weak(head, buffer, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+                return buffer;
+            }
+
+            // Copies the events of every thread that ended at or after the provided time.
+            static AZStd::vector<TimelineThreadEvents, AZ::OSStdAllocator> CollectEvents(AZStd::sys_time_t fromTicks)
+            {
+                AZStd::vector<TimelineThreadEvents, AZ::OSStdAllocator> result;
+                for (const TimelineThreadBuffer* buffer = s_threadBuffers.load(AZStd::memory_order_acquire); buffer; buffer = buffer->m_next)
+                {
+                    const AZ::u64 end = buffer->m_writeIndex.load(AZStd::memory_order_acquire);
+                    AZ::u64 begin = end > buffer->m_capacity ? end - buffer->m_capacity : 0;
+                    if (begin == end)
+                    {
+                        continue;
+                    }
+
+                    TimelineThreadEvents& threadEvents = result.emplace_back();
+                    threadEvents.m_buffer = buffer;
+                    threadEvents.m_events.reserve(end - begin);
+                    for (AZ::u64 index = begin; index < end; ++index)
+                    {
+                        threadEvents.m_events.push_back(buffer->m_events[index & (buffer->m_capacity - 1)]);
+                    }
+
+                    // Drop the events the owning thread overwrote while they were being copied. The owning thread may also be
+                    // writing the slot at endAfterCopy without having published it yet, so that slot counts as overwritten too.
+                    const AZ::u64 endAfterCopy = buffer->m_writeIndex.load(AZStd::memory_order_acquire);
+                    const AZ::u64 firstValid = endAfterCopy + 1 > buffer->m_capacity ? endAfterCopy + 1 - buffer->m_capacity : 0;
+                    if (firstValid > begin)
+                    {
+                        const size_t numOverwritten = static_cast<size_t>(AZStd::min(firstValid - begin, end - begin));
+                        threadEvents.m_events.erase(threadEvents.m_events.begin(), threadEvents.m_events.begin() + numOverwritten);
+                    }
+
+                    auto outsideWindow = [fromTicks](const TimelineEvent& event) { return event.m_endTicks < fromTicks; };
+                    threadEvents.m_events.erase(
+                        AZStd::remove_if(threadEvents.m_events.begin(), threadEvents.m_events.end(), outsideWindow), threadEvents.m_events.end());
+                }
+                return result;
+            }
+
+            static void AppendJsonString(AZStd::string& output, const char* text)
+            {
+                output += '"';
+                for (const char* c = text ? text : ""; *c; ++c)
+                {
+                    switch (*c)
+                    {
+                    case '"':
+                        output += "\\\"";
+                        break;
+                    case '\\':
+                        output += "\\\\";
+                        break;
+                    case '\n':
+                        output += "\\n";
+                        break;
+                    case '\t':
+                        output += "\\t";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(*c) >= 0x20)
+                        {
+                            output += *c;
+                        }
+                        break;
+                    }
+                }
+                output += '"';
+            }
+        } // namespace Internal
+
+        AZStd::atomic_bool TimelineRecorder::s_isRecording{ false };
+
+        void TimelineRecorder::Start(AZ::u32 eventsPerThread)
+        {
+            AZ::u32 capacity = 1;
+            while (capacity < eventsPerThread)
+            {
+                capacity <<= 1;
+            }
+            Internal::s_eventsPerThread.store(capacity, AZStd::memory_order_relaxed);
+            Internal::s_lastFrameEndTicks = 0;
+            s_isRecording.store(true, AZStd::memory_order_relaxed);
+        }
+
+        void TimelineRecorder::Stop()
+        {
+            s_isRecording.store(false, AZStd::memory_order_relaxed);
+        }
+
+        void TimelineRecorder::RecordEvent(const char* category, const char* name, AZStd::sys_time_t startTicks, AZStd::sys_time_t endTicks)
+        {
+            Internal::TimelineThreadBuffer* buffer = Internal::s_threadBuffer;
+            if (!buffer)
+            {
+                buffer = Internal::CreateThreadBuffer();
+                Internal::s_threadBuffer = buffer;
+            }
+
+            const AZ::u64 index = buffer->m_writeIndex.load(AZStd::memory_order_relaxed);
+            TimelineEvent& event = buffer->m_events[index & (buffer->m_capacity - 1)];
+            event.m_category = category;
+            event.m_name = name;
+            event.m_startTicks = startTicks;
+            event.m_endTicks = endTicks;
+            buffer->m_writeIndex.store(index + 1, AZStd::memory_order_release);
+        }
+
+        void TimelineRecorder::WriteChromeTrace(AZStd::string& output, float windowSeconds)
+        {
+            const AZStd::sys_time_t ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+            const AZStd::sys_time_t now = GetTicks();
+            const AZStd::sys_time_t fromTicks = now - static_cast<AZStd::sys_time_t>(windowSeconds * static_cast<float>(ticksPerSecond));
+            auto threads = Internal::CollectEvents(fromTicks);
+
+            AZStd::sys_time_t baseTicks = now;
+            for (const Internal::TimelineThreadEvents& threadEvents : threads)
+            {
+                for (const TimelineEvent& event : threadEvents.m_events)
+                {
+                    baseTicks = AZStd::min(baseTicks, event.m_startTicks);
+                }
+            }
+            const double microSecondsPerTick = 1000000.0 / static_cast<double>(ticksPerSecond);
+
+            char line[256];
+            output += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            bool isFirst = true;
+            for (const Internal::TimelineThreadEvents& threadEvents : threads)
+            {
+                const AZ::u32 tid = threadEvents.m_buffer->m_threadIndex;
+                azsnprintf(line, AZ_ARRAY_SIZE(line),
+                    "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u (%" PRIu64 ")\"}}",
+                    isFirst ? "" : ",", tid, tid, static_cast<AZ::u64>(AZStd::hash<AZStd::thread_id>()(threadEvents.m_buffer->m_threadId)));
+                output += line;
+                isFirst = false;
+
+                for (const TimelineEvent& event : threadEvents.m_events)
+                {
+                    output += ",\n{\"name\":";
+                    Internal::AppendJsonString(output, event.m_name);
+                    output += ",\"cat\":";
+                    Internal::AppendJsonString(output, event.m_category);
+                    azsnprintf(line, AZ_ARRAY_SIZE(line), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                        static_cast<double>(event.m_startTicks - baseTicks) * microSecondsPerTick,
+                        static_cast<double>(event.m_endTicks - event.m_startTicks) * microSecondsPerTick, tid);
+                    output += line;
+                }
+            }
+            output += "\n]}\n";
+        }
+
+        bool TimelineRecorder::WriteChromeTraceFile(const char* filePath, float windowSeconds)
+        {
+            AZStd::string trace;
+            WriteChromeTrace(trace, windowSeconds);
+
+            AZ::IO::SystemFile file;
+            if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Error("Timeline", false, "Failed to open '%s' to write the timeline capture.", filePath);
+                return false;
+            }
+            return file.Write(trace.data(), trace.size()) == trace.size();
+        }
+
+        void TimelineRecorder::EndFrame()
+        {
+            if (!IsRecording())
+            {
+                return;
+            }
+
+            const AZStd::sys_time_t now = GetTicks();
+            const AZStd::sys_time_t frameStart = Internal::s_lastFrameEndTicks;
+            Internal::s_lastFrameEndTicks = now;
+            if (frameStart == 0)
+            {
+                return;
+            }
+            RecordEvent("Frame", "Frame", frameStart, now);
+
+            const float frameBudgetMs = timeline_frameBudgetMs;
+            if (frameBudgetMs <= 0.0f)
+            {
+                return;
+            }
+            const AZStd::sys_time_t ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+            const float frameMs = static_cast<float>(now - frameStart) * 1000.0f / static_cast<float>(ticksPerSecond);
+            const float captureSeconds = timeline_captureSeconds;
+            const bool isCoolingDown = Internal::s_lastBudgetCaptureTicks != 0 &&
+                static_cast<float>(now - Internal::s_lastBudgetCaptureTicks) < captureSeconds * static_cast<float>(ticksPerSecond);
+            if (frameMs <= frameBudgetMs || isCoolingDown)
+            {
+                return;
+            }
+            Internal::s_lastBudgetCaptureTicks = now;
+
+            char filePath[AZ::IO::MaxPathLength];
+            azsnprintf(filePath, AZ_ARRAY_SIZE(filePath), "@user@/Profiling/Timeline_%" PRIu64 ".json", AZStd::GetTimeUTCMilliSecond());
+            char resolvedPath[AZ::IO::MaxPathLength];
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            if (!fileIO || !fileIO->ResolvePath(filePath, resolvedPath, AZ_ARRAY_SIZE(resolvedPath)))
+            {
+                return;
+            }
+            if (WriteChromeTraceFile(resolvedPath, captureSeconds))
+            {
+                AZ_TracePrintf("Timeline", "Frame took %.2f ms (budget %.2f ms), timeline written to '%s'.\n", frameMs, frameBudgetMs, resolvedPath);
+            }
+        }
+    } // namespace Debug
+
+    static void timeline_start(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::u32 eventsPerThread = Debug::TimelineRecorder::DefaultEventsPerThread;
+        if (!arguments.empty())
+        {
+            eventsPerThread = static_cast<AZ::u32>(AZStd::stoul(AZStd::string(arguments.front())));
+        }
+        Debug::TimelineRecorder::Start(eventsPerThread);
+        AZ_TracePrintf("Timeline", "Timeline recording started.\n");
+    }
+
+    static void timeline_stop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        Debug::TimelineRecorder::Stop();
+        AZ_TracePrintf("Timeline", "Timeline recording stopped.\n");
+    }
+
+    static void timeline_capture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZStd::string filePath = arguments.empty()
+            ? AZStd::string::format("@user@/Profiling/Timeline_%" PRIu64 ".json", AZStd::GetTimeUTCMilliSecond())
+            : AZStd::string(arguments.front());
+
+        char resolvedPath[AZ::IO::MaxPathLength];
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (fileIO && fileIO->ResolvePath(filePath.c_str(), resolvedPath, AZ_ARRAY_SIZE(resolvedPath)))
+        {
+            filePath = resolvedPath;
+        }
+
+        if (Debug::TimelineRecorder::WriteChromeTraceFile(filePath.c_str(), timeline_captureSeconds))
+        {
+            AZ_TracePrintf("Timeline", "Timeline written to '%s'.\n", filePath.c_str());
+        }
+    }
+
+    AZ_CONSOLEFREEFUNC(timeline_start, AZ::ConsoleFunctorFlags::Null,
+        "Starts recording the timeline of all threads. Parameter: number of events kept per thread, defaults to 65536.");
+    AZ_CONSOLEFREEFUNC(timeline_stop, AZ::ConsoleFunctorFlags::Null, "Stops recording the timeline.");
+    AZ_CONSOLEFREEFUNC(timeline_capture, AZ::ConsoleFunctorFlags::Null,
+        "Writes the last timeline_captureSeconds of the timeline as Chrome trace event JSON, viewable in chrome://tracing or ui.perfetto.dev. "
+        "Parameter: file path, defaults to @user@/Profiling/Timeline_<time>.json.");
+} // namespace AZ
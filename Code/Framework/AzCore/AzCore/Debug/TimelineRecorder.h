@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        //! A single completed scope on the timeline of a thread.
+        struct TimelineEvent
+        {
+            const char* m_category;
+            const char* m_name;
+            AZStd::sys_time_t m_startTicks;
+            AZStd::sys_time_t m_endTicks;
+        };
+
+        /**
+         * Low overhead recorder for a timeline of scopes on every thread, meant to be left running in production. Every
+         * thread records into its own fixed size ring buffer without taking locks, so the recorder always holds the most
+         * recent events and older events are overwritten. On request, the last N seconds are exported as a Chrome trace
+         * event JSON file that can be opened in chrome://tracing or https://ui.perfetto.dev.
+         *
+         * The recorder is fed by AZ_PROFILE_SCOPE and AZ_PROFILE_FUNCTION (which also cover job and task graph
+         * execution) and by EBus dispatches. Only the pointers to the category and name are recorded, so the strings
+         * have to outlive the capture, which is the case for string literals and function signatures.
+         *
+         * Console commands: timeline_start [eventsPerThread], timeline_stop and timeline_capture [filePath]. When
+         * timeline_frameBudgetMs is set, a capture is also written to @user@/Profiling if a frame takes longer.
+         */
+        class TimelineRecorder
+        {
+        public:
+            static constexpr AZ::u32 DefaultEventsPerThread = 64 * 1024;
+
+            //! Starts recording. The number of events per thread is rounded up to a power of two and applies to threads
+            //! that record their first event after this call. Ring buffers of threads are kept for the process lifetime.
+            static void Start(AZ::u32 eventsPerThread = DefaultEventsPerThread);
+            //! Stops recording. Events that were already recorded can still be exported.
+            static void Stop();
+            static bool IsRecording() { return s_isRecording.load(AZStd::memory_order_relaxed); }
+
+            static AZStd::sys_time_t GetTicks() { return AZStd::GetTimeNowTicks(); }
+            //! Adds a completed scope to the ring buffer of the calling thread.
+            static void RecordEvent(const char* category, const char* name, AZStd::sys_time_t startTicks, AZStd::sys_time_t endTicks);
+
+            //! Appends the events that ended in the last windowSeconds to output in the Chrome trace event format.
+            static void WriteChromeTrace(AZStd::string& output, float windowSeconds);
+            //! Writes the events that ended in the last windowSeconds to a Chrome trace event JSON file.
+            static bool WriteChromeTraceFile(const char* filePath, float windowSeconds);
+
+            //! Marks the end of a frame. Records the frame on the timeline and writes a capture if the frame exceeded
+            //! the budget set with timeline_frameBudgetMs. Called by ComponentApplication::Tick.
+            static void EndFrame();
+
+        private:
+            static AZStd::atomic_bool s_isRecording;
+        };
+
+        //! Records the lifetime of the scope on the timeline if the recorder is running when the scope is entered.
+        class TimelineScope
+        {
+        public:
+            //! Additional arguments, such as the format arguments of AZ_PROFILE_SCOPE_DYNAMIC, are ignored.
+            template<typename... Args>
+            TimelineScope(const char* category, const char* name, Args&&...)
+            {
+                if (TimelineRecorder::IsRecording())
+                {
+                    m_category = category;
+                    m_name = name;
+                    m_startTicks = TimelineRecorder::GetTicks();
+                }
+            }
+            ~TimelineScope()
+            {
+                if (m_name)
+                {
+                    TimelineRecorder::RecordEvent(m_category, m_name, m_startTicks, TimelineRecorder::GetTicks());
+                }
+            }
+
+            TimelineScope(const TimelineScope&) = delete;
+            TimelineScope& operator=(const TimelineScope&) = delete;
+
+        private:
+            const char* m_category = nullptr;
+            const char* m_name = nullptr;
+            AZStd::sys_time_t m_startTicks = 0;
+        };
+    } // namespace Debug
+} // namespace AZ
+
+//! Records the current scope on the timeline. The name must be a string literal or otherwise outlive the capture.
+#define AZ_TIMELINE_SCOPE(category, ...) AZ::Debug::TimelineScope AZ_JOIN(azTimelineScope, __LINE__)(category, __VA_ARGS__)
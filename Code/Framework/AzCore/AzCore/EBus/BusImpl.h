@@ -819,6 +819,7 @@ namespace AZ
         }
 
 #undef EBUS_DO_ROUTING
+#undef EBUS_TIMELINE_SCOPE
 
         template <class Bus, class Traits>
         template <class Function, class ... InputArgs>
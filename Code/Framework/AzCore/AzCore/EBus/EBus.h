@@ -199,6 +199,18 @@ namespace AZ
         */
         static const bool LocklessDispatch = false;
 
+        /**
+         * Determines whether each address keeps a contiguous array of its handler pointers for dispatch.
+         * Event, EventResult, Broadcast and BroadcastResult then call the handlers with a linear scan of the array
+         * instead of walking the handler list. The array is rebuilt on the first dispatch after handlers connect or
+         * disconnect, so this pays off on buses with many handlers that are dispatched more often than connected to,
+         * such as per frame notification buses.
+         * Handlers that connect while the array is in use will not receive the current event.
+         * Only used when #HandlerPolicy is EBusHandlerPolicy::Multiple or EBusHandlerPolicy::MultipleAndOrdered.
+         * By default, dispatch walks the handler list.
+         */
+        static constexpr bool EnableHandlerSnapshot = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
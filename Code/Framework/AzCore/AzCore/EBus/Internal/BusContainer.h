@@ -7,7 +7,10 @@
  */
 #pragma once
 
+#include <AzCore/Debug/TimelineRecorder.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 
@@ -22,6 +25,114 @@ namespace AZ
 {
     namespace Internal
     {
+        /**
+         * Contiguous copy of the handler pointers of one address, used by buses that set EBusTraits::EnableHandlerSnapshot.
+         * Connect and Disconnect only bump the generation. The array is rebuilt by the next dispatch that finds it out of
+         * date while no other dispatch is reading it, so a burst of connections costs a single rebuild. Dispatches that
+         * can't use the array (it is out of date and in use, e.g. a handler connected during a dispatch) fall back to
+         * walking the handler list. A handler that disconnects while the array is in use is cleared from it.
+         */
+        template <typename Interface, typename Allocator, bool IsEnabled>
+        class HandlerSnapshot
+        {
+        public:
+            void OnConnect() {}
+            void OnDisconnect(Interface*) {}
+        };
+
+        template <typename Interface, typename Allocator>
+        class HandlerSnapshot<Interface, Allocator, true>
+        {
+        public:
+            HandlerSnapshot() = default;
+            HandlerSnapshot(const HandlerSnapshot&) = delete;
+            HandlerSnapshot& operator=(const HandlerSnapshot&) = delete;
+
+            void OnConnect()
+            {
+                m_generation.fetch_add(1, AZStd::memory_order_release);
+            }
+
+            void OnDisconnect(Interface* handler)
+            {
+                m_generation.fetch_add(1, AZStd::memory_order_release);
+                if (m_readers.load(AZStd::memory_order_acquire) > 0)
+                {
+                    for (Interface*& entry : m_handlers)
+                    {
+                        if (entry == handler)
+                        {
+                            entry = nullptr;
+                        }
+                    }
+                }
+            }
+
+            //! Rebuilds the array if needed and registers the caller as a reader.
+            //! Returns false if the array can't be used for this dispatch, Release must only be called after true was returned.
+            template <typename HandlerStorage>
+            bool Acquire(const HandlerStorage& handlers)
+            {
+                // m_readers is -1 while a rebuild is in progress, which can only happen on buses with LocklessDispatch
+                int readers = m_readers.load(AZStd::memory_order_acquire);
+                for (;;)
+                {
+                    if (readers < 0)
+                    {
+                        return false;
+                    }
+                    const unsigned int generation = m_generation.load(AZStd::memory_order_acquire);
+                    if (m_snapshotGeneration.load(AZStd::memory_order_acquire) == generation)
+                    {
+                        if (m_readers.compare_exchange_weak(readers, readers + 1, AZStd::memory_order_acq_rel))
+                        {
+                            return true;
+                        }
+                    }
+                    else if (readers > 0)
+                    {
+                        return false;
+                    }
+                    else if (m_readers.compare_exchange_weak(readers, -1, AZStd::memory_order_acq_rel))
+                    {
+                        m_handlers.clear();
+                        for (const auto& handler : handlers)
+                        {
+                            m_handlers.push_back(handler.m_interface);
+                        }
+                        m_snapshotGeneration.store(generation, AZStd::memory_order_release);
+                        m_readers.store(1, AZStd::memory_order_release);
+                        return true;
+                    }
+                }
+            }
+
+            void Release()
+            {
+                m_readers.fetch_sub(1, AZStd::memory_order_release);
+            }
+
+            template <typename Callback>
+            void ForEach(Callback&& callback) const
+            {
+                // The array is not resized while there are readers, entries of disconnected handlers are set to null
+                const size_t count = m_handlers.size();
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (Interface* handler = m_handlers[i])
+                    {
+                        callback(handler);
+                    }
+                }
+            }
+
+        private:
+            AZStd::vector<Interface*, Allocator> m_handlers;
+            AZStd::atomic_uint m_generation{ 1 };
+            AZStd::atomic_uint m_snapshotGeneration{ 0 };
+            AZStd::atomic_int m_readers{ 0 };
+        };
+
         // Helpers for the BusContainer implementations
         namespace
         {
@@ -67,6 +178,23 @@ namespace AZ
             {
                 return MidDispatchDisconnectFixer<Bus, PreHandler, PostHandler>(context, busId, AZStd::forward<PreHandler>(remove), AZStd::forward<PostHandler>(post));
             }
+
+            // Calls callback for every handler in the snapshot of an address, see EBusTraits::EnableHandlerSnapshot.
+            // Returns false without calling anything if the caller has to walk the handler list instead.
+            template <typename Bus, typename Snapshot, typename HandlerStorage, typename Callback>
+            bool DispatchHandlerSnapshot(typename Bus::Context* context, const typename Bus::BusIdType* busId, Snapshot& snapshot, const HandlerStorage& handlers, Callback&& callback)
+            {
+                if (!snapshot.Acquire(handlers))
+                {
+                    return false;
+                }
+                {
+                    AZ::Internal::CallstackEntry<typename Bus::InterfaceType, typename Bus::Traits> entry(context, busId);
+                    snapshot.ForEach(callback);
+                }
+                snapshot.Release();
+                return true;
+            }
         }
 
 // Executes router handling in a generic way
@@ -80,6 +208,9 @@ namespace AZ
         }                                                                                       \
     } while(false)
 
+// Records the dispatch on the timeline while AZ::Debug::TimelineRecorder is running. All dispatches of a bus share its name.
+#define EBUS_TIMELINE_SCOPE() AZ::Debug::TimelineScope ebusTimelineScope("EBus", Bus::GetName())
+
         // Default impl, used when there are multiple addresses and multiple handlers
         template <typename Interface, typename Traits, EBusAddressPolicy addressPolicy = Traits::AddressPolicy, EBusHandlerPolicy handlerPolicy = Traits::HandlerPolicy>
         struct EBusContainer
@@ -98,6 +229,8 @@ namespace AZ
             using AddressStorage = AddressStoragePolicy<Traits, HandlerHolder>;
             // Defines how handlers are stored per address (will be some sort of list)
             using HandlerStorage = HandlerStoragePolicy<Interface, Traits, HandlerNode>;
+            // Contiguous copy of the handlers per address, only populated if Traits::EnableHandlerSnapshot is set
+            using HandlerSnapshotType = HandlerSnapshot<Interface, typename Traits::AllocatorType, Traits::EnableHandlerSnapshot>;
 
             using Handler = IdHandler<Interface, Traits, ContainerType>;
             using MultiHandler = MultiHandler<Interface, Traits, ContainerType>;
@@ -116,6 +249,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -125,6 +259,16 @@ namespace AZ
                             HandlerHolder& holder = *addressIt;
                             holder.add_ref();
 
+                            if constexpr (Traits::EnableHandlerSnapshot)
+                            {
+                                if (DispatchHandlerSnapshot<Bus>(context, &id, holder.m_snapshot, holder.m_handlers,
+                                    [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); }))
+                                {
+                                    holder.release();
+                                    return;
+                                }
+                            }
+
                             auto& handlers = holder.m_handlers;
                             auto handlerIt = handlers.begin();
                             auto handlersEnd = handlers.end();
@@ -159,6 +303,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -168,6 +313,16 @@ namespace AZ
                             HandlerHolder& holder = *addressIt;
                             holder.add_ref();
 
+                            if constexpr (Traits::EnableHandlerSnapshot)
+                            {
+                                if (DispatchHandlerSnapshot<Bus>(context, &id, holder.m_snapshot, holder.m_handlers,
+                                    [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); }))
+                                {
+                                    holder.release();
+                                    return;
+                                }
+                            }
+
                             auto& handlers = holder.m_handlers;
                             auto handlerIt = handlers.begin();
                             auto handlersEnd = handlers.end();
@@ -202,6 +357,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -231,6 +387,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -263,8 +420,18 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
+                        if constexpr (Traits::EnableHandlerSnapshot)
+                        {
+                            if (DispatchHandlerSnapshot<Bus>(context, &busPtr->m_busId, busPtr->m_snapshot, busPtr->m_handlers,
+                                [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); }))
+                            {
+                                return;
+                            }
+                        }
+
                         auto& handlers = busPtr->m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -299,8 +466,18 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
+                        if constexpr (Traits::EnableHandlerSnapshot)
+                        {
+                            if (DispatchHandlerSnapshot<Bus>(context, &busPtr->m_busId, busPtr->m_snapshot, busPtr->m_handlers,
+                                [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); }))
+                            {
+                                return;
+                            }
+                        }
+
                         auto& handlers = busPtr->m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -335,6 +512,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         auto& handlers = busPtr->m_handlers;
@@ -357,6 +535,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         auto& handlers = busPtr->m_handlers;
@@ -378,6 +557,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -387,6 +567,17 @@ namespace AZ
                             HandlerHolder& holder = *addressIt;
                             holder.add_ref();
 
+                            if constexpr (Traits::EnableHandlerSnapshot)
+                            {
+                                if (DispatchHandlerSnapshot<Bus>(context, &holder.m_busId, holder.m_snapshot, holder.m_handlers,
+                                    [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); }))
+                                {
+                                    ++addressIt;
+                                    holder.release();
+                                    continue;
+                                }
+                            }
+
                             auto& handlers = holder.m_handlers;
                             auto handlerIt = handlers.begin();
                             auto handlersEnd = handlers.end();
@@ -424,6 +615,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -433,6 +625,17 @@ namespace AZ
                             HandlerHolder& holder = *addressIt;
                             holder.add_ref();
 
+                            if constexpr (Traits::EnableHandlerSnapshot)
+                            {
+                                if (DispatchHandlerSnapshot<Bus>(context, &holder.m_busId, holder.m_snapshot, holder.m_handlers,
+                                    [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); }))
+                                {
+                                    ++addressIt;
+                                    holder.release();
+                                    continue;
+                                }
+                            }
+
                             auto& handlers = holder.m_handlers;
                             auto handlerIt = handlers.begin();
                             auto handlersEnd = handlers.end();
@@ -470,6 +673,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -528,6 +732,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -683,6 +888,7 @@ namespace AZ
                 ContainerType& m_busContainer;
                 IdType m_busId;
                 typename HandlerStorage::StorageType m_handlers;
+                HandlerSnapshotType m_snapshot;
                 AZStd::atomic_uint m_refCount{ 0 };
 
                 HandlerHolder(ContainerType& storage, const IdType& id)
@@ -745,6 +951,7 @@ namespace AZ
 
                 HandlerHolder& holder = FindOrCreateHandlerHolder(id);
                 holder.m_handlers.insert(handler);
+                holder.m_snapshot.OnConnect();
                 handler.m_holder = &holder;
             }
 
@@ -753,6 +960,7 @@ namespace AZ
                 EBUS_ASSERT(handler.m_holder, "Internal error: disconnecting handler that is incompletely connected");
 
                 handler.m_holder->m_handlers.erase(handler);
+                handler.m_holder->m_snapshot.OnDisconnect(handler.m_interface);
 
                 // Must reset handler after removing it from the list, otherwise m_holder could have been destroyed already (and handlerList would be invalid)
                 handler.m_holder.reset();
@@ -796,6 +1004,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -813,6 +1022,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -830,6 +1040,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -847,6 +1058,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -867,6 +1079,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         if (busPtr->m_interface)
@@ -885,6 +1098,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         if (busPtr->m_interface)
@@ -903,6 +1117,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         if (busPtr->m_interface)
@@ -921,6 +1136,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         if (busPtr->m_interface)
@@ -938,6 +1154,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -976,6 +1193,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1014,6 +1232,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1070,6 +1289,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1319,6 +1539,8 @@ namespace AZ
             using HandlerNode = HandlerNode<Interface, Traits, HandlerHolder>;
             // Defines how handlers are stored per address (will be some sort of list)
             using HandlerStorage = HandlerStoragePolicy<Interface, Traits, HandlerNode>;
+            // Contiguous copy of the handlers, only populated if Traits::EnableHandlerSnapshot is set
+            using HandlerSnapshotType = HandlerSnapshot<Interface, typename Traits::AllocatorType, Traits::EnableHandlerSnapshot>;
             // No need for AddressStorage, there's only 1
 
             struct BusPtr { };
@@ -1337,8 +1559,18 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
+                        if constexpr (Traits::EnableHandlerSnapshot)
+                        {
+                            if (DispatchHandlerSnapshot<Bus>(context, nullptr, context->m_buses.m_snapshot, context->m_buses.m_handlers,
+                                [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); }))
+                            {
+                                return;
+                            }
+                        }
+
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -1372,8 +1604,18 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
+                        if constexpr (Traits::EnableHandlerSnapshot)
+                        {
+                            if (DispatchHandlerSnapshot<Bus>(context, nullptr, context->m_buses.m_snapshot, context->m_buses.m_handlers,
+                                [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); }))
+                            {
+                                return;
+                            }
+                        }
+
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -1407,6 +1649,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1428,6 +1671,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1488,15 +1732,18 @@ namespace AZ
             {
                 // Don't need to check for duplicates here, because BusConnect would have caught it already
                 m_handlers.insert(handler);
+                m_snapshot.OnConnect();
             }
 
             void Disconnect(HandlerNode& handler)
             {
                 // Don't need to check that handler is already connected here, because BusDisconnect would have caught it already
                 m_handlers.erase(handler);
+                m_snapshot.OnDisconnect(handler.m_interface);
             }
 
             typename HandlerStorage::StorageType m_handlers;
+            HandlerSnapshotType m_snapshot;
         };
 
         // Specialization for single address, single handler
@@ -1531,6 +1778,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1547,6 +1795,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1563,6 +1812,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1579,6 +1829,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_TIMELINE_SCOPE();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -9,6 +9,7 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/string.h>
@@ -31,6 +32,15 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Position in a compressed file from which decompression can start without needing any of the preceding data.
+        struct CompressionSeekPoint
+        {
+            //! Offset of the compressed block, relative to the start of the compressed file.
+            size_t m_compressedOffset = 0;
+            //! Offset of the data the block decompresses to, relative to the start of the uncompressed file.
+            size_t m_uncompressedOffset = 0;
+        };
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
@@ -61,6 +71,11 @@ namespace AZ
             bool m_isCompressed = false;
             //! Whether or not the pak file is used in multiple location or reads can be done exclusively.
             bool m_isSharedPak = false; 
+            //! Optional list of seek points for files that are stored as independently compressed blocks, sorted by offset with the
+            //! first entry at offset 0. Each block runs up to the next seek point or the end of the file. If seek points are provided
+            //! the decompressor is called once per block, which allows blocks to be decompressed in parallel and partial reads to
+            //! only decompress the blocks they overlap.
+            AZStd::vector<CompressionSeekPoint> m_seekPoints;
         };
 
         class Compression
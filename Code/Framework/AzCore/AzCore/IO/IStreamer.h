@@ -130,6 +130,54 @@ namespace AZ::IO
             IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium,
             size_t offset = 0) = 0;
 
+        //! Creates a request to read multiple ranges from a single file (scatter/gather).
+        //! Ranges are ordered by offset and adjacent or nearby ranges are read with a single vectored read, which is considerably
+        //! cheaper than issuing a read request per range when reading many small pieces from the same file or archive.
+        //! The request completes when all ranges have been read and fails if any of the ranges failed.
+        //! @param relativePath Relative path to the file to load. This can include aliases such as @assets@.
+        //! @param ranges The ranges to read and where to store them. Ranges are not allowed to overlap in the output memory.
+        //! @param deadline The amount of time from calling ReadRanges that the request should complete. Is FileRequest::s_noDeadline
+        //!         if the request doesn't need to be completed before a specific time.
+        //! @param priority The priority used to order requests if multiple requests are at risk of missing their deadline.
+        //! @return A smart pointer to the newly created request with the read ranges command.
+        virtual FileRequestPtr ReadRanges(
+            AZStd::string_view relativePath,
+            AZStd::vector<IStreamerTypes::ReadRange> ranges,
+            AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
+            IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium) = 0;
+
+        //! Sets a request to the read ranges command.
+        //! @param request The request that will store the read ranges command.
+        //! @param relativePath Relative path to the file to load. This can include aliases such as @assets@.
+        //! @param ranges The ranges to read and where to store them. Ranges are not allowed to overlap in the output memory.
+        //! @param deadline The amount of time from calling ReadRanges that the request should complete. Is FileRequest::s_noDeadline
+        //!         if the request doesn't need to be completed before a specific time.
+        //! @param priority The priority used to order requests if multiple requests are at risk of missing their deadline.
+        //! @return A reference to the provided request.
+        virtual FileRequestPtr& ReadRanges(
+            FileRequestPtr& request,
+            AZStd::string_view relativePath,
+            AZStd::vector<IStreamerTypes::ReadRange> ranges,
+            AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
+            IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium) = 0;
+
+        //! Creates a request to map a file into memory and return a read-only view of it instead of a copy of the data.
+        //! Only loose files and uncompressed files in archives can be mapped. Requests for compressed files fail, in which case
+        //! Read should be used instead. Use GetMapFileRequestResult to retrieve the view once the request has completed.
+        //! @param relativePath Relative path to the file to map. This can include aliases such as @assets@.
+        //! @param offset The offset into the file where the view starts.
+        //! @param size The size of the view in bytes. If zero the view extends to the end of the file.
+        //! @return A smart pointer to the newly created request with the map file command.
+        virtual FileRequestPtr MapFile(AZStd::string_view relativePath, u64 offset = 0, u64 size = 0) = 0;
+
+        //! Sets a request to the map file command.
+        //! @param request The request that will store the map file command.
+        //! @param relativePath Relative path to the file to map. This can include aliases such as @assets@.
+        //! @param offset The offset into the file where the view starts.
+        //! @param size The size of the view in bytes. If zero the view extends to the end of the file.
+        //! @return A reference to the provided request.
+        virtual FileRequestPtr& MapFile(FileRequestPtr& request, AZStd::string_view relativePath, u64 offset = 0, u64 size = 0) = 0;
+
         //! Creates a request to cancel a previously queued request.
         //! When this request completes it's not guaranteed to have canceled the target request. Not all requests can be canceled and requests
         //! that already processing may complete. It's recommended to let the target request handle the completion of the request as normal
@@ -322,6 +370,7 @@ namespace AZ::IO
         virtual AZStd::chrono::system_clock::time_point GetEstimatedRequestCompletionTime(FileRequestHandle request) const = 0;
 
         //! Get the result for operations that read data.
+        //! For read ranges requests the buffer is the output of the first range as passed to ReadRanges and the number of bytes is the total of all ranges.
         //! @param request The request to query.
         //! @param buffer The buffer the data was written to.
         //! @param numBytesRead The total number of bytes that were read from the file.
@@ -329,6 +378,12 @@ namespace AZ::IO
         virtual bool GetReadRequestResult(FileRequestHandle request, void*& buffer, u64& numBytesRead,
             IStreamerTypes::ClaimMemory claimMemory = IStreamerTypes::ClaimMemory::No) const = 0;
 
+        //! Get the result for map file requests.
+        //! @param request The request to query.
+        //! @param view The view into the mapped file. The view keeps the mapping alive independently of the request.
+        //! @return True if the request mapped the file, otherwise false.
+        virtual bool GetMapFileRequestResult(FileRequestHandle request, MappedView& view) const = 0;
+
         //
         // General Streamer functions
         //
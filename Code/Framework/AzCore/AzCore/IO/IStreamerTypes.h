@@ -89,6 +89,14 @@ namespace AZ::IO::IStreamerTypes
             //!< the allocator provided to request to later release this memory.
     };
 
+    //! A single range of a scatter/gather read. See IStreamer::ReadRanges.
+    struct ReadRange
+    {
+        void* m_output; //!< The memory the data will be written to. This needs to be able to hold at least m_size bytes.
+        u64 m_offset; //!< The offset in bytes into the file.
+        u64 m_size; //!< The number of bytes to read.
+    };
+
     struct RequestMemoryAllocatorResult
     {
         void* m_address; //!< The address to the reserved memory.
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    namespace Platform
+    {
+        // Forward declaration of platform specific implementations
+        bool MapFile(const char* absolutePath, const u8*& data, u64& size, uintptr_t& platformHandle);
+        void UnmapFile(const u8* data, u64 size, uintptr_t platformHandle);
+    }
+
+    AZStd::shared_ptr<MemoryMappedFile> MemoryMappedFile::Map(const char* absolutePath)
+    {
+        AZ_Assert(absolutePath, "No path provided to MemoryMappedFile::Map.");
+        auto result = AZStd::make_shared<MemoryMappedFile>();
+        if (Platform::MapFile(absolutePath, result->m_data, result->m_size, result->m_platformHandle))
+        {
+            return result;
+        }
+        return nullptr;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (m_data)
+        {
+            Platform::UnmapFile(m_data, m_size, m_platformHandle);
+        }
+    }
+
+    MappedView::MappedView(AZStd::shared_ptr<const MemoryMappedFile> file, u64 offset, u64 size)
+        : m_file(AZStd::move(file))
+    {
+        AZ_Assert(m_file, "MappedView created without a mapped file.");
+        AZ_Assert(offset + size <= m_file->GetSize(), "MappedView range (%llu, %llu) falls outside the mapped file of %llu bytes.",
+            offset, size, m_file->GetSize());
+        m_data = m_file->GetData() + offset;
+        m_size = aznumeric_cast<size_t>(size);
+    }
+
+    void MappedView::Reset()
+    {
+        m_file.reset();
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    MemoryMappedFileCache::MemoryMappedFileCache(size_t maxNumFiles)
+        : m_maxNumFiles(maxNumFiles)
+    {
+        AZ_Assert(maxNumFiles > 0, "MemoryMappedFileCache needs to be able to hold at least one file.");
+        m_paths.reserve(maxNumFiles);
+        m_files.reserve(maxNumFiles);
+        m_lastUsed.reserve(maxNumFiles);
+    }
+
+    MappedView MemoryMappedFileCache::CreateView(AZStd::string_view absolutePath, u64 offset, u64 size)
+    {
+        size_t index = 0;
+        for (; index < m_paths.size(); ++index)
+        {
+            if (m_paths[index] == absolutePath)
+            {
+                break;
+            }
+        }
+
+        if (index == m_paths.size())
+        {
+            AZStd::string path(absolutePath);
+            AZStd::shared_ptr<MemoryMappedFile> file = MemoryMappedFile::Map(path.c_str());
+            if (!file)
+            {
+                return {};
+            }
+
+            if (m_files.size() < m_maxNumFiles)
+            {
+                m_paths.push_back(AZStd::move(path));
+                m_files.push_back(AZStd::move(file));
+                m_lastUsed.push_back(0);
+            }
+            else
+            {
+                index = 0;
+                for (size_t i = 1; i < m_lastUsed.size(); ++i)
+                {
+                    if (m_lastUsed[i] < m_lastUsed[index])
+                    {
+                        index = i;
+                    }
+                }
+                m_paths[index] = AZStd::move(path);
+                m_files[index] = AZStd::move(file);
+            }
+        }
+        m_lastUsed[index] = ++m_useCounter;
+
+        const AZStd::shared_ptr<const MemoryMappedFile>& file = m_files[index];
+        if (offset > file->GetSize())
+        {
+            return {};
+        }
+        if (size == 0)
+        {
+            size = file->GetSize() - offset;
+        }
+        else if (size > file->GetSize() - offset)
+        {
+            return {};
+        }
+        return MappedView(file, offset, size);
+    }
+
+    void MemoryMappedFileCache::Flush(AZStd::string_view absolutePath)
+    {
+        for (size_t i = 0; i < m_paths.size(); ++i)
+        {
+            if (m_paths[i] == absolutePath)
+            {
+                m_paths.erase(m_paths.begin() + i);
+                m_files.erase(m_files.begin() + i);
+                m_lastUsed.erase(m_lastUsed.begin() + i);
+                return;
+            }
+        }
+    }
+
+    void MemoryMappedFileCache::FlushAll()
+    {
+        m_paths.clear();
+        m_files.clear();
+        m_lastUsed.clear();
+    }
+} // namespace AZ::IO
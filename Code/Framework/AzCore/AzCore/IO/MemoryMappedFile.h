@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::IO
+{
+    //! Read-only mapping of an entire file into the address space of the process. The pages of the mapping are shared
+    //! with the file cache of the operating system, so data can be accessed without copying it to an intermediate buffer.
+    //! The file can't be written to while it's mapped.
+    class MemoryMappedFile
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MemoryMappedFile, AZ::SystemAllocator, 0);
+
+        //! Maps the file at the provided absolute path. Returns null if the file doesn't exist, is empty or can't be mapped.
+        static AZStd::shared_ptr<MemoryMappedFile> Map(const char* absolutePath);
+
+        MemoryMappedFile() = default;
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&&) = delete;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;
+
+        const u8* GetData() const { return m_data; }
+        u64 GetSize() const { return m_size; }
+
+    private:
+        const u8* m_data{ nullptr };
+        u64 m_size{ 0 };
+        uintptr_t m_platformHandle{ 0 }; //!< Handle to the mapping object on platforms that require one to release the mapping.
+    };
+
+    //! Read-only view into a range of a memory mapped file. The view holds on to the mapping, so the data remains valid for
+    //! as long as the view, or a copy of it, exists, even if the file has been flushed from any cache in the meantime.
+    class MappedView
+    {
+    public:
+        MappedView() = default;
+        MappedView(AZStd::shared_ptr<const MemoryMappedFile> file, u64 offset, u64 size);
+
+        const u8* data() const { return m_data; }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        const u8* begin() const { return m_data; }
+        const u8* end() const { return m_data + m_size; }
+
+        //! Returns true if the view references a mapped file.
+        bool IsValid() const { return m_file != nullptr; }
+        //! Releases the reference to the mapped file. The data can no longer be accessed after this call.
+        void Reset();
+
+        const AZStd::shared_ptr<const MemoryMappedFile>& GetMappedFile() const { return m_file; }
+
+    private:
+        AZStd::shared_ptr<const MemoryMappedFile> m_file;
+        const u8* m_data{ nullptr };
+        size_t m_size{ 0 };
+    };
+
+    //! Keeps a limited number of files mapped so repeated views into the same file don't need to map it again. When the
+    //! cache is full the least recently used mapping is released. Views that were created from a released mapping remain
+    //! valid. This class isn't thread safe.
+    class MemoryMappedFileCache
+    {
+    public:
+        explicit MemoryMappedFileCache(size_t maxNumFiles);
+
+        //! Creates a view into the file at the absolute path. If size is zero the view extends to the end of the file.
+        //! Returns an invalid view if the file can't be mapped or the range doesn't fit in the file.
+        MappedView CreateView(AZStd::string_view absolutePath, u64 offset, u64 size);
+
+        //! Releases the mapping of the provided file, if it's mapped.
+        void Flush(AZStd::string_view absolutePath);
+        //! Releases all mappings.
+        void FlushAll();
+
+        size_t GetNumMappedFiles() const { return m_files.size(); }
+
+    private:
+        AZStd::vector<AZStd::string> m_paths;
+        AZStd::vector<AZStd::shared_ptr<const MemoryMappedFile>> m_files;
+        AZStd::vector<u64> m_lastUsed;
+        u64 m_useCounter{ 0 };
+        size_t m_maxNumFiles;
+    };
+} // namespace AZ::IO
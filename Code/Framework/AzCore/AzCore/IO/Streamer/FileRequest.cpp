@@ -75,6 +75,62 @@ namespace AZ
             , m_sharedRead(sharedRead)
         {}
 
+        FileRequest::ReadRangesRequestData::ReadRangesRequestData(RequestPath path, AZStd::vector<IStreamerTypes::ReadRange>&& ranges,
+            AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority)
+            : m_path(AZStd::move(path))
+            , m_ranges(AZStd::move(ranges))
+            , m_firstOutput(m_ranges.empty() ? nullptr : m_ranges.front().m_output)
+            , m_deadline(deadline)
+            , m_priority(priority)
+        {}
+
+        FileRequest::ReadRangesData::ReadRangesData(const RequestPath& path, const IStreamerTypes::ReadRange* ranges, size_t numRanges,
+            u64 baseOffset, bool sharedRead)
+            : m_path(path)
+            , m_ranges(ranges)
+            , m_numRanges(numRanges)
+            , m_baseOffset(baseOffset)
+            , m_sharedRead(sharedRead)
+        {}
+
+        u64 FileRequest::ReadRangesData::GetStartOffset() const
+        {
+            return m_numRanges > 0 ? m_baseOffset + m_ranges[0].m_offset : m_baseOffset;
+        }
+
+        u64 FileRequest::ReadRangesData::GetEndOffset() const
+        {
+            u64 end = m_baseOffset;
+            for (size_t i = 0; i < m_numRanges; ++i)
+            {
+                end = AZStd::max(end, m_baseOffset + m_ranges[i].m_offset + m_ranges[i].m_size);
+            }
+            return end;
+        }
+
+        u64 FileRequest::ReadRangesData::GetTotalSize() const
+        {
+            u64 total = 0;
+            for (size_t i = 0; i < m_numRanges; ++i)
+            {
+                total += m_ranges[i].m_size;
+            }
+            return total;
+        }
+
+        FileRequest::MapFileRequestData::MapFileRequestData(RequestPath path, u64 offset, u64 size)
+            : m_path(AZStd::move(path))
+            , m_offset(offset)
+            , m_size(size)
+        {}
+
+        FileRequest::MapFileData::MapFileData(const RequestPath& path, MappedView* output, u64 offset, u64 size)
+            : m_path(path)
+            , m_output(output)
+            , m_offset(offset)
+            , m_size(size)
+        {}
+
         FileRequest::CompressedReadData::CompressedReadData(CompressionInfo&& compressionInfo, void* output, u64 readOffset, u64 readSize)
             : m_compressionInfo(AZStd::move(compressionInfo))
             , m_output(output)
@@ -183,6 +239,38 @@ namespace AZ
             SetOptionalParent(parent);
         }
 
+        void FileRequest::CreateReadRangesRequest(RequestPath path, AZStd::vector<IStreamerTypes::ReadRange>&& ranges,
+            AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority)
+        {
+            AZ_Assert(AZStd::holds_alternative<AZStd::monostate>(m_command),
+                "Attempting to set FileRequest to 'ReadRangesRequest', but another task was already assigned.");
+            m_command.emplace<ReadRangesRequestData>(AZStd::move(path), AZStd::move(ranges), deadline, priority);
+        }
+
+        void FileRequest::CreateReadRanges(FileRequest* parent, const RequestPath& path, const IStreamerTypes::ReadRange* ranges,
+            size_t numRanges, u64 baseOffset, bool sharedRead)
+        {
+            AZ_Assert(AZStd::holds_alternative<AZStd::monostate>(m_command),
+                "Attempting to set FileRequest to 'ReadRanges', but another task was already assigned.");
+            m_command.emplace<ReadRangesData>(path, ranges, numRanges, baseOffset, sharedRead);
+            SetOptionalParent(parent);
+        }
+
+        void FileRequest::CreateMapFileRequest(RequestPath path, u64 offset, u64 size)
+        {
+            AZ_Assert(AZStd::holds_alternative<AZStd::monostate>(m_command),
+                "Attempting to set FileRequest to 'MapFileRequest', but another task was already assigned.");
+            m_command.emplace<MapFileRequestData>(AZStd::move(path), offset, size);
+        }
+
+        void FileRequest::CreateMapFile(FileRequest* parent, const RequestPath& path, MappedView* output, u64 offset, u64 size)
+        {
+            AZ_Assert(AZStd::holds_alternative<AZStd::monostate>(m_command),
+                "Attempting to set FileRequest to 'MapFile', but another task was already assigned.");
+            m_command.emplace<MapFileData>(path, output, offset, size);
+            SetOptionalParent(parent);
+        }
+
         void FileRequest::CreateCompressedRead(FileRequest* parent, const CompressionInfo& compressionInfo,
             void* output, u64 readOffset, u64 readSize)
         {
@@ -10,11 +10,13 @@
 #include <AzCore/base.h>
 #include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/MemoryMappedFile.h>
 #include <AzCore/IO/Streamer/FileRange.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/containers/variant.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
@@ -106,6 +108,76 @@ namespace AZ
                 bool m_sharedRead; //!< True if other code will be reading from the file or the stack entry can exclusively lock.
             };
 
+            //! Request to read multiple ranges from a single file. This is an untranslated request and holds a relative path.
+            //! The Scheduler orders the ranges by offset before the request is translated to ReadRangesData.
+            struct ReadRangesRequestData
+            {
+                inline constexpr static IStreamerTypes::Priority s_orderPriority = IStreamerTypes::s_priorityMedium;
+                inline constexpr static bool s_failWhenUnhandled = true;
+
+                ReadRangesRequestData(RequestPath path, AZStd::vector<IStreamerTypes::ReadRange>&& ranges,
+                    AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority);
+
+                RequestPath m_path; //!< Relative path to the target file.
+                AZStd::vector<IStreamerTypes::ReadRange> m_ranges; //!< The ranges to read from the file.
+                void* m_firstOutput; //!< Output of the first range as provided by the caller, before the ranges are ordered.
+                AZStd::chrono::system_clock::time_point m_deadline; //!< Time by which this request should have been completed.
+                IStreamerTypes::Priority m_priority; //!< Priority used for ordering requests. This is used when requests have the same deadline.
+            };
+
+            //! Request to read multiple ranges from a single file. This is a translated request and holds an absolute path and
+            //! has been resolved to the archive file if needed. The ranges are stored in the ReadRangesRequestData and are
+            //! ordered by offset so adjacent ranges can be read with a single vectored read.
+            struct ReadRangesData
+            {
+                inline constexpr static IStreamerTypes::Priority s_orderPriority = IStreamerTypes::s_priorityMedium;
+                inline constexpr static bool s_failWhenUnhandled = true;
+
+                ReadRangesData(const RequestPath& path, const IStreamerTypes::ReadRange* ranges, size_t numRanges,
+                    u64 baseOffset, bool sharedRead);
+
+                u64 GetStartOffset() const; //!< The offset into the file of the first byte that will be read.
+                u64 GetEndOffset() const; //!< The offset into the file directly after the last byte that will be read.
+                u64 GetTotalSize() const; //!< The total number of bytes that will be read.
+
+                const RequestPath& m_path; //!< The path to the file that contains the requested data.
+                const IStreamerTypes::ReadRange* m_ranges; //!< The ranges to read, ordered by offset.
+                size_t m_numRanges; //!< The number of entries in m_ranges.
+                u64 m_baseOffset; //!< Offset added to the offset of every range, e.g. the offset of a file in an archive.
+                bool m_sharedRead; //!< True if other code will be reading from the file or the stack entry can exclusively lock.
+            };
+
+            //! Request to create a read-only view into a file that's backed by a memory mapping instead of a copy of the data.
+            //! This is an untranslated request and holds a relative path. Only loose files and uncompressed files in archives
+            //! can be mapped.
+            struct MapFileRequestData
+            {
+                inline constexpr static IStreamerTypes::Priority s_orderPriority = IStreamerTypes::s_priorityMedium;
+                inline constexpr static bool s_failWhenUnhandled = true;
+
+                MapFileRequestData(RequestPath path, u64 offset, u64 size);
+
+                RequestPath m_path; //!< Relative path to the target file.
+                MappedView m_view; //!< The view into the mapped file. This is set when the request completes successfully.
+                u64 m_offset; //!< The offset into the file where the view starts.
+                u64 m_size; //!< The size of the view. If zero the view extends to the end of the file.
+            };
+
+            //! Request to create a read-only view into a file that's backed by a memory mapping. This is a translated request
+            //! and holds an absolute path and has been resolved to the archive file if needed.
+            struct MapFileData
+            {
+                inline constexpr static IStreamerTypes::Priority s_orderPriority = IStreamerTypes::s_priorityMedium;
+                inline constexpr static bool s_failWhenUnhandled = true;
+
+                MapFileData(const RequestPath& path, MappedView* output, u64 offset, u64 size);
+
+                const RequestPath& m_path; //!< The path to the file that contains the requested data.
+                MappedView* m_output; //!< The view that will be set to the mapped range.
+                u64 m_offset; //!< The offset into the file where the view starts.
+                u64 m_size; //!< The size of the view. If zero the view extends to the end of the file.
+            };
+
             //! Request to read and decompress data.
             struct CompressedReadData
             {
@@ -248,8 +320,9 @@ namespace AZ
             };
 
             using CommandVariant = AZStd::variant<AZStd::monostate, ExternalRequestData, RequestPathStoreData, ReadRequestData, ReadData,
-                CompressedReadData, WaitData, FileExistsCheckData, FileMetaDataRetrievalData, CancelData, RescheduleData, FlushData,
-                FlushAllData, CreateDedicatedCacheData, DestroyDedicatedCacheData, ReportData, CustomData>;
+                ReadRangesRequestData, ReadRangesData, MapFileRequestData, MapFileData, CompressedReadData, WaitData, FileExistsCheckData,
+                FileMetaDataRetrievalData, CancelData, RescheduleData, FlushData, FlushAllData, CreateDedicatedCacheData,
+                DestroyDedicatedCacheData, ReportData, CustomData>;
             using OnCompletionCallback = AZStd::function<void(FileRequest& request)>;
 
             AZ_CLASS_ALLOCATOR(FileRequest, SystemAllocator, 0);
@@ -267,6 +340,12 @@ namespace AZ
             void CreateReadRequest(RequestPath path, IStreamerTypes::RequestMemoryAllocator* allocator, u64 offset, u64 size,
                 AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority);
             void CreateRead(FileRequest* parent, void* output, u64 outputSize, const RequestPath& path, u64 offset, u64 size, bool sharedRead = false);
+            void CreateReadRangesRequest(RequestPath path, AZStd::vector<IStreamerTypes::ReadRange>&& ranges,
+                AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority);
+            void CreateReadRanges(FileRequest* parent, const RequestPath& path, const IStreamerTypes::ReadRange* ranges, size_t numRanges,
+                u64 baseOffset = 0, bool sharedRead = false);
+            void CreateMapFileRequest(RequestPath path, u64 offset, u64 size);
+            void CreateMapFile(FileRequest* parent, const RequestPath& path, MappedView* output, u64 offset, u64 size);
             void CreateCompressedRead(FileRequest* parent, const CompressionInfo& compressionInfo, void* output,
                 u64 readOffset, u64 readSize);
             void CreateCompressedRead(FileRequest* parent, CompressionInfo&& compressionInfo, void* output,
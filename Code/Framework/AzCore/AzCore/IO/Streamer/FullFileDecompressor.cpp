@@ -16,6 +16,7 @@
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/typetraits/decay.h>
@@ -28,7 +29,7 @@ namespace AZ
             const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
         {
             auto stackEntry = AZStd::make_shared<FullFileDecompressor>(
-                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize), m_maxNumBlockJobs, hardware.m_maxTransfer);
             stackEntry->SetNext(AZStd::move(parent));
             return stackEntry;
         }
@@ -38,9 +39,10 @@ namespace AZ
             if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
             {
                 serializeContext->Class<FullFileDecompressorConfig, IStreamerStackConfig>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("MaxNumReads", &FullFileDecompressorConfig::m_maxNumReads)
-                    ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs);
+                    ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs)
+                    ->Field("MaxNumBlockJobs", &FullFileDecompressorConfig::m_maxNumBlockJobs);
             }
         }
 
@@ -52,10 +54,12 @@ namespace AZ
             return !!m_compressedData;
         }
         
-        FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment)
+        FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u32 maxNumBlockJobs, u64 blockReadSize)
             : StreamStackEntry("Full file decompressor")
+            , m_blockReadSize(blockReadSize)
             , m_maxNumReads(maxNumReads)
             , m_maxNumJobs(maxNumJobs)
+            , m_maxNumBlockJobs(maxNumBlockJobs != 0 ? maxNumBlockJobs : AZ::GetMax(AZStd::thread::hardware_concurrency(), 1u))
             , m_alignment(alignment)
         {
             JobManagerDesc jobDesc;
@@ -72,6 +76,7 @@ namespace AZ
             m_readBuffers = AZStd::make_unique<Buffer[]>(maxNumReads);
             m_readRequests = AZStd::make_unique<FileRequest*[]>(maxNumReads);
             m_readBufferStatus = AZStd::make_unique<ReadBufferStatus[]>(maxNumReads);
+            m_blockDecompressions = AZStd::make_unique<BlockDecompressionInformation[]>(maxNumReads);
             for (u32 i = 0; i < maxNumReads; ++i)
             {
                 m_readBufferStatus[i] = ReadBufferStatus::Unused;
@@ -93,6 +98,14 @@ namespace AZ
                 {
                     PrepareReadRequest(request, args);
                 }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesRequestData>)
+                {
+                    PrepareReadRangesRequest(request, args);
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::MapFileRequestData>)
+                {
+                    PrepareMapFileRequest(request, args);
+                }
                 else if constexpr (AZStd::is_same_v<Command, FileRequest::CreateDedicatedCacheData> ||
                     AZStd::is_same_v<Command, FileRequest::DestroyDedicatedCacheData>)
                 {
@@ -243,6 +256,10 @@ namespace AZ
                 case ReadBufferStatus::PendingDecompression:
                     baseTime = now;
                     break;
+                case ReadBufferStatus::BlockDecompression:
+                    // The block reads are estimated by the entries further down the stack and blocks are decompressed as soon as
+                    // their read completes, so they're not held up by other decompression jobs.
+                    continue;
                 default:
                     AZ_Assert(false, "Unsupported buffer type: %i.", m_readBufferStatus[i]);
                     continue;
@@ -293,8 +310,10 @@ namespace AZ
             {
                 AZStd::chrono::microseconds processingTime = decompressionDelay;
                 size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                // Files with seek points have their blocks decompressed in parallel.
+                size_t parallelism = AZ::GetClamp(data->m_compressionInfo.m_seekPoints.size(), size_t(1), size_t(m_maxNumBlockJobs));
                 processingTime += AZStd::chrono::microseconds(
-                    aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDurationUs) / totalBytesDecompressed));
+                    aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDurationUs) / (totalBytesDecompressed * parallelism)));
                 
                 cumulativeDelay += processingTime;
                 request->SetEstimatedCompletion(request->GetEstimatedCompletion() + processingTime);
@@ -328,6 +347,12 @@ namespace AZ
 #endif
             }
 
+            if (m_numBlocksDecompressed > 0)
+            {
+                statistics.push_back(Statistic::CreateInteger(m_name, "Running block jobs", m_numRunningBlockJobs));
+                statistics.push_back(Statistic::CreateInteger(m_name, "Blocks decompressed", aznumeric_cast<s64>(m_numBlocksDecompressed)));
+            }
+
             StreamStackEntry::CollectStatistics(statistics);
         }
 
@@ -401,6 +426,142 @@ namespace AZ
             }
         }
 
+        void FullFileDecompressor::PrepareReadRangesRequest(FileRequest* request, FileRequest::ReadRangesRequestData& data)
+        {
+            CompressionInfo info;
+            if (CompressionUtils::FindCompressionInfo(info, data.m_path.GetRelativePath()))
+            {
+                if (info.m_conflictResolution == ConflictResolution::PreferFile)
+                {
+                    auto callback = [this, request, info = AZStd::move(info)](const FileRequest& checkRequest) mutable
+                    {
+                        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                        auto check = AZStd::get_if<FileRequest::FileExistsCheckData>(&checkRequest.GetCommand());
+                        AZ_Assert(check,
+                            "Callback in FullFileDecompressor::PrepareReadRangesRequest expected FileExistsCheck but got another command.");
+                        if (check->m_found)
+                        {
+                            StreamStackEntry::PrepareRequest(request);
+                        }
+                        else
+                        {
+                            PushArchiveReadRanges(request, AZStd::get<FileRequest::ReadRangesRequestData>(request->GetCommand()),
+                                AZStd::move(info));
+                        }
+                    };
+                    FileRequest* fileCheckRequest = m_context->GetNewInternalRequest();
+                    fileCheckRequest->CreateFileExistsCheck(data.m_path);
+                    fileCheckRequest->SetCompletionCallback(AZStd::move(callback));
+                    StreamStackEntry::QueueRequest(fileCheckRequest);
+                }
+                else
+                {
+                    PushArchiveReadRanges(request, data, AZStd::move(info));
+                }
+            }
+            else
+            {
+                StreamStackEntry::PrepareRequest(request);
+            }
+        }
+
+        void FullFileDecompressor::PushArchiveReadRanges(FileRequest* request, FileRequest::ReadRangesRequestData& data,
+            CompressionInfo&& info)
+        {
+            if (info.m_isCompressed)
+            {
+                // Compressed files can only be decompressed as a whole, so every range becomes a separate compressed read.
+                AZ_Assert(info.m_decompressor,
+                    "FullFileDecompressor::PrepareRequest found a compressed file, but no decompressor to decompress with.");
+                if (data.m_ranges.empty())
+                {
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(request);
+                    return;
+                }
+                for (const IStreamerTypes::ReadRange& range : data.m_ranges)
+                {
+                    FileRequest* compressedRead = m_context->GetNewInternalRequest();
+                    compressedRead->CreateCompressedRead(request, info, range.m_output, range.m_offset, range.m_size);
+                    m_context->PushPreparedRequest(compressedRead);
+                }
+            }
+            else
+            {
+                // Uncompressed files can be read directly from the archive, so the ranges are kept together.
+                FileRequest* pathStorageRequest = m_context->GetNewInternalRequest();
+                pathStorageRequest->CreateRequestPathStore(request, AZStd::move(info.m_archiveFilename));
+                auto& pathStorage = AZStd::get<FileRequest::RequestPathStoreData>(pathStorageRequest->GetCommand());
+
+                FileRequest* readRanges = m_context->GetNewInternalRequest();
+                readRanges->CreateReadRanges(pathStorageRequest, pathStorage.m_path, data.m_ranges.data(), data.m_ranges.size(),
+                    info.m_offset, info.m_isSharedPak);
+                m_context->PushPreparedRequest(readRanges);
+            }
+        }
+
+        void FullFileDecompressor::PrepareMapFileRequest(FileRequest* request, FileRequest::MapFileRequestData& data)
+        {
+            CompressionInfo info;
+            if (CompressionUtils::FindCompressionInfo(info, data.m_path.GetRelativePath()))
+            {
+                if (info.m_conflictResolution == ConflictResolution::PreferFile)
+                {
+                    auto callback = [this, request, info = AZStd::move(info)](const FileRequest& checkRequest) mutable
+                    {
+                        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                        auto check = AZStd::get_if<FileRequest::FileExistsCheckData>(&checkRequest.GetCommand());
+                        AZ_Assert(check,
+                            "Callback in FullFileDecompressor::PrepareMapFileRequest expected FileExistsCheck but got another command.");
+                        if (check->m_found)
+                        {
+                            StreamStackEntry::PrepareRequest(request);
+                        }
+                        else
+                        {
+                            PushArchiveMapFile(request, AZStd::get<FileRequest::MapFileRequestData>(request->GetCommand()),
+                                AZStd::move(info));
+                        }
+                    };
+                    FileRequest* fileCheckRequest = m_context->GetNewInternalRequest();
+                    fileCheckRequest->CreateFileExistsCheck(data.m_path);
+                    fileCheckRequest->SetCompletionCallback(AZStd::move(callback));
+                    StreamStackEntry::QueueRequest(fileCheckRequest);
+                }
+                else
+                {
+                    PushArchiveMapFile(request, data, AZStd::move(info));
+                }
+            }
+            else
+            {
+                StreamStackEntry::PrepareRequest(request);
+            }
+        }
+
+        void FullFileDecompressor::PushArchiveMapFile(FileRequest* request, FileRequest::MapFileRequestData& data,
+            CompressionInfo&& info)
+        {
+            // Compressed data can't be used in place, so those files need to be read instead. Empty views aren't supported either.
+            u64 fileSize = info.m_uncompressedSize;
+            if (info.m_isCompressed || data.m_offset >= fileSize || data.m_size > fileSize - data.m_offset)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+                return;
+            }
+
+            FileRequest* pathStorageRequest = m_context->GetNewInternalRequest();
+            pathStorageRequest->CreateRequestPathStore(request, AZStd::move(info.m_archiveFilename));
+            auto& pathStorage = AZStd::get<FileRequest::RequestPathStoreData>(pathStorageRequest->GetCommand());
+
+            // The view is limited to the file in the archive rather than extending to the end of the archive.
+            u64 size = data.m_size != 0 ? data.m_size : fileSize - data.m_offset;
+            FileRequest* mapFile = m_context->GetNewInternalRequest();
+            mapFile->CreateMapFile(pathStorageRequest, pathStorage.m_path, &data.m_view, info.m_offset + data.m_offset, size);
+            m_context->PushPreparedRequest(mapFile);
+        }
+
         void FullFileDecompressor::PrepareDedicatedCache(FileRequest* request, const RequestPath& path)
         {
             CompressionInfo info;
@@ -493,6 +654,12 @@ namespace AZ
                     CompressionInfo& info = data->m_compressionInfo;
                     AZ_Assert(info.m_decompressor, "FullFileDecompressor is planning to a queue a request for reading but couldn't find a decompressor.");
 
+                    if (!info.m_seekPoints.empty())
+                    {
+                        StartBlockReads(compressedReadRequest, i);
+                        return;
+                    }
+
                     // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
                     // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
                     // the BlockCache's prolog and epilog are read into aligned buffers.
@@ -568,6 +735,186 @@ namespace AZ
             }
         }
 
+        void FullFileDecompressor::StartBlockReads(FileRequest* compressedReadRequest, u32 readSlot)
+        {
+            auto& data = AZStd::get<FileRequest::CompressedReadData>(compressedReadRequest->GetCommand());
+            const CompressionInfo& info = data.m_compressionInfo;
+
+            // Only the blocks that overlap with the requested range need to be read and decompressed.
+            BlockDecompressionInformation& blockInfo = m_blockDecompressions[readSlot];
+            blockInfo.m_firstBlock = FindBlock(info, data.m_readOffset);
+            blockInfo.m_endBlock = data.m_readSize > 0 ? FindBlock(info, data.m_readOffset + data.m_readSize - 1) + 1 : blockInfo.m_firstBlock + 1;
+            blockInfo.m_numPendingReads = 0;
+            blockInfo.m_numPendingBlocks = 0;
+
+            const size_t spanStart = info.m_seekPoints[blockInfo.m_firstBlock].m_compressedOffset;
+            const BlockRange lastBlock = GetBlockRange(info, blockInfo.m_endBlock - 1);
+            const size_t spanSize = lastBlock.m_compressedOffset + lastBlock.m_compressedSize - spanStart;
+
+            // Same as for full files, the buffer is aligned down but the offset is not corrected.
+            const size_t archiveOffset = info.m_offset + spanStart;
+            size_t offsetAdjustment = archiveOffset - AZ_SIZE_ALIGN_DOWN(archiveOffset, aznumeric_cast<size_t>(m_alignment));
+            blockInfo.m_alignmentOffset = aznumeric_caster(offsetAdjustment);
+            blockInfo.m_bufferSize = AZ_SIZE_ALIGN_UP((spanSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+            m_readBuffers[readSlot] = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                blockInfo.m_bufferSize, m_alignment, 0, "AZ::IO::Streamer FullFileDecompressor", __FILE__, __LINE__));
+            m_memoryUsage += blockInfo.m_bufferSize;
+
+            if (!m_blockDecompressionJobManager)
+            {
+                // Block jobs get their own threads so they don't compete with full file decompression, but only once a
+                // file with seek points shows up so stacks that never read one don't pay for the threads.
+                JobManagerDesc jobDesc;
+                u32 numThreads = AZ::GetMin(m_maxNumBlockJobs, AZStd::thread::hardware_concurrency());
+                for (u32 i = 0; i < numThreads; ++i)
+                {
+                    jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+                }
+                m_blockDecompressionJobManager = AZStd::make_unique<JobManager>(jobDesc);
+                m_blockDecompressionJobContext = AZStd::make_unique<JobContext>(*m_blockDecompressionJobManager);
+            }
+
+            m_readRequests[readSlot] = compressedReadRequest;
+            m_readBufferStatus[readSlot] = ReadBufferStatus::BlockDecompression;
+            AZ_Assert(m_numInFlightReads < m_maxNumReads,
+                "A FileRequest was queued for reading in FullFileDecompressor, but there's no slots available.");
+            m_numInFlightReads++;
+
+            // Split the reads along block boundaries so blocks can be decompressed while later blocks are still being read.
+            size_t block = blockInfo.m_firstBlock;
+            while (block < blockInfo.m_endBlock)
+            {
+                const size_t chunkStart = info.m_seekPoints[block].m_compressedOffset;
+                size_t chunkEnd = block + 1;
+                for (; chunkEnd < blockInfo.m_endBlock; ++chunkEnd)
+                {
+                    BlockRange range = GetBlockRange(info, chunkEnd);
+                    if (m_blockReadSize != 0 && range.m_compressedOffset + range.m_compressedSize - chunkStart > m_blockReadSize)
+                    {
+                        break;
+                    }
+                }
+                const BlockRange chunkLastBlock = GetBlockRange(info, chunkEnd - 1);
+                const size_t chunkSize = chunkLastBlock.m_compressedOffset + chunkLastBlock.m_compressedSize - chunkStart;
+                const size_t bufferOffset = offsetAdjustment + (chunkStart - spanStart);
+
+                FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
+                archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[readSlot] + bufferOffset,
+                    blockInfo.m_bufferSize - bufferOffset, info.m_archiveFilename, info.m_offset + chunkStart, chunkSize, info.m_isSharedPak);
+                archiveReadRequest->SetCompletionCallback(
+                    [this, readSlot, firstBlock = block, endBlock = chunkEnd](FileRequest& request)
+                    {
+                        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                        FinishBlockRead(&request, readSlot, firstBlock, endBlock);
+                    });
+                blockInfo.m_numPendingReads++;
+                m_next->QueueRequest(archiveReadRequest);
+
+                block = chunkEnd;
+            }
+        }
+
+        void FullFileDecompressor::FinishBlockRead(FileRequest* readRequest, u32 readSlot, size_t firstBlock, size_t endBlock)
+        {
+            FileRequest* compressedRequest = readRequest->GetParent();
+            AZ_Assert(compressedRequest, "Block read started by FullFileDecompressor is missing a parent request.");
+            AZ_Assert(m_readRequests[readSlot] == compressedRequest, "Block read completed for a different request than the one in its read slot.");
+
+            BlockDecompressionInformation& blockInfo = m_blockDecompressions[readSlot];
+            AZ_Assert(blockInfo.m_numPendingReads > 0, "More block reads completed in FullFileDecompressor than were started.");
+            blockInfo.m_numPendingReads--;
+
+            // If the read failed or was canceled the status is passed on to the compressed request, so there's no need to decompress.
+            if (readRequest->GetStatus() == IStreamerTypes::RequestStatus::Completed)
+            {
+                for (size_t block = firstBlock; block < endBlock; ++block)
+                {
+                    StartBlockDecompression(compressedRequest, readSlot, block);
+                }
+            }
+
+            if (blockInfo.m_numPendingReads == 0 && blockInfo.m_numPendingBlocks == 0)
+            {
+                ReleaseBlockReadSlot(readSlot);
+            }
+        }
+
+        void FullFileDecompressor::StartBlockDecompression(FileRequest* compressedReadRequest, u32 readSlot, size_t block)
+        {
+            auto& data = AZStd::get<FileRequest::CompressedReadData>(compressedReadRequest->GetCommand());
+            BlockDecompressionInformation& blockInfo = m_blockDecompressions[readSlot];
+            const size_t spanStart = data.m_compressionInfo.m_seekPoints[blockInfo.m_firstBlock].m_compressedOffset;
+            const u8* compressedData = m_readBuffers[readSlot] + blockInfo.m_alignmentOffset +
+                (data.m_compressionInfo.m_seekPoints[block].m_compressedOffset - spanStart);
+
+            // The wait keeps the compressed request from completing until the block has been decompressed, including while
+            // the block is waiting for a job to become available.
+            FileRequest* waitRequest = m_context->GetNewInternalRequest();
+            waitRequest->CreateWait(compressedReadRequest);
+            waitRequest->SetCompletionCallback([this, readSlot](FileRequest&)
+                {
+                    AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                    FinishBlockDecompression(readSlot);
+                });
+            blockInfo.m_numPendingBlocks++;
+
+            PendingBlockDecompression pending{ waitRequest, compressedData, block };
+            if (m_numRunningBlockJobs < m_maxNumBlockJobs)
+            {
+                LaunchBlockDecompression(pending);
+            }
+            else
+            {
+                m_pendingBlockDecompressions.push_back(pending);
+            }
+        }
+
+        void FullFileDecompressor::LaunchBlockDecompression(const PendingBlockDecompression& pending)
+        {
+            m_numRunningBlockJobs++;
+            auto job = [context = m_context, pending]()
+            {
+                BlockDecompression(context, pending.m_waitRequest, pending.m_compressedData, pending.m_block);
+            };
+            AZ::CreateJobFunction(job, true, m_blockDecompressionJobContext.get())->Start();
+        }
+
+        void FullFileDecompressor::FinishBlockDecompression(u32 readSlot)
+        {
+            BlockDecompressionInformation& blockInfo = m_blockDecompressions[readSlot];
+            AZ_Assert(blockInfo.m_numPendingBlocks > 0, "More blocks were decompressed in FullFileDecompressor than were started.");
+            AZ_Assert(m_numRunningBlockJobs > 0, "About to complete a block decompression job, but the internal count doesn't see a running job.");
+            blockInfo.m_numPendingBlocks--;
+            m_numRunningBlockJobs--;
+            m_numBlocksDecompressed++;
+
+            if (!m_pendingBlockDecompressions.empty())
+            {
+                PendingBlockDecompression pending = m_pendingBlockDecompressions.front();
+                m_pendingBlockDecompressions.pop_front();
+                LaunchBlockDecompression(pending);
+            }
+
+            if (blockInfo.m_numPendingReads == 0 && blockInfo.m_numPendingBlocks == 0)
+            {
+                ReleaseBlockReadSlot(readSlot);
+            }
+        }
+
+        void FullFileDecompressor::ReleaseBlockReadSlot(u32 readSlot)
+        {
+            BlockDecompressionInformation& blockInfo = m_blockDecompressions[readSlot];
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_readBuffers[readSlot], blockInfo.m_bufferSize, m_alignment);
+            m_memoryUsage -= blockInfo.m_bufferSize;
+            m_readBuffers[readSlot] = nullptr;
+            blockInfo = BlockDecompressionInformation{};
+
+            m_readRequests[readSlot] = nullptr;
+            m_readBufferStatus[readSlot] = ReadBufferStatus::Unused;
+            AZ_Assert(m_numInFlightReads > 0, "Trying to release a block read slot in FullFileDecompressor, but no read requests are supposed to be queued.");
+            m_numInFlightReads--;
+        }
+
         bool FullFileDecompressor::StartDecompressions()
         {
             bool queuedJobs = false;
@@ -732,5 +1079,70 @@ namespace AZ
             context->MarkRequestAsCompleted(info.m_waitRequest);
             context->WakeUpSchedulingThread();
         }
+
+        void FullFileDecompressor::BlockDecompression(StreamerContext* context, FileRequest* waitRequest, const u8* compressedData, size_t block)
+        {
+            FileRequest* compressedRequest = waitRequest->GetParent();
+            AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
+            auto request = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(request, "Compressed request in FullFileDecompressor that's running block decompression didn't contain compression read data.");
+            const CompressionInfo& compressionInfo = request->m_compressionInfo;
+            AZ_Assert(compressionInfo.m_decompressor, "Block decompressor job started, but there's no decompressor callback assigned.");
+
+            const BlockRange range = GetBlockRange(compressionInfo, block);
+            const size_t readStart = request->m_readOffset;
+            const size_t readEnd = request->m_readOffset + request->m_readSize;
+            const size_t blockEnd = range.m_uncompressedOffset + range.m_uncompressedSize;
+            u8* output = reinterpret_cast<u8*>(request->m_output);
+
+            bool success;
+            if (readStart <= range.m_uncompressedOffset && blockEnd <= readEnd)
+            {
+                // The entire block is requested, so decompress straight into the final location.
+                success = compressionInfo.m_decompressor(compressionInfo, compressedData, range.m_compressedSize,
+                    output + (range.m_uncompressedOffset - readStart), range.m_uncompressedSize);
+            }
+            else
+            {
+                AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[range.m_uncompressedSize]);
+                success = compressionInfo.m_decompressor(compressionInfo, compressedData, range.m_compressedSize,
+                    decompressionBuffer.get(), range.m_uncompressedSize);
+                if (success)
+                {
+                    const size_t copyStart = AZStd::max(readStart, range.m_uncompressedOffset);
+                    const size_t copyEnd = AZStd::min(readEnd, blockEnd);
+                    memcpy(output + (copyStart - readStart), decompressionBuffer.get() + (copyStart - range.m_uncompressedOffset),
+                        copyEnd - copyStart);
+                }
+            }
+            waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+
+            context->MarkRequestAsCompleted(waitRequest);
+            context->WakeUpSchedulingThread();
+        }
+
+        size_t FullFileDecompressor::FindBlock(const CompressionInfo& info, size_t uncompressedOffset)
+        {
+            AZ_Assert(!info.m_seekPoints.empty(), "Looking for a block in a file without seek points.");
+            auto it = AZStd::upper_bound(info.m_seekPoints.begin(), info.m_seekPoints.end(), uncompressedOffset,
+                [](size_t offset, const CompressionSeekPoint& seekPoint) { return offset < seekPoint.m_uncompressedOffset; });
+            return it == info.m_seekPoints.begin() ? 0 : aznumeric_cast<size_t>(AZStd::distance(info.m_seekPoints.begin(), it)) - 1;
+        }
+
+        auto FullFileDecompressor::GetBlockRange(const CompressionInfo& info, size_t block) -> BlockRange
+        {
+            AZ_Assert(block < info.m_seekPoints.size(), "Block index %zu is out of range.", block);
+            const CompressionSeekPoint& start = info.m_seekPoints[block];
+            const bool isLast = block + 1 == info.m_seekPoints.size();
+            const size_t compressedEnd = isLast ? info.m_compressedSize : info.m_seekPoints[block + 1].m_compressedOffset;
+            const size_t uncompressedEnd = isLast ? info.m_uncompressedSize : info.m_seekPoints[block + 1].m_uncompressedOffset;
+
+            BlockRange result;
+            result.m_compressedOffset = start.m_compressedOffset;
+            result.m_compressedSize = compressedEnd - start.m_compressedOffset;
+            result.m_uncompressedOffset = start.m_uncompressedOffset;
+            result.m_uncompressedSize = uncompressedEnd - start.m_uncompressedOffset;
+            return result;
+        }
     } // namespace IO
 } // namespace AZ
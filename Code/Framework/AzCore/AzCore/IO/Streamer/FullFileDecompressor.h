@@ -38,6 +38,9 @@ namespace AZ
             u32 m_maxNumReads{ 2 };
             //! Maximum number of decompression jobs that can run simultaneously.
             u32 m_maxNumJobs{ 2 };
+            //! Maximum number of block decompression jobs that can run simultaneously. This only applies to files that are
+            //! stored with seek points. If set to 0, one job per hardware thread is used.
+            u32 m_maxNumBlockJobs{ 0 };
         };
 
         //! Entry in the streaming stack that decompresses files from an archive that are stored
@@ -49,11 +52,18 @@ namespace AZ
         //! Finally, the lack of an upper limit also means that the duration of the decompression job
         //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
         //! the main job system from working.
+        //! Files that are stored as independently compressed blocks (files with seek points) are an exception.
+        //! For those only the blocks that overlap with the requested range are read, the reads are split in
+        //! chunks so decompression of earlier blocks can start while later blocks are still being read, and
+        //! every block is decompressed in its own job directly into the output buffer. Block jobs run on a separate
+        //! dedicated job system that's only created once the first file with seek points is read.
         class FullFileDecompressor
             : public StreamStackEntry
         {
         public:
-            FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment);
+            //! @param maxNumBlockJobs The maximum number of block decompression jobs that can run simultaneously. If 0, one per hardware thread.
+            //! @param blockReadSize The size of the reads for files with seek points. If 0, all blocks are read with a single read.
+            FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u32 maxNumBlockJobs = 0, u64 blockReadSize = 0);
             ~FullFileDecompressor() override = default;
 
             void PrepareRequest(FileRequest* request) override;
@@ -73,7 +83,8 @@ namespace AZ
             {
                 Unused,
                 ReadInFlight,
-                PendingDecompression
+                PendingDecompression,
+                BlockDecompression //!< Blocks of a file with seek points are being read and decompressed.
             };
 
             struct DecompressionInformation
@@ -87,9 +98,40 @@ namespace AZ
                 u32 m_alignmentOffset{ 0 };
             };
 
+            //! Information for a read slot that's reading and decompressing a file with seek points.
+            struct BlockDecompressionInformation
+            {
+                size_t m_firstBlock{ 0 };
+                size_t m_endBlock{ 0 };
+                size_t m_bufferSize{ 0 };
+                u32 m_alignmentOffset{ 0 };
+                u32 m_numPendingReads{ 0 };
+                u32 m_numPendingBlocks{ 0 };
+            };
+
+            //! A block that has been read but is waiting for a block decompression job to become available.
+            struct PendingBlockDecompression
+            {
+                FileRequest* m_waitRequest;
+                const u8* m_compressedData;
+                size_t m_block;
+            };
+
+            struct BlockRange
+            {
+                size_t m_compressedOffset;
+                size_t m_compressedSize;
+                size_t m_uncompressedOffset;
+                size_t m_uncompressedSize;
+            };
+
             bool IsIdle() const;
 
             void PrepareReadRequest(FileRequest* request, FileRequest::ReadRequestData& data);
+            void PrepareReadRangesRequest(FileRequest* request, FileRequest::ReadRangesRequestData& data);
+            void PushArchiveReadRanges(FileRequest* request, FileRequest::ReadRangesRequestData& data, CompressionInfo&& info);
+            void PrepareMapFileRequest(FileRequest* request, FileRequest::MapFileRequestData& data);
+            void PushArchiveMapFile(FileRequest* request, FileRequest::MapFileRequestData& data, CompressionInfo&& info);
             void PrepareDedicatedCache(FileRequest* request, const RequestPath& path);
             void FileExistsCheck(FileRequest* checkRequest);
 
@@ -98,14 +140,25 @@ namespace AZ
 
             void StartArchiveRead(FileRequest* compressedReadRequest);
             void FinishArchiveRead(FileRequest* readRequest, u32 readSlot);
+            void StartBlockReads(FileRequest* compressedReadRequest, u32 readSlot);
+            void FinishBlockRead(FileRequest* readRequest, u32 readSlot, size_t firstBlock, size_t endBlock);
+            void StartBlockDecompression(FileRequest* compressedReadRequest, u32 readSlot, size_t block);
+            void LaunchBlockDecompression(const PendingBlockDecompression& pending);
+            void FinishBlockDecompression(u32 readSlot);
+            void ReleaseBlockReadSlot(u32 readSlot);
             bool StartDecompressions();
             void FinishDecompression(FileRequest* waitRequest, u32 jobSlot);
             
             static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
             static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
+            static void BlockDecompression(StreamerContext* context, FileRequest* waitRequest, const u8* compressedData, size_t block);
+
+            static size_t FindBlock(const CompressionInfo& info, size_t uncompressedOffset);
+            static BlockRange GetBlockRange(const CompressionInfo& info, size_t block);
 
             AZStd::deque<FileRequest*> m_pendingReads;
             AZStd::deque<FileRequest*> m_pendingFileExistChecks;
+            AZStd::deque<PendingBlockDecompression> m_pendingBlockDecompressions;
 
             AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionJobDelayMicroSec;
             AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionDurationMicroSec;
@@ -117,19 +170,27 @@ namespace AZ
 
             AZStd::unique_ptr<Buffer[]> m_readBuffers;
             // Nullptr if not reading, the read request if reading the file and the wait request for decompression when waiting on decompression.
+            // For files with seek points this is the compressed request for as long as its blocks are being read or decompressed.
             AZStd::unique_ptr<FileRequest*[]> m_readRequests;
             AZStd::unique_ptr<ReadBufferStatus[]> m_readBufferStatus;
+            AZStd::unique_ptr<BlockDecompressionInformation[]> m_blockDecompressions;
             
             AZStd::unique_ptr<DecompressionInformation[]> m_processingJobs;
             AZStd::unique_ptr<JobManager> m_decompressionJobManager;
             AZStd::unique_ptr<JobContext> m_decompressionjobContext;
+            AZStd::unique_ptr<JobManager> m_blockDecompressionJobManager;
+            AZStd::unique_ptr<JobContext> m_blockDecompressionJobContext;
 
             size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+            u64 m_blockReadSize{ 0 };
+            u64 m_numBlocksDecompressed{ 0 };
             u32 m_maxNumReads{ 2 };
             u32 m_numInFlightReads{ 0 };
             u32 m_numPendingDecompression{ 0 };
             u32 m_maxNumJobs{ 1 };
             u32 m_numRunningJobs{ 0 };
+            u32 m_maxNumBlockJobs{ 1 };
+            u32 m_numRunningBlockJobs{ 0 };
             u32 m_alignment{ 0 };
         };
     } // namespace IO
@@ -0,0 +1,698 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PrefetchCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> PrefetchCacheConfig::AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            size_t blockSize;
+            switch (m_blockSize)
+            {
+            case BlockCacheConfig::BlockSize::MaxTransfer:
+                blockSize = hardware.m_maxTransfer;
+                break;
+            case BlockCacheConfig::BlockSize::MemoryAlignment:
+                blockSize = hardware.m_maxPhysicalSectorSize;
+                break;
+            case BlockCacheConfig::BlockSize::SizeAlignment:
+                blockSize = hardware.m_maxLogicalSectorSize;
+                break;
+            default:
+                blockSize = m_blockSize;
+                break;
+            }
+
+            u64 cacheSize = m_cacheSizeMib * 1_mib;
+            if (blockSize * 2 > cacheSize)
+            {
+                AZ_Warning("Streamer", false, "Size (%llu) for PrefetchCache isn't big enough to hold at least two blocks of size (%zu). "
+                    "The cache size will be increased to fit 2 blocks.", cacheSize, blockSize);
+                cacheSize = blockSize * 2;
+            }
+
+            auto stackEntry = AZStd::make_shared<PrefetchCache>(cacheSize, aznumeric_caster(blockSize),
+                aznumeric_caster(hardware.m_maxPhysicalSectorSize), m_maxPrefetchDepth, m_maxStreams);
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void PrefetchCacheConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<PrefetchCacheConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("CacheSizeMib", &PrefetchCacheConfig::m_cacheSizeMib)
+                    ->Field("BlockSize", &PrefetchCacheConfig::m_blockSize)
+                    ->Field("MaxPrefetchDepth", &PrefetchCacheConfig::m_maxPrefetchDepth)
+                    ->Field("MaxStreams", &PrefetchCacheConfig::m_maxStreams);
+            }
+        }
+
+        static constexpr char HitRateName[] = "Prefetch hit rate";
+
+        // Read-ahead blocks that haven't been touched for this long are assumed to be abandoned and can be recycled.
+        const AZStd::chrono::milliseconds PrefetchCache::s_staleBlockAge = AZStd::chrono::milliseconds(500);
+
+        PrefetchCache::PrefetchCache(u64 cacheSize, u32 blockSize, u32 alignment, u32 maxPrefetchDepth, u32 maxStreams)
+            : StreamStackEntry("Prefetch cache")
+            , m_blockSize(blockSize)
+            , m_alignment(alignment)
+            , m_maxPrefetchDepth(AZStd::max(maxPrefetchDepth, 1u))
+            , m_maxStreams(AZStd::max(maxStreams, 1u))
+        {
+            AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
+            AZ_Assert(IStreamerTypes::IsAlignedTo(blockSize, alignment), "Block size needs to be a multiple of the alignment.");
+            AZ_Assert(blockSize > 0, "PrefetchCache requires a block size larger than zero.");
+
+            u32 numBlocks = AZStd::max(aznumeric_cast<u32>(cacheSize / blockSize), 1u);
+            m_cacheSize = aznumeric_cast<u64>(numBlocks) * blockSize;
+            m_cache = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                m_cacheSize, alignment, 0, "AZ::IO::Streamer PrefetchCache", __FILE__, __LINE__));
+            m_blocks.resize(numBlocks);
+            m_streams.reserve(m_maxStreams);
+        }
+
+        PrefetchCache::~PrefetchCache()
+        {
+            AZ_Assert(m_numInFlightPrefetches == 0, "PrefetchCache destroyed while there are still %u read-ahead requests in flight.",
+                m_numInFlightPrefetches);
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_cache, m_cacheSize, m_alignment);
+        }
+
+        void PrefetchCache::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+
+            AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+                {
+                    ReadFile(request, args);
+                    return;
+                }
+                else
+                {
+                    if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+                    {
+                        CancelWaitingRequests(args.m_target);
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+                    {
+                        FlushCache(args.m_path);
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+                    {
+                        FlushEntireCache();
+                    }
+                    StreamStackEntry::QueueRequest(request);
+                }
+            }, request->GetCommand());
+        }
+
+        bool PrefetchCache::ExecuteRequests()
+        {
+            bool issuedPrefetches = IssuePrefetches();
+            bool nextResult = StreamStackEntry::ExecuteRequests();
+            return nextResult || issuedPrefetches;
+        }
+
+        void PrefetchCache::UpdateStatus(Status& status) const
+        {
+            StreamStackEntry::UpdateStatus(status);
+            m_nextAvailableSlots = status.m_numAvailableSlots;
+            status.m_isIdle = status.m_isIdle &&
+                m_waitingRequests.empty() &&
+                m_numInFlightPrefetches == 0 &&
+                m_numMetaDataRetrievalInProgress == 0;
+        }
+
+        void PrefetchCache::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+            AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+            StreamerContext::PreparedQueue::iterator pendingEnd)
+        {
+            StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+            // Requests that are waiting for read-ahead data complete when the last of the blocks they depend on is read.
+            for (FileRequest* request : m_waitingRequests)
+            {
+                auto& data = AZStd::get<FileRequest::ReadData>(request->GetCommand());
+                TimePoint estimate = now;
+                u64 position = data.m_offset;
+                const u64 end = data.m_offset + data.m_size;
+                while (position < end)
+                {
+                    u32 index = FindBlock(data.m_path, position);
+                    if (index == s_noBlock)
+                    {
+                        break;
+                    }
+                    const Block& block = m_blocks[index];
+                    if (block.m_request)
+                    {
+                        estimate = AZStd::max(estimate, block.m_request->GetEstimatedCompletion());
+                    }
+                    position = block.m_offset + block.m_size;
+                }
+                request->SetEstimatedCompletion(estimate);
+            }
+        }
+
+        void PrefetchCache::ReadFile(FileRequest* request, FileRequest::ReadData& data)
+        {
+            Stream& stream = FindOrCreateStream(data.m_path);
+            stream.m_sharedRead = data.m_sharedRead;
+            UpdateStream(stream, data.m_offset, data.m_size);
+
+            switch (ServiceFromCache(data, true))
+            {
+            case ServiceResult::Serviced:
+                ServiceFromCache(data, false);
+                m_numHits++;
+                m_hitRateStat.PushSample(1.0);
+                Statistic::PlotImmediate(m_name, HitRateName, m_hitRateStat.GetMostRecentSample());
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+                break;
+            case ServiceResult::Wait:
+                m_waitingRequests.push_back(request);
+                break;
+            case ServiceResult::Miss:
+                m_numMisses++;
+                m_hitRateStat.PushSample(0.0);
+                Statistic::PlotImmediate(m_name, HitRateName, m_hitRateStat.GetMostRecentSample());
+                StreamStackEntry::QueueRequest(request);
+                break;
+            default:
+                AZ_Assert(false, "Unsupported service result.");
+            }
+        }
+
+        auto PrefetchCache::ServiceFromCache(FileRequest::ReadData& data, bool onlyCheck) -> ServiceResult
+        {
+            bool isInFlight = false;
+            u64 position = data.m_offset;
+            const u64 end = data.m_offset + data.m_size;
+            while (position < end)
+            {
+                u32 index = FindBlock(data.m_path, position);
+                if (index == s_noBlock)
+                {
+                    return ServiceResult::Miss;
+                }
+
+                Block& block = m_blocks[index];
+                const u64 blockEnd = block.m_offset + block.m_size;
+                if (block.m_state == BlockState::InFlight)
+                {
+                    AZ_Assert(onlyCheck, "Attempting to copy data from a read-ahead block that's still in flight.");
+                    isInFlight = true;
+                }
+                else if (!onlyCheck)
+                {
+                    const u64 copySize = AZStd::min(end, blockEnd) - position;
+                    ::memcpy(reinterpret_cast<u8*>(data.m_output) + (position - data.m_offset),
+                        GetBlockData(index) + (position - block.m_offset), copySize);
+
+                    if (!block.m_used)
+                    {
+                        // The read-ahead paid off, so allow the file to read further ahead.
+                        block.m_used = true;
+                        if (Stream* stream = FindStream(block.m_path); stream != nullptr)
+                        {
+                            stream->m_depth = AZStd::min(stream->m_depth * 2, m_maxPrefetchDepth);
+                        }
+                    }
+                    block.m_lastTouched = AZStd::chrono::system_clock::now();
+                    if (end >= blockEnd)
+                    {
+                        // The block has been read to the end, so it's unlikely to be needed again.
+                        ReleaseBlock(index);
+                    }
+                }
+                position = blockEnd;
+            }
+            return isInFlight ? ServiceResult::Wait : ServiceResult::Serviced;
+        }
+
+        void PrefetchCache::CompletePrefetch(u32 blockIndex, IStreamerTypes::RequestStatus status)
+        {
+            AZ_Assert(m_numInFlightPrefetches > 0, "More read-ahead requests completed than were issued.");
+            m_numInFlightPrefetches--;
+
+            Block& block = m_blocks[blockIndex];
+            AZ_Assert(block.m_state == BlockState::InFlight, "Read-ahead block %u completed, but wasn't in flight.", blockIndex);
+            block.m_request = nullptr;
+            if (block.m_discard || status != IStreamerTypes::RequestStatus::Completed)
+            {
+                ReleaseBlock(blockIndex);
+            }
+            else
+            {
+                block.m_state = BlockState::Ready;
+                block.m_lastTouched = AZStd::chrono::system_clock::now();
+            }
+
+            ProcessWaitingRequests();
+        }
+
+        void PrefetchCache::ProcessWaitingRequests()
+        {
+            for (auto it = m_waitingRequests.begin(); it != m_waitingRequests.end();)
+            {
+                FileRequest* request = *it;
+                auto& data = AZStd::get<FileRequest::ReadData>(request->GetCommand());
+                switch (ServiceFromCache(data, true))
+                {
+                case ServiceResult::Serviced:
+                    ServiceFromCache(data, false);
+                    m_numLateHits++;
+                    m_hitRateStat.PushSample(1.0);
+                    Statistic::PlotImmediate(m_name, HitRateName, m_hitRateStat.GetMostRecentSample());
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(request);
+                    it = m_waitingRequests.erase(it);
+                    break;
+                case ServiceResult::Miss:
+                    // One of the blocks failed to read or was discarded, so read the data directly.
+                    m_numMisses++;
+                    m_hitRateStat.PushSample(0.0);
+                    Statistic::PlotImmediate(m_name, HitRateName, m_hitRateStat.GetMostRecentSample());
+                    StreamStackEntry::QueueRequest(request);
+                    it = m_waitingRequests.erase(it);
+                    break;
+                default:
+                    ++it;
+                    break;
+                }
+            }
+        }
+
+        void PrefetchCache::CancelWaitingRequests(FileRequestPtr& target)
+        {
+            for (auto it = m_waitingRequests.begin(); it != m_waitingRequests.end();)
+            {
+                if ((*it)->WorksOn(target))
+                {
+                    (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                    m_context->MarkRequestAsCompleted(*it);
+                    it = m_waitingRequests.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        void PrefetchCache::UpdateStream(Stream& stream, u64 offset, u64 size)
+        {
+            stream.m_lastAccess = AZStd::chrono::system_clock::now();
+            if (stream.m_lastSize != 0)
+            {
+                const s64 delta = aznumeric_cast<s64>(offset) - aznumeric_cast<s64>(stream.m_lastOffset);
+                if (offset == stream.m_lastOffset + stream.m_lastSize)
+                {
+                    if (stream.m_pattern == AccessPattern::Sequential)
+                    {
+                        stream.m_confidence++;
+                    }
+                    else
+                    {
+                        stream.m_pattern = AccessPattern::Sequential;
+                        stream.m_confidence = 1;
+                    }
+                }
+                else if (delta != 0 && delta == stream.m_stride)
+                {
+                    if (stream.m_pattern == AccessPattern::Strided)
+                    {
+                        stream.m_confidence++;
+                    }
+                    else
+                    {
+                        stream.m_pattern = AccessPattern::Strided;
+                        stream.m_confidence = 1;
+                    }
+                }
+                else
+                {
+                    if (stream.m_pattern != AccessPattern::Unknown)
+                    {
+                        // The pattern has been broken, so any data that was read ahead is unlikely to be used.
+                        DiscardBlocks(stream.m_path, true);
+                        stream.m_depth = 1;
+                        stream.m_prefetchFrontier = 0;
+                    }
+                    stream.m_pattern = AccessPattern::Unknown;
+                    stream.m_confidence = 0;
+                }
+                stream.m_stride = delta;
+            }
+            stream.m_lastOffset = offset;
+            stream.m_lastSize = size;
+        }
+
+        auto PrefetchCache::FindOrCreateStream(const RequestPath& filePath) -> Stream&
+        {
+            if (Stream* stream = FindStream(filePath); stream != nullptr)
+            {
+                return *stream;
+            }
+
+            if (m_streams.size() < m_maxStreams)
+            {
+                Stream& stream = m_streams.emplace_back();
+                stream.m_path = filePath;
+                return stream;
+            }
+
+            // Replace the file that hasn't been read from for the longest time.
+            auto oldest = m_streams.begin();
+            for (auto it = m_streams.begin() + 1; it != m_streams.end(); ++it)
+            {
+                if (it->m_lastAccess < oldest->m_lastAccess)
+                {
+                    oldest = it;
+                }
+            }
+            DiscardBlocks(oldest->m_path, true);
+            *oldest = Stream{};
+            oldest->m_path = filePath;
+            return *oldest;
+        }
+
+        auto PrefetchCache::FindStream(const RequestPath& filePath) -> Stream*
+        {
+            for (Stream& stream : m_streams)
+            {
+                if (stream.m_path == filePath)
+                {
+                    return &stream;
+                }
+            }
+            return nullptr;
+        }
+
+        void PrefetchCache::RequestFileSize(Stream& stream)
+        {
+            if (stream.m_fileSizeRequested)
+            {
+                return;
+            }
+            stream.m_fileSizeRequested = true;
+
+            auto storeFileSize = [this, filePath = stream.m_path](FileRequest& fileSizeRequest)
+            {
+                AZ_Assert(m_numMetaDataRetrievalInProgress > 0,
+                    "More requests have completed meta data retrieval in the Prefetch Cache than were requested.");
+                m_numMetaDataRetrievalInProgress--;
+                if (fileSizeRequest.GetStatus() == IStreamerTypes::RequestStatus::Completed)
+                {
+                    auto& requestInfo = AZStd::get<FileRequest::FileMetaDataRetrievalData>(fileSizeRequest.GetCommand());
+                    Stream* stream = FindStream(filePath);
+                    if (requestInfo.m_found && stream)
+                    {
+                        stream->m_fileSize = requestInfo.m_fileSize;
+                        stream->m_fileSizeKnown = true;
+                    }
+                }
+                // If the file size couldn't be retrieved the file is never read ahead.
+            };
+            m_numMetaDataRetrievalInProgress++;
+            FileRequest* fileSizeRequest = m_context->GetNewInternalRequest();
+            fileSizeRequest->CreateFileMetaDataRetrieval(stream.m_path);
+            fileSizeRequest->SetCompletionCallback(AZStd::move(storeFileSize));
+            StreamStackEntry::QueueRequest(fileSizeRequest);
+        }
+
+        bool PrefetchCache::IssuePrefetches()
+        {
+            if (!m_next)
+            {
+                return false;
+            }
+
+            bool hasIssued = false;
+            for (Stream& stream : m_streams)
+            {
+                if (stream.m_pattern == AccessPattern::Unknown || stream.m_confidence < s_minConfidence)
+                {
+                    continue;
+                }
+                if (!stream.m_fileSizeKnown)
+                {
+                    // Read-ahead is capped at the end of the file, so the file size needs to be known first.
+                    if (!stream.m_fileSizeRequested)
+                    {
+                        RequestFileSize(stream);
+                        hasIssued = true;
+                    }
+                    continue;
+                }
+
+                const u64 readEnd = stream.m_lastOffset + stream.m_lastSize;
+                if (stream.m_pattern == AccessPattern::Sequential)
+                {
+                    const u64 target = AZStd::min(stream.m_fileSize, readEnd + aznumeric_cast<u64>(stream.m_depth) * m_blockSize);
+                    stream.m_prefetchFrontier = AZStd::max(stream.m_prefetchFrontier, readEnd);
+                    while (stream.m_prefetchFrontier < target)
+                    {
+                        if (u32 index = FindBlock(stream.m_path, stream.m_prefetchFrontier); index != s_noBlock)
+                        {
+                            stream.m_prefetchFrontier = m_blocks[index].m_offset + m_blocks[index].m_size;
+                            continue;
+                        }
+
+                        const u64 size = AZStd::min(aznumeric_cast<u64>(m_blockSize), stream.m_fileSize - stream.m_prefetchFrontier);
+                        if (!IssuePrefetch(stream, stream.m_prefetchFrontier, size))
+                        {
+                            return hasIssued;
+                        }
+                        stream.m_prefetchFrontier += size;
+                        hasIssued = true;
+                    }
+                }
+                else if (stream.m_lastSize <= m_blockSize)
+                {
+                    // Strided reads are read ahead per predicted read, so only reads that fit in a block are considered.
+                    for (u32 i = 1; i <= stream.m_depth; ++i)
+                    {
+                        const s64 predicted = aznumeric_cast<s64>(stream.m_lastOffset) + stream.m_stride * i;
+                        if (predicted < 0 || aznumeric_cast<u64>(predicted) + stream.m_lastSize > stream.m_fileSize)
+                        {
+                            break;
+                        }
+                        if (FindBlock(stream.m_path, aznumeric_cast<u64>(predicted)) != s_noBlock)
+                        {
+                            continue;
+                        }
+                        if (!IssuePrefetch(stream, aznumeric_cast<u64>(predicted), stream.m_lastSize))
+                        {
+                            return hasIssued;
+                        }
+                        hasIssued = true;
+                    }
+                }
+            }
+            return hasIssued;
+        }
+
+        bool PrefetchCache::IssuePrefetch(Stream& stream, u64 offset, u64 size)
+        {
+            AZ_Assert(size > 0 && size <= m_blockSize, "Invalid read-ahead size %llu.", size);
+            if (m_nextAvailableSlots <= 0)
+            {
+                return false;
+            }
+            u32 index = ClaimBlock();
+            if (index == s_noBlock)
+            {
+                return false;
+            }
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(nullptr, GetBlockData(index), m_blockSize, stream.m_path, offset, size, stream.m_sharedRead);
+            read->SetCompletionCallback([this, index](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                    CompletePrefetch(index, request.GetStatus());
+                });
+
+            Block& block = m_blocks[index];
+            block.m_path = stream.m_path;
+            block.m_offset = offset;
+            block.m_size = size;
+            block.m_request = read;
+            block.m_state = BlockState::InFlight;
+            block.m_used = false;
+            block.m_discard = false;
+            block.m_lastTouched = AZStd::chrono::system_clock::now();
+
+            m_nextAvailableSlots--;
+            m_numInFlightPrefetches++;
+            m_numPrefetchedBlocks++;
+            m_next->QueueRequest(read);
+            return true;
+        }
+
+        u8* PrefetchCache::GetBlockData(u32 index)
+        {
+            AZ_Assert(index < m_blocks.size(), "Read-ahead block index %u is out of bounds.", index);
+            return m_cache + aznumeric_cast<u64>(index) * m_blockSize;
+        }
+
+        u32 PrefetchCache::FindBlock(const RequestPath& filePath, u64 offset) const
+        {
+            const u32 numBlocks = aznumeric_cast<u32>(m_blocks.size());
+            for (u32 i = 0; i < numBlocks; ++i)
+            {
+                const Block& block = m_blocks[i];
+                if (block.m_state != BlockState::Empty && !block.m_discard &&
+                    block.m_offset <= offset && offset < block.m_offset + block.m_size && block.m_path == filePath)
+                {
+                    return i;
+                }
+            }
+            return s_noBlock;
+        }
+
+        u32 PrefetchCache::ClaimBlock()
+        {
+            const TimePoint staleTime = AZStd::chrono::system_clock::now() - s_staleBlockAge;
+            u32 oldest = s_noBlock;
+            const u32 numBlocks = aznumeric_cast<u32>(m_blocks.size());
+            for (u32 i = 0; i < numBlocks; ++i)
+            {
+                const Block& block = m_blocks[i];
+                if (block.m_state == BlockState::Empty)
+                {
+                    return i;
+                }
+                if (block.m_state == BlockState::Ready && block.m_lastTouched < staleTime &&
+                    (oldest == s_noBlock || block.m_lastTouched < m_blocks[oldest].m_lastTouched))
+                {
+                    oldest = i;
+                }
+            }
+
+            if (oldest != s_noBlock)
+            {
+                Block& block = m_blocks[oldest];
+                if (!block.m_used)
+                {
+                    m_numWastedBlocks++;
+                    if (Stream* stream = FindStream(block.m_path); stream != nullptr)
+                    {
+                        stream->m_depth = AZStd::max(stream->m_depth / 2, 1u);
+                    }
+                }
+                ReleaseBlock(oldest);
+            }
+            return oldest;
+        }
+
+        void PrefetchCache::ReleaseBlock(u32 index)
+        {
+            Block& block = m_blocks[index];
+            AZ_Assert(block.m_state != BlockState::InFlight, "Read-ahead block %u can't be released while it's in flight.", index);
+            block = Block{};
+        }
+
+        void PrefetchCache::DiscardBlocks(const RequestPath& filePath, bool countAsWaste)
+        {
+            const u32 numBlocks = aznumeric_cast<u32>(m_blocks.size());
+            for (u32 i = 0; i < numBlocks; ++i)
+            {
+                Block& block = m_blocks[i];
+                if (block.m_state == BlockState::Empty || block.m_discard || block.m_path != filePath)
+                {
+                    continue;
+                }
+                if (countAsWaste && !block.m_used)
+                {
+                    m_numWastedBlocks++;
+                }
+                if (block.m_state == BlockState::InFlight)
+                {
+                    block.m_discard = true;
+                }
+                else
+                {
+                    ReleaseBlock(i);
+                }
+            }
+        }
+
+        void PrefetchCache::FlushCache(const RequestPath& filePath)
+        {
+            DiscardBlocks(filePath, false);
+            for (auto it = m_streams.begin(); it != m_streams.end(); ++it)
+            {
+                if (it->m_path == filePath)
+                {
+                    m_streams.erase(it);
+                    break;
+                }
+            }
+        }
+
+        void PrefetchCache::FlushEntireCache()
+        {
+            for (Block& block : m_blocks)
+            {
+                if (block.m_state == BlockState::InFlight)
+                {
+                    block.m_discard = true;
+                }
+                else
+                {
+                    block = Block{};
+                }
+            }
+            m_streams.clear();
+        }
+
+        void PrefetchCache::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            s64 activeStreams = 0;
+            for (const Stream& stream : m_streams)
+            {
+                if (stream.m_pattern != AccessPattern::Unknown && stream.m_confidence >= s_minConfidence)
+                {
+                    activeStreams++;
+                }
+            }
+
+            statistics.push_back(Statistic::CreatePercentage(m_name, HitRateName, m_hitRateStat.GetAverage()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Hits", aznumeric_cast<s64>(m_numHits)));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Late hits", aznumeric_cast<s64>(m_numLateHits)));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Misses", aznumeric_cast<s64>(m_numMisses)));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Prefetched blocks", aznumeric_cast<s64>(m_numPrefetchedBlocks)));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Wasted blocks", aznumeric_cast<s64>(m_numWastedBlocks)));
+            statistics.push_back(Statistic::CreatePercentage(m_name, "Waste rate", m_numPrefetchedBlocks > 0
+                ? aznumeric_cast<double>(m_numWastedBlocks) / aznumeric_cast<double>(m_numPrefetchedBlocks) : 0.0));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Detected streams", activeStreams));
+
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+    } // namespace IO
+} // namespace AZ
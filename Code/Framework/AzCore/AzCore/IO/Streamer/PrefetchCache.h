@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct PrefetchCacheConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::PrefetchCacheConfig, "{0E6B1C55-3F0A-4C1B-8D8E-57A4E2B9C6D3}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(PrefetchCacheConfig, AZ::SystemAllocator, 0);
+
+            ~PrefetchCacheConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! The memory budget for read-ahead data in megabytes.
+            u32 m_cacheSizeMib{ 8 };
+            //! The size of the individual read-ahead blocks.
+            BlockCacheConfig::BlockSize m_blockSize{ BlockCacheConfig::BlockSize::MaxTransfer };
+            //! The maximum number of blocks that a single file can read ahead.
+            u32 m_maxPrefetchDepth{ 4 };
+            //! The maximum number of files for which access patterns are tracked at the same time.
+            u32 m_maxStreams{ 8 };
+        };
+
+        //! Stream stack entry that learns the access pattern of files and reads ahead of them. Reads of every file are tracked and
+        //! when a number of reads follow each other directly (sequential access) or are a fixed distance apart (strided access), the
+        //! upcoming reads are issued to the next entry in the stack while the stack has slots available. Reads that are covered by
+        //! read-ahead data are serviced from memory, or wait for the read-ahead to complete if it's still in flight. The number of
+        //! blocks that are read ahead grows for files where read-ahead data is used and shrinks for files where it's wasted.
+        class PrefetchCache
+            : public StreamStackEntry
+        {
+        public:
+            PrefetchCache(u64 cacheSize, u32 blockSize, u32 alignment, u32 maxPrefetchDepth, u32 maxStreams);
+            PrefetchCache(PrefetchCache&& rhs) = delete;
+            PrefetchCache(const PrefetchCache& rhs) = delete;
+            ~PrefetchCache() override;
+
+            PrefetchCache& operator=(PrefetchCache&& rhs) = delete;
+            PrefetchCache& operator=(const PrefetchCache& rhs) = delete;
+
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+
+            void UpdateStatus(Status& status) const override;
+            void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+                StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+            void FlushCache(const RequestPath& filePath);
+            void FlushEntireCache();
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+            //! The number of reads that were fully serviced from read-ahead data that was already available.
+            u64 GetNumHits() const { return m_numHits; }
+            //! The number of reads that were serviced from read-ahead data, but had to wait for the read-ahead to complete.
+            u64 GetNumLateHits() const { return m_numLateHits; }
+            //! The number of reads that weren't covered by read-ahead data.
+            u64 GetNumMisses() const { return m_numMisses; }
+            //! The number of blocks that were read ahead.
+            u64 GetNumPrefetchedBlocks() const { return m_numPrefetchedBlocks; }
+            //! The number of read-ahead blocks that were discarded without being used.
+            u64 GetNumWastedBlocks() const { return m_numWastedBlocks; }
+
+        protected:
+            using TimePoint = AZStd::chrono::system_clock::time_point;
+
+            static constexpr u32 s_minConfidence = 2; //!< Number of consecutive reads that need to match a pattern before reading ahead.
+            static constexpr u32 s_noBlock = static_cast<u32>(-1);
+            static const AZStd::chrono::milliseconds s_staleBlockAge;
+
+            enum class BlockState : u8
+            {
+                Empty,
+                InFlight,
+                Ready
+            };
+
+            struct Block
+            {
+                RequestPath m_path;
+                TimePoint m_lastTouched;
+                FileRequest* m_request{ nullptr }; //!< The read request that's filling this block, if in flight.
+                u64 m_offset{ 0 };
+                u64 m_size{ 0 };
+                BlockState m_state{ BlockState::Empty };
+                bool m_used{ false }; //!< Whether or not any read has been serviced from this block.
+                bool m_discard{ false }; //!< If set, the block is released as soon as the in-flight read completes.
+            };
+
+            enum class AccessPattern : u8
+            {
+                Unknown,
+                Sequential,
+                Strided
+            };
+
+            struct Stream
+            {
+                RequestPath m_path;
+                TimePoint m_lastAccess;
+                u64 m_fileSize{ 0 };
+                u64 m_lastOffset{ 0 };
+                u64 m_lastSize{ 0 };
+                u64 m_prefetchFrontier{ 0 }; //!< The offset up to which sequential data has been read ahead.
+                s64 m_stride{ 0 };
+                u32 m_confidence{ 0 };
+                u32 m_depth{ 1 }; //!< The number of blocks to read ahead.
+                AccessPattern m_pattern{ AccessPattern::Unknown };
+                bool m_fileSizeKnown{ false };
+                bool m_fileSizeRequested{ false };
+                bool m_sharedRead{ false };
+            };
+
+            enum class ServiceResult
+            {
+                Serviced, //!< All data was available and has been copied to the request.
+                Wait, //!< All data is covered by read-ahead blocks, but at least one of them is still in flight.
+                Miss //!< At least part of the data isn't covered by read-ahead blocks.
+            };
+
+            void ReadFile(FileRequest* request, FileRequest::ReadData& data);
+            ServiceResult ServiceFromCache(FileRequest::ReadData& data, bool onlyCheck);
+            void CompletePrefetch(u32 blockIndex, IStreamerTypes::RequestStatus status);
+            void ProcessWaitingRequests();
+            void CancelWaitingRequests(FileRequestPtr& target);
+
+            void UpdateStream(Stream& stream, u64 offset, u64 size);
+            Stream& FindOrCreateStream(const RequestPath& filePath);
+            Stream* FindStream(const RequestPath& filePath);
+            void RequestFileSize(Stream& stream);
+
+            bool IssuePrefetches();
+            bool IssuePrefetch(Stream& stream, u64 offset, u64 size);
+
+            u8* GetBlockData(u32 index);
+            u32 FindBlock(const RequestPath& filePath, u64 offset) const;
+            u32 ClaimBlock();
+            void ReleaseBlock(u32 index);
+            void DiscardBlocks(const RequestPath& filePath, bool countAsWaste);
+
+            AZStd::vector<Block> m_blocks;
+            AZStd::vector<Stream> m_streams;
+            //! Reads that are covered by read-ahead blocks that are still in flight.
+            AZStd::vector<FileRequest*> m_waitingRequests;
+
+            AZ::Statistics::RunningStatistic m_hitRateStat;
+
+            u8* m_cache{ nullptr };
+            u64 m_cacheSize{ 0 };
+            u32 m_blockSize{ 0 };
+            u32 m_alignment{ 0 };
+            u32 m_maxPrefetchDepth{ 1 };
+            u32 m_maxStreams{ 1 };
+            u32 m_numInFlightPrefetches{ 0 };
+            s32 m_numMetaDataRetrievalInProgress{ 0 };
+            //! The number of slots the rest of the stack reported as available during the last status update. Read-ahead is only
+            //! issued when there are slots left over, so it doesn't delay reads that have been explicitly requested.
+            mutable s32 m_nextAvailableSlots{ 0 };
+
+            u64 m_numHits{ 0 };
+            u64 m_numLateHits{ 0 };
+            u64 m_numMisses{ 0 };
+            u64 m_numPrefetchedBlocks{ 0 };
+            u64 m_numWastedBlocks{ 0 };
+        };
+    } // namespace IO
+} // namespace AZ
@@ -16,6 +16,33 @@ namespace AZ::IO
     static constexpr char SchedulerName[] = "Scheduler";
     static constexpr char ImmediateReadsName[] = "Immediate reads";
 
+    namespace SchedulerInternal
+    {
+        struct ReadScheduleInfo
+        {
+            AZStd::chrono::system_clock::time_point m_deadline;
+            IStreamerTypes::Priority m_priority;
+        };
+
+        //! Gets the deadline and priority of the read or ranges request in the chain of the provided request.
+        static bool GetReadScheduleInfo(ReadScheduleInfo& info, const FileRequest* request)
+        {
+            if (const FileRequest::ReadRequestData* read = request->GetCommandFromChain<FileRequest::ReadRequestData>(); read)
+            {
+                info.m_deadline = read->m_deadline;
+                info.m_priority = read->m_priority;
+                return true;
+            }
+            if (const FileRequest::ReadRangesRequestData* ranges = request->GetCommandFromChain<FileRequest::ReadRangesRequestData>(); ranges)
+            {
+                info.m_deadline = ranges->m_deadline;
+                info.m_priority = ranges->m_priority;
+                return true;
+            }
+            return false;
+        }
+    } // namespace SchedulerInternal
+
     Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(memoryAlignment), "Memory alignment provided to AZ::IO::Scheduler isn't a power of two.");
@@ -220,40 +247,50 @@ namespace AZ::IO
                 AZStd::is_same_v<Command, FileRequest::ReadData> ||
                 AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
             {
+                const char* relativePath = nullptr;
                 auto parentReadRequest = next->GetCommandFromChain<FileRequest::ReadRequestData>();
-                AZ_Assert(parentReadRequest != nullptr, "The issued read request can't be found for the (compressed) read command.");
-                
-                size_t size = parentReadRequest->m_size;
-                if (parentReadRequest->m_output == nullptr)
+                if (parentReadRequest)
                 {
-                    AZ_Assert(parentReadRequest->m_allocator,
-                        "The read request was issued without a memory allocator or valid output address.");
-                    u64 recommendedSize = size;
-                    if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
-                    {
-                        recommendedSize = m_recommendations.CalculateRecommendedMemorySize(size, parentReadRequest->m_offset);
-                    }
-                    IStreamerTypes::RequestMemoryAllocatorResult allocation =
-                        parentReadRequest->m_allocator->Allocate(size, recommendedSize, m_recommendations.m_memoryAlignment);
-                    if (allocation.m_address == nullptr || allocation.m_size < parentReadRequest->m_size)
-                    {
-                        next->SetStatus(IStreamerTypes::RequestStatus::Failed);
-                        m_context.MarkRequestAsCompleted(next);
-                        return;
-                    }
-                    parentReadRequest->m_output = allocation.m_address;
-                    parentReadRequest->m_outputSize = allocation.m_size;
-                    parentReadRequest->m_memoryType = allocation.m_type;
-                    if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+                    relativePath = parentReadRequest->m_path.GetRelativePath();
+                    size_t size = parentReadRequest->m_size;
+                    if (parentReadRequest->m_output == nullptr)
                     {
-                        args.m_output = parentReadRequest->m_output;
-                        args.m_outputSize = allocation.m_size;
-                    }
-                    else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
-                    {
-                        args.m_output = parentReadRequest->m_output;
+                        AZ_Assert(parentReadRequest->m_allocator,
+                            "The read request was issued without a memory allocator or valid output address.");
+                        u64 recommendedSize = size;
+                        if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+                        {
+                            recommendedSize = m_recommendations.CalculateRecommendedMemorySize(size, parentReadRequest->m_offset);
+                        }
+                        IStreamerTypes::RequestMemoryAllocatorResult allocation =
+                            parentReadRequest->m_allocator->Allocate(size, recommendedSize, m_recommendations.m_memoryAlignment);
+                        if (allocation.m_address == nullptr || allocation.m_size < parentReadRequest->m_size)
+                        {
+                            next->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                            m_context.MarkRequestAsCompleted(next);
+                            return;
+                        }
+                        parentReadRequest->m_output = allocation.m_address;
+                        parentReadRequest->m_outputSize = allocation.m_size;
+                        parentReadRequest->m_memoryType = allocation.m_type;
+                        if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+                        {
+                            args.m_output = parentReadRequest->m_output;
+                            args.m_outputSize = allocation.m_size;
+                        }
+                        else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+                        {
+                            args.m_output = parentReadRequest->m_output;
+                        }
                     }
                 }
+                else
+                {
+                    // Reads for individual ranges of a ranges request always have an output buffer provided by the caller.
+                    auto parentRangesRequest = next->GetCommandFromChain<FileRequest::ReadRangesRequestData>();
+                    AZ_Assert(parentRangesRequest != nullptr, "The issued read request can't be found for the (compressed) read command.");
+                    relativePath = parentRangesRequest->m_path.GetRelativePath();
+                }
 
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                 if (m_processingSize == 0)
@@ -280,7 +317,26 @@ namespace AZ::IO
 #endif
                 }
                 AZ_PROFILE_INTERVAL_START_COLORED(AZ::Debug::ProfileCategory::AzCore, next, ProfilerColor,
-                    "Streamer queued %zu: %s", next->GetCommand().index(), parentReadRequest->m_path.GetRelativePath());
+                    "Streamer queued %zu: %s", next->GetCommand().index(), relativePath);
+                m_threadData.m_streamStack->QueueRequest(next);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
+            {
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+                if (m_processingSize == 0)
+                {
+                    m_processingStartTime = AZStd::chrono::system_clock::now();
+                }
+                m_processingSize += args.GetTotalSize();
+#endif
+                m_threadData.m_lastFilePath = args.m_path;
+                m_threadData.m_lastFileOffset = args.GetEndOffset();
+
+                auto parentRangesRequest = next->GetCommandFromChain<FileRequest::ReadRangesRequestData>();
+                AZ_Assert(parentRangesRequest != nullptr, "The issued ranges request can't be found for the read ranges command.");
+                AZ_PROFILE_INTERVAL_START_COLORED(AZ::Debug::ProfileCategory::AzCore, next, ProfilerColor,
+                    "Streamer queued %zu: %s (%zu ranges)", next->GetCommand().index(), parentRangesRequest->m_path.GetRelativePath(),
+                    args.m_numRanges);
                 m_threadData.m_streamStack->QueueRequest(next);
             }
             else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
@@ -349,6 +405,19 @@ namespace AZ::IO
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                 m_immediateReadsPercentageStat.PushSample(args.m_deadline <= now ? 1.0 : 0.0);
                 Statistic::PlotImmediate(SchedulerName, ImmediateReadsName, m_immediateReadsPercentageStat.GetMostRecentSample());
+#endif
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesRequestData>)
+            {
+                // Order the ranges by offset so the stack entries can read adjacent ranges with a single vectored read.
+                AZStd::sort(args.m_ranges.begin(), args.m_ranges.end(),
+                    [](const IStreamerTypes::ReadRange& lhs, const IStreamerTypes::ReadRange& rhs)
+                    {
+                        return lhs.m_offset < rhs.m_offset;
+                    });
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+                m_immediateReadsPercentageStat.PushSample(args.m_deadline <= now ? 1.0 : 0.0);
+                Statistic::PlotImmediate(SchedulerName, ImmediateReadsName, m_immediateReadsPercentageStat.GetMostRecentSample());
 #endif
             }
         };
@@ -425,6 +494,11 @@ namespace AZ::IO
                     readRequest->m_deadline = data.m_newDeadline;
                     readRequest->m_priority = data.m_newPriority;
                 }
+                else if (auto rangesRequest = pending->GetCommandFromChain<FileRequest::ReadRangesRequestData>(); rangesRequest)
+                {
+                    rangesRequest->m_deadline = data.m_newDeadline;
+                    rangesRequest->m_priority = data.m_newPriority;
+                }
                 // Nothing more needs to happen as the request will be rescheduled in the next full pass in the main loop or
                 // it's going to be one of the next requests to be picked up, in which case the time between the reschedule
                 // request and read being processed that this similar to the reschedule being too late.
@@ -458,29 +532,28 @@ namespace AZ::IO
 
         // Order is the same for both requests, so prioritize the request that are at risk of missing
         // it's deadline.
-        const FileRequest::ReadRequestData* firstRead = first->GetCommandFromChain<FileRequest::ReadRequestData>();
-        const FileRequest::ReadRequestData* secondRead = second->GetCommandFromChain<FileRequest::ReadRequestData>();
-
-        if (firstRead == nullptr || secondRead == nullptr)
+        SchedulerInternal::ReadScheduleInfo firstRead;
+        SchedulerInternal::ReadScheduleInfo secondRead;
+        if (!SchedulerInternal::GetReadScheduleInfo(firstRead, first) || !SchedulerInternal::GetReadScheduleInfo(secondRead, second))
         {
             // One of the two requests or both don't have information for scheduling so leave them
             // in the same order.
             return Order::Equal;
         }
 
-        bool firstInPanic = first->GetEstimatedCompletion() > firstRead->m_deadline;
-        bool secondInPanic = second->GetEstimatedCompletion() > secondRead->m_deadline;
+        bool firstInPanic = first->GetEstimatedCompletion() > firstRead.m_deadline;
+        bool secondInPanic = second->GetEstimatedCompletion() > secondRead.m_deadline;
         // Both request are at risk of not completing before their deadline.
         if (firstInPanic && secondInPanic)
         {
             // Let the one with the highest priority go first.
-            if (firstRead->m_priority != secondRead->m_priority)
+            if (firstRead.m_priority != secondRead.m_priority)
             {
-                return firstRead->m_priority < secondRead->m_priority ? Order::FirstRequest : Order::SecondRequest;
+                return firstRead.m_priority < secondRead.m_priority ? Order::FirstRequest : Order::SecondRequest;
             }
 
             // If neither has started and have the same priority, prefer to start the closest deadline.
-            return firstRead->m_deadline <= secondRead->m_deadline ? Order::FirstRequest : Order::SecondRequest;
+            return firstRead.m_deadline <= secondRead.m_deadline ? Order::FirstRequest : Order::SecondRequest;
         }
 
         // Check if one of the requests is in panic and prefer to prioritize that request
@@ -491,7 +564,7 @@ namespace AZ::IO
         auto sameFile = [this](auto&& args)
         {
             using Command = AZStd::decay_t<decltype(args)>;
-            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> || AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
             {
                 return m_threadData.m_lastFilePath == args.m_path;
             }
@@ -516,6 +589,10 @@ namespace AZ::IO
                 {
                     return aznumeric_caster(args.m_offset);
                 }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
+                {
+                    return aznumeric_caster(args.GetStartOffset());
+                }
                 else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
                 {
                     return aznumeric_caster(args.m_compressionInfo.m_offset);
@@ -42,6 +42,7 @@ namespace AZ
 
         StorageDrive::StorageDrive(u32 maxFileHandles)
             : StreamStackEntry("Storage drive (generic)")
+            , m_mappedFiles(s_maxMappedFiles)
         {
             m_fileLastUsed.resize(maxFileHandles, AZStd::chrono::system_clock::time_point::min());
             m_filePaths.resize(maxFileHandles);
@@ -72,6 +73,24 @@ namespace AZ
                 m_context->PushPreparedRequest(read);
                 return;
             }
+            else if (AZStd::holds_alternative<FileRequest::ReadRangesRequestData>(request->GetCommand()))
+            {
+                auto& rangesRequest = AZStd::get<FileRequest::ReadRangesRequestData>(request->GetCommand());
+
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateReadRanges(request, rangesRequest.m_path, rangesRequest.m_ranges.data(), rangesRequest.m_ranges.size());
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+            else if (AZStd::holds_alternative<FileRequest::MapFileRequestData>(request->GetCommand()))
+            {
+                auto& mapRequest = AZStd::get<FileRequest::MapFileRequestData>(request->GetCommand());
+
+                FileRequest* mapFile = m_context->GetNewInternalRequest();
+                mapFile->CreateMapFile(request, mapRequest.m_path, &mapRequest.m_view, mapRequest.m_offset, mapRequest.m_size);
+                m_context->PushPreparedRequest(mapFile);
+                return;
+            }
             StreamStackEntry::PrepareRequest(request);
         }
 
@@ -82,6 +101,8 @@ namespace AZ
             {
                 using Command = AZStd::decay_t<decltype(args)>;
                 if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                    AZStd::is_same_v<Command, FileRequest::ReadRangesData> ||
+                    AZStd::is_same_v<Command, FileRequest::MapFileData> ||
                     AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
                     AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
                 {
@@ -124,6 +145,14 @@ namespace AZ
                     {
                         ReadFile(request);
                     }
+                    else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
+                    {
+                        ReadRanges(request);
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, FileRequest::MapFileData>)
+                    {
+                        MapFile(request);
+                    }
                     else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
                     {
                         FileExistsRequest(request);
@@ -207,6 +236,12 @@ namespace AZ
                     readSize = args.m_size;
                     offset = args.m_offset;
                 }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
+                {
+                    targetFile = &args.m_path;
+                    readSize = args.GetTotalSize();
+                    offset = args.GetStartOffset();
+                }
                 else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
                 {
                     targetFile = &args.m_compressionInfo.m_archiveFilename;
@@ -252,56 +287,61 @@ namespace AZ
             request->SetEstimatedCompletion(startTime);
         }
 
-        void StorageDrive::ReadFile(FileRequest* request)
+        SystemFile* StorageDrive::OpenFile(size_t& cacheIndex, const RequestPath& filePath)
         {
-            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
-
-            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
-            AZ_Assert(data, "FileRequest queued on StorageDrive to be read didn't contain read data.");
-            
-            SystemFile* file = nullptr;
-
             // If the file is already open, use that file handle and update it's last touched time.
-            size_t cacheIndex = FindFileInCache(data->m_path);
+            cacheIndex = FindFileInCache(filePath);
             if (cacheIndex != s_fileNotFound)
             {
-                file = m_fileHandles[cacheIndex].get();
                 m_fileLastUsed[cacheIndex] = AZStd::chrono::high_resolution_clock::now();
+                return m_fileHandles[cacheIndex].get();
             }
-            
+
             // If the file is not open, eject the entry from the cache that hasn't been used for the longest time 
             // and open the file for reading.
-            if (!file)
+            AZStd::chrono::system_clock::time_point oldest = m_fileLastUsed[0];
+            cacheIndex = 0;
+            size_t numFiles = m_filePaths.size();
+            for (size_t i = 1; i < numFiles; ++i)
             {
-                AZStd::chrono::system_clock::time_point oldest = m_fileLastUsed[0];
-                cacheIndex = 0;
-                size_t numFiles = m_filePaths.size();
-                for (size_t i = 1; i < numFiles; ++i)
+                if (m_fileLastUsed[i] < oldest)
                 {
-                    if (m_fileLastUsed[i] < oldest)
-                    {
-                        oldest = m_fileLastUsed[i];
-                        cacheIndex = i;
-                    }
-                }
-
-                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
-                AZStd::unique_ptr<SystemFile> newFile = AZStd::make_unique<SystemFile>();
-                bool isOpen = newFile->Open(data->m_path.GetAbsolutePath(), SystemFile::OpenMode::SF_OPEN_READ_ONLY);
-                if (!isOpen)
-                {
-                    request->SetStatus(IStreamerTypes::RequestStatus::Failed);
-                    m_context->MarkRequestAsCompleted(request);
-                    return;
+                    oldest = m_fileLastUsed[i];
+                    cacheIndex = i;
                 }
+            }
 
-                file = newFile.get();
-                m_fileLastUsed[cacheIndex] = AZStd::chrono::high_resolution_clock::now();
-                m_fileHandles[cacheIndex] = AZStd::move(newFile);
-                m_filePaths[cacheIndex] = data->m_path;
+            TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+            AZStd::unique_ptr<SystemFile> newFile = AZStd::make_unique<SystemFile>();
+            bool isOpen = newFile->Open(filePath.GetAbsolutePath(), SystemFile::OpenMode::SF_OPEN_READ_ONLY);
+            if (!isOpen)
+            {
+                return nullptr;
             }
+
+            SystemFile* file = newFile.get();
+            m_fileLastUsed[cacheIndex] = AZStd::chrono::high_resolution_clock::now();
+            m_fileHandles[cacheIndex] = AZStd::move(newFile);
+            m_filePaths[cacheIndex] = filePath;
+            return file;
+        }
+
+        void StorageDrive::ReadFile(FileRequest* request)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            AZ_Assert(data, "FileRequest queued on StorageDrive to be read didn't contain read data.");
             
-            AZ_Assert(file, "While searching for file '%s' StorageDevice::ReadFile failed to detect a problem.", data->m_path.GetRelativePath());
+            size_t cacheIndex = s_fileNotFound;
+            SystemFile* file = OpenFile(cacheIndex, data->m_path);
+            if (!file)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+                return;
+            }
+
             u64 bytesRead = 0;
             {
                 TIMED_AVERAGE_WINDOW_SCOPE(m_readTimeAverage);
@@ -320,6 +360,84 @@ namespace AZ
             m_context->MarkRequestAsCompleted(request);
         }
 
+        void StorageDrive::ReadRanges(FileRequest* request)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            auto data = AZStd::get_if<FileRequest::ReadRangesData>(&request->GetCommand());
+            AZ_Assert(data, "FileRequest queued on StorageDrive to be read didn't contain read ranges data.");
+
+            size_t cacheIndex = s_fileNotFound;
+            SystemFile* file = OpenFile(cacheIndex, data->m_path);
+            if (!file)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+                return;
+            }
+            m_activeCacheSlot = cacheIndex;
+
+            // The ranges have been sorted by offset by the scheduler. Ranges that are adjacent or only separated by a small gap
+            // are combined into a single vectored read. The data in the gaps is read into a scratch buffer and discarded, which
+            // is cheaper than issuing another read. Overlapping ranges start a new read.
+            bool success = true;
+            size_t rangeIndex = 0;
+            while (success && rangeIndex < data->m_numRanges)
+            {
+                m_readVectors.clear();
+                const u64 readStart = data->m_baseOffset + data->m_ranges[rangeIndex].m_offset;
+                u64 readEnd = readStart;
+                size_t numRangesInRead = 0;
+                for (; rangeIndex < data->m_numRanges; ++rangeIndex)
+                {
+                    const IStreamerTypes::ReadRange& range = data->m_ranges[rangeIndex];
+                    const u64 rangeStart = data->m_baseOffset + range.m_offset;
+                    if (numRangesInRead > 0)
+                    {
+                        if (rangeStart < readEnd || rangeStart - readEnd > s_maxCoalescedGap)
+                        {
+                            break;
+                        }
+                        if (rangeStart > readEnd)
+                        {
+                            if (m_gapBuffer.empty())
+                            {
+                                m_gapBuffer.resize_no_construct(s_maxCoalescedGap);
+                            }
+                            m_readVectors.push_back(SystemFile::ReadVector{ m_gapBuffer.data(), rangeStart - readEnd });
+                        }
+                    }
+                    m_readVectors.push_back(SystemFile::ReadVector{ range.m_output, range.m_size });
+                    readEnd = rangeStart + range.m_size;
+                    numRangesInRead++;
+                }
+
+                u64 bytesRead = 0;
+                {
+                    TIMED_AVERAGE_WINDOW_SCOPE(m_readTimeAverage);
+                    bytesRead = file->ReadVectored(readStart, m_readVectors.data(), m_readVectors.size());
+                }
+                m_readSizeAverage.PushEntry(bytesRead);
+                m_rangesPerReadAverage.PushEntry(numRangesInRead);
+                m_activeOffset = readStart + bytesRead;
+
+                success = bytesRead == readEnd - readStart;
+            }
+
+            request->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void StorageDrive::MapFile(FileRequest* request)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            auto& data = AZStd::get<FileRequest::MapFileData>(request->GetCommand());
+            *data.m_output = m_mappedFiles.CreateView(data.m_path.GetAbsolutePath(), data.m_offset, data.m_size);
+            request->SetStatus(data.m_output->IsValid() ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
         void StorageDrive::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
         {
             for (auto it = m_pendingRequests.begin(); it != m_pendingRequests.end();)
@@ -401,6 +519,7 @@ namespace AZ
                 m_fileHandles[cacheIndex].reset();
                 m_filePaths[cacheIndex].Clear();
             }
+            m_mappedFiles.Flush(filePath.GetAbsolutePath());
         }
 
         void StorageDrive::FlushEntireCache()
@@ -412,6 +531,7 @@ namespace AZ
                 m_fileHandles[i].reset();
                 m_filePaths[i].Clear();
             }
+            m_mappedFiles.FlushAll();
         }
 
         size_t StorageDrive::FindFileInCache(const RequestPath& filePath) const
@@ -446,6 +566,10 @@ namespace AZ
                 statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataTimeAverage.CalculateAverage().count()));
                 statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", s64{ s_maxRequests } - m_pendingRequests.size()));
             }
+            if (m_rangesPerReadAverage.GetNumRecorded() > 0)
+            {
+                statistics.push_back(Statistic::CreateFloat(m_name, "Ranges per read (avg.)", m_rangesPerReadAverage.CalculateAverage()));
+            }
         }
 
         void StorageDrive::Report(const FileRequest::ReportData& data) const
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/IO/MemoryMappedFile.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
@@ -62,9 +63,17 @@ namespace AZ
         protected:
             static const AZStd::chrono::microseconds s_averageSeekTime;
             static constexpr s32 s_maxRequests = 1;
+            //! The largest gap between two ranges of a ranges request that will be read and discarded to
+            //! combine the ranges into a single read.
+            static constexpr u64 s_maxCoalescedGap = 16 * 1024;
+            //! The maximum number of files that are kept mapped for map file requests.
+            static constexpr size_t s_maxMappedFiles = 16;
 
             size_t FindFileInCache(const RequestPath& filePath) const;
+            SystemFile* OpenFile(size_t& cacheIndex, const RequestPath& filePath);
             void ReadFile(FileRequest* request);
+            void ReadRanges(FileRequest* request);
+            void MapFile(FileRequest* request);
             void CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
             void FileExistsRequest(FileRequest* request);
             void FileMetaDataRetrievalRequest(FileRequest* request);
@@ -81,6 +90,7 @@ namespace AZ
             TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataTimeAverage;
             TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
             AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+            AverageWindow<u64, float, s_statisticsWindowSize> m_rangesPerReadAverage;
             //! File requests that are queued for processing.
             AZStd::deque<FileRequest*> m_pendingRequests;
 
@@ -91,6 +101,14 @@ namespace AZ
             //! A list of file handles that's being cached in case they're needed again in the future.
             AZStd::vector<AZStd::unique_ptr<SystemFile>> m_fileHandles;
 
+            //! Scratch list of buffers for a single vectored read.
+            AZStd::vector<SystemFile::ReadVector> m_readVectors;
+            //! Buffer that receives the data in the gaps between coalesced ranges. The data is discarded.
+            AZStd::vector<u8> m_gapBuffer;
+
+            //! Files that have been mapped for map file requests.
+            MemoryMappedFileCache m_mappedFiles;
+
             //! The offset into the file that's cached by the active cache slot.
             u64 m_activeOffset = 0;
             //! The index into m_fileHandles for the file that's currently being read.
@@ -55,6 +55,41 @@ namespace AZ::IO
         return request;
     }
 
+    FileRequestPtr Streamer::ReadRanges(AZStd::string_view relativePath, AZStd::vector<IStreamerTypes::ReadRange> ranges,
+        AZStd::chrono::microseconds deadline, IStreamerTypes::Priority priority)
+    {
+        FileRequestPtr result = CreateRequest();
+        ReadRanges(result, relativePath, AZStd::move(ranges), deadline, priority);
+        return result;
+    }
+
+    FileRequestPtr& Streamer::ReadRanges(FileRequestPtr& request, AZStd::string_view relativePath,
+        AZStd::vector<IStreamerTypes::ReadRange> ranges, AZStd::chrono::microseconds deadline, IStreamerTypes::Priority priority)
+    {
+        RequestPath path;
+        path.InitFromRelativePath(relativePath);
+        AZStd::chrono::system_clock::time_point deadlineTimePoint = (deadline == IStreamerTypes::s_noDeadline)
+            ? FileRequest::s_noDeadlineTime
+            : AZStd::chrono::system_clock::now() + deadline;
+        request->m_request.CreateReadRangesRequest(AZStd::move(path), AZStd::move(ranges), deadlineTimePoint, priority);
+        return request;
+    }
+
+    FileRequestPtr Streamer::MapFile(AZStd::string_view relativePath, u64 offset, u64 size)
+    {
+        FileRequestPtr result = CreateRequest();
+        MapFile(result, relativePath, offset, size);
+        return result;
+    }
+
+    FileRequestPtr& Streamer::MapFile(FileRequestPtr& request, AZStd::string_view relativePath, u64 offset, u64 size)
+    {
+        RequestPath path;
+        path.InitFromRelativePath(relativePath);
+        request->m_request.CreateMapFileRequest(AZStd::move(path), offset, size);
+        return request;
+    }
+
     FileRequestPtr Streamer::Cancel(FileRequestPtr target)
     {
         FileRequestPtr result = CreateRequest();
@@ -224,6 +259,18 @@ namespace AZ::IO
             }
             return true;
         }
+        else if (auto readRangesRequest = AZStd::get_if<FileRequest::ReadRangesRequestData>(&request.m_request->GetCommand());
+            readRangesRequest != nullptr)
+        {
+            AZ_Assert(claimMemory == IStreamerTypes::ClaimMemory::No, "Read ranges requests don't own their memory, so it can't be claimed.");
+            buffer = readRangesRequest->m_firstOutput;
+            numBytesRead = 0;
+            for (const IStreamerTypes::ReadRange& range : readRangesRequest->m_ranges)
+            {
+                numBytesRead += range.m_size;
+            }
+            return true;
+        }
         else
         {
             AZ_Assert(false, "Provided file request did not contain read information");
@@ -233,6 +280,23 @@ namespace AZ::IO
         }
     }
 
+    bool Streamer::GetMapFileRequestResult(FileRequestHandle request, MappedView& view) const
+    {
+        AZ_Assert(request.m_request, "The request handle provided to Streamer::GetMapFileRequestResult is invalid.");
+        auto mapRequest = AZStd::get_if<FileRequest::MapFileRequestData>(&request.m_request->GetCommand());
+        if (mapRequest != nullptr)
+        {
+            view = mapRequest->m_view;
+            return view.IsValid();
+        }
+        else
+        {
+            AZ_Assert(false, "Provided file request did not contain map file information");
+            view.Reset();
+            return false;
+        }
+    }
+
     void Streamer::CollectStatistics(AZStd::vector<Statistic>& statistics)
     {
         m_streamStack->CollectStatistics(statistics);
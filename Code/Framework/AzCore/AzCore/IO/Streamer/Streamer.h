@@ -59,6 +59,21 @@ namespace AZ::IO
             size_t size, AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
             IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium, size_t offset = 0) override;
 
+        //! Creates a request to read multiple ranges from a single file.
+        FileRequestPtr ReadRanges(AZStd::string_view relativePath, AZStd::vector<IStreamerTypes::ReadRange> ranges,
+            AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
+            IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium) override;
+
+        //! Sets a request to the read ranges command.
+        FileRequestPtr& ReadRanges(FileRequestPtr& request, AZStd::string_view relativePath,
+            AZStd::vector<IStreamerTypes::ReadRange> ranges, AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
+            IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium) override;
+
+        //! Creates a request to map a file into memory and return a read-only view of it.
+        FileRequestPtr MapFile(AZStd::string_view relativePath, u64 offset = 0, u64 size = 0) override;
+
+        //! Sets a request to the map file command.
+        FileRequestPtr& MapFile(FileRequestPtr& request, AZStd::string_view relativePath, u64 offset = 0, u64 size = 0) override;
 
         //! Creates a request to cancel a previously queued request.
         FileRequestPtr Cancel(FileRequestPtr target) override;
@@ -160,6 +175,9 @@ namespace AZ::IO
         bool GetReadRequestResult(FileRequestHandle request, void*& buffer, u64& numBytesRead,
             IStreamerTypes::ClaimMemory claimMemory = IStreamerTypes::ClaimMemory::No) const override;
 
+        //! Gets the result for map file requests.
+        bool GetMapFileRequestResult(FileRequestHandle request, MappedView& view) const override;
+
         //
         // General Streamer functions
         //
@@ -14,6 +14,7 @@
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
+#include <AzCore/IO/Streamer/PrefetchCache.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
@@ -194,6 +195,7 @@ namespace AZ
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
+        PrefetchCacheConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
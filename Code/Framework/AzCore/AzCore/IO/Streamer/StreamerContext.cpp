@@ -209,6 +209,11 @@ namespace AZ
                         m_missedDeadlinePercentageStat.PushSample(now < readRequest->m_deadline ? 0.0 : 1.0);
                         Statistic::PlotImmediate(ContextName, MissedDeadlinesName, m_missedDeadlinePercentageStat.GetMostRecentSample());
                     }
+                    else if (auto rangesRequest = AZStd::get_if<FileRequest::ReadRangesRequestData>(&top->GetCommand()); rangesRequest)
+                    {
+                        m_missedDeadlinePercentageStat.PushSample(now < rangesRequest->m_deadline ? 0.0 : 1.0);
+                        Statistic::PlotImmediate(ContextName, MissedDeadlinesName, m_missedDeadlinePercentageStat.GetMostRecentSample());
+                    }
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
                     // Get all information before calling the completion routine as it's technically possible that an external
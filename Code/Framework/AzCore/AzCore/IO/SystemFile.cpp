@@ -31,6 +31,8 @@ namespace Platform
     bool Eof(FileHandleType handle, const SystemFile* systemFile);
     AZ::u64 ModificationTime(FileHandleType handle, const SystemFile* systemFile);
     SystemFile::SizeType Read(FileHandleType handle, const SystemFile* systemFile, SizeType byteSize, void* buffer);
+    SystemFile::SizeType ReadVectored(FileHandleType handle, const SystemFile* systemFile, SizeType offset,
+        const SystemFile::ReadVector* buffers, size_t numBuffers);
     SystemFile::SizeType Write(FileHandleType handle, const SystemFile* systemFile, const void* buffer, SizeType byteSize);
     void Flush(FileHandleType handle, const SystemFile* systemFile );
     SystemFile::SizeType Length(FileHandleType handle, const SystemFile* systemFile);
@@ -205,6 +207,31 @@ SystemFile::SizeType SystemFile::Read(SizeType byteSize, void* buffer)
     return Platform::Read(m_handle, this, byteSize, buffer);
 }
 
+SystemFile::SizeType SystemFile::ReadVectored(SizeType offset, const ReadVector* buffers, size_t numBuffers)
+{
+    AZ_PROFILE_INTERVAL_SCOPED(AZ::Debug::ProfileCategory::AzCore, this, "SystemFile::ReadVectored - %s:%i", m_fileName.c_str(), numBuffers);
+    AZ_PROFILE_SCOPE_STALL_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "SystemFile::ReadVectored - %s:%i", m_fileName.c_str(), numBuffers);
+
+    if (FileIOBus::HasHandlers())
+    {
+        // Read the buffers one by one so the file IO handlers get to see every read.
+        Seek(offset, SF_SEEK_BEGIN);
+        SizeType totalRead = 0;
+        for (size_t i = 0; i < numBuffers; ++i)
+        {
+            SizeType numRead = Read(buffers[i].m_size, buffers[i].m_buffer);
+            totalRead += numRead;
+            if (numRead != buffers[i].m_size)
+            {
+                break;
+            }
+        }
+        return totalRead;
+    }
+
+    return Platform::ReadVectored(m_handle, this, offset, buffers, numBuffers);
+}
+
 SystemFile::SizeType SystemFile::Write(const void* buffer, SizeType byteSize)
 {
     AZ_PROFILE_INTERVAL_SCOPED(AZ::Debug::ProfileCategory::AzCore, this, "SystemFile::Write - %s:%i", m_fileName.c_str(), byteSize);
@@ -51,6 +51,13 @@ namespace AZ
             using SeekSizeType = AZ::IO::Internal::SeekSizeType;
             using FileHandleType = AZ::IO::Internal::FileHandleType;
 
+            //! Destination of one part of a vectored read.
+            struct ReadVector
+            {
+                void* m_buffer;
+                SizeType m_size;
+            };
+
             SystemFile();
             ~SystemFile();
 
@@ -79,6 +86,13 @@ namespace AZ
             AZ::u64 ModificationTime();
             /// Read data from a file synchronous. Return number of bytes actually read in the buffer.
             SizeType Read(SizeType byteSize, void* buffer);
+            /**
+             * Reads consecutive data starting at offset into multiple buffers, filling each buffer completely before
+             * moving on to the next. Where the platform supports it this is done with a single vectored read (preadv).
+             * The position of the file cursor is undefined afterwards.
+             * \return number of bytes actually read into the buffers.
+             */
+            SizeType ReadVectored(SizeType offset, const ReadVector* buffers, size_t numBuffers);
             /// Writes data to a file synchronous. Return number of bytes actually written to the file.
             SizeType Write(const void* buffer, SizeType byteSize);
             /// Flush the contents of the file buffers to disk.
@@ -10,6 +10,7 @@
 
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/Internal/JobNotify.h>
+#include <AzCore/Jobs/Internal/ProcessorTopology.h>
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
@@ -31,29 +32,94 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
 
 void WorkQueue::LocalInsert(Job* job)
 {
+    if (job->GetPriority() == 0)
+    {
+        m_defaultPriorityJobs.PushBottom(job);
+        return;
+    }
+
     LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
+    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_prioritizedJobs.begin(),
+                                                                                   m_prioritizedJobs.end(),
                                                                                    job->GetPriority(),
                                                                                    CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    m_prioritizedJobs.insert(locationToinsert, job);
+    m_numPrioritizedJobs.fetch_add(1, AZStd::memory_order_release);
 }
 
 Job* WorkQueue::LocalPopFront()
+{
+    if (m_numPrioritizedJobs.load(AZStd::memory_order_acquire) > 0)
+    {
+        if (Job* job = PopPrioritized(true))
+        {
+            return job;
+        }
+    }
+
+    // Taking from the top can fail while the deque isn't empty if a thief takes the same job, so retry
+    while (!m_defaultPriorityJobs.IsEmpty())
+    {
+        if (Job* job = m_defaultPriorityJobs.StealTop())
+        {
+            return job;
+        }
+    }
+
+    if (m_numPrioritizedJobs.load(AZStd::memory_order_acquire) > 0)
+    {
+        return PopPrioritized(false);
+    }
+
+    return nullptr;
+}
+
+Job* WorkQueue::TryStealFront()
+{
+    if (m_numPrioritizedJobs.load(AZStd::memory_order_acquire) > 0)
+    {
+        if (Job* job = TryStealPrioritized(true))
+        {
+            return job;
+        }
+    }
+
+    AZStd::exponential_backoff backoff;
+    for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps && !m_defaultPriorityJobs.IsEmpty(); ++attempCount)
+    {
+        // Do a bounded spin with backoff, failing only means another thread took the job we were after
+        if (Job* job = m_defaultPriorityJobs.StealTop())
+        {
+            return job;
+        }
+
+        backoff.wait();
+    }
+
+    if (m_numPrioritizedJobs.load(AZStd::memory_order_acquire) > 0)
+    {
+        return TryStealPrioritized(false);
+    }
+
+    return nullptr;
+}
+
+Job* WorkQueue::PopPrioritized(bool higherThanDefault)
 {
     LockGuard lock(m_lock);
 
     Job* result = nullptr;
-    if (!m_queue.empty())
+    if (!m_prioritizedJobs.empty() && (!higherThanDefault || m_prioritizedJobs.front()->GetPriority() > 0))
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        result = m_prioritizedJobs.front();
+        m_prioritizedJobs.pop_front();
+        m_numPrioritizedJobs.fetch_sub(1, AZStd::memory_order_release);
     }
 
     return result;
 }
 
-Job* WorkQueue::TryStealFront()
+Job* WorkQueue::TryStealPrioritized(bool higherThanDefault)
 {
     AZStd::exponential_backoff backoff;
     for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
@@ -62,10 +128,11 @@ Job* WorkQueue::TryStealFront()
         if (m_lock.try_lock())
         {
             Job* result = nullptr;
-            if (!m_queue.empty())
+            if (!m_prioritizedJobs.empty() && (!higherThanDefault || m_prioritizedJobs.front()->GetPriority() > 0))
             {
-                result = m_queue.front();
-                m_queue.pop_front();
+                result = m_prioritizedJobs.front();
+                m_prioritizedJobs.pop_front();
+                m_numPrioritizedJobs.fetch_sub(1, AZStd::memory_order_release);
             }
 
             m_lock.unlock();
@@ -85,6 +152,14 @@ JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_workerThreads)))
 {
+    //topology aware stealing and waking is only useful when workers can run in more than one domain
+    m_processorDomains = GetProcessorTopologyDomains();
+    if (AZStd::find_if(m_processorDomains.begin(), m_processorDomains.end(),
+        [this](AZ::u32 domain) { return domain != m_processorDomains.front(); }) == m_processorDomains.end())
+    {
+        m_processorDomains.clear();
+    }
+
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
     m_initSemaphore.release(static_cast<unsigned int>(desc.m_workerThreads.size()));
 }
@@ -150,7 +225,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
         ++info->m_jobsForked;
 #endif
         // if there are threads asleep wake one up
-        ActivateWorker();
+        ActivateWorker(info);
     }
     else
     {
@@ -165,7 +240,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
             m_globalJobQueue.insert(locationToinsert, job);
 
             //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
-            ActivateWorker();
+            ActivateWorker(info);
         }
         else
         {
@@ -305,6 +380,7 @@ void JobManagerWorkStealing::ProcessJobsWorker(ThreadInfo* info)
 
     //setup thread-local storage
     m_currentThreadInfo = info;
+    UpdateTopologyDomain(info);
 
     ProcessJobsInternal(info, NULL, NULL);
 
@@ -315,6 +391,7 @@ void JobManagerWorkStealing::ProcessJobsAssist(ThreadInfo* info, Job* suspendedJ
 {
     ThreadInfo* oldInfo = m_currentThreadInfo;
     m_currentThreadInfo = info;
+    UpdateTopologyDomain(info);
 
     ProcessJobsInternal(info, suspendedJob, notifyFlag);
 
@@ -373,6 +450,9 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     info->m_waitEvent.acquire();
                     AZ_PROFILE_INTERVAL_END(AZ::Debug::ProfileCategory::JobManagerDetailed, info);
 
+                    //the OS may have moved the thread while it was asleep
+                    UpdateTopologyDomain(info);
+
                     if (m_quitRequested)
                     {
                         return;
@@ -437,7 +517,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     if (job)
                     {
                         // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
-                        ActivateWorker();
+                        ActivateWorker(info);
                     }
                 }
                 else
@@ -461,6 +541,16 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
                 unsigned int numStealAttempts = 0;
                 const unsigned int maxStealAttempts = (unsigned int)m_workerThreads.size() * 3; //try every thread a few times before giving up
+
+                //when workers are spread over multiple sockets/caches, spend the first attempts on workers sharing our domain,
+                //stealing from them is cheaper as the jobs and their data are more likely to be in a shared cache
+                const unsigned int maxSameDomainStealAttempts = m_processorDomains.empty() ? 0 : (unsigned int)m_workerThreads.size();
+                if (maxSameDomainStealAttempts > 0 &&
+                    m_workerThreads[victim]->m_topologyDomain.load(AZStd::memory_order_relaxed) != info->m_topologyDomain.load(AZStd::memory_order_relaxed))
+                {
+                    victim = SelectNextVictim(info, victim, true);
+                }
+
                 while (!job)
                 {
                     //check if our suspended job is ready, before we try stealing a new job
@@ -500,12 +590,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     }
 
                     //steal failed, choose a new victim for next time
-                    victim = (victim + 1) % m_workerThreads.size();
-                    if (m_workerThreads[victim] == info)
-                    {
-                        //don't steal from ourselves
-                        victim = (victim + 1) % m_workerThreads.size();
-                    }
+                    victim = SelectNextVictim(info, victim, numStealAttempts < maxSameDomainStealAttempts);
                 }
             }
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -660,25 +745,73 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     return workerThreads;
 }
 
-inline void JobManagerWorkStealing::ActivateWorker()
+unsigned int JobManagerWorkStealing::SelectNextVictim(const ThreadInfo* info, unsigned int victim, bool sameDomainOnly) const
+{
+    const unsigned int numWorkers = static_cast<unsigned int>(m_workerThreads.size());
+    const AZ::u32 domain = info->m_topologyDomain.load(AZStd::memory_order_relaxed);
+    for (unsigned int i = 0; i < numWorkers; ++i)
+    {
+        victim = (victim + 1) % numWorkers;
+        const ThreadInfo* victimInfo = m_workerThreads[victim];
+
+        //don't steal from ourselves
+        if (victimInfo != info &&
+            (!sameDomainOnly || victimInfo->m_topologyDomain.load(AZStd::memory_order_relaxed) == domain))
+        {
+            return victim;
+        }
+    }
+
+    //nobody else shares our domain, keep the current victim
+    return victim;
+}
+
+void JobManagerWorkStealing::UpdateTopologyDomain(ThreadInfo* info) const
+{
+    if (!m_processorDomains.empty())
+    {
+        const int processor = GetCurrentProcessorIndex();
+        if (processor >= 0 && static_cast<size_t>(processor) < m_processorDomains.size())
+        {
+            info->m_topologyDomain.store(m_processorDomains[processor], AZStd::memory_order_relaxed);
+        }
+    }
+}
+
+inline void JobManagerWorkStealing::ActivateWorker(const ThreadInfo* activatingThread)
 {
+    //start looking after the activating worker so wake ups are spread over all workers instead of always waking the first ones,
+    //and when workers are spread over multiple domains prefer waking one sharing the activating thread's domain
+    const size_t numWorkers = m_workerThreads.size();
+    const bool isOwnWorker = activatingThread && activatingThread->m_isWorker && (activatingThread->m_owningManager == this);
+    const size_t firstWorker = isOwnWorker ? activatingThread->m_workerId + 1 : 0;
+    const bool preferSameDomain = isOwnWorker && !m_processorDomains.empty();
+    const AZ::u32 domain = isOwnWorker ? activatingThread->m_topologyDomain.load(AZStd::memory_order_relaxed) : 0;
+
     // find an available worker thread (we do it brute force because the number of threads is small)
     while (m_numAvailableWorkers.load(AZStd::memory_order_acquire) > 0)
     {
-        for (size_t i = 0; i < m_workerThreads.size(); ++i)
+        for (int pass = preferSameDomain ? 0 : 1; pass < 2; ++pass)
         {
-            ThreadInfo* info = m_workerThreads[i];
-            if (info->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel) == true)
+            for (size_t i = 0; i < numWorkers; ++i)
             {
-                // decrement number of available workers
-                m_numAvailableWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
-                // resume the thread execution
+                ThreadInfo* info = m_workerThreads[(firstWorker + i) % numWorkers];
+                if (pass == 0 && info->m_topologyDomain.load(AZStd::memory_order_relaxed) != domain)
+                {
+                    continue;
+                }
 
-                AZ_PROFILE_INTERVAL_START(AZ::Debug::ProfileCategory::JobManagerDetailed, info, "AzCore WakeJobThread %d", info->m_workerId);
-                info->m_waitEvent.release();
-                return;
+                if (info->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel) == true)
+                {
+                    // decrement number of available workers
+                    m_numAvailableWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
+                    // resume the thread execution
+
+                    AZ_PROFILE_INTERVAL_START(AZ::Debug::ProfileCategory::JobManagerDetailed, info, "AzCore WakeJobThread %d", info->m_workerId);
+                    info->m_waitEvent.release();
+                    return;
+                }
             }
         }
     }
 }
-
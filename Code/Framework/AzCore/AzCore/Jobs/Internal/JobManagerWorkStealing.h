@@ -11,6 +11,7 @@
 // Included directly from JobManager.h
 
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
+#include <AzCore/Jobs/Internal/WorkStealingDeque.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
@@ -27,9 +28,16 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * Per worker job queue. Jobs with the default priority, which are the vast majority, go into a lock-free
+         * work stealing deque. Jobs with any other priority go into a locked queue sorted by priority, which is
+         * only consulted when it is known to be non-empty. Jobs with a higher priority than the default are taken
+         * before default priority jobs, and jobs with a lower priority after them.
+         */
         class WorkQueue final
         {
         public:
+            //! Must only be called from the thread owning the queue.
             void LocalInsert(Job *job);
             Job* LocalPopFront();
             Job* TryStealFront();
@@ -42,8 +50,14 @@ namespace AZ
             using LockType = AZStd::shared_mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
+            Job* PopPrioritized(bool higherThanDefault);
+            Job* TryStealPrioritized(bool higherThanDefault);
+
+            WorkStealingDeque<Job*> m_defaultPriorityJobs;
+
+            AZStd::deque<Job*> m_prioritizedJobs;
             LockType m_lock;
+            AZStd::atomic_uint m_numPrioritizedJobs{ 0 };
         };
 
         /**
@@ -82,7 +96,11 @@ namespace AZ
 
         private:
 
-            void ActivateWorker();
+            struct ThreadInfo;
+
+            void ActivateWorker(const ThreadInfo* activatingThread);
+            unsigned int SelectNextVictim(const ThreadInfo* info, unsigned int victim, bool sameDomainOnly) const;
+            void UpdateTopologyDomain(ThreadInfo* info) const;
 
             struct ThreadInfo
             {
@@ -99,6 +117,9 @@ namespace AZ
                 AZStd::binary_semaphore m_waitEvent;
                 WorkQueue m_pendingJobs;
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
+                //! Topology domain (socket/last level cache) of the processor the worker last ran on, used to prefer
+                //! stealing from and waking up workers that share a cache. Updated each time the worker wakes up.
+                AZStd::atomic_uint m_topologyDomain{ 0 };
 
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
@@ -140,6 +161,9 @@ namespace AZ
             volatile bool               m_quitRequested = false;
             AZStd::atomic_uint          m_numAvailableWorkers{0};
 
+            //! Topology domain of each logical processor, empty if the topology is unknown or there is only one domain.
+            AZStd::vector<AZ::u32>      m_processorDomains;
+
             //thread-local pointer to the info for this thread. This is set for worker threads all the time,
             //and user threads only while they are processing jobs
             static AZ_THREAD_LOCAL ThreadInfo* m_currentThreadInfo;
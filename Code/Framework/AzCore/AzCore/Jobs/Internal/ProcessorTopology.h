@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        //! Returns, indexed by logical processor, the id of the topology domain the processor belongs to.
+        //! Processors sharing a socket and last level cache have the same domain id.
+        //! Returns an empty list if the topology can't be determined on this platform.
+        AZStd::vector<AZ::u32> GetProcessorTopologyDomains();
+
+        //! Returns the index of the logical processor the calling thread is running on, or -1 if unknown.
+        int GetCurrentProcessorIndex();
+    } // namespace Internal
+} // namespace AZ
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Lock-free, growable work stealing deque based on "Dynamic Circular Work-Stealing Deque" (Chase, Lev 2005)
+         * and its C11 memory model formulation (Le, Pop, Cohen, Zappa Nardelli 2013).
+         * A single owner thread pushes elements at the bottom, any thread (including the owner) can take elements
+         * from the top. Taking elements only from the top keeps elements in the order they were pushed, which the
+         * job system relies on to run jobs of equal priority in the order they were added.
+         * Buffers replaced while growing are kept alive until the deque is destroyed, as other threads may still
+         * be reading from them. Since the capacity doubles every time, this never more than doubles the memory used.
+         */
+        template<typename T>
+        class WorkStealingDeque final
+        {
+            static_assert(AZStd::is_pointer<T>::value, "WorkStealingDeque only supports pointer elements");
+        public:
+            AZ_CLASS_ALLOCATOR(WorkStealingDeque, AZ::SystemAllocator, 0);
+
+            explicit WorkStealingDeque(size_t initialCapacity = 256)
+            {
+                AZ_Assert(initialCapacity > 0 && (initialCapacity & (initialCapacity - 1)) == 0, "WorkStealingDeque capacity must be a power of two");
+                m_buffer.store(aznew Buffer(initialCapacity), AZStd::memory_order_relaxed);
+            }
+
+            ~WorkStealingDeque()
+            {
+                delete m_buffer.load(AZStd::memory_order_relaxed);
+                for (Buffer* retiredBuffer : m_retiredBuffers)
+                {
+                    delete retiredBuffer;
+                }
+            }
+
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            //! Adds an element at the bottom of the deque. Must only be called from the owning thread.
+            void PushBottom(T element)
+            {
+                const int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+                const int64_t top = m_top.load(AZStd::memory_order_acquire);
+                Buffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+                if (bottom - top > static_cast<int64_t>(buffer->m_mask))
+                {
+                    buffer = Grow(buffer, top, bottom);
+                }
+                buffer->Store(bottom, element);
+                AZStd::atomic_thread_fence(AZStd::memory_order_release);
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+
+            //! Takes the element at the top of the deque. Safe to call from any thread.
+            //! Returns nullptr if the deque was empty or another thread won the race for the top element.
+            T StealTop()
+            {
+                int64_t top = m_top.load(AZStd::memory_order_acquire);
+                AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                const int64_t bottom = m_bottom.load(AZStd::memory_order_acquire);
+                if (top < bottom)
+                {
+                    // Acquire rather than consume, consume is promoted to acquire by every compiler we support anyway.
+                    Buffer* buffer = m_buffer.load(AZStd::memory_order_acquire);
+                    T element = buffer->Load(top);
+                    if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                    {
+                        return element;
+                    }
+                }
+                return nullptr;
+            }
+
+            //! Returns true if the deque appeared to be empty at the time of the call.
+            bool IsEmpty() const
+            {
+                const int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+                const int64_t top = m_top.load(AZStd::memory_order_relaxed);
+                return bottom <= top;
+            }
+
+        private:
+            struct Buffer
+            {
+                AZ_CLASS_ALLOCATOR(Buffer, AZ::SystemAllocator, 0);
+
+                explicit Buffer(size_t capacity)
+                    : m_elements(capacity)
+                    , m_mask(capacity - 1)
+                {
+                }
+
+                T Load(int64_t index) const
+                {
+                    return m_elements[static_cast<size_t>(index) & m_mask].load(AZStd::memory_order_relaxed);
+                }
+
+                void Store(int64_t index, T element)
+                {
+                    m_elements[static_cast<size_t>(index) & m_mask].store(element, AZStd::memory_order_relaxed);
+                }
+
+                AZStd::vector<AZStd::atomic<T>> m_elements;
+                size_t m_mask;
+            };
+
+            Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom)
+            {
+                Buffer* newBuffer = aznew Buffer(buffer->m_elements.size() * 2);
+                for (int64_t i = top; i < bottom; ++i)
+                {
+                    newBuffer->Store(i, buffer->Load(i));
+                }
+                m_retiredBuffers.push_back(buffer);
+                m_buffer.store(newBuffer, AZStd::memory_order_release);
+                return newBuffer;
+            }
+
+            // Top and bottom are on separate cache lines, they are written by different threads.
+            alignas(64) AZStd::atomic<int64_t> m_top{ 0 };
+            alignas(64) AZStd::atomic<int64_t> m_bottom{ 0 };
+            AZStd::atomic<Buffer*> m_buffer{ nullptr };
+            AZStd::vector<Buffer*> m_retiredBuffers; ///< Only accessed by the owning thread and the destructor.
+        };
+    } // namespace Internal
+} // namespace AZ
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/TaskGraph.h>
+#include <AzCore/Jobs/Job.h>
+#include <AzCore/Jobs/JobCancelGroup.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Job running a single task of a TaskGraph. The job is reused for every submission of the graph.
+         */
+        class TaskGraphJob final
+            : public Job
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(TaskGraphJob, ThreadPoolAllocator, 0)
+
+            TaskGraphJob(TaskGraph& graph, TaskGraph::TaskId task, JobContext* context)
+                : Job(false, context)
+                , m_graph(graph)
+                , m_task(task)
+            {
+            }
+
+        protected:
+            void Process() override
+            {
+                m_graph.RunTask(m_task);
+            }
+
+        private:
+            TaskGraph& m_graph;
+            TaskGraph::TaskId m_task;
+        };
+    } // namespace Internal
+
+    TaskGraph::TaskGraph(JobContext* context)
+        : m_context(context)
+    {
+    }
+
+    TaskGraph::~TaskGraph()
+    {
+        AZ_Assert(!m_isSubmitted, "TaskGraph destroyed while a submission is in flight, call Wait first.");
+        DestroyJobs();
+    }
+
+    TaskGraph::TaskId TaskGraph::AddTask(const char* name, TaskFunction function)
+    {
+        AZ_Assert(!m_isSubmitted, "Tasks can't be added while the graph is submitted.");
+        m_isCompiled = false;
+
+        Task& task = m_tasks.emplace_back();
+        task.m_name = name;
+        task.m_function = AZStd::move(function);
+        return static_cast<TaskId>(m_tasks.size() - 1);
+    }
+
+    void TaskGraph::AddDependency(TaskId predecessor, TaskId successor)
+    {
+        AZ_Assert(!m_isSubmitted, "Dependencies can't be added while the graph is submitted.");
+        AZ_Assert(predecessor < m_tasks.size() && successor < m_tasks.size(), "Invalid task id.");
+        AZ_Assert(predecessor != successor, "A task can't depend on itself.");
+        m_isCompiled = false;
+
+        AZStd::vector<TaskId>& successors = m_tasks[predecessor].m_successors;
+        if (AZStd::find(successors.begin(), successors.end(), successor) == successors.end())
+        {
+            successors.push_back(successor);
+        }
+    }
+
+    bool TaskGraph::Compile()
+    {
+        AZ_Assert(!m_isSubmitted, "The graph can't be compiled while it is submitted.");
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        DestroyJobs();
+        m_isCompiled = false;
+
+        const size_t taskCount = m_tasks.size();
+        m_predecessorCounts.assign(taskCount, 0);
+        for (const Task& task : m_tasks)
+        {
+            for (TaskId successor : task.m_successors)
+            {
+                ++m_predecessorCounts[successor];
+            }
+        }
+
+        // Sort the tasks topologically (Kahn's algorithm), any task left over is part of a cycle.
+        m_sortedTasks.clear();
+        m_sortedTasks.reserve(taskCount);
+        AZStd::vector<AZ::u32> remainingPredecessors = m_predecessorCounts;
+        for (TaskId task = 0; task < taskCount; ++task)
+        {
+            if (remainingPredecessors[task] == 0)
+            {
+                m_sortedTasks.push_back(task);
+            }
+        }
+        for (size_t i = 0; i < m_sortedTasks.size(); ++i)
+        {
+            for (TaskId successor : m_tasks[m_sortedTasks[i]].m_successors)
+            {
+                if (--remainingPredecessors[successor] == 0)
+                {
+                    m_sortedTasks.push_back(successor);
+                }
+            }
+        }
+
+        if (m_sortedTasks.size() != taskCount)
+        {
+            for (TaskId task = 0; task < taskCount; ++task)
+            {
+                if (remainingPredecessors[task] != 0)
+                {
+                    AZ_Error("TaskGraph", false, "Task '%s' is part of a dependency cycle.", m_tasks[task].m_name);
+                }
+            }
+            m_sortedTasks.clear();
+            return false;
+        }
+
+        JobContext* context = m_context ? m_context : JobContext::GetParentContext();
+        AZ_Assert(context, "TaskGraph requires a JobContext, either pass one in or set the global context.");
+        m_jobContext = aznew JobContext(context->GetJobManager());
+        m_cancelGroup = context->GetCancelGroup();
+
+        m_completion = aznew JobCompletion(m_jobContext);
+        m_jobs.reserve(taskCount);
+        for (TaskId task = 0; task < taskCount; ++task)
+        {
+            m_jobs.push_back(aznew Internal::TaskGraphJob(*this, task, m_jobContext));
+        }
+
+        m_successorOffsets.clear();
+        m_successorOffsets.reserve(taskCount + 1);
+        m_successors.clear();
+        for (const Task& task : m_tasks)
+        {
+            m_successorOffsets.push_back(static_cast<AZ::u32>(m_successors.size()));
+            for (TaskId successor : task.m_successors)
+            {
+                m_successors.push_back(m_jobs[successor]);
+            }
+        }
+        m_successorOffsets.push_back(static_cast<AZ::u32>(m_successors.size()));
+
+        m_timings.assign(taskCount, TaskTiming());
+        m_isCompiled = true;
+        return true;
+    }
+
+    void TaskGraph::Submit()
+    {
+        AZ_Assert(m_isCompiled, "The graph must be compiled before it is submitted.");
+        AZ_Assert(!m_isSubmitted, "The graph is already submitted, call Wait before submitting it again.");
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        m_isSubmitted = true;
+        if (m_isTimingEnabled)
+        {
+            m_submitTime = AZStd::GetTimeNowTicks();
+        }
+
+        // Rearm every job before starting any of them, a started task may complete and notify its successors right away.
+        m_completion->Reset(true);
+        for (TaskId task : m_sortedTasks)
+        {
+            Internal::TaskGraphJob* job = m_jobs[task];
+            job->Reset(true);
+            for (AZ::u32 i = 0; i < m_predecessorCounts[task]; ++i)
+            {
+                job->IncrementDependentCount();
+            }
+
+            // Tasks without successors notify the completion through the regular job dependent
+            if (m_successorOffsets[task] == m_successorOffsets[task + 1])
+            {
+                job->SetDependent(m_completion);
+            }
+        }
+
+        for (TaskId task : m_sortedTasks)
+        {
+            m_jobs[task]->Start();
+        }
+    }
+
+    void TaskGraph::Wait()
+    {
+        AZ_Assert(m_isSubmitted, "The graph must be submitted before it can be waited on.");
+        m_completion->StartAndWaitForCompletion();
+        m_isSubmitted = false;
+    }
+
+    void TaskGraph::SubmitAndWait()
+    {
+        Submit();
+        Wait();
+    }
+
+    const char* TaskGraph::GetTaskName(TaskId task) const
+    {
+        AZ_Assert(task < m_tasks.size(), "Invalid task id.");
+        return m_tasks[task].m_name;
+    }
+
+    const TaskGraph::TaskTiming& TaskGraph::GetTaskTiming(TaskId task) const
+    {
+        AZ_Assert(task < m_timings.size(), "Invalid task id, or the graph hasn't been compiled.");
+        return m_timings[task];
+    }
+
+    AZStd::vector<TaskGraph::TaskId> TaskGraph::GetCriticalPath(AZStd::sys_time_t* criticalPathDuration) const
+    {
+        AZ_Assert(m_isCompiled, "The graph must be compiled to compute its critical path.");
+
+        // Longest path through the DAG weighted by task duration, visiting tasks in topological order.
+        const size_t taskCount = m_tasks.size();
+        AZStd::vector<AZStd::sys_time_t> pathDurations(taskCount, 0);
+        AZStd::vector<TaskId> pathPredecessors(taskCount, InvalidTaskId);
+        TaskId lastTask = InvalidTaskId;
+        for (TaskId task : m_sortedTasks)
+        {
+            pathDurations[task] += m_timings[task].GetDuration();
+            if (lastTask == InvalidTaskId || pathDurations[task] > pathDurations[lastTask])
+            {
+                lastTask = task;
+            }
+
+            for (TaskId successor : m_tasks[task].m_successors)
+            {
+                if (pathPredecessors[successor] == InvalidTaskId || pathDurations[task] > pathDurations[successor])
+                {
+                    pathDurations[successor] = pathDurations[task];
+                    pathPredecessors[successor] = task;
+                }
+            }
+        }
+
+        AZStd::vector<TaskId> criticalPath;
+        for (TaskId task = lastTask; task != InvalidTaskId; task = pathPredecessors[task])
+        {
+            criticalPath.push_back(task);
+        }
+        AZStd::reverse(criticalPath.begin(), criticalPath.end());
+
+        if (criticalPathDuration)
+        {
+            *criticalPathDuration = (lastTask != InvalidTaskId) ? pathDurations[lastTask] : 0;
+        }
+        return criticalPath;
+    }
+
+    void TaskGraph::ReportTimings() const
+    {
+        AZ_Warning("TaskGraph", m_isTimingEnabled, "Timing is not enabled for this task graph, the report will be empty.");
+
+        const double ticksToMs = 1000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+        AZ_TracePrintf("TaskGraph", "Task                                      Start (ms)    Duration (ms)\n");
+        for (TaskId task : m_sortedTasks)
+        {
+            const TaskTiming& timing = m_timings[task];
+            AZ_TracePrintf("TaskGraph", "%-40s  %10.3f    %10.3f\n", m_tasks[task].m_name,
+                timing.m_start * ticksToMs, timing.GetDuration() * ticksToMs);
+        }
+
+        AZStd::sys_time_t criticalPathDuration = 0;
+        const AZStd::vector<TaskId> criticalPath = GetCriticalPath(&criticalPathDuration);
+        AZ_TracePrintf("TaskGraph", "Critical path (%.3f ms):\n", criticalPathDuration * ticksToMs);
+        for (TaskId task : criticalPath)
+        {
+            AZ_TracePrintf("TaskGraph", "    %s\n", m_tasks[task].m_name);
+        }
+    }
+
+    void TaskGraph::RunTask(TaskId task)
+    {
+        if (m_isTimingEnabled)
+        {
+            m_timings[task].m_start = AZStd::GetTimeNowTicks() - m_submitTime;
+        }
+
+        // A cancelled task is skipped, but still releases its successors so the submission runs to completion.
+        if (!m_cancelGroup || !m_cancelGroup->IsCancelled())
+        {
+            AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "TaskGraph: %s", m_tasks[task].m_name);
+            m_tasks[task].m_function();
+        }
+
+        if (m_isTimingEnabled)
+        {
+            m_timings[task].m_end = AZStd::GetTimeNowTicks() - m_submitTime;
+        }
+
+        // Notifying the successors must be the last access to the graph, once the final task completes the graph may
+        // be submitted again or recompiled.
+        Internal::TaskGraphJob* const* successor = m_successors.data() + m_successorOffsets[task];
+        Internal::TaskGraphJob* const* successorsEnd = m_successors.data() + m_successorOffsets[task + 1];
+        for (; successor != successorsEnd; ++successor)
+        {
+            (*successor)->DecrementDependentCount();
+        }
+    }
+
+    void TaskGraph::DestroyJobs()
+    {
+        for (Internal::TaskGraphJob* job : m_jobs)
+        {
+            delete job;
+        }
+        m_jobs.clear();
+
+        delete m_completion;
+        m_completion = nullptr;
+
+        delete m_jobContext;
+        m_jobContext = nullptr;
+        m_cancelGroup = nullptr;
+    }
+} // namespace AZ
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    class JobCancelGroup;
+    class JobCompletion;
+    class JobContext;
+
+    namespace Internal
+    {
+        class TaskGraphJob;
+    }
+
+    /**
+     * Declarative description of a directed acyclic graph of tasks which run on the job system.
+     * The graph is described once with AddTask/AddDependency and compiled into a launch plan. Compiling validates the graph
+     * and allocates one job per task, so submitting a compiled graph doesn't allocate, and it can be submitted any number
+     * of times (e.g. once per frame). Only one submission of a graph can be in flight at a time.
+     *
+     * Usage:
+     *     AZ::TaskGraph graph;
+     *     AZ::TaskGraph::TaskId cull = graph.AddTask("Cull", [](){ ... });
+     *     AZ::TaskGraph::TaskId sort = graph.AddTask("Sort", [](){ ... });
+     *     graph.AddDependency(cull, sort);
+     *     graph.Compile();
+     *     ...
+     *     graph.SubmitAndWait(); // every frame
+     */
+    class TaskGraph final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TaskGraph, SystemAllocator, 0);
+
+        using TaskId = AZ::u32;
+        using TaskFunction = AZStd::function<void()>;
+        static constexpr TaskId InvalidTaskId = static_cast<TaskId>(-1);
+
+        /**
+         * Timing of a task during the last completed submission, in ticks (see AZStd::GetTimeTicksPerSecond) relative
+         * to the time the graph was submitted.
+         */
+        struct TaskTiming
+        {
+            AZStd::sys_time_t m_start = 0;
+            AZStd::sys_time_t m_end = 0;
+
+            AZStd::sys_time_t GetDuration() const { return m_end - m_start; }
+        };
+
+        /**
+         * If a JobContext is not specified, the context of the currently processing job or the global context is used,
+         * see AZ::Job. Cancelling the cancel group of the context skips the tasks that haven't started yet, Wait still
+         * returns once the running tasks have completed.
+         */
+        explicit TaskGraph(JobContext* context = nullptr);
+        ~TaskGraph();
+
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        /**
+         * Adds a task to the graph. Adding tasks invalidates a previous compilation.
+         * @param name Name used for profiling and timing reports, must outlive the graph.
+         * @param function Function run by the task.
+         */
+        TaskId AddTask(const char* name, TaskFunction function);
+
+        /**
+         * Makes successor wait for predecessor to complete before starting. Adding dependencies invalidates a previous compilation.
+         */
+        void AddDependency(TaskId predecessor, TaskId successor);
+
+        /**
+         * Validates the graph and builds the launch plan. Returns false if the graph contains a cycle.
+         */
+        bool Compile();
+
+        bool IsCompiled() const { return m_isCompiled; }
+
+        /**
+         * Starts all tasks of a compiled graph, respecting their dependencies, and returns immediately.
+         * Wait must be called before the graph is submitted again or modified.
+         */
+        void Submit();
+
+        /**
+         * Blocks until all tasks of the last submission have completed. Like JobCompletion::StartAndWaitForCompletion this
+         * blocks the calling thread, so it should not be called from a job.
+         */
+        void Wait();
+
+        /**
+         * Convenience function calling Submit followed by Wait.
+         */
+        void SubmitAndWait();
+
+        /**
+         * Enables recording the start and end time of every task. Disabled by default, as it adds two timer queries per task.
+         */
+        void SetTimingEnabled(bool enabled) { m_isTimingEnabled = enabled; }
+        bool IsTimingEnabled() const { return m_isTimingEnabled; }
+
+        size_t GetTaskCount() const { return m_tasks.size(); }
+        const char* GetTaskName(TaskId task) const;
+
+        /**
+         * Returns the timing of a task during the last submission, timing must be enabled.
+         */
+        const TaskTiming& GetTaskTiming(TaskId task) const;
+
+        /**
+         * Returns the chain of dependent tasks with the longest total duration during the last submission, which bounds
+         * how fast the graph can complete regardless of the number of worker threads. Timing must be enabled.
+         * @param criticalPathDuration If not null, receives the summed duration of the tasks on the path in ticks.
+         */
+        AZStd::vector<TaskId> GetCriticalPath(AZStd::sys_time_t* criticalPathDuration = nullptr) const;
+
+        /**
+         * Prints the timing of every task and the critical path of the last submission.
+         */
+        void ReportTimings() const;
+
+    private:
+        friend class Internal::TaskGraphJob;
+
+        struct Task
+        {
+            const char* m_name = nullptr;
+            TaskFunction m_function;
+            AZStd::vector<TaskId> m_successors;
+        };
+
+        void RunTask(TaskId task);
+        void DestroyJobs();
+
+        JobContext* m_context = nullptr;
+        AZStd::vector<Task> m_tasks;
+
+        // The jobs run in a context without a cancel group, as the job manager skips cancelled jobs entirely and they
+        // would never release their successors. Cancellation is checked against the cancel group of m_context instead.
+        JobContext* m_jobContext = nullptr;
+        JobCancelGroup* m_cancelGroup = nullptr;
+
+        // Launch plan, built by Compile.
+        AZStd::vector<Internal::TaskGraphJob*> m_jobs; ///< One job per task.
+        AZStd::vector<TaskId> m_sortedTasks; ///< Tasks in topological order.
+        AZStd::vector<AZ::u32> m_predecessorCounts;
+        AZStd::vector<AZ::u32> m_successorOffsets; ///< Offsets into m_successors for each task, plus one past the end.
+        AZStd::vector<Internal::TaskGraphJob*> m_successors; ///< Flattened successor jobs of all tasks.
+        JobCompletion* m_completion = nullptr;
+
+        AZStd::vector<TaskTiming> m_timings;
+        AZStd::sys_time_t m_submitTime = 0;
+        bool m_isTimingEnabled = false;
+        bool m_isCompiled = false;
+        bool m_isSubmitted = false;
+    };
+} // namespace AZ
@@ -0,0 +1,644 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/SimdMathBatch.h>
+
+// Width independent implementations of the batch kernels. Every kernel is a template over a simd vector type which
+// provides the same static functions as Simd::Vec4, and processes VecType::ElementCount values per iteration.
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace Batch
+        {
+            namespace Internal
+            {
+                //! Loads the first count values of a block, padding the remaining lanes with copies of the last value so
+                //! the padding lanes never produce values that could raise exceptions.
+                template <typename VecType>
+                AZ_MATH_INLINE typename VecType::FloatType LoadPartial(const float* values, size_t count)
+                {
+                    constexpr size_t ElementCount = static_cast<size_t>(VecType::ElementCount);
+                    if (count == ElementCount)
+                    {
+                        return VecType::LoadUnaligned(values);
+                    }
+
+                    float buffer[ElementCount];
+                    for (size_t lane = 0; lane < ElementCount; ++lane)
+                    {
+                        buffer[lane] = values[lane < count ? lane : count - 1];
+                    }
+                    return VecType::LoadUnaligned(buffer);
+                }
+
+                //! Stores the first count lanes of a block.
+                template <typename VecType>
+                AZ_MATH_INLINE void StorePartial(float* values, typename VecType::FloatArgType value, size_t count)
+                {
+                    constexpr size_t ElementCount = static_cast<size_t>(VecType::ElementCount);
+                    if (count == ElementCount)
+                    {
+                        VecType::StoreUnaligned(values, value);
+                        return;
+                    }
+
+                    float buffer[ElementCount];
+                    VecType::StoreUnaligned(buffer, value);
+                    for (size_t lane = 0; lane < count; ++lane)
+                    {
+                        values[lane] = buffer[lane];
+                    }
+                }
+
+                //! Loads InputCount component arrays a block of ElementCount values at a time, calls the kernel on the
+                //! loaded registers and stores the OutputCount results. The last partial block is padded, see LoadPartial.
+                template <typename VecType, size_t InputCount, size_t OutputCount, typename KernelType>
+                AZ_MATH_INLINE void ForEachBlock(const float* const (&inputs)[InputCount], float* const (&outputs)[OutputCount],
+                    size_t count, const KernelType& kernel)
+                {
+                    using FloatType = typename VecType::FloatType;
+                    constexpr size_t ElementCount = static_cast<size_t>(VecType::ElementCount);
+
+                    FloatType in[InputCount];
+                    FloatType out[OutputCount];
+
+                    size_t index = 0;
+                    for (; index + ElementCount <= count; index += ElementCount)
+                    {
+                        for (size_t i = 0; i < InputCount; ++i)
+                        {
+                            in[i] = VecType::LoadUnaligned(inputs[i] + index);
+                        }
+                        kernel(in, out);
+                        for (size_t i = 0; i < OutputCount; ++i)
+                        {
+                            VecType::StoreUnaligned(outputs[i] + index, out[i]);
+                        }
+                    }
+
+                    if (index < count)
+                    {
+                        const size_t remaining = count - index;
+                        for (size_t i = 0; i < InputCount; ++i)
+                        {
+                            in[i] = LoadPartial<VecType>(inputs[i] + index, remaining);
+                        }
+                        kernel(in, out);
+                        for (size_t i = 0; i < OutputCount; ++i)
+                        {
+                            StorePartial<VecType>(outputs[i] + index, out[i], remaining);
+                        }
+                    }
+                }
+
+                //! Transforms points or vectors by a row major 3x4 matrix.
+                template <typename VecType, bool Translate>
+                AZ_MATH_INLINE void TransformPoints(const float (&matrix)[12], ConstVec3Array input, Vec3Array output, size_t count)
+                {
+                    using FloatType = typename VecType::FloatType;
+
+                    FloatType rows[12];
+                    for (size_t i = 0; i < 12; ++i)
+                    {
+                        rows[i] = VecType::Splat(matrix[i]);
+                    }
+
+                    const float* const inputs[] = { input.m_x, input.m_y, input.m_z };
+                    float* const outputs[] = { output.m_x, output.m_y, output.m_z };
+                    ForEachBlock<VecType>(inputs, outputs, count, [&rows](const FloatType* in, FloatType* out)
+                    {
+                        for (size_t row = 0; row < 3; ++row)
+                        {
+                            const FloatType* m = rows + row * 4;
+                            FloatType result = Translate ? VecType::Madd(in[0], m[0], m[3]) : VecType::Mul(in[0], m[0]);
+                            result = VecType::Madd(in[1], m[1], result);
+                            out[row] = VecType::Madd(in[2], m[2], result);
+                        }
+                    });
+                }
+
+                //! Transforms normals by a row major 3x3 matrix, stored in the first 3 columns of a 3x4 matrix, and
+                //! normalizes the results.
+                template <typename VecType>
+                AZ_MATH_INLINE void TransformNormals(const float (&matrix)[12], ConstVec3Array input, Vec3Array output, size_t count)
+                {
+                    using FloatType = typename VecType::FloatType;
+
+                    FloatType rows[12];
+                    for (size_t i = 0; i < 12; ++i)
+                    {
+                        rows[i] = VecType::Splat(matrix[i]);
+                    }
+
+                    const float* const inputs[] = { input.m_x, input.m_y, input.m_z };
+                    float* const outputs[] = { output.m_x, output.m_y, output.m_z };
+                    ForEachBlock<VecType>(inputs, outputs, count, [&rows](const FloatType* in, FloatType* out)
+                    {
+                        FloatType transformed[3];
+                        for (size_t row = 0; row < 3; ++row)
+                        {
+                            const FloatType* m = rows + row * 4;
+                            FloatType result = VecType::Mul(in[0], m[0]);
+                            result = VecType::Madd(in[1], m[1], result);
+                            transformed[row] = VecType::Madd(in[2], m[2], result);
+                        }
+
+                        FloatType lengthSq = VecType::Mul(transformed[0], transformed[0]);
+                        lengthSq = VecType::Madd(transformed[1], transformed[1], lengthSq);
+                        lengthSq = VecType::Madd(transformed[2], transformed[2], lengthSq);
+                        const FloatType invLength = VecType::SqrtInv(lengthSq);
+                        out[0] = VecType::Mul(transformed[0], invLength);
+                        out[1] = VecType::Mul(transformed[1], invLength);
+                        out[2] = VecType::Mul(transformed[2], invLength);
+                    });
+                }
+
+                //! Multiplies quaternions in SoA form, matching Vec4::QuaternionMultiply.
+                template <typename VecType>
+                AZ_MATH_INLINE void QuaternionMultiply(const typename VecType::FloatType* lhs, const typename VecType::FloatType* rhs,
+                    typename VecType::FloatType* out)
+                {
+                    using FloatType = typename VecType::FloatType;
+                    // x = (l.y * r.z) - (l.z * r.y) + (l.w * r.x) + (l.x * r.w)
+                    // y = (l.z * r.x) - (l.x * r.z) + (l.w * r.y) + (l.y * r.w)
+                    // z = (l.x * r.y) - (l.y * r.x) + (l.w * r.z) + (l.z * r.w)
+                    // w = (l.w * r.w) - (l.x * r.x) - (l.y * r.y) - (l.z * r.z)
+                    FloatType x = VecType::Sub(VecType::Mul(lhs[1], rhs[2]), VecType::Mul(lhs[2], rhs[1]));
+                    x = VecType::Madd(lhs[3], rhs[0], x);
+                    x = VecType::Madd(lhs[0], rhs[3], x);
+
+                    FloatType y = VecType::Sub(VecType::Mul(lhs[2], rhs[0]), VecType::Mul(lhs[0], rhs[2]));
+                    y = VecType::Madd(lhs[3], rhs[1], y);
+                    y = VecType::Madd(lhs[1], rhs[3], y);
+
+                    FloatType z = VecType::Sub(VecType::Mul(lhs[0], rhs[1]), VecType::Mul(lhs[1], rhs[0]));
+                    z = VecType::Madd(lhs[3], rhs[2], z);
+                    z = VecType::Madd(lhs[2], rhs[3], z);
+
+                    FloatType w = VecType::Mul(lhs[3], rhs[3]);
+                    w = VecType::Sub(w, VecType::Mul(lhs[0], rhs[0]));
+                    w = VecType::Sub(w, VecType::Mul(lhs[1], rhs[1]));
+                    w = VecType::Sub(w, VecType::Mul(lhs[2], rhs[2]));
+
+                    out[0] = x;
+                    out[1] = y;
+                    out[2] = z;
+                    out[3] = w;
+                }
+
+                //! Rotates vectors by quaternions in SoA form, matching Vec4::QuaternionTransform:
+                //! 2 * (q.v) * q + (w^2 - q.q) * v + 2 * w * (q x v)
+                template <typename VecType>
+                AZ_MATH_INLINE void QuaternionTransform(const typename VecType::FloatType* quat, const typename VecType::FloatType* vec,
+                    typename VecType::FloatType* out)
+                {
+                    using FloatType = typename VecType::FloatType;
+                    const FloatType two = VecType::Splat(2.0f);
+
+                    FloatType quatDotVec = VecType::Mul(quat[0], vec[0]);
+                    quatDotVec = VecType::Madd(quat[1], vec[1], quatDotVec);
+                    quatDotVec = VecType::Madd(quat[2], vec[2], quatDotVec);
+                    const FloatType twoQuatDotVec = VecType::Mul(two, quatDotVec);
+
+                    FloatType quatDotQuat = VecType::Mul(quat[0], quat[0]);
+                    quatDotQuat = VecType::Madd(quat[1], quat[1], quatDotQuat);
+                    quatDotQuat = VecType::Madd(quat[2], quat[2], quatDotQuat);
+                    const FloatType vecScale = VecType::Sub(VecType::Mul(quat[3], quat[3]), quatDotQuat);
+                    const FloatType twoW = VecType::Mul(two, quat[3]);
+
+                    const FloatType cross[3] =
+                    {
+                        VecType::Sub(VecType::Mul(quat[1], vec[2]), VecType::Mul(quat[2], vec[1])),
+                        VecType::Sub(VecType::Mul(quat[2], vec[0]), VecType::Mul(quat[0], vec[2])),
+                        VecType::Sub(VecType::Mul(quat[0], vec[1]), VecType::Mul(quat[1], vec[0]))
+                    };
+
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        FloatType result = VecType::Mul(twoQuatDotVec, quat[i]);
+                        result = VecType::Madd(vecScale, vec[i], result);
+                        out[i] = VecType::Madd(twoW, cross[i], result);
+                    }
+                }
+
+                template <typename VecType>
+                AZ_MATH_INLINE void MultiplyTransforms(ConstTransformArray lhs, ConstTransformArray rhs, TransformArray output, size_t count)
+                {
+                    using FloatType = typename VecType::FloatType;
+
+                    const float* const inputs[] =
+                    {
+                        lhs.m_rotation.m_x, lhs.m_rotation.m_y, lhs.m_rotation.m_z, lhs.m_rotation.m_w, lhs.m_scale,
+                        lhs.m_translation.m_x, lhs.m_translation.m_y, lhs.m_translation.m_z,
+                        rhs.m_rotation.m_x, rhs.m_rotation.m_y, rhs.m_rotation.m_z, rhs.m_rotation.m_w, rhs.m_scale,
+                        rhs.m_translation.m_x, rhs.m_translation.m_y, rhs.m_translation.m_z
+                    };
+                    float* const outputs[] =
+                    {
+                        output.m_rotation.m_x, output.m_rotation.m_y, output.m_rotation.m_z, output.m_rotation.m_w, output.m_scale,
+                        output.m_translation.m_x, output.m_translation.m_y, output.m_translation.m_z
+                    };
+                    ForEachBlock<VecType>(inputs, outputs, count, [](const FloatType* in, FloatType* out)
+                    {
+                        const FloatType* lhsRotation = in;
+                        const FloatType& lhsScale = in[4];
+                        const FloatType* lhsTranslation = in + 5;
+                        const FloatType* rhsRotation = in + 8;
+                        const FloatType& rhsScale = in[12];
+                        const FloatType* rhsTranslation = in + 13;
+
+                        QuaternionMultiply<VecType>(lhsRotation, rhsRotation, out);
+                        out[4] = VecType::Mul(lhsScale, rhsScale);
+
+                        // Same as lhs.TransformPoint(rhs.m_translation).
+                        const FloatType scaled[3] =
+                        {
+                            VecType::Mul(lhsScale, rhsTranslation[0]),
+                            VecType::Mul(lhsScale, rhsTranslation[1]),
+                            VecType::Mul(lhsScale, rhsTranslation[2])
+                        };
+                        FloatType rotated[3];
+                        QuaternionTransform<VecType>(lhsRotation, scaled, rotated);
+                        out[5] = VecType::Add(rotated[0], lhsTranslation[0]);
+                        out[6] = VecType::Add(rotated[1], lhsTranslation[1]);
+                        out[7] = VecType::Add(rotated[2], lhsTranslation[2]);
+                    });
+                }
+
+                //! Tests boxes against 6 planes, stored as normal x/y/z and distance. Writes 1.0f for every box that
+                //! overlaps and 0.0f otherwise.
+                template <typename VecType>
+                AZ_MATH_INLINE void OverlapsPlanes(const float (&planes)[6][4], ConstAabbArray aabbs, float* output, size_t count)
+                {
+                    using FloatType = typename VecType::FloatType;
+
+                    FloatType normals[6][3];
+                    FloatType absNormals[6][3];
+                    FloatType distances[6];
+                    for (size_t plane = 0; plane < 6; ++plane)
+                    {
+                        for (size_t i = 0; i < 3; ++i)
+                        {
+                            normals[plane][i] = VecType::Splat(planes[plane][i]);
+                            absNormals[plane][i] = VecType::Abs(normals[plane][i]);
+                        }
+                        distances[plane] = VecType::Splat(planes[plane][3]);
+                    }
+
+                    const float* const inputs[] =
+                    {
+                        aabbs.m_min.m_x, aabbs.m_min.m_y, aabbs.m_min.m_z, aabbs.m_max.m_x, aabbs.m_max.m_y, aabbs.m_max.m_z
+                    };
+                    float* const outputs[] = { output };
+                    ForEachBlock<VecType>(inputs, outputs, count, [&](const FloatType* in, FloatType* out)
+                    {
+                        const FloatType half = VecType::Splat(0.5f);
+                        FloatType center[3];
+                        FloatType extents[3];
+                        for (size_t i = 0; i < 3; ++i)
+                        {
+                            const FloatType halfMin = VecType::Mul(half, in[i]);
+                            const FloatType halfMax = VecType::Mul(half, in[i + 3]);
+                            center[i] = VecType::Add(halfMin, halfMax);
+                            extents[i] = VecType::Sub(halfMax, halfMin);
+                        }
+
+                        FloatType outside = VecType::ZeroFloat();
+                        for (size_t plane = 0; plane < 6; ++plane)
+                        {
+                            FloatType distance = VecType::Madd(normals[plane][0], center[0], distances[plane]);
+                            distance = VecType::Madd(normals[plane][1], center[1], distance);
+                            distance = VecType::Madd(normals[plane][2], center[2], distance);
+                            distance = VecType::Madd(absNormals[plane][0], extents[0], distance);
+                            distance = VecType::Madd(absNormals[plane][1], extents[1], distance);
+                            distance = VecType::Madd(absNormals[plane][2], extents[2], distance);
+                            outside = VecType::Or(outside, VecType::CmpLtEq(distance, VecType::ZeroFloat()));
+                        }
+                        out[0] = VecType::AndNot(outside, VecType::Splat(1.0f));
+                    });
+                }
+
+                //! Interpolates quaternions in SoA form, matching Quaternion::Slerp.
+                template <typename VecType>
+                AZ_MATH_INLINE void SlerpLanes(const typename VecType::FloatType* from, const typename VecType::FloatType* to,
+                    typename VecType::FloatArgType t, typename VecType::FloatType* out)
+                {
+                    using FloatType = typename VecType::FloatType;
+                    const FloatType one = VecType::Splat(1.0f);
+
+                    FloatType dot = VecType::Mul(from[0], to[0]);
+                    dot = VecType::Madd(from[1], to[1], dot);
+                    dot = VecType::Madd(from[2], to[2], dot);
+                    dot = VecType::Madd(from[3], to[3], dot);
+                    const FloatType cosom = VecType::Abs(dot);
+                    const FloatType oneMinusT = VecType::Sub(one, t);
+
+                    // Lanes that are too close to each other fall back to linear interpolation. The slerp weights of
+                    // those lanes may be inf or nan, but they're discarded by the select.
+                    const FloatType omega = VecType::Acos(cosom);
+                    const FloatType invSinom = VecType::Reciprocal(VecType::Sin(omega));
+                    const FloatType slerpA = VecType::Mul(VecType::Sin(VecType::Mul(oneMinusT, omega)), invSinom);
+                    const FloatType slerpB = VecType::Mul(VecType::Sin(VecType::Mul(t, omega)), invSinom);
+                    const FloatType useSlerp = VecType::CmpLt(cosom, VecType::Splat(0.9999f));
+                    FloatType scaleA = VecType::Select(slerpA, oneMinusT, useSlerp);
+                    const FloatType scaleB = VecType::Select(slerpB, t, useSlerp);
+
+                    // Take the shortest path if the quaternions are in opposite hemispheres.
+                    const FloatType flip = VecType::CmpLt(dot, VecType::ZeroFloat());
+                    scaleA = VecType::Select(VecType::Sub(VecType::ZeroFloat(), scaleA), scaleA, flip);
+
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        out[i] = VecType::Madd(to[i], scaleB, VecType::Mul(from[i], scaleA));
+                    }
+                }
+
+                template <typename VecType>
+                AZ_MATH_INLINE void Slerp(ConstQuaternionArray from, ConstQuaternionArray to, const float* t, QuaternionArray output, size_t count)
+                {
+                    using FloatType = typename VecType::FloatType;
+
+                    const float* const inputs[] = { from.m_x, from.m_y, from.m_z, from.m_w, to.m_x, to.m_y, to.m_z, to.m_w, t };
+                    float* const outputs[] = { output.m_x, output.m_y, output.m_z, output.m_w };
+                    ForEachBlock<VecType>(inputs, outputs, count, [](const FloatType* in, FloatType* out)
+                    {
+                        SlerpLanes<VecType>(in, in + 4, in[8], out);
+                    });
+                }
+
+                template <typename VecType>
+                AZ_MATH_INLINE void Slerp(ConstQuaternionArray from, ConstQuaternionArray to, float t, QuaternionArray output, size_t count)
+                {
+                    using FloatType = typename VecType::FloatType;
+
+                    const FloatType splatT = VecType::Splat(t);
+                    const float* const inputs[] = { from.m_x, from.m_y, from.m_z, from.m_w, to.m_x, to.m_y, to.m_z, to.m_w };
+                    float* const outputs[] = { output.m_x, output.m_y, output.m_z, output.m_w };
+                    ForEachBlock<VecType>(inputs, outputs, count, [&splatT](const FloatType* in, FloatType* out)
+                    {
+                        SlerpLanes<VecType>(in, in + 4, splatT, out);
+                    });
+                }
+
+                //! Linear blend skinning. Blends the joint matrices of every vertex by their weights and transforms the
+                //! positions, and optionally the normals, by the blended matrix. Joint matrices are row major 3x4
+                //! matrices stored as 12 consecutive floats.
+                template <typename VecType, bool SkinNormals>
+                AZ_MATH_INLINE void SkinVertices(const float* jointMatrices, SkinInfluenceArray influences, ConstVec3Array positions,
+                    ConstVec3Array normals, Vec3Array outputPositions, Vec3Array outputNormals, size_t count)
+                {
+                    using FloatType = typename VecType::FloatType;
+                    constexpr size_t ElementCount = static_cast<size_t>(VecType::ElementCount);
+
+                    for (size_t index = 0; index < count; index += ElementCount)
+                    {
+                        const size_t laneCount = count - index < ElementCount ? count - index : ElementCount;
+
+                        FloatType blended[12];
+                        for (size_t element = 0; element < 12; ++element)
+                        {
+                            blended[element] = VecType::ZeroFloat();
+                        }
+
+                        for (size_t influence = 0; influence < influences.m_influenceCount; ++influence)
+                        {
+                            const size_t offset = influence * count + index;
+                            const FloatType weight = LoadPartial<VecType>(influences.m_jointWeights + offset, laneCount);
+
+                            // Every lane can use a different joint, so the matrices are gathered one lane at a time.
+                            float gathered[12][ElementCount];
+                            for (size_t lane = 0; lane < ElementCount; ++lane)
+                            {
+                                const uint32_t joint = influences.m_jointIndices[offset + (lane < laneCount ? lane : laneCount - 1)];
+                                const float* matrix = jointMatrices + joint * 12;
+                                for (size_t element = 0; element < 12; ++element)
+                                {
+                                    gathered[element][lane] = matrix[element];
+                                }
+                            }
+                            for (size_t element = 0; element < 12; ++element)
+                            {
+                                blended[element] = VecType::Madd(VecType::LoadUnaligned(gathered[element]), weight, blended[element]);
+                            }
+                        }
+
+                        const FloatType position[3] =
+                        {
+                            LoadPartial<VecType>(positions.m_x + index, laneCount),
+                            LoadPartial<VecType>(positions.m_y + index, laneCount),
+                            LoadPartial<VecType>(positions.m_z + index, laneCount)
+                        };
+                        FloatType normal[3];
+                        if constexpr (SkinNormals)
+                        {
+                            normal[0] = LoadPartial<VecType>(normals.m_x + index, laneCount);
+                            normal[1] = LoadPartial<VecType>(normals.m_y + index, laneCount);
+                            normal[2] = LoadPartial<VecType>(normals.m_z + index, laneCount);
+                        }
+
+                        float* const positionOutputs[] = { outputPositions.m_x, outputPositions.m_y, outputPositions.m_z };
+                        for (size_t row = 0; row < 3; ++row)
+                        {
+                            const FloatType* m = blended + row * 4;
+                            FloatType result = VecType::Madd(position[0], m[0], m[3]);
+                            result = VecType::Madd(position[1], m[1], result);
+                            result = VecType::Madd(position[2], m[2], result);
+                            StorePartial<VecType>(positionOutputs[row] + index, result, laneCount);
+                        }
+
+                        if constexpr (SkinNormals)
+                        {
+                            FloatType transformed[3];
+                            for (size_t row = 0; row < 3; ++row)
+                            {
+                                const FloatType* m = blended + row * 4;
+                                FloatType result = VecType::Mul(normal[0], m[0]);
+                                result = VecType::Madd(normal[1], m[1], result);
+                                transformed[row] = VecType::Madd(normal[2], m[2], result);
+                            }
+
+                            FloatType lengthSq = VecType::Mul(transformed[0], transformed[0]);
+                            lengthSq = VecType::Madd(transformed[1], transformed[1], lengthSq);
+                            lengthSq = VecType::Madd(transformed[2], transformed[2], lengthSq);
+                            const FloatType invLength = VecType::SqrtInv(lengthSq);
+                            StorePartial<VecType>(outputNormals.m_x + index, VecType::Mul(transformed[0], invLength), laneCount);
+                            StorePartial<VecType>(outputNormals.m_y + index, VecType::Mul(transformed[1], invLength), laneCount);
+                            StorePartial<VecType>(outputNormals.m_z + index, VecType::Mul(transformed[2], invLength), laneCount);
+                        }
+                    }
+                }
+
+                template <typename VecType>
+                AZ_MATH_INLINE void SkinPositions(const float* jointMatrices, SkinInfluenceArray influences, ConstVec3Array positions,
+                    Vec3Array output, size_t count)
+                {
+                    SkinVertices<VecType, false>(jointMatrices, influences, positions, ConstVec3Array(), output, Vec3Array(), count);
+                }
+
+                template <typename VecType>
+                AZ_MATH_INLINE void SkinPositionsAndNormals(const float* jointMatrices, SkinInfluenceArray influences,
+                    ConstVec3Array positions, ConstVec3Array normals, Vec3Array outputPositions, Vec3Array outputNormals, size_t count)
+                {
+                    SkinVertices<VecType, true>(jointMatrices, influences, positions, normals, outputPositions, outputNormals, count);
+                }
+
+                //! Dot product of one of 12 gradient directions with (x, y, z), picked by the low 4 bits of the hash.
+                //! Same selection as Ken Perlin's improved noise reference implementation:
+                //! u = h < 8 ? x : y, v = h < 4 ? y : (h == 12 || h == 14 ? x : z), (h & 1 ? -u : u) + (h & 2 ? -v : v)
+                template <typename VecType>
+                AZ_MATH_INLINE typename VecType::FloatType PerlinGradient(typename VecType::Int32ArgType hash, typename VecType::FloatArgType x,
+                    typename VecType::FloatArgType y, typename VecType::FloatArgType z)
+                {
+                    using FloatType = typename VecType::FloatType;
+                    using Int32Type = typename VecType::Int32Type;
+
+                    const Int32Type h = VecType::And(hash, VecType::Splat(15));
+                    const FloatType u = VecType::Select(x, y, VecType::CastToFloat(VecType::CmpLt(h, VecType::Splat(8))));
+                    // (h | 2) == 14 is true for exactly 12 and 14.
+                    const FloatType xOrZ = VecType::Select(x, z, VecType::CastToFloat(VecType::CmpEq(VecType::Or(h, VecType::Splat(2)), VecType::Splat(14))));
+                    const FloatType v = VecType::Select(y, xOrZ, VecType::CastToFloat(VecType::CmpLt(h, VecType::Splat(4))));
+
+                    const FloatType signBit = VecType::CastToFloat(VecType::Splat(static_cast<int32_t>(0x80000000)));
+                    const FloatType negateU = VecType::CastToFloat(VecType::CmpEq(VecType::And(h, VecType::Splat(1)), VecType::Splat(1)));
+                    const FloatType negateV = VecType::CastToFloat(VecType::CmpEq(VecType::And(h, VecType::Splat(2)), VecType::Splat(2)));
+                    return VecType::Add(VecType::Xor(u, VecType::And(negateU, signBit)), VecType::Xor(v, VecType::And(negateV, signBit)));
+                }
+
+                //! Improved Perlin noise in [0, 1], see Simd::Batch::PerlinNoise.
+                template <typename VecType>
+                AZ_MATH_INLINE void PerlinNoise(const int32_t* permutationTable, ConstVec3Array positions, float* output, size_t count)
+                {
+                    using FloatType = typename VecType::FloatType;
+                    using Int32Type = typename VecType::Int32Type;
+                    constexpr size_t ElementCount = static_cast<size_t>(VecType::ElementCount);
+
+                    const float* const inputs[] = { positions.m_x, positions.m_y, positions.m_z };
+                    float* const outputs[] = { output };
+                    ForEachBlock<VecType>(inputs, outputs, count, [permutationTable](const FloatType* in, FloatType* out)
+                    {
+                        const FloatType one = VecType::Splat(1.0f);
+
+                        FloatType fraction[3];
+                        FloatType fade[3];
+                        int32_t cells[3][ElementCount];
+                        for (size_t i = 0; i < 3; ++i)
+                        {
+                            const FloatType floor = VecType::Floor(in[i]);
+                            fraction[i] = VecType::Sub(in[i], floor);
+                            VecType::StoreUnaligned(cells[i], VecType::And(VecType::ConvertToInt(floor), VecType::Splat(255)));
+
+                            // 6t^5 - 15t^4 + 10t^3
+                            const FloatType t = fraction[i];
+                            FloatType polynomial = VecType::Madd(t, VecType::Splat(6.0f), VecType::Splat(-15.0f));
+                            polynomial = VecType::Madd(polynomial, t, VecType::Splat(10.0f));
+                            fade[i] = VecType::Mul(VecType::Mul(VecType::Mul(t, t), t), polynomial);
+                        }
+
+                        // The permutation table lookups depend on each other, so the hashes of the 8 corners of the
+                        // unit cube are computed one lane at a time. Corner c is offset by (c & 1, (c >> 1) & 1, c >> 2).
+                        const int32_t* p = permutationTable;
+                        int32_t hashes[8][ElementCount];
+                        for (size_t lane = 0; lane < ElementCount; ++lane)
+                        {
+                            const int32_t x = cells[0][lane];
+                            const int32_t y = cells[1][lane];
+                            const int32_t z = cells[2][lane];
+                            const int32_t a = p[x] + y;
+                            const int32_t b = p[x + 1] + y;
+                            const int32_t aa = p[a] + z;
+                            const int32_t ab = p[a + 1] + z;
+                            const int32_t ba = p[b] + z;
+                            const int32_t bb = p[b + 1] + z;
+                            hashes[0][lane] = p[aa];
+                            hashes[1][lane] = p[ba];
+                            hashes[2][lane] = p[ab];
+                            hashes[3][lane] = p[bb];
+                            hashes[4][lane] = p[aa + 1];
+                            hashes[5][lane] = p[ba + 1];
+                            hashes[6][lane] = p[ab + 1];
+                            hashes[7][lane] = p[bb + 1];
+                        }
+
+                        const FloatType x0 = fraction[0];
+                        const FloatType y0 = fraction[1];
+                        const FloatType z0 = fraction[2];
+                        const FloatType x1 = VecType::Sub(x0, one);
+                        const FloatType y1 = VecType::Sub(y0, one);
+                        const FloatType z1 = VecType::Sub(z0, one);
+
+                        FloatType gradients[8];
+                        for (size_t corner = 0; corner < 8; ++corner)
+                        {
+                            const Int32Type hash = VecType::LoadUnaligned(hashes[corner]);
+                            gradients[corner] = PerlinGradient<VecType>(hash, (corner & 1) ? x1 : x0, (corner & 2) ? y1 : y0, (corner & 4) ? z1 : z0);
+                        }
+
+                        // Lerp(a, b, t) = a + t * (b - a)
+                        FloatType xLerps[4];
+                        for (size_t i = 0; i < 4; ++i)
+                        {
+                            xLerps[i] = VecType::Madd(fade[0], VecType::Sub(gradients[i * 2 + 1], gradients[i * 2]), gradients[i * 2]);
+                        }
+                        const FloatType yLerp0 = VecType::Madd(fade[1], VecType::Sub(xLerps[1], xLerps[0]), xLerps[0]);
+                        const FloatType yLerp1 = VecType::Madd(fade[1], VecType::Sub(xLerps[3], xLerps[2]), xLerps[2]);
+                        const FloatType noise = VecType::Madd(fade[2], VecType::Sub(yLerp1, yLerp0), yLerp0);
+
+                        // Remap from [-1, 1] to [0, 1].
+                        out[0] = VecType::Mul(VecType::Add(noise, one), VecType::Splat(0.5f));
+                    });
+                }
+
+                //! Function pointers to the kernels instantiated for one simd vector type, so the vector type can be
+                //! picked at runtime. Each table is instantiated in a translation unit that's compiled for its
+                //! instruction set, see SimdMathBatch.cpp.
+                struct KernelTable
+                {
+                    InstructionSet m_instructionSet;
+                    void (*m_transformPoints)(const float (&matrix)[12], ConstVec3Array, Vec3Array, size_t);
+                    void (*m_transformVectors)(const float (&matrix)[12], ConstVec3Array, Vec3Array, size_t);
+                    void (*m_transformNormals)(const float (&matrix)[12], ConstVec3Array, Vec3Array, size_t);
+                    void (*m_multiplyTransforms)(ConstTransformArray, ConstTransformArray, TransformArray, size_t);
+                    void (*m_overlapsPlanes)(const float (&planes)[6][4], ConstAabbArray, float*, size_t);
+                    void (*m_slerp)(ConstQuaternionArray, ConstQuaternionArray, const float*, QuaternionArray, size_t);
+                    void (*m_slerpConstant)(ConstQuaternionArray, ConstQuaternionArray, float, QuaternionArray, size_t);
+                    void (*m_skinPositions)(const float*, SkinInfluenceArray, ConstVec3Array, Vec3Array, size_t);
+                    void (*m_skinPositionsAndNormals)(const float*, SkinInfluenceArray, ConstVec3Array, ConstVec3Array, Vec3Array, Vec3Array, size_t);
+                    void (*m_perlinNoise)(const int32_t*, ConstVec3Array, float*, size_t);
+                };
+
+                template <typename VecType>
+                constexpr KernelTable MakeKernelTable(InstructionSet instructionSet)
+                {
+                    return KernelTable
+                    {
+                        instructionSet,
+                        &TransformPoints<VecType, true>,
+                        &TransformPoints<VecType, false>,
+                        &TransformNormals<VecType>,
+                        &MultiplyTransforms<VecType>,
+                        &OverlapsPlanes<VecType>,
+                        &Slerp<VecType>,
+                        &Slerp<VecType>,
+                        &SkinPositions<VecType>,
+                        &SkinPositionsAndNormals<VecType>,
+                        &PerlinNoise<VecType>
+                    };
+                }
+
+                //! Implemented in SimdMathBatch_Avx2.cpp and SimdMathBatch_Avx512.cpp. Return nullptr when the
+                //! platform doesn't support the instruction set.
+                const KernelTable* GetAvx2KernelTable();
+                const KernelTable* GetAvx512KernelTable();
+            } // namespace Internal
+        } // namespace Batch
+    } // namespace Simd
+} // namespace AZ
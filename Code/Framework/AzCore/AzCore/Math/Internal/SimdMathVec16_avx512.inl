@@ -0,0 +1,575 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Internal/SimdMathCommon_simd.inl>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace Common
+        {
+            // The shared constants only hold 4 lanes, see the Vec8 specializations.
+            template <>
+            AZ_MATH_INLINE Vec16::FloatType FastLoadConstant<Vec16>(const float* values)
+            {
+                return _mm512_set1_ps(*values);
+            }
+
+
+            template <>
+            AZ_MATH_INLINE Vec16::Int32Type FastLoadConstant<Vec16>(const int32_t* values)
+            {
+                return _mm512_set1_epi32(*values);
+            }
+        }
+
+
+        namespace Avx512
+        {
+            // AVX-512 comparisons produce bit masks, which are expanded to full lanes so Vec16 masks can be combined
+            // and selected with in the same way as the masks of the other vector types. Only AVX-512F instructions
+            // are used, so the bitwise float operations go through the integer domain.
+            AZ_MATH_INLINE __m512 MaskToFloat(__mmask16 mask)
+            {
+                return _mm512_castsi512_ps(_mm512_maskz_set1_epi32(mask, -1));
+            }
+
+
+            AZ_MATH_INLINE __m512i MaskToInt(__mmask16 mask)
+            {
+                return _mm512_maskz_set1_epi32(mask, -1);
+            }
+
+
+            //! Returns a bit mask of the lanes that have their sign bit set, matching the blendv behavior of Select.
+            AZ_MATH_INLINE __mmask16 SignMask(__m512i mask)
+            {
+                return _mm512_cmplt_epi32_mask(mask, _mm512_setzero_si512());
+            }
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::LoadAligned(const float* __restrict addr)
+        {
+            AZ_MATH_ASSERT(IsAligned<64>(addr), "Alignment failure");
+            return _mm512_load_ps(addr);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::LoadAligned(const int32_t* __restrict addr)
+        {
+            AZ_MATH_ASSERT(IsAligned<64>(addr), "Alignment failure");
+            return _mm512_load_si512(addr);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::LoadUnaligned(const float* __restrict addr)
+        {
+            return _mm512_loadu_ps(addr);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::LoadUnaligned(const int32_t* __restrict addr)
+        {
+            return _mm512_loadu_si512(addr);
+        }
+
+
+        AZ_MATH_INLINE void Vec16::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            AZ_MATH_ASSERT(IsAligned<64>(addr), "Alignment failure");
+            _mm512_store_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec16::StoreAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            AZ_MATH_ASSERT(IsAligned<64>(addr), "Alignment failure");
+            _mm512_store_si512(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec16::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm512_storeu_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec16::StoreUnaligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm512_storeu_si512(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec16::StreamAligned(float* __restrict addr, FloatArgType value)
+        {
+            AZ_MATH_ASSERT(IsAligned<64>(addr), "Alignment failure");
+            _mm512_stream_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec16::StreamAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            AZ_MATH_ASSERT(IsAligned<64>(addr), "Alignment failure");
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(addr), value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Splat(float value)
+        {
+            return _mm512_set1_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Splat(int32_t value)
+        {
+            return _mm512_set1_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_add_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_sub_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_mul_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return _mm512_fmadd_ps(mul1, mul2, add);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_div_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Abs(FloatArgType value)
+        {
+            return And(value, CastToFloat(Splat(0x7FFFFFFF)));
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Add(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_add_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Sub(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_sub_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Mul(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_mullo_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Madd(Int32ArgType mul1, Int32ArgType mul2, Int32ArgType add)
+        {
+            return Add(Mul(mul1, mul2), add);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Abs(Int32ArgType value)
+        {
+            return _mm512_abs_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Not(FloatArgType value)
+        {
+            return CastToFloat(Not(CastToInt(value)));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return CastToFloat(And(CastToInt(arg1), CastToInt(arg2)));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return CastToFloat(AndNot(CastToInt(arg1), CastToInt(arg2)));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return CastToFloat(Or(CastToInt(arg1), CastToInt(arg2)));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return CastToFloat(Xor(CastToInt(arg1), CastToInt(arg2)));
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Not(Int32ArgType value)
+        {
+            return _mm512_xor_si512(value, Splat(static_cast<int32_t>(0xFFFFFFFF)));
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::And(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_and_si512(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::AndNot(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_andnot_si512(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Or(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_or_si512(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Xor(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_xor_si512(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Floor(FloatArgType value)
+        {
+            return _mm512_roundscale_ps(value, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Ceil(FloatArgType value)
+        {
+            return _mm512_roundscale_ps(value, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Round(FloatArgType value)
+        {
+            return _mm512_roundscale_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Truncate(FloatArgType value)
+        {
+            return _mm512_roundscale_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_min_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_max_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return Max(min, Min(value, max));
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Min(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_min_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Max(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_max_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Clamp(Int32ArgType value, Int32ArgType min, Int32ArgType max)
+        {
+            return Max(min, Min(value, max));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToFloat(_mm512_cmp_ps_mask(arg1, arg2, _CMP_EQ_OQ));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToFloat(_mm512_cmp_ps_mask(arg1, arg2, _CMP_NEQ_UQ));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToFloat(_mm512_cmp_ps_mask(arg1, arg2, _CMP_GT_OQ));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToFloat(_mm512_cmp_ps_mask(arg1, arg2, _CMP_GE_OQ));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToFloat(_mm512_cmp_ps_mask(arg1, arg2, _CMP_LT_OQ));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToFloat(_mm512_cmp_ps_mask(arg1, arg2, _CMP_LE_OQ));
+        }
+
+
+        AZ_MATH_INLINE bool Vec16::CmpAllEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_cmp_ps_mask(arg1, arg2, _CMP_NEQ_UQ) == 0;
+        }
+
+
+        AZ_MATH_INLINE bool Vec16::CmpAllLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_cmp_ps_mask(arg1, arg2, _CMP_GE_OQ) == 0;
+        }
+
+
+        AZ_MATH_INLINE bool Vec16::CmpAllLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_cmp_ps_mask(arg1, arg2, _CMP_GT_OQ) == 0;
+        }
+
+
+        AZ_MATH_INLINE bool Vec16::CmpAllGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_cmp_ps_mask(arg1, arg2, _CMP_LE_OQ) == 0;
+        }
+
+
+        AZ_MATH_INLINE bool Vec16::CmpAllGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_cmp_ps_mask(arg1, arg2, _CMP_LT_OQ) == 0;
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CmpEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx512::MaskToInt(_mm512_cmpeq_epi32_mask(arg1, arg2));
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CmpNeq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx512::MaskToInt(_mm512_cmpneq_epi32_mask(arg1, arg2));
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CmpGt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx512::MaskToInt(_mm512_cmpgt_epi32_mask(arg1, arg2));
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CmpGtEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx512::MaskToInt(_mm512_cmpge_epi32_mask(arg1, arg2));
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CmpLt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx512::MaskToInt(_mm512_cmplt_epi32_mask(arg1, arg2));
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CmpLtEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx512::MaskToInt(_mm512_cmple_epi32_mask(arg1, arg2));
+        }
+
+
+        AZ_MATH_INLINE bool Vec16::CmpAllEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_cmpneq_epi32_mask(arg1, arg2) == 0;
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return _mm512_mask_blend_ps(Avx512::SignMask(CastToInt(mask)), arg2, arg1);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask)
+        {
+            return _mm512_mask_blend_epi32(Avx512::SignMask(mask), arg2, arg1);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Reciprocal(FloatArgType value)
+        {
+            return Div(Splat(1.0f), value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::ReciprocalEstimate(FloatArgType value)
+        {
+            return _mm512_rcp14_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Mod(FloatArgType value, FloatArgType divisor)
+        {
+            return Sub(value, Mul(Truncate(Div(value, divisor)), divisor));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Wrap(FloatArgType value, FloatArgType minValue, FloatArgType maxValue)
+        {
+            return Common::Wrap<Vec16>(value, minValue, maxValue);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::AngleMod(FloatArgType value)
+        {
+            return Common::AngleMod<Vec16>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Sqrt(FloatArgType value)
+        {
+            return _mm512_sqrt_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::SqrtEstimate(FloatArgType value)
+        {
+            return ReciprocalEstimate(SqrtInvEstimate(value));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::SqrtInv(FloatArgType value)
+        {
+            return Div(Splat(1.0f), Sqrt(value));
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::SqrtInvEstimate(FloatArgType value)
+        {
+            return _mm512_rsqrt14_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Sin(FloatArgType value)
+        {
+            return Common::Sin<Vec16>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Cos(FloatArgType value)
+        {
+            return Common::Cos<Vec16>(value);
+        }
+
+
+        AZ_MATH_INLINE void Vec16::SinCos(FloatArgType value, FloatType& sin, FloatType& cos)
+        {
+            Common::SinCos<Vec16>(value, sin, cos);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Acos(FloatArgType value)
+        {
+            return Common::Acos<Vec16>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Atan(FloatArgType value)
+        {
+            return Common::Atan<Vec16>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Atan2(FloatArgType y, FloatArgType x)
+        {
+            return Common::Atan2<Vec16>(y, x);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::ConvertToFloat(Int32ArgType value)
+        {
+            return _mm512_cvtepi32_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::ConvertToInt(FloatArgType value)
+        {
+            return _mm512_cvttps_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::ConvertToIntNearest(FloatArgType value)
+        {
+            return _mm512_cvtps_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CastToFloat(Int32ArgType value)
+        {
+            return _mm512_castsi512_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CastToInt(FloatArgType value)
+        {
+            return _mm512_castps_si512(value);
+        }
+
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::ZeroFloat()
+        {
+            return _mm512_setzero_ps();
+        }
+
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::ZeroInt()
+        {
+            return _mm512_setzero_si512();
+        }
+    }
+}
@@ -0,0 +1,551 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Internal/SimdMathCommon_simd.inl>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace Common
+        {
+            // The shared constants only hold 4 lanes and always have the same value in every lane, so they're
+            // broadcast instead of being loaded as a full register.
+            template <>
+            AZ_MATH_INLINE Vec8::FloatType FastLoadConstant<Vec8>(const float* values)
+            {
+                return _mm256_broadcast_ss(values);
+            }
+
+
+            template <>
+            AZ_MATH_INLINE Vec8::Int32Type FastLoadConstant<Vec8>(const int32_t* values)
+            {
+                return _mm256_set1_epi32(*values);
+            }
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadAligned(const float* __restrict addr)
+        {
+            AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+            return _mm256_load_ps(addr);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadAligned(const int32_t* __restrict addr)
+        {
+            AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(addr));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadUnaligned(const float* __restrict addr)
+        {
+            return _mm256_loadu_ps(addr);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadUnaligned(const int32_t* __restrict addr)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(addr));
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+            _mm256_store_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+            _mm256_store_si256(reinterpret_cast<__m256i*>(addr), value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm256_storeu_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(addr), value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StreamAligned(float* __restrict addr, FloatArgType value)
+        {
+            AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+            _mm256_stream_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StreamAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(addr), value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Splat(float value)
+        {
+            return _mm256_set1_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Splat(int32_t value)
+        {
+            return _mm256_set1_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_add_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_sub_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_mul_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return _mm256_fmadd_ps(mul1, mul2, add);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_div_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Abs(FloatArgType value)
+        {
+            return And(value, CastToFloat(Splat(0x7FFFFFFF)));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Add(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_add_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Sub(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_sub_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Mul(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_mullo_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Madd(Int32ArgType mul1, Int32ArgType mul2, Int32ArgType add)
+        {
+            return Add(Mul(mul1, mul2), add);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Abs(Int32ArgType value)
+        {
+            return _mm256_abs_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Not(FloatArgType value)
+        {
+            return _mm256_xor_ps(value, CastToFloat(Splat(static_cast<int32_t>(0xFFFFFFFF))));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_and_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_andnot_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_or_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_xor_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Not(Int32ArgType value)
+        {
+            return _mm256_xor_si256(value, Splat(static_cast<int32_t>(0xFFFFFFFF)));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::And(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_and_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::AndNot(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_andnot_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Or(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_or_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Xor(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_xor_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Floor(FloatArgType value)
+        {
+            return _mm256_floor_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Ceil(FloatArgType value)
+        {
+            return _mm256_ceil_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Round(FloatArgType value)
+        {
+            return _mm256_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Truncate(FloatArgType value)
+        {
+            return _mm256_round_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_min_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_max_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return Max(min, Min(value, max));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Min(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_min_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Max(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_max_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Clamp(Int32ArgType value, Int32ArgType min, Int32ArgType max)
+        {
+            return Max(min, Min(value, max));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_EQ_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_NEQ_UQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_GT_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_GE_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_LT_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_LE_OQ);
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_movemask_ps(CmpNeq(arg1, arg2)) == 0;
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_movemask_ps(CmpGtEq(arg1, arg2)) == 0;
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_movemask_ps(CmpGt(arg1, arg2)) == 0;
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_movemask_ps(CmpLtEq(arg1, arg2)) == 0;
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_movemask_ps(CmpLt(arg1, arg2)) == 0;
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpeq_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpNeq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Not(CmpEq(arg1, arg2));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpGt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpgt_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpGtEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Not(CmpLt(arg1, arg2));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpLt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpgt_epi32(arg2, arg1);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpLtEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Not(CmpGt(arg1, arg2));
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_movemask_epi8(CmpNeq(arg1, arg2)) == 0;
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return _mm256_blendv_ps(arg2, arg1, mask);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask)
+        {
+            return _mm256_blendv_epi8(arg2, arg1, mask);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Reciprocal(FloatArgType value)
+        {
+            return Div(Splat(1.0f), value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ReciprocalEstimate(FloatArgType value)
+        {
+            return _mm256_rcp_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Mod(FloatArgType value, FloatArgType divisor)
+        {
+            return Sub(value, Mul(Truncate(Div(value, divisor)), divisor));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Wrap(FloatArgType value, FloatArgType minValue, FloatArgType maxValue)
+        {
+            return Common::Wrap<Vec8>(value, minValue, maxValue);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::AngleMod(FloatArgType value)
+        {
+            return Common::AngleMod<Vec8>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sqrt(FloatArgType value)
+        {
+            return _mm256_sqrt_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::SqrtEstimate(FloatArgType value)
+        {
+            return ReciprocalEstimate(SqrtInvEstimate(value));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::SqrtInv(FloatArgType value)
+        {
+            return Div(Splat(1.0f), Sqrt(value));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::SqrtInvEstimate(FloatArgType value)
+        {
+            return _mm256_rsqrt_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sin(FloatArgType value)
+        {
+            return Common::Sin<Vec8>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Cos(FloatArgType value)
+        {
+            return Common::Cos<Vec8>(value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::SinCos(FloatArgType value, FloatType& sin, FloatType& cos)
+        {
+            Common::SinCos<Vec8>(value, sin, cos);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Acos(FloatArgType value)
+        {
+            return Common::Acos<Vec8>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Atan(FloatArgType value)
+        {
+            return Common::Atan<Vec8>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Atan2(FloatArgType y, FloatArgType x)
+        {
+            return Common::Atan2<Vec8>(y, x);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ConvertToFloat(Int32ArgType value)
+        {
+            return _mm256_cvtepi32_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ConvertToInt(FloatArgType value)
+        {
+            return _mm256_cvttps_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ConvertToIntNearest(FloatArgType value)
+        {
+            return _mm256_cvtps_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CastToFloat(Int32ArgType value)
+        {
+            return _mm256_castsi256_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CastToInt(FloatArgType value)
+        {
+            return _mm256_castps_si256(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ZeroFloat()
+        {
+            return _mm256_setzero_ps();
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ZeroInt()
+        {
+            return _mm256_setzero_si256();
+        }
+    }
+}
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMathBatch.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Plane.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Internal/SimdMathBatch_simd.inl>
+#include <AzCore/std/parallel/atomic.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+#   if defined(AZ_COMPILER_MSVC)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace Batch
+        {
+            namespace
+            {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+                void CpuId(uint32_t leaf, uint32_t (&registers)[4])
+                {
+#   if defined(AZ_COMPILER_MSVC)
+                    int values[4];
+                    __cpuidex(values, static_cast<int>(leaf), 0);
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        registers[i] = static_cast<uint32_t>(values[i]);
+                    }
+#   else
+                    __cpuid_count(leaf, 0, registers[0], registers[1], registers[2], registers[3]);
+#   endif
+                }
+
+                uint64_t GetEnabledRegisterStates()
+                {
+#   if defined(AZ_COMPILER_MSVC)
+                    return _xgetbv(0);
+#   else
+                    // Inline assembly, because the intrinsic requires compiling with xsave support.
+                    uint32_t low;
+                    uint32_t high;
+                    __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+                    return (static_cast<uint64_t>(high) << 32) | low;
+#   endif
+                }
+#endif
+
+                InstructionSet DetectInstructionSet()
+                {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+                    uint32_t registers[4];
+                    CpuId(0, registers);
+                    if (registers[0] < 7)
+                    {
+                        return InstructionSet::Default;
+                    }
+
+                    constexpr uint32_t Fma = 1 << 12;
+                    constexpr uint32_t OsXsave = 1 << 27;
+                    constexpr uint32_t Avx = 1 << 28;
+                    CpuId(1, registers);
+                    if ((registers[2] & (Fma | OsXsave | Avx)) != (Fma | OsXsave | Avx))
+                    {
+                        return InstructionSet::Default;
+                    }
+
+                    // The OS also has to save the wider registers on context switches, xmm/ymm for AVX and the
+                    // opmask/zmm registers for AVX-512.
+                    constexpr uint64_t AvxStates = 0x6;
+                    constexpr uint64_t Avx512States = 0xE6;
+                    const uint64_t enabledStates = GetEnabledRegisterStates();
+                    if ((enabledStates & AvxStates) != AvxStates)
+                    {
+                        return InstructionSet::Default;
+                    }
+
+                    constexpr uint32_t Avx2 = 1 << 5;
+                    constexpr uint32_t Avx512F = 1 << 16;
+                    CpuId(7, registers);
+                    if ((registers[1] & Avx2) == 0)
+                    {
+                        return InstructionSet::Default;
+                    }
+                    if ((registers[1] & Avx512F) != 0 && (enabledStates & Avx512States) == Avx512States)
+                    {
+                        return InstructionSet::Avx512;
+                    }
+                    return InstructionSet::Avx2;
+#else
+                    return InstructionSet::Default;
+#endif
+                }
+
+                const Internal::KernelTable* GetKernelTable(InstructionSet instructionSet)
+                {
+                    static constexpr Internal::KernelTable DefaultKernels = Internal::MakeKernelTable<Vec4>(InstructionSet::Default);
+
+                    // Fall back to narrower instruction sets until one is available.
+                    const Internal::KernelTable* kernels = nullptr;
+                    if (instructionSet == InstructionSet::Avx512)
+                    {
+                        kernels = Internal::GetAvx512KernelTable();
+                        instructionSet = InstructionSet::Avx2;
+                    }
+                    if (kernels == nullptr && instructionSet == InstructionSet::Avx2)
+                    {
+                        kernels = Internal::GetAvx2KernelTable();
+                    }
+                    return kernels ? kernels : &DefaultKernels;
+                }
+
+                AZStd::atomic<const Internal::KernelTable*>& GetActiveKernels()
+                {
+                    static AZStd::atomic<const Internal::KernelTable*> s_kernels{ GetKernelTable(GetSupportedInstructionSet()) };
+                    return s_kernels;
+                }
+
+                const Internal::KernelTable& Kernels()
+                {
+                    return *GetActiveKernels().load(AZStd::memory_order_relaxed);
+                }
+
+                void StoreMatrix(const Matrix3x4& matrix, float (&output)[12])
+                {
+                    for (int32_t row = 0; row < 3; ++row)
+                    {
+                        for (int32_t col = 0; col < 4; ++col)
+                        {
+                            output[row * 4 + col] = matrix.GetElement(row, col);
+                        }
+                    }
+                }
+            }
+
+            InstructionSet GetSupportedInstructionSet()
+            {
+                static const InstructionSet s_supported = DetectInstructionSet();
+                return s_supported;
+            }
+
+            InstructionSet GetInstructionSet()
+            {
+                return Kernels().m_instructionSet;
+            }
+
+            InstructionSet SetInstructionSet(InstructionSet instructionSet)
+            {
+                const InstructionSet supported = GetSupportedInstructionSet();
+                const Internal::KernelTable* kernels = GetKernelTable(instructionSet < supported ? instructionSet : supported);
+                GetActiveKernels().store(kernels, AZStd::memory_order_relaxed);
+                return kernels->m_instructionSet;
+            }
+
+            const char* GetInstructionSetName(InstructionSet instructionSet)
+            {
+                switch (instructionSet)
+                {
+                case InstructionSet::Avx2:
+                    return "AVX2";
+                case InstructionSet::Avx512:
+                    return "AVX-512";
+                default:
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+                    return "SSE";
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+                    return "NEON";
+#else
+                    return "Scalar";
+#endif
+                }
+            }
+
+            void TransformPoints(const Transform& transform, ConstVec3Array points, Vec3Array output, size_t count)
+            {
+                // The rotation is converted to a matrix once, which is cheaper per point than a quaternion rotation.
+                TransformPoints(Matrix3x4::CreateFromTransform(transform), points, output, count);
+            }
+
+            void TransformPoints(const Matrix3x4& matrix, ConstVec3Array points, Vec3Array output, size_t count)
+            {
+                float values[12];
+                StoreMatrix(matrix, values);
+                Kernels().m_transformPoints(values, points, output, count);
+            }
+
+            void TransformVectors(const Transform& transform, ConstVec3Array vectors, Vec3Array output, size_t count)
+            {
+                TransformVectors(Matrix3x4::CreateFromTransform(transform), vectors, output, count);
+            }
+
+            void TransformVectors(const Matrix3x4& matrix, ConstVec3Array vectors, Vec3Array output, size_t count)
+            {
+                float values[12];
+                StoreMatrix(matrix, values);
+                Kernels().m_transformVectors(values, vectors, output, count);
+            }
+
+            void TransformNormals(const Transform& transform, ConstVec3Array normals, Vec3Array output, size_t count)
+            {
+                // A uniform scale doesn't change the direction of normals, so only the rotation is needed.
+                float values[12];
+                StoreMatrix(Matrix3x4::CreateFromQuaternion(transform.GetRotation()), values);
+                Kernels().m_transformNormals(values, normals, output, count);
+            }
+
+            void TransformNormals(const Matrix3x4& matrix, ConstVec3Array normals, Vec3Array output, size_t count)
+            {
+                float values[12];
+                StoreMatrix(matrix.GetInverseFull().GetTranspose3x3(), values);
+                Kernels().m_transformNormals(values, normals, output, count);
+            }
+
+            void MultiplyTransforms(ConstTransformArray lhs, ConstTransformArray rhs, TransformArray output, size_t count)
+            {
+                Kernels().m_multiplyTransforms(lhs, rhs, output, count);
+            }
+
+            void Overlaps(const Frustum& frustum, ConstAabbArray aabbs, bool* output, size_t count)
+            {
+                float planes[Frustum::PlaneId::MAX][4];
+                for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    frustum.GetPlane(planeId).GetPlaneEquationCoefficients().StoreToFloat4(planes[planeId]);
+                }
+
+                // The kernel writes its results as floats, so process the boxes in chunks that fit on the stack.
+                const Internal::KernelTable& kernels = Kernels();
+                constexpr size_t ChunkSize = 256;
+                float results[ChunkSize];
+                for (size_t offset = 0; offset < count; offset += ChunkSize)
+                {
+                    const size_t chunkCount = AZStd::min(ChunkSize, count - offset);
+                    ConstAabbArray chunk;
+                    chunk.m_min = ConstVec3Array(aabbs.m_min.m_x + offset, aabbs.m_min.m_y + offset, aabbs.m_min.m_z + offset);
+                    chunk.m_max = ConstVec3Array(aabbs.m_max.m_x + offset, aabbs.m_max.m_y + offset, aabbs.m_max.m_z + offset);
+                    kernels.m_overlapsPlanes(planes, chunk, results, chunkCount);
+                    for (size_t i = 0; i < chunkCount; ++i)
+                    {
+                        output[offset + i] = results[i] != 0.0f;
+                    }
+                }
+            }
+
+            void Slerp(ConstQuaternionArray from, ConstQuaternionArray to, const float* t, QuaternionArray output, size_t count)
+            {
+                Kernels().m_slerp(from, to, t, output, count);
+            }
+
+            void Slerp(ConstQuaternionArray from, ConstQuaternionArray to, float t, QuaternionArray output, size_t count)
+            {
+                Kernels().m_slerpConstant(from, to, t, output, count);
+            }
+
+            void SkinPositions(const Matrix3x4* jointMatrices, SkinInfluenceArray influences, ConstVec3Array positions,
+                Vec3Array output, size_t count)
+            {
+                static_assert(sizeof(Matrix3x4) == 12 * sizeof(float), "The kernels expect tightly packed row major matrices");
+                Kernels().m_skinPositions(reinterpret_cast<const float*>(jointMatrices), influences, positions, output, count);
+            }
+
+            void SkinPositionsAndNormals(const Matrix3x4* jointMatrices, SkinInfluenceArray influences, ConstVec3Array positions,
+                ConstVec3Array normals, Vec3Array outputPositions, Vec3Array outputNormals, size_t count)
+            {
+                static_assert(sizeof(Matrix3x4) == 12 * sizeof(float), "The kernels expect tightly packed row major matrices");
+                Kernels().m_skinPositionsAndNormals(
+                    reinterpret_cast<const float*>(jointMatrices), influences, positions, normals, outputPositions, outputNormals, count);
+            }
+
+            void PerlinNoise(const int32_t* permutationTable, ConstVec3Array positions, float* output, size_t count)
+            {
+                Kernels().m_perlinNoise(permutationTable, positions, output, count);
+            }
+        } // namespace Batch
+    } // namespace Simd
+} // namespace AZ
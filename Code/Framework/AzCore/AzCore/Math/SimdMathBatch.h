@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    class Frustum;
+    class Matrix3x4;
+    class Transform;
+
+    namespace Simd
+    {
+        //! Batch kernels that apply the same math operation to many values at once.
+        //! Values are passed in structure-of-arrays (SoA) layout, with every component in its own array, so all the
+        //! lanes of a simd register can be filled with the same component of consecutive values. The kernels give
+        //! the same results as calling the matching Vector3, Quaternion, Transform or ShapeIntersection functions
+        //! per value, up to floating point rounding.
+        //! Input and output arrays may be the same arrays, but must not otherwise overlap. Arrays don't need to be
+        //! aligned and the count doesn't need to be a multiple of the simd width.
+        namespace Batch
+        {
+            //! Instruction sets the batch kernels can run with.
+            enum class InstructionSet : uint8_t
+            {
+                Default, //!< 4 lanes with the platform's Simd::Vec4 implementation, SSE, NEON or scalar.
+                Avx2, //!< 8 lanes with AVX2 and FMA.
+                Avx512 //!< 16 lanes with AVX-512F.
+            };
+
+            //! Returns the widest instruction set that's supported by both the platform and the cpu.
+            InstructionSet GetSupportedInstructionSet();
+
+            //! Returns the instruction set the batch kernels currently run with. Defaults to GetSupportedInstructionSet().
+            InstructionSet GetInstructionSet();
+
+            //! Changes the instruction set the batch kernels run with, to compare instruction sets on the same machine.
+            //! Instruction sets that aren't supported fall back to the widest one that is.
+            //! @return The instruction set that was selected.
+            InstructionSet SetInstructionSet(InstructionSet instructionSet);
+
+            const char* GetInstructionSetName(InstructionSet instructionSet);
+
+            //! SoA view of 3 component vectors.
+            struct Vec3Array
+            {
+                float* m_x = nullptr;
+                float* m_y = nullptr;
+                float* m_z = nullptr;
+            };
+
+            struct ConstVec3Array
+            {
+                ConstVec3Array() = default;
+                ConstVec3Array(const float* x, const float* y, const float* z)
+                    : m_x(x), m_y(y), m_z(z) {}
+                ConstVec3Array(const Vec3Array& array)
+                    : m_x(array.m_x), m_y(array.m_y), m_z(array.m_z) {}
+
+                const float* m_x = nullptr;
+                const float* m_y = nullptr;
+                const float* m_z = nullptr;
+            };
+
+            //! SoA view of quaternions stored in x/y/z/w notation.
+            struct QuaternionArray
+            {
+                float* m_x = nullptr;
+                float* m_y = nullptr;
+                float* m_z = nullptr;
+                float* m_w = nullptr;
+            };
+
+            struct ConstQuaternionArray
+            {
+                ConstQuaternionArray() = default;
+                ConstQuaternionArray(const float* x, const float* y, const float* z, const float* w)
+                    : m_x(x), m_y(y), m_z(z), m_w(w) {}
+                ConstQuaternionArray(const QuaternionArray& array)
+                    : m_x(array.m_x), m_y(array.m_y), m_z(array.m_z), m_w(array.m_w) {}
+
+                const float* m_x = nullptr;
+                const float* m_y = nullptr;
+                const float* m_z = nullptr;
+                const float* m_w = nullptr;
+            };
+
+            //! SoA view of transforms, with the same rotation, uniform scale and translation layout as AZ::Transform.
+            struct TransformArray
+            {
+                QuaternionArray m_rotation;
+                float* m_scale = nullptr;
+                Vec3Array m_translation;
+            };
+
+            struct ConstTransformArray
+            {
+                ConstTransformArray() = default;
+                ConstTransformArray(const ConstQuaternionArray& rotation, const float* scale, const ConstVec3Array& translation)
+                    : m_rotation(rotation), m_scale(scale), m_translation(translation) {}
+                ConstTransformArray(const TransformArray& array)
+                    : m_rotation(array.m_rotation), m_scale(array.m_scale), m_translation(array.m_translation) {}
+
+                ConstQuaternionArray m_rotation;
+                const float* m_scale = nullptr;
+                ConstVec3Array m_translation;
+            };
+
+            //! SoA view of axis aligned bounding boxes.
+            struct ConstAabbArray
+            {
+                ConstVec3Array m_min;
+                ConstVec3Array m_max;
+            };
+
+            //! Same as Transform::TransformPoint for every point.
+            void TransformPoints(const Transform& transform, ConstVec3Array points, Vec3Array output, size_t count);
+            //! Same as Matrix3x4::operator* for every point.
+            void TransformPoints(const Matrix3x4& matrix, ConstVec3Array points, Vec3Array output, size_t count);
+
+            //! Same as Transform::TransformVector for every vector.
+            void TransformVectors(const Transform& transform, ConstVec3Array vectors, Vec3Array output, size_t count);
+            //! Same as Matrix3x4::TransformVector for every vector.
+            void TransformVectors(const Matrix3x4& matrix, ConstVec3Array vectors, Vec3Array output, size_t count);
+
+            //! Rotates the normals by the transform and normalizes them. Translation and the uniform scale are ignored.
+            void TransformNormals(const Transform& transform, ConstVec3Array normals, Vec3Array output, size_t count);
+            //! Transforms the normals by the inverse transpose of the 3x3 part of the matrix and normalizes them, so
+            //! normals stay perpendicular to their surface under non-uniform scale and shear.
+            void TransformNormals(const Matrix3x4& matrix, ConstVec3Array normals, Vec3Array output, size_t count);
+
+            //! Same as Transform::operator* for every pair of transforms, lhs[i] * rhs[i].
+            void MultiplyTransforms(ConstTransformArray lhs, ConstTransformArray rhs, TransformArray output, size_t count);
+
+            //! Joint influences of skinned vertices. Influences are stored influence major, so the joint index and weight
+            //! of influence k of vertex i are at index k * vertexCount + i. Vertices with fewer influences should use
+            //! a weight of 0.
+            struct SkinInfluenceArray
+            {
+                const uint32_t* m_jointIndices = nullptr;
+                const float* m_jointWeights = nullptr;
+                size_t m_influenceCount = 0;
+            };
+
+            //! Same as ShapeIntersection::Overlaps(frustum, aabb) for every box.
+            void Overlaps(const Frustum& frustum, ConstAabbArray aabbs, bool* output, size_t count);
+
+            //! Same as Quaternion::Slerp for every pair of quaternions, from[i].Slerp(to[i], t[i]).
+            void Slerp(ConstQuaternionArray from, ConstQuaternionArray to, const float* t, QuaternionArray output, size_t count);
+            //! Same as Quaternion::Slerp for every pair of quaternions, using the same t for all of them.
+            void Slerp(ConstQuaternionArray from, ConstQuaternionArray to, float t, QuaternionArray output, size_t count);
+
+            //! Linear blend skinning, transforms every position by the sum of its joint matrices multiplied by their weights.
+            void SkinPositions(const Matrix3x4* jointMatrices, SkinInfluenceArray influences, ConstVec3Array positions,
+                Vec3Array output, size_t count);
+            //! Same as SkinPositions, also transforms the normals by the 3x3 part of the blended matrix and normalizes them.
+            //! Like most linear blend skinning implementations, this assumes the joints have no non-uniform scale.
+            void SkinPositionsAndNormals(const Matrix3x4* jointMatrices, SkinInfluenceArray influences, ConstVec3Array positions,
+                ConstVec3Array normals, Vec3Array outputPositions, Vec3Array outputNormals, size_t count);
+
+            //! Ken Perlin's improved noise in [0, 1] for every position, same as GradientSignal::PerlinImprovedNoise::GenerateNoise.
+            //! @param permutationTable 512 values, a permutation of 0-255 that's repeated twice.
+            void PerlinNoise(const int32_t* permutationTable, ConstVec3Array positions, float* output, size_t count);
+        } // namespace Batch
+    } // namespace Simd
+} // namespace AZ
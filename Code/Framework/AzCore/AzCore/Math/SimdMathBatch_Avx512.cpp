@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// This file is compiled with AVX-512F enabled, see Platform/<platform>/platform_<platform>.cmake, and is only
+// called after SimdMathBatch.cpp has checked the cpu supports it.
+// Inline functions are emitted in every translation unit that uses them and the linker keeps only one of the copies,
+// so nothing but code that's templated on Vec16 may be instantiated here. Otherwise AVX-512 instructions could leak into
+// functions that are shared with the rest of the engine.
+
+#include <AzCore/Math/SimdMathBatch.h>
+#include <AzCore/Math/SimdMathVec16.h>
+#include <AzCore/Math/Internal/SimdMathBatch_simd.inl>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace Batch
+        {
+            namespace Internal
+            {
+                const KernelTable* GetAvx512KernelTable()
+                {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+                    static constexpr KernelTable Kernels = MakeKernelTable<Vec16>(InstructionSet::Avx512);
+                    return &Kernels;
+#else
+                    return nullptr;
+#endif
+                }
+            } // namespace Internal
+        } // namespace Batch
+    } // namespace Simd
+} // namespace AZ
@@ -0,0 +1,500 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/IAllocator.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/time.h>
+
+#include <cinttypes>
+#include <math.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        namespace Internal
+        {
+            // Per thread sampling state. This is a POD, as it is stored in thread local storage, zero initialized.
+            struct SamplingThreadState
+            {
+                AZ::s64 m_bytesUntilSample;
+                AZ::u64 m_randomState;
+                AZ::u32 m_generation; ///< Sampler generation m_bytesUntilSample was drawn for.
+                bool m_isInSampler; ///< Guards against sampling allocations made by the sampler itself.
+            };
+
+            static AZ_THREAD_LOCAL SamplingThreadState s_samplingThreadState;
+
+            // Returns the distance to the next sample, exponentially distributed with a mean of samplingInterval.
+            static AZ::s64 GetNextSampleDistance(SamplingThreadState& state, size_t samplingInterval)
+            {
+                if (state.m_randomState == 0)
+                {
+                    state.m_randomState = (reinterpret_cast<AZ::u64>(&state) ^ static_cast<AZ::u64>(AZStd::GetTimeNowMicroSecond())) | 1;
+                }
+
+                // xorshift64*
+                state.m_randomState ^= state.m_randomState >> 12;
+                state.m_randomState ^= state.m_randomState << 25;
+                state.m_randomState ^= state.m_randomState >> 27;
+                const AZ::u64 random = state.m_randomState * 2685821657736338717ull;
+
+                // Uniform in (0, 1], so the logarithm is finite.
+                const double uniform = static_cast<double>((random >> 11) + 1) * (1.0 / 9007199254740992.0);
+                return static_cast<AZ::s64>(-log(uniform) * static_cast<double>(samplingInterval)) + 1;
+            }
+
+            // Inverse of the probability that an allocation of byteSize is sampled.
+            static double GetSampleWeight(size_t byteSize, size_t samplingInterval)
+            {
+                return 1.0 / (1.0 - exp(-static_cast<double>(byteSize) / static_cast<double>(samplingInterval)));
+            }
+
+            static AZ::u64 HashCallSite(const IAllocator* allocator, const StackFrame* frames, unsigned int numFrames)
+            {
+                // FNV-1a
+                AZ::u64 hash = 14695981039346656037ull;
+                auto combine = [&hash](AZ::u64 value)
+                {
+                    hash ^= value;
+                    hash *= 1099511628211ull;
+                };
+                combine(reinterpret_cast<AZ::u64>(allocator));
+                for (unsigned int i = 0; i < numFrames; ++i)
+                {
+                    combine(static_cast<AZ::u64>(frames[i].m_programCounter));
+                }
+                return hash;
+            }
+        } // namespace Internal
+
+        //=========================================================================
+        // AllocationSampler
+        //=========================================================================
+        AllocationSampler::AllocationSampler()
+            : m_startTime(AZStd::chrono::system_clock::now())
+        {
+            for (AZStd::atomic<AZ::u32>& count : m_liveFilter)
+            {
+                count.store(0, AZStd::memory_order_relaxed);
+            }
+        }
+
+        //=========================================================================
+        // ~AllocationSampler
+        //=========================================================================
+        AllocationSampler::~AllocationSampler()
+        {
+            Reset();
+        }
+
+        //=========================================================================
+        // SetSamplingInterval
+        //=========================================================================
+        void AllocationSampler::SetSamplingInterval(size_t samplingInterval)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (GetSamplingInterval() == 0 && samplingInterval != 0)
+            {
+                m_startTime = AZStd::chrono::system_clock::now();
+            }
+            m_samplingInterval.store(samplingInterval, AZStd::memory_order_relaxed);
+            m_generation.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+
+        //=========================================================================
+        // Reset
+        //=========================================================================
+        void AllocationSampler::Reset()
+        {
+            // As in RemoveAllocator, the sampler's own deallocations must not re-enter it while the lock is held.
+            Internal::SamplingThreadState& state = Internal::s_samplingThreadState;
+            const bool wasInSampler = state.m_isInSampler;
+            state.m_isInSampler = true;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                for (auto& liveSample : m_liveSamples)
+                {
+                    m_liveFilter[GetLiveFilterIndex(liveSample.first)].fetch_sub(1, AZStd::memory_order_relaxed);
+                }
+                m_liveSamples.clear();
+                for (auto& callSite : m_callSites)
+                {
+                    delete callSite.second;
+                }
+                m_callSites.clear();
+                m_startTime = AZStd::chrono::system_clock::now();
+            }
+            m_generation.fetch_add(1, AZStd::memory_order_relaxed);
+            state.m_isInSampler = wasInSampler;
+        }
+
+        //=========================================================================
+        // RemoveAllocator
+        //=========================================================================
+        void AllocationSampler::RemoveAllocator(const IAllocator* allocator)
+        {
+            // Freeing call sites goes through the OSAllocator, which must not re-enter the sampler while the lock is held.
+            Internal::SamplingThreadState& state = Internal::s_samplingThreadState;
+            const bool wasInSampler = state.m_isInSampler;
+            state.m_isInSampler = true;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                for (auto liveSampleIt = m_liveSamples.begin(); liveSampleIt != m_liveSamples.end();)
+                {
+                    if (liveSampleIt->second.m_callSite->m_allocator == allocator)
+                    {
+                        m_liveFilter[GetLiveFilterIndex(liveSampleIt->first)].fetch_sub(1, AZStd::memory_order_relaxed);
+                        liveSampleIt = m_liveSamples.erase(liveSampleIt);
+                    }
+                    else
+                    {
+                        ++liveSampleIt;
+                    }
+                }
+                for (auto callSiteIt = m_callSites.begin(); callSiteIt != m_callSites.end();)
+                {
+                    if (callSiteIt->second->m_allocator == allocator)
+                    {
+                        delete callSiteIt->second;
+                        callSiteIt = m_callSites.erase(callSiteIt);
+                    }
+                    else
+                    {
+                        ++callSiteIt;
+                    }
+                }
+            }
+            state.m_isInSampler = wasInSampler;
+        }
+
+        //=========================================================================
+        // OnAllocation
+        //=========================================================================
+        void AllocationSampler::OnAllocation(IAllocator* allocator, void* ptr, size_t byteSize, unsigned int suppressStackRecord)
+        {
+            const size_t samplingInterval = GetSamplingInterval();
+            Internal::SamplingThreadState& state = Internal::s_samplingThreadState;
+            if (samplingInterval == 0 || !ptr || state.m_isInSampler)
+            {
+                return;
+            }
+
+            const AZ::u32 generation = m_generation.load(AZStd::memory_order_relaxed);
+            if (state.m_generation != generation)
+            {
+                // The thread's sample distance is missing, or was drawn for a previous interval or before a Reset.
+                state.m_generation = generation;
+                state.m_bytesUntilSample = Internal::GetNextSampleDistance(state, samplingInterval);
+            }
+
+            state.m_bytesUntilSample -= static_cast<AZ::s64>(byteSize);
+            if (state.m_bytesUntilSample > 0)
+            {
+                return;
+            }
+            state.m_bytesUntilSample = Internal::GetNextSampleDistance(state, samplingInterval);
+
+            state.m_isInSampler = true;
+            RecordSample(allocator, ptr, byteSize, suppressStackRecord);
+            state.m_isInSampler = false;
+        }
+
+        //=========================================================================
+        // OnDeallocation
+        //=========================================================================
+        void AllocationSampler::OnDeallocation(void* ptr)
+        {
+            if (!ptr || m_liveFilter[GetLiveFilterIndex(ptr)].load(AZStd::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+            Internal::SamplingThreadState& state = Internal::s_samplingThreadState;
+            if (state.m_isInSampler)
+            {
+                return;
+            }
+
+            state.m_isInSampler = true;
+            RemoveLiveSample(ptr);
+            state.m_isInSampler = false;
+        }
+
+        //=========================================================================
+        // RecordSample
+        //=========================================================================
+        void AllocationSampler::RecordSample(IAllocator* allocator, void* ptr, size_t byteSize, unsigned int suppressStackRecord)
+        {
+            StackFrame frames[MaxStackFrames];
+            // Hide this function, OnAllocation and AllocatorBase::SampleAllocation.
+            const unsigned int numFrames = StackRecorder::Record(frames, MaxStackFrames, suppressStackRecord + 3);
+            const AZ::u64 hash = Internal::HashCallSite(allocator, frames, numFrames);
+            const double weight = Internal::GetSampleWeight(byteSize, GetSamplingInterval());
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            CallSite*& callSite = m_callSites[hash];
+            if (!callSite)
+            {
+                callSite = aznew CallSite();
+                callSite->m_allocator = allocator;
+                callSite->m_numFrames = numFrames;
+                AZStd::copy(frames, frames + numFrames, callSite->m_frames);
+            }
+
+            callSite->m_numAllocationSamples++;
+            callSite->m_allocationSampleBytes += byteSize;
+            callSite->m_numLiveSamples++;
+            callSite->m_liveSampleBytes += byteSize;
+            callSite->m_estimatedAllocations += weight;
+            callSite->m_estimatedAllocatedBytes += weight * byteSize;
+            callSite->m_estimatedLiveAllocations += weight;
+            callSite->m_estimatedLiveBytes += weight * byteSize;
+
+            if (m_liveSamples.emplace(ptr, LiveSample{ callSite, byteSize, weight }).second)
+            {
+                m_liveFilter[GetLiveFilterIndex(ptr)].fetch_add(1, AZStd::memory_order_relaxed);
+            }
+        }
+
+        //=========================================================================
+        // RemoveLiveSample
+        //=========================================================================
+        void AllocationSampler::RemoveLiveSample(void* ptr)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto liveSampleIt = m_liveSamples.find(ptr);
+            if (liveSampleIt == m_liveSamples.end())
+            {
+                return;
+            }
+
+            const LiveSample& liveSample = liveSampleIt->second;
+            CallSite* callSite = liveSample.m_callSite;
+            callSite->m_numLiveSamples--;
+            callSite->m_liveSampleBytes -= liveSample.m_byteSize;
+            callSite->m_estimatedLiveAllocations = AZStd::max(callSite->m_estimatedLiveAllocations - liveSample.m_weight, 0.0);
+            callSite->m_estimatedLiveBytes = AZStd::max(callSite->m_estimatedLiveBytes - liveSample.m_weight * liveSample.m_byteSize, 0.0);
+
+            m_liveSamples.erase(liveSampleIt);
+            m_liveFilter[GetLiveFilterIndex(ptr)].fetch_sub(1, AZStd::memory_order_relaxed);
+        }
+
+        //=========================================================================
+        // GetLiveFilterIndex
+        //=========================================================================
+        size_t AllocationSampler::GetLiveFilterIndex(void* ptr)
+        {
+            // Fibonacci hashing, the low bits of addresses are mostly zero due to alignment.
+            const AZ::u64 address = reinterpret_cast<AZ::u64>(ptr);
+            return static_cast<size_t>((address * 11400714819323198485ull) >> 52) & (LiveFilterSize - 1);
+        }
+
+        //=========================================================================
+        // EnumerateCallSites
+        //=========================================================================
+        void AllocationSampler::EnumerateCallSites(const CallSiteCBType& callback, const IAllocator* allocator) const
+        {
+            Internal::SamplingThreadState& state = Internal::s_samplingThreadState;
+            state.m_isInSampler = true;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                for (const auto& callSite : m_callSites)
+                {
+                    if (allocator && callSite.second->m_allocator != allocator)
+                    {
+                        continue;
+                    }
+                    if (!callback(*callSite.second))
+                    {
+                        break;
+                    }
+                }
+            }
+            state.m_isInSampler = false;
+        }
+
+        //=========================================================================
+        // GetSamplingDuration
+        //=========================================================================
+        AZStd::chrono::milliseconds AllocationSampler::GetSamplingDuration() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::system_clock::now() - m_startTime);
+        }
+
+        //=========================================================================
+        // WriteHeapProfile
+        //=========================================================================
+        bool AllocationSampler::WriteHeapProfile(const char* filePath, const char* allocatorName) const
+        {
+            const size_t samplingInterval = AZStd::max<size_t>(GetSamplingInterval(), 1);
+
+            // Gather the call sites first, so no allocator lock is held while writing the file.
+            using CallSiteList = AZStd::vector<CallSite, OSStdAllocator>;
+            CallSiteList callSites;
+            AZ::u64 totals[4] = { 0, 0, 0, 0 };
+            EnumerateCallSites([&](const CallSite& callSite)
+            {
+                if (!allocatorName || azstricmp(callSite.m_allocator->GetName(), allocatorName) == 0)
+                {
+                    callSites.push_back(callSite);
+                    totals[0] += callSite.m_numLiveSamples;
+                    totals[1] += callSite.m_liveSampleBytes;
+                    totals[2] += callSite.m_numAllocationSamples;
+                    totals[3] += callSite.m_allocationSampleBytes;
+                }
+                return true;
+            });
+
+            AZ::IO::SystemFile file;
+            if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Error("Memory", false, "Failed to open '%s' to write the allocation profile.", filePath);
+                return false;
+            }
+
+            using LineString = AZStd::fixed_string<1024>;
+            auto writeLine = [&file](const LineString& line)
+            {
+                file.Write(line.data(), line.size());
+            };
+
+            writeLine(LineString::format("heap profile: %" PRIu64 ": %" PRIu64 " [ %" PRIu64 ": %" PRIu64 "] @ heap_v2/%zu\n",
+                totals[0], totals[1], totals[2], totals[3], samplingInterval));
+            for (const CallSite& callSite : callSites)
+            {
+                LineString line = LineString::format("%" PRIu64 ": %" PRIu64 " [%" PRIu64 ": %" PRIu64 "] @",
+                    callSite.m_numLiveSamples, callSite.m_liveSampleBytes, callSite.m_numAllocationSamples, callSite.m_allocationSampleBytes);
+                for (unsigned int i = 0; i < callSite.m_numFrames && line.size() + 20 < line.max_size(); ++i)
+                {
+                    line += LineString::format(" 0x%" PRIx64, static_cast<AZ::u64>(callSite.m_frames[i].m_programCounter));
+                }
+                line += '\n';
+                writeLine(line);
+            }
+
+            // pprof needs the memory map of the process to symbolize the addresses, on platforms which provide it.
+            AZ::IO::SystemFile mapsFile;
+            if (mapsFile.Open("/proc/self/maps", AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+            {
+                writeLine("\nMAPPED_LIBRARIES:\n");
+                char buffer[4096];
+                while (AZ::IO::SystemFile::SizeType numRead = mapsFile.Read(sizeof(buffer), buffer))
+                {
+                    file.Write(buffer, numRead);
+                }
+            }
+            return true;
+        }
+
+        //=========================================================================
+        // PrintSummary
+        //=========================================================================
+        void AllocationSampler::PrintSummary(unsigned int maxCallSitesPerAllocator) const
+        {
+            const double seconds = AZStd::max(GetSamplingDuration().count() / 1000.0, 0.001);
+            AZ_TracePrintf("Memory", "Allocation samples of the last %.1f seconds, sampling interval %zu bytes:\n", seconds, GetSamplingInterval());
+
+            AllocatorManager& manager = AllocatorManager::Instance();
+            auto lock = manager.LockAllocators();
+            for (int i = 0; i < manager.GetNumAllocators(); ++i)
+            {
+                const IAllocator* allocator = manager.GetAllocator(i);
+
+                using CallSiteList = AZStd::vector<CallSite, OSStdAllocator>;
+                CallSiteList callSites;
+                double liveBytes = 0.0;
+                double allocatedBytes = 0.0;
+                EnumerateCallSites([&](const CallSite& callSite)
+                {
+                    liveBytes += callSite.m_estimatedLiveBytes;
+                    allocatedBytes += callSite.m_estimatedAllocatedBytes;
+                    callSites.push_back(callSite);
+                    return true;
+                }, allocator);
+                if (callSites.empty())
+                {
+                    continue;
+                }
+
+                AZ_TracePrintf("Memory", "  %s: ~%.2f MB live, ~%.2f MB/s allocated\n", allocator->GetName(),
+                    liveBytes / (1024.0 * 1024.0), allocatedBytes / (1024.0 * 1024.0) / seconds);
+
+                AZStd::sort(callSites.begin(), callSites.end(), [](const CallSite& lhs, const CallSite& rhs)
+                {
+                    return lhs.m_estimatedAllocatedBytes > rhs.m_estimatedAllocatedBytes;
+                });
+                const size_t numCallSites = AZStd::min<size_t>(callSites.size(), maxCallSitesPerAllocator);
+                for (size_t callSiteIndex = 0; callSiteIndex < numCallSites; ++callSiteIndex)
+                {
+                    const CallSite& callSite = callSites[callSiteIndex];
+                    SymbolStorage::StackLine stackLine;
+                    // The first frame is the caller of the allocator.
+                    if (callSite.m_numFrames > 0)
+                    {
+                        SymbolStorage::DecodeFrames(callSite.m_frames, 1, &stackLine);
+                    }
+                    else
+                    {
+                        azstrcpy(stackLine, AZ_ARRAY_SIZE(stackLine), "<unknown>");
+                    }
+                    AZ_TracePrintf("Memory", "    ~%.2f KB/s, ~%.2f KB live: %s\n",
+                        callSite.m_estimatedAllocatedBytes / 1024.0 / seconds, callSite.m_estimatedLiveBytes / 1024.0, stackLine);
+                }
+            }
+        }
+    } // namespace Debug
+
+    static void mem_SampleAllocations(const AZ::ConsoleCommandContainer& arguments)
+    {
+        size_t samplingInterval = Debug::AllocationSampler::DefaultSamplingInterval;
+        if (!arguments.empty())
+        {
+            samplingInterval = static_cast<size_t>(AZStd::stoull(AZStd::string(arguments.front())));
+        }
+        AllocatorManager::Instance().SetAllocationSamplingInterval(samplingInterval);
+        AZ_TracePrintf("Memory", samplingInterval ? "Sampling one allocation every %zu bytes on average.\n" : "Allocation sampling disabled.\n", samplingInterval);
+    }
+
+    static void mem_DumpAllocationSamples(const AZ::ConsoleCommandContainer& arguments)
+    {
+        Debug::AllocationSampler* sampler = AllocatorManager::Instance().GetAllocationSampler();
+        if (!sampler)
+        {
+            AZ_Warning("Memory", false, "Allocation sampling was never enabled, use mem_SampleAllocations first.");
+            return;
+        }
+
+        if (arguments.empty())
+        {
+            sampler->PrintSummary();
+            return;
+        }
+
+        const AZStd::string filePath(arguments[0]);
+        const AZStd::string allocatorName(arguments.size() > 1 ? arguments[1] : AZStd::string_view());
+        if (sampler->WriteHeapProfile(filePath.c_str(), allocatorName.empty() ? nullptr : allocatorName.c_str()))
+        {
+            AZ_TracePrintf("Memory", "Allocation profile written to '%s'.\n", filePath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mem_SampleAllocations, AZ::ConsoleFunctorFlags::Null,
+        "Enables allocation sampling. Parameter: mean number of bytes between samples, defaults to 512KB. 0 disables sampling.");
+    AZ_CONSOLEFREEFUNC(mem_DumpAllocationSamples, AZ::ConsoleFunctorFlags::Null,
+        "Without parameters, prints the allocation rate and live heap of every allocator and its top call sites. "
+        "Parameters: file path [allocator name], writes the allocation samples to a pprof heap profile.");
+} // namespace AZ
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    class IAllocator;
+
+    namespace Debug
+    {
+        /**
+         * Low overhead allocation profiler. Instead of recording every allocation like AllocationRecords, it records
+         * a stack trace for roughly one allocation every N bytes, where the distance between samples is drawn from an
+         * exponential distribution with a mean of N (the sampling interval), as tcmalloc and heapprofd do. Large
+         * allocations are therefore always sampled and the samples are an unbiased estimate of where memory is
+         * allocated.
+         * Samples are aggregated per allocator and call site, both for memory which is still allocated (live heap)
+         * and for all memory allocated since sampling started (allocation rate).
+         *
+         * The sampler is owned by the AllocatorManager, see AllocatorManager::SetAllocationSamplingInterval. It is fed
+         * by AllocatorBase's sampling hooks, so it covers every allocator which reports its allocations. The hooks
+         * are not tied to AZ_MEMORY_PROFILE, so sampling is also available in release builds.
+         */
+        class AllocationSampler
+        {
+        public:
+            static constexpr size_t DefaultSamplingInterval = 512 * 1024;
+            static constexpr unsigned int MaxStackFrames = 32;
+
+            /// Sampled allocations of a single allocator and call site.
+            struct CallSite
+            {
+                AZ_CLASS_ALLOCATOR(CallSite, OSAllocator, 0);
+
+                IAllocator* m_allocator = nullptr;
+                StackFrame m_frames[MaxStackFrames];
+                unsigned int m_numFrames = 0;
+
+                // Raw sample counts, as the pprof heap format expects.
+                AZ::u64 m_numAllocationSamples = 0;
+                AZ::u64 m_allocationSampleBytes = 0;
+                AZ::u64 m_numLiveSamples = 0;
+                AZ::u64 m_liveSampleBytes = 0;
+
+                // Estimated totals, corrected for the sampling probability of every sample.
+                double m_estimatedAllocations = 0.0;
+                double m_estimatedAllocatedBytes = 0.0;
+                double m_estimatedLiveAllocations = 0.0;
+                double m_estimatedLiveBytes = 0.0;
+            };
+
+            /// Call site enumeration callback, return false to stop the enumeration.
+            using CallSiteCBType = AZStd::function<bool(const CallSite&)>;
+
+            AllocationSampler();
+            ~AllocationSampler();
+
+            AllocationSampler(const AllocationSampler&) = delete;
+            AllocationSampler& operator=(const AllocationSampler&) = delete;
+
+            /// Sets the mean number of bytes between samples, 0 disables sampling. Collected samples are kept, the sample
+            /// distance of every thread is redrawn on its next allocation.
+            void SetSamplingInterval(size_t samplingInterval);
+            size_t GetSamplingInterval() const { return m_samplingInterval.load(AZStd::memory_order_relaxed); }
+            bool IsEnabled() const { return GetSamplingInterval() != 0; }
+
+            /// Discards all collected samples, restarts the allocation rate measurement and redraws the sample distances.
+            void Reset();
+
+            /// Discards the samples of an allocator, called by the AllocatorManager when the allocator is unregistered.
+            /// Call sites keep a pointer to their allocator, which must not outlive it.
+            void RemoveAllocator(const IAllocator* allocator);
+
+            //! @{ Allocator hooks, called through AllocatorBase::SampleAllocation and friends. Cheap unless the allocation is sampled.
+            void OnAllocation(IAllocator* allocator, void* ptr, size_t byteSize, unsigned int suppressStackRecord);
+            void OnDeallocation(void* ptr);
+            //! @}
+
+            /// Enumerates all call sites with samples, optionally only the ones of a single allocator.
+            void EnumerateCallSites(const CallSiteCBType& callback, const IAllocator* allocator = nullptr) const;
+
+            /// Returns the time samples have been collected for, used to turn allocated bytes into an allocation rate.
+            AZStd::chrono::milliseconds GetSamplingDuration() const;
+
+            /**
+             * Writes the samples in the pprof legacy heap profile format ("heap_v2"), which can be opened with
+             * "pprof <executable> <file>". pprof corrects the sample counts for the sampling interval itself.
+             * Both the live heap (inuse_space, inuse_objects) and allocations since sampling started (alloc_space,
+             * alloc_objects) are included. If allocatorName is provided, only samples of that allocator are written.
+             */
+            bool WriteHeapProfile(const char* filePath, const char* allocatorName = nullptr) const;
+
+            /// Prints the estimated live heap and allocation rate of every allocator, and its top call sites by allocation rate.
+            void PrintSummary(unsigned int maxCallSitesPerAllocator = 5) const;
+
+        private:
+            struct LiveSample
+            {
+                CallSite* m_callSite;
+                AZ::u64 m_byteSize;
+                double m_weight;
+            };
+
+            static constexpr size_t LiveFilterSize = 4096;
+
+            void RecordSample(IAllocator* allocator, void* ptr, size_t byteSize, unsigned int suppressStackRecord);
+            void RemoveLiveSample(void* ptr);
+            static size_t GetLiveFilterIndex(void* ptr);
+
+            AZStd::atomic<size_t> m_samplingInterval{ 0 };
+            AZStd::atomic<AZ::u32> m_generation{ 1 }; ///< Bumped to invalidate the sample distance of all threads.
+
+            mutable AZStd::mutex m_mutex;
+            AZStd::unordered_map<AZ::u64, CallSite*, AZStd::hash<AZ::u64>, AZStd::equal_to<AZ::u64>, OSStdAllocator> m_callSites;
+            AZStd::unordered_map<void*, LiveSample, AZStd::hash<void*>, AZStd::equal_to<void*>, OSStdAllocator> m_liveSamples;
+            AZStd::chrono::system_clock::time_point m_startTime;
+
+            // Counting filter over the addresses of live samples, so deallocations of memory which wasn't sampled,
+            // which is almost all of them, don't need to take the lock.
+            AZStd::atomic<AZ::u32> m_liveFilter[LiveFilterSize];
+        };
+    } // namespace Debug
+} // namespace AZ
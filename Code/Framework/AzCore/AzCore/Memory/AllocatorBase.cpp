@@ -8,10 +8,19 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
 
 using namespace AZ;
 
+namespace
+{
+    Debug::AllocationSampler* GetAllocationSampler()
+    {
+        return AllocatorManager::IsReady() ? AllocatorManager::Instance().GetAllocationSampler() : nullptr;
+    }
+}
+
 AllocatorBase::AllocatorBase(IAllocatorAllocate* allocationSource, const char* name, const char* desc) :
     IAllocator(allocationSource),
     m_name(name),
@@ -189,6 +198,31 @@ void AllocatorBase::ProfileResize(void* ptr, size_t newSize)
     }
 }
 
+void AllocatorBase::SampleAllocation(void* ptr, size_t byteSize, unsigned int suppressStackRecord)
+{
+    if (Debug::AllocationSampler* sampler = GetAllocationSampler())
+    {
+        sampler->OnAllocation(this, ptr, byteSize, suppressStackRecord);
+    }
+}
+
+void AllocatorBase::SampleDeallocation(void* ptr)
+{
+    if (Debug::AllocationSampler* sampler = GetAllocationSampler())
+    {
+        sampler->OnDeallocation(ptr);
+    }
+}
+
+void AllocatorBase::SampleReallocation(void* ptr, void* newPtr, size_t newSize)
+{
+    if (Debug::AllocationSampler* sampler = GetAllocationSampler())
+    {
+        sampler->OnDeallocation(ptr);
+        sampler->OnAllocation(this, newPtr, newSize, 0);
+    }
+}
+
 bool AllocatorBase::OnOutOfMemory(size_t byteSize, size_t alignment, int flags, const char* name, const char* fileName, int lineNum)
 {
     if (AllocatorManager::IsReady() && AllocatorManager::Instance().m_outOfMemoryListener)
@@ -96,6 +96,13 @@ namespace AZ
         /// Records a resize for profiling.
         void ProfileResize(void* ptr, size_t newSize);
 
+        //! @{ Feeds the allocation sampler, see Debug::AllocationSampler. Unlike the profiling hooks these are not
+        //! compiled out of release builds, and only cost a few instructions while sampling is disabled.
+        void SampleAllocation(void* ptr, size_t byteSize, unsigned int suppressStackRecord);
+        void SampleDeallocation(void* ptr);
+        void SampleReallocation(void* ptr, void* newPtr, size_t newSize);
+        //! @}
+
         /// User allocator should call this function when they run out of memory!
         bool OnOutOfMemory(size_t byteSize, size_t alignment, int flags, const char* name, const char* fileName, int lineNum);
 
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/IAllocator.h>
 
@@ -237,6 +238,12 @@ AllocatorManager::InternalDestroy()
         // Do not actually destroy the lazy allocator as it may have work to do during non-deterministic shutdown
     }
 
+    if (Debug::AllocationSampler* sampler = m_allocationSampler.exchange(nullptr))
+    {
+        sampler->~AllocationSampler();
+        m_mallocSchema->DeAllocate(sampler);
+    }
+
     if (m_data)
     {
         m_data->~InternalData();
@@ -326,6 +333,11 @@ AllocatorManager::UnRegisterAllocator(class IAllocator* alloc)
         EBUS_EVENT(Debug::MemoryDrillerBus, UnregisterAllocator, alloc);
     }
 
+    if (Debug::AllocationSampler* sampler = m_allocationSampler.load(AZStd::memory_order_acquire))
+    {
+        sampler->RemoveAllocator(alloc);
+    }
+
     for (int i = 0; i < m_numAllocators; ++i)
     {
         if (m_allocators[i] == alloc)
@@ -544,6 +556,32 @@ AllocatorManager::ExitProfilingMode()
     AZ_Assert(m_profilingRefcount.load() >= 0, "ExitProfilingMode called without matching EnterProfilingMode");
 }
 
+//=========================================================================
+// SetAllocationSamplingInterval
+//=========================================================================
+void
+AllocatorManager::SetAllocationSamplingInterval(size_t samplingInterval)
+{
+    Debug::AllocationSampler* sampler = m_allocationSampler.load(AZStd::memory_order_acquire);
+    if (!sampler)
+    {
+        if (samplingInterval == 0)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+        sampler = m_allocationSampler.load(AZStd::memory_order_acquire);
+        if (!sampler)
+        {
+            // The sampler uses the OSAllocator for its own data, so it never samples itself.
+            sampler = new (m_mallocSchema->Allocate(sizeof(Debug::AllocationSampler), alignof(Debug::AllocationSampler), 0)) Debug::AllocationSampler();
+            m_allocationSampler.store(sampler, AZStd::memory_order_release);
+        }
+    }
+    sampler->SetSamplingInterval(samplingInterval);
+}
+
 void
 AllocatorManager::DumpAllocators()
 {
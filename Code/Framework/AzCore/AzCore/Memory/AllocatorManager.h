@@ -23,6 +23,11 @@ namespace AZ
     class IAllocator;
     class MallocSchema;
 
+    namespace Debug
+    {
+        class AllocationSampler;
+    }
+
     /**
     * Global allocation manager. It has access to all
     * created allocators IAllocator interface. And control
@@ -100,6 +105,13 @@ namespace AZ
         /// Outputs allocator useage to the console, and also stores the values in m_dumpInfo for viewing in the crash dump
         void DumpAllocators();
 
+        /// Enables low overhead sampling of the allocations of all allocators, see Debug::AllocationSampler.
+        /// Roughly one allocation every samplingInterval bytes is recorded with its call stack, 0 disables sampling.
+        /// Can also be controlled with the mem_SampleAllocations and mem_DumpAllocationSamples console commands.
+        void SetAllocationSamplingInterval(size_t samplingInterval);
+        /// Returns the allocation sampler, nullptr if sampling was never enabled.
+        Debug::AllocationSampler* GetAllocationSampler() const { return m_allocationSampler.load(AZStd::memory_order_acquire); }
+
         struct DumpInfo
         {
             // Must contain only POD types
@@ -179,6 +191,7 @@ namespace AZ
         InternalData*       m_data;
         bool                m_configurationFinalized;
         AZStd::atomic<int>  m_profilingRefcount;
+        AZStd::atomic<Debug::AllocationSampler*> m_allocationSampler{ nullptr }; ///< Created on first use and kept until destruction, allocators may use it at any time.
 
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
         AZStd::unique_ptr<AZ::MallocSchema, void(*)(AZ::MallocSchema*)> m_mallocSchema;
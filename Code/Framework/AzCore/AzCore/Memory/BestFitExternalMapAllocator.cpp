@@ -102,6 +102,7 @@ BestFitExternalMapAllocator::Allocate(size_type byteSize, size_type alignment, i
 
     AZ_Assert(address != 0, "BestFitExternalMapAllocator: Failed to allocate %d bytes aligned on %d (flags: 0x%08x) %s : %s (%d)!", byteSize, alignment, flags, name ? name : "(no name)", fileName ? fileName : "(no file name)", lineNum);
     AZ_MEMORY_PROFILE(ProfileAllocation(address, byteSize, alignment, name, fileName, lineNum, suppressStackRecord + 1));
+    SampleAllocation(address, byteSize, suppressStackRecord + 1);
 
     return address;
 }
@@ -115,6 +116,7 @@ BestFitExternalMapAllocator::DeAllocate(pointer_type ptr, size_type byteSize, si
 {
     byteSize = MemorySizeAdjustedUp(byteSize);
     AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
+    SampleDeallocation(ptr);
 
     (void)byteSize;
     (void)alignment;
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Memory/FrameArenaSchema.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /*!
+        * Template you can use to create your own frame arena allocators, as you can't inherit from FrameArenaAllocator.
+        * This is the case because we use thread local storage and we need a separate "static" instance for each allocator.
+        */
+        template<class Schema>
+        class FrameArenaAllocatorHelper
+            : public SimpleSchemaAllocator<Schema, typename Schema::Descriptor, /* ProfileAllocations */ false, /* ReportOutOfMemory */ true>
+        {
+        public:
+            using Base = SimpleSchemaAllocator<Schema, typename Schema::Descriptor, false, true>;
+            using Descriptor = typename Schema::Descriptor;
+            using pointer_type = typename Base::pointer_type;
+            using size_type = typename Base::size_type;
+            using difference_type = typename Base::difference_type;
+
+            FrameArenaAllocatorHelper(const char* name, const char* desc)
+                : Base(name, desc)
+            {
+            }
+
+            bool Create(const Descriptor& descriptor)
+            {
+                AZ_Assert(this->IsReady() == false, "Allocator was already created!");
+                if (this->IsReady())
+                {
+                    return false;
+                }
+
+                // The schema is created from the descriptor when it's constructed
+                return static_cast<Base*>(this)->Create(descriptor);
+            }
+
+            void Destroy() override
+            {
+                GetFrameArenaSchema()->Destroy();
+                Base::Destroy();
+            }
+
+            AllocatorDebugConfig GetDebugConfig() override
+            {
+                // Allocations are released in bulk by ResetFrame, which allocation records can't follow.
+                // The schema does its own overrun and leak detection in debug builds.
+                return AllocatorDebugConfig().ExcludeFromDebugging();
+            }
+
+            /// Ends the current frame, all memory allocated from this allocator during the frame is released.
+            void ResetFrame()
+            {
+                GetFrameArenaSchema()->ResetFrame();
+            }
+
+            /// Returns the number of frames which have been reset.
+            AZ::u32 GetFrameIndex() const
+            {
+                return static_cast<const Schema*>(this->m_schema)->GetFrameIndex();
+            }
+
+            FrameArenaAllocatorHelper& operator=(const FrameArenaAllocatorHelper&) = delete;
+
+        private:
+            Schema* GetFrameArenaSchema()
+            {
+                return static_cast<Schema*>(this->m_schema);
+            }
+        };
+    }
+
+    template<class Allocator>
+    using FrameArenaBase = Internal::FrameArenaAllocatorHelper<FrameArenaSchemaHelper<Allocator>>;
+
+    /*!
+     * Frame arena allocator, see \ref FrameArenaSchema.
+     * Thread safe linear allocator for per frame scratch memory, e.g. temporary containers used during culling,
+     * animation or replication. All allocations are released together when the frame is reset, which the
+     * ComponentApplication does at the start of every tick if the allocator has been created.
+     * If you want to create your own frame arena, with its own frame boundary, inherit from FrameArenaBase.
+     */
+    class FrameArenaAllocator final
+        : public FrameArenaBase<FrameArenaAllocator>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameArenaAllocator, SystemAllocator, 0);
+        AZ_TYPE_INFO(FrameArenaAllocator, "{6C3B3F8B-6E1D-4E8B-9E0C-2A8D5F1B7C44}");
+
+        using Base = FrameArenaBase<FrameArenaAllocator>;
+
+        FrameArenaAllocator()
+            : Base("FrameArenaAllocator", "Thread safe linear allocator for memory released at the end of the frame")
+        {
+        }
+    };
+
+    typedef AZStdAlloc<FrameArenaAllocator> FrameArenaStdAllocator;
+}
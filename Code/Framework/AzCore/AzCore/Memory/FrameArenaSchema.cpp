@@ -0,0 +1,636 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaSchema.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    namespace FrameArenaInternal
+    {
+        static AZStd::atomic<AZ::u32> s_nextSchemaId{ 1 };
+
+        static constexpr size_t ChunkAlignment = 16;
+
+        struct Chunk
+        {
+            Chunk* m_next;
+            size_t m_size; ///< Usable bytes after the header.
+
+            char* Begin() { return reinterpret_cast<char*>(this) + AZ_SIZE_ALIGN_UP(sizeof(Chunk), ChunkAlignment); }
+            char* End() { return Begin() + m_size; }
+        };
+
+#if defined(AZ_DEBUG_BUILD)
+        // Every arena allocation is preceded by a debug header and followed by a guard. The headers of a thread are
+        // linked so the guards can be validated when the thread's frame is reset. The magic value is stored in the
+        // 4 bytes before the returned pointer. Chunks are kept until the schema is destroyed, so the header of an arena
+        // allocation can always be read, even after its frame ended.
+        static constexpr AZ::u32 ArenaMagic = 0xfa3eaa11;
+        static constexpr AZ::u32 FreedMagic = 0xfa3ef3ee;
+        static constexpr AZ::u32 DeadMagic = 0xcdcdcdcd; ///< Arena memory of a previous frame, after its thread rewound it.
+        static constexpr size_t GuardSize = 8;
+        static constexpr unsigned char GuardByte = 0xfd;
+        static constexpr unsigned char DeadByte = 0xcd;
+
+        struct DebugHeader
+        {
+            DebugHeader* m_previous;
+            AZ::u32 m_size;
+            AZ::u32 m_frameIndex;
+            AZ::u32 m_padding;
+            AZ::u32 m_magic;
+        };
+        static constexpr size_t DebugHeaderSize = sizeof(DebugHeader);
+
+        static AZ::u32 GetMagic(void* ptr)
+        {
+            return *(reinterpret_cast<AZ::u32*>(ptr) - 1);
+        }
+
+        static bool ValidateGuard(const DebugHeader* header)
+        {
+            const unsigned char* guard = reinterpret_cast<const unsigned char*>(header + 1) + header->m_size;
+            for (size_t i = 0; i < GuardSize; ++i)
+            {
+                if (guard[i] != GuardByte)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+#else
+        static constexpr size_t GuardSize = 0;
+        static constexpr size_t DebugHeaderSize = 0;
+#endif
+
+        struct FallbackHeader
+        {
+            FallbackHeader* m_next;
+            void* m_block;
+            size_t m_blockSize;
+        };
+    }
+
+    /**
+     * Per thread state of a FrameArenaSchema. Only the owning thread modifies the arena, the byte counters are
+     * atomic so statistics can be gathered from any thread.
+     */
+    struct FrameArenaThreadData
+    {
+        FrameArenaThreadData* m_next = nullptr;
+
+        FrameArenaInternal::Chunk* m_firstChunk = nullptr;
+        FrameArenaInternal::Chunk* m_lastChunk = nullptr;
+        FrameArenaInternal::Chunk* m_currentChunk = nullptr;
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+
+        // The most recent arena allocation can be resized in place, and rolled back when deallocated.
+        char* m_lastAllocation = nullptr;
+        char* m_lastAllocationStart = nullptr; ///< Cursor before the most recent allocation.
+        size_t m_lastAllocationSize = 0;
+
+        FrameArenaInternal::FallbackHeader* m_fallbackAllocations = nullptr;
+        AZ::u32 m_frameIndex = 0;
+
+        AZStd::atomic<size_t> m_numAllocatedBytes{ 0 };
+        AZStd::atomic<size_t> m_capacity{ 0 };
+        unsigned int m_numChunks = 0;
+
+#if defined(AZ_DEBUG_BUILD)
+        FrameArenaInternal::DebugHeader* m_lastDebugHeader = nullptr;
+#endif
+    };
+
+    //=========================================================================
+    // FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::FrameArenaSchema(GetThreadSlot getThreadSlot)
+        : m_threadSlotGetter(getThreadSlot)
+    {
+    }
+
+    //=========================================================================
+    // ~FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        if (m_schemaId != 0)
+        {
+            Destroy();
+        }
+    }
+
+    //=========================================================================
+    // Create
+    //=========================================================================
+    bool FrameArenaSchema::Create(const Descriptor& desc)
+    {
+        AZ_Assert(m_schemaId == 0, "FrameArenaSchema was already created!");
+
+        m_desc = desc;
+        if (!m_desc.m_chunkAllocator)
+        {
+            m_desc.m_chunkAllocator = &AllocatorInstance<SystemAllocator>::Get();
+        }
+        if (!m_desc.m_fallbackAllocator)
+        {
+            m_desc.m_fallbackAllocator = &AllocatorInstance<SystemAllocator>::Get();
+        }
+        m_desc.m_chunkSize = AZ_SIZE_ALIGN_UP(AZStd::max<size_t>(m_desc.m_chunkSize, 4 * 1024), FrameArenaInternal::ChunkAlignment);
+        m_desc.m_maxChunksPerThread = AZStd::max(m_desc.m_maxChunksPerThread, 1u);
+        // A fresh chunk always has room for an allocation which passes this limit, including alignment, header and guard.
+        m_desc.m_maxArenaAllocationSize = AZStd::min(m_desc.m_maxArenaAllocationSize, m_desc.m_chunkSize / 4);
+
+        m_schemaId = FrameArenaInternal::s_nextSchemaId.fetch_add(1, AZStd::memory_order_relaxed);
+        return true;
+    }
+
+    //=========================================================================
+    // Destroy
+    //=========================================================================
+    bool FrameArenaSchema::Destroy()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        FrameArenaThreadData* threadData = m_threads;
+        while (threadData)
+        {
+            FrameArenaThreadData* nextThreadData = threadData->m_next;
+
+            ReleaseFallbackAllocations(*threadData);
+            FrameArenaInternal::Chunk* chunk = threadData->m_firstChunk;
+            while (chunk)
+            {
+                FrameArenaInternal::Chunk* nextChunk = chunk->m_next;
+                m_desc.m_chunkAllocator->DeAllocate(chunk, reinterpret_cast<char*>(chunk->End()) - reinterpret_cast<char*>(chunk), FrameArenaInternal::ChunkAlignment);
+                chunk = nextChunk;
+            }
+
+            threadData->~FrameArenaThreadData();
+            m_desc.m_chunkAllocator->DeAllocate(threadData, sizeof(FrameArenaThreadData), alignof(FrameArenaThreadData));
+            threadData = nextThreadData;
+        }
+        m_threads = nullptr;
+
+        // Thread slots still referencing this schema are detected by the id mismatch.
+        m_schemaId = 0;
+        return true;
+    }
+
+    //=========================================================================
+    // ResetFrame
+    //=========================================================================
+    void FrameArenaSchema::ResetFrame()
+    {
+#if defined(AZ_DEBUG_BUILD)
+        const size_t numLiveAllocations = m_numLiveAllocations.exchange(0, AZStd::memory_order_relaxed);
+        AZ_Warning("FrameArenaSchema", numLiveAllocations == 0,
+            "%zu allocation(s) of frame %u have not been deallocated before the end of the frame. "
+            "Frame arena memory must not be used once the frame has been reset.", numLiveAllocations, GetFrameIndex());
+#endif
+        // Threads pick up the new frame index on their next allocation, and rewind their arena then.
+        m_frameIndex.fetch_add(1, AZStd::memory_order_release);
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type
+    FrameArenaSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)suppressStackRecord;
+
+        FrameArenaThreadData* threadData = GetThreadData();
+        if (!threadData)
+        {
+            return nullptr;
+        }
+
+        const AZ::u32 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        if (threadData->m_frameIndex != frameIndex)
+        {
+            BeginThreadFrame(*threadData);
+        }
+
+        byteSize = AZStd::max<size_type>(byteSize, 1);
+        alignment = AZStd::max<size_type>(alignment, 1);
+
+        void* ptr = nullptr;
+        if (byteSize + alignment <= m_desc.m_maxArenaAllocationSize)
+        {
+            ptr = AllocateFromArena(*threadData, byteSize, alignment);
+        }
+        if (!ptr)
+        {
+            ptr = AllocateFallback(*threadData, byteSize, alignment, name, fileName, lineNum);
+        }
+
+#if defined(AZ_DEBUG_BUILD)
+        if (ptr)
+        {
+            m_numLiveAllocations.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+#endif
+        return ptr;
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void FrameArenaSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+        if (!ptr)
+        {
+            return;
+        }
+
+#if defined(AZ_DEBUG_BUILD)
+        const AZ::u32 frameIndex = GetFrameIndex();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_fallbackAllocationsMutex);
+            auto fallbackAllocation = m_liveFallbackAllocations.find(ptr);
+            if (fallbackAllocation != m_liveFallbackAllocations.end())
+            {
+                // Allocations of previous frames were already counted by the ResetFrame that ended their frame.
+                if (fallbackAllocation->second == frameIndex)
+                {
+                    m_numLiveAllocations.fetch_sub(1, AZStd::memory_order_relaxed);
+                }
+                m_liveFallbackAllocations.erase(fallbackAllocation);
+                return;
+            }
+        }
+
+        if (!IsArenaAllocation(ptr))
+        {
+            // A fallback allocation whose block was released with its frame, or an address which isn't ours. Neither can
+            // be told apart without touching memory which may have been freed.
+            return;
+        }
+
+        const AZ::u32 magic = FrameArenaInternal::GetMagic(ptr);
+        if (magic == FrameArenaInternal::DeadMagic)
+        {
+            // Memory of a previous frame which its thread has already rewound. ResetFrame reported it as live.
+            return;
+        }
+        if (magic == FrameArenaInternal::FreedMagic)
+        {
+            AZ_Assert(false, "FrameArenaSchema: Address 0x%p was deallocated twice!", ptr);
+            return;
+        }
+        AZ_Assert(magic == FrameArenaInternal::ArenaMagic,
+            "FrameArenaSchema: Address 0x%p was not allocated from this allocator, or its header was overwritten!", ptr);
+        FrameArenaInternal::DebugHeader* header = reinterpret_cast<FrameArenaInternal::DebugHeader*>(ptr) - 1;
+        AZ_Assert(FrameArenaInternal::ValidateGuard(header), "FrameArenaSchema: Memory overrun detected after address 0x%p (%u bytes)!", ptr, header->m_size);
+        header->m_magic = FrameArenaInternal::FreedMagic;
+        if (header->m_frameIndex != frameIndex)
+        {
+            // Already counted by the ResetFrame that ended the allocation's frame.
+            return;
+        }
+        m_numLiveAllocations.fetch_sub(1, AZStd::memory_order_relaxed);
+#endif
+
+        // Memory is released in bulk at the end of the frame, but deallocating the most recent allocation of the
+        // calling thread gives its memory back to the arena right away. This keeps temporaries used like a stack cheap.
+        FrameArenaThreadSlot& slot = m_threadSlotGetter();
+        if (slot.m_schemaId != m_schemaId)
+        {
+            return;
+        }
+        FrameArenaThreadData* threadData = slot.m_data;
+        if (threadData->m_lastAllocation == ptr && threadData->m_frameIndex == m_frameIndex.load(AZStd::memory_order_relaxed))
+        {
+#if defined(AZ_DEBUG_BUILD)
+            threadData->m_lastDebugHeader = threadData->m_lastDebugHeader->m_previous;
+#endif
+            threadData->m_numAllocatedBytes.fetch_sub(threadData->m_cursor - threadData->m_lastAllocationStart, AZStd::memory_order_relaxed);
+            threadData->m_cursor = threadData->m_lastAllocationStart;
+            threadData->m_lastAllocation = nullptr;
+            threadData->m_lastAllocationSize = 0;
+        }
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        FrameArenaThreadSlot& slot = m_threadSlotGetter();
+        if (!ptr || slot.m_schemaId != m_schemaId)
+        {
+            return 0;
+        }
+        FrameArenaThreadData* threadData = slot.m_data;
+        if (threadData->m_lastAllocation != ptr || threadData->m_frameIndex != m_frameIndex.load(AZStd::memory_order_relaxed))
+        {
+            return 0;
+        }
+
+        char* newCursor = threadData->m_lastAllocation + newSize + FrameArenaInternal::GuardSize;
+        if (newSize == 0 || newCursor > threadData->m_end)
+        {
+            return threadData->m_lastAllocationSize;
+        }
+
+        threadData->m_numAllocatedBytes.fetch_add(newCursor - threadData->m_cursor, AZStd::memory_order_relaxed);
+        threadData->m_cursor = newCursor;
+        threadData->m_lastAllocationSize = newSize;
+#if defined(AZ_DEBUG_BUILD)
+        FrameArenaInternal::DebugHeader* header = threadData->m_lastDebugHeader;
+        header->m_size = static_cast<AZ::u32>(newSize);
+        memset(threadData->m_lastAllocation + newSize, FrameArenaInternal::GuardByte, FrameArenaInternal::GuardSize);
+#endif
+        return newSize;
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        (void)ptr;
+        (void)newSize;
+        (void)newAlignment;
+        AZ_Assert(false, "Not supported!");
+        return nullptr;
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::AllocationSize(pointer_type ptr)
+    {
+        // The arena doesn't keep track of individual allocations, only the most recent one of the calling thread is known.
+        FrameArenaThreadSlot& slot = m_threadSlotGetter();
+        if (ptr && slot.m_schemaId == m_schemaId && slot.m_data->m_lastAllocation == ptr)
+        {
+            return slot.m_data->m_lastAllocationSize;
+        }
+        return 0;
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::NumAllocatedBytes() const
+    {
+        size_type numAllocatedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(const_cast<AZStd::mutex&>(m_threadsMutex));
+        for (FrameArenaThreadData* threadData = m_threads; threadData; threadData = threadData->m_next)
+        {
+            numAllocatedBytes += threadData->m_numAllocatedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return numAllocatedBytes;
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Capacity() const
+    {
+        size_type capacity = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(const_cast<AZStd::mutex&>(m_threadsMutex));
+        for (FrameArenaThreadData* threadData = m_threads; threadData; threadData = threadData->m_next)
+        {
+            capacity += threadData->m_capacity.load(AZStd::memory_order_relaxed);
+        }
+        return capacity;
+    }
+
+    //=========================================================================
+    // GetSubAllocator
+    //=========================================================================
+    IAllocatorAllocate* FrameArenaSchema::GetSubAllocator()
+    {
+        return m_desc.m_chunkAllocator;
+    }
+
+    //=========================================================================
+    // GetThreadData
+    //=========================================================================
+    FrameArenaThreadData* FrameArenaSchema::GetThreadData()
+    {
+        AZ_Assert(m_schemaId != 0, "FrameArenaSchema is not created!");
+        FrameArenaThreadSlot& slot = m_threadSlotGetter();
+        if (slot.m_schemaId != m_schemaId)
+        {
+            slot.m_data = CreateThreadData();
+            slot.m_schemaId = slot.m_data ? m_schemaId : 0;
+        }
+        return slot.m_data;
+    }
+
+    //=========================================================================
+    // CreateThreadData
+    //=========================================================================
+    FrameArenaThreadData* FrameArenaSchema::CreateThreadData()
+    {
+        void* memory = m_desc.m_chunkAllocator->Allocate(sizeof(FrameArenaThreadData), alignof(FrameArenaThreadData), 0, "AZ::FrameArenaSchema thread data", __FILE__, __LINE__);
+        if (!memory)
+        {
+            return nullptr;
+        }
+
+        FrameArenaThreadData* threadData = new (memory) FrameArenaThreadData();
+        threadData->m_frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        threadData->m_next = m_threads;
+        m_threads = threadData;
+        return threadData;
+    }
+
+    //=========================================================================
+    // BeginThreadFrame
+    //=========================================================================
+    void FrameArenaSchema::BeginThreadFrame(FrameArenaThreadData& threadData)
+    {
+#if defined(AZ_DEBUG_BUILD)
+        // Validate the guards of every allocation of the previous frame, then overwrite the memory so any use after
+        // the reset stands out.
+        for (FrameArenaInternal::DebugHeader* header = threadData.m_lastDebugHeader; header; header = header->m_previous)
+        {
+            AZ_Assert(FrameArenaInternal::ValidateGuard(header), "FrameArenaSchema: Memory overrun detected after address 0x%p (%u bytes)!", header + 1, header->m_size);
+        }
+        threadData.m_lastDebugHeader = nullptr;
+
+        for (FrameArenaInternal::Chunk* chunk = threadData.m_firstChunk; chunk; chunk = chunk->m_next)
+        {
+            const bool isCurrentChunk = chunk == threadData.m_currentChunk;
+            char* usedEnd = isCurrentChunk ? threadData.m_cursor : chunk->End();
+            memset(chunk->Begin(), FrameArenaInternal::DeadByte, usedEnd - chunk->Begin());
+            if (isCurrentChunk)
+            {
+                break;
+            }
+        }
+#endif
+
+        ReleaseFallbackAllocations(threadData);
+
+        threadData.m_currentChunk = threadData.m_firstChunk;
+        threadData.m_cursor = threadData.m_firstChunk ? threadData.m_firstChunk->Begin() : nullptr;
+        threadData.m_end = threadData.m_firstChunk ? threadData.m_firstChunk->End() : nullptr;
+        threadData.m_lastAllocation = nullptr;
+        threadData.m_lastAllocationStart = nullptr;
+        threadData.m_lastAllocationSize = 0;
+        threadData.m_numAllocatedBytes.store(0, AZStd::memory_order_relaxed);
+        threadData.m_frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+    }
+
+    //=========================================================================
+    // AllocateFromArena
+    //=========================================================================
+    void* FrameArenaSchema::AllocateFromArena(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment)
+    {
+        char* start = threadData.m_cursor;
+        char* ptr = AZ::PointerAlignUp(start + FrameArenaInternal::DebugHeaderSize, alignment);
+        char* newCursor = ptr + byteSize + FrameArenaInternal::GuardSize;
+        if (!start || newCursor > threadData.m_end)
+        {
+            // Move on to the next chunk, reusing the chunks of previous frames before allocating new ones.
+            FrameArenaInternal::Chunk* chunk = threadData.m_currentChunk ? threadData.m_currentChunk->m_next : threadData.m_firstChunk;
+            if (!chunk)
+            {
+                if (threadData.m_numChunks >= m_desc.m_maxChunksPerThread)
+                {
+                    return nullptr;
+                }
+
+                const size_t chunkBlockSize = AZ_SIZE_ALIGN_UP(sizeof(FrameArenaInternal::Chunk), FrameArenaInternal::ChunkAlignment) + m_desc.m_chunkSize;
+                void* memory = m_desc.m_chunkAllocator->Allocate(chunkBlockSize, FrameArenaInternal::ChunkAlignment, 0, "AZ::FrameArenaSchema chunk", __FILE__, __LINE__);
+                if (!memory)
+                {
+                    return nullptr;
+                }
+                chunk = reinterpret_cast<FrameArenaInternal::Chunk*>(memory);
+                chunk->m_next = nullptr;
+                chunk->m_size = m_desc.m_chunkSize;
+                if (threadData.m_lastChunk)
+                {
+                    threadData.m_lastChunk->m_next = chunk;
+                }
+                else
+                {
+                    threadData.m_firstChunk = chunk;
+                }
+                threadData.m_lastChunk = chunk;
+                ++threadData.m_numChunks;
+                threadData.m_capacity.fetch_add(m_desc.m_chunkSize, AZStd::memory_order_relaxed);
+            }
+
+            threadData.m_currentChunk = chunk;
+            start = chunk->Begin();
+            threadData.m_end = chunk->End();
+            ptr = AZ::PointerAlignUp(start + FrameArenaInternal::DebugHeaderSize, alignment);
+            newCursor = ptr + byteSize + FrameArenaInternal::GuardSize;
+            AZ_Assert(newCursor <= threadData.m_end, "FrameArenaSchema: Allocation doesn't fit in an empty chunk, the allocation size limit is wrong.");
+        }
+
+#if defined(AZ_DEBUG_BUILD)
+        FrameArenaInternal::DebugHeader* header = reinterpret_cast<FrameArenaInternal::DebugHeader*>(ptr) - 1;
+        header->m_previous = threadData.m_lastDebugHeader;
+        header->m_size = static_cast<AZ::u32>(byteSize);
+        header->m_frameIndex = threadData.m_frameIndex;
+        header->m_magic = FrameArenaInternal::ArenaMagic;
+        memset(ptr + byteSize, FrameArenaInternal::GuardByte, FrameArenaInternal::GuardSize);
+        threadData.m_lastDebugHeader = header;
+#endif
+
+        threadData.m_numAllocatedBytes.fetch_add(newCursor - threadData.m_cursor, AZStd::memory_order_relaxed);
+        threadData.m_cursor = newCursor;
+        threadData.m_lastAllocation = ptr;
+        threadData.m_lastAllocationStart = start;
+        threadData.m_lastAllocationSize = byteSize;
+        return ptr;
+    }
+
+    //=========================================================================
+    // AllocateFallback
+    //=========================================================================
+    void* FrameArenaSchema::AllocateFallback(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment, const char* name, const char* fileName, int lineNum)
+    {
+        using FrameArenaInternal::FallbackHeader;
+
+        alignment = AZStd::max(alignment, alignof(FallbackHeader));
+        const size_t blockSize = sizeof(FallbackHeader) + alignment + byteSize;
+        void* block = m_desc.m_fallbackAllocator->Allocate(blockSize, alignof(FallbackHeader), 0, name ? name : "AZ::FrameArenaSchema fallback", fileName, lineNum);
+        if (!block)
+        {
+            return nullptr;
+        }
+
+        char* ptr = AZ::PointerAlignUp(reinterpret_cast<char*>(block) + sizeof(FallbackHeader), alignment);
+        FallbackHeader* header = reinterpret_cast<FallbackHeader*>(ptr) - 1;
+        header->m_next = threadData.m_fallbackAllocations;
+        header->m_block = block;
+        header->m_blockSize = blockSize;
+#if defined(AZ_DEBUG_BUILD)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_fallbackAllocationsMutex);
+            m_liveFallbackAllocations.emplace(ptr, threadData.m_frameIndex);
+        }
+#endif
+        threadData.m_fallbackAllocations = header;
+        threadData.m_numAllocatedBytes.fetch_add(byteSize, AZStd::memory_order_relaxed);
+        return ptr;
+    }
+
+    //=========================================================================
+    // ReleaseFallbackAllocations
+    //=========================================================================
+    void FrameArenaSchema::ReleaseFallbackAllocations(FrameArenaThreadData& threadData)
+    {
+#if defined(AZ_DEBUG_BUILD)
+        AZStd::lock_guard<AZStd::mutex> lock(m_fallbackAllocationsMutex);
+#endif
+        FrameArenaInternal::FallbackHeader* header = threadData.m_fallbackAllocations;
+        while (header)
+        {
+            FrameArenaInternal::FallbackHeader* nextHeader = header->m_next;
+#if defined(AZ_DEBUG_BUILD)
+            m_liveFallbackAllocations.erase(header + 1);
+#endif
+            m_desc.m_fallbackAllocator->DeAllocate(header->m_block, header->m_blockSize, alignof(FrameArenaInternal::FallbackHeader));
+            header = nextHeader;
+        }
+        threadData.m_fallbackAllocations = nullptr;
+    }
+
+#if defined(AZ_DEBUG_BUILD)
+    //=========================================================================
+    // IsArenaAllocation
+    //=========================================================================
+    bool FrameArenaSchema::IsArenaAllocation(void* ptr)
+    {
+        // Chunks are only appended to a thread's list, and never released before the schema is destroyed.
+        char* address = reinterpret_cast<char*>(ptr);
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        for (FrameArenaThreadData* threadData = m_threads; threadData; threadData = threadData->m_next)
+        {
+            for (FrameArenaInternal::Chunk* chunk = threadData->m_firstChunk; chunk; chunk = chunk->m_next)
+            {
+                if (address >= chunk->Begin() && address < chunk->End())
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+#endif
+}
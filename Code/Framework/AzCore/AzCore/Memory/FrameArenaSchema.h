@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    struct FrameArenaThreadData;
+
+    /**
+     * Thread local state of a thread using a FrameArenaSchema. The schema id is stored next to the data so a
+     * thread can tell if its data belongs to a schema which has been destroyed since. This is a POD, as it is stored
+     * in thread local storage, zero initialized.
+     */
+    struct FrameArenaThreadSlot
+    {
+        FrameArenaThreadData* m_data;
+        AZ::u32 m_schemaId; ///< Schema ids start at 1.
+    };
+
+    /**
+     * Frame arena schema.
+     * Linear (bump) allocator for short lived, per frame scratch memory. Every thread allocates from its own chunks
+     * without any synchronization, deallocation is a no-op and all memory allocated during a frame is released at once
+     * by ResetFrame. ResetFrame is O(1), each thread rewinds its chunks the next time it allocates. Chunks are kept
+     * between frames, so after warming up a frame doesn't allocate from the system at all.
+     * Allocations which are too large for a chunk, or which don't fit once a thread used all its chunks, fall back to
+     * the fallback allocator and are released in bulk with the rest of the frame.
+     *
+     * IMPORTANT: Memory allocated during a frame must not be used after ResetFrame, and ResetFrame must not be called
+     * while other threads are allocating. In debug builds every allocation is guarded to detect overruns, released
+     * memory is overwritten and ResetFrame reports allocations which haven't been deallocated before the frame ended.
+     */
+    class FrameArenaSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        // Function returning the thread local slot of the calling thread
+        typedef FrameArenaThreadSlot& (* GetThreadSlot)();
+
+        struct Descriptor
+        {
+            Descriptor()
+                : m_chunkSize(256 * 1024)
+                , m_maxChunksPerThread(16)
+                , m_maxArenaAllocationSize(64 * 1024)
+                , m_chunkAllocator(nullptr)
+                , m_fallbackAllocator(nullptr)
+            {}
+
+            size_t              m_chunkSize;                ///< Size of the chunks threads bump allocate from.
+            unsigned int        m_maxChunksPerThread;       ///< Maximum number of chunks per thread, once they are used up allocations fall back to m_fallbackAllocator.
+            size_t              m_maxArenaAllocationSize;   ///< Larger allocations always fall back to m_fallbackAllocator. Clamped to a quarter of m_chunkSize.
+            IAllocatorAllocate* m_chunkAllocator;           ///< Allocator for chunks and thread data, SystemAllocator if not set.
+            IAllocatorAllocate* m_fallbackAllocator;        ///< Allocator for allocations which don't fit in the arena, SystemAllocator if not set.
+        };
+
+        FrameArenaSchema(GetThreadSlot getThreadSlot);
+        ~FrameArenaSchema();
+
+        bool Create(const Descriptor& desc);
+        bool Destroy();
+
+        /// Ends the current frame, all memory allocated from the schema during the frame is released.
+        void ResetFrame();
+        /// Returns the number of times ResetFrame has been called.
+        AZ::u32 GetFrameIndex() const { return m_frameIndex.load(AZStd::memory_order_relaxed); }
+
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord) override;
+        /// Individual allocations are released by ResetFrame, this only validates the allocation in debug builds.
+        void DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment) override;
+        /// Only the most recent allocation of the calling thread can be resized (in place).
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type Capacity() const override;
+        IAllocatorAllocate* GetSubAllocator() override;
+
+    protected:
+        FrameArenaSchema(const FrameArenaSchema&) = delete;
+        FrameArenaSchema& operator=(const FrameArenaSchema&) = delete;
+
+        FrameArenaThreadData* GetThreadData();
+        FrameArenaThreadData* CreateThreadData();
+        void BeginThreadFrame(FrameArenaThreadData& threadData);
+        void* AllocateFromArena(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment);
+        void* AllocateFallback(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment, const char* name, const char* fileName, int lineNum);
+        void ReleaseFallbackAllocations(FrameArenaThreadData& threadData);
+#if defined(AZ_DEBUG_BUILD)
+        bool IsArenaAllocation(void* ptr);
+#endif
+
+        Descriptor m_desc;
+        GetThreadSlot m_threadSlotGetter;
+        AZ::u32 m_schemaId = 0;
+        AZStd::atomic<AZ::u32> m_frameIndex{ 0 };
+
+        AZStd::mutex m_threadsMutex;
+        FrameArenaThreadData* m_threads = nullptr; ///< Intrusive list of the data of all threads which allocated from the schema.
+#if defined(AZ_DEBUG_BUILD)
+        AZStd::atomic<size_t> m_numLiveAllocations{ 0 }; ///< Allocations made during the current frame which haven't been deallocated.
+        // Fallback blocks are returned to the fallback allocator at the end of their frame, so their headers can't be
+        // inspected on deallocation. Instead the live fallback allocations are tracked by address, with their frame index.
+        AZStd::mutex m_fallbackAllocationsMutex;
+        AZStd::unordered_map<void*, AZ::u32, AZStd::hash<void*>, AZStd::equal_to<void*>, OSStdAllocator> m_liveFallbackAllocations;
+#endif
+    };
+
+    /**
+     * Helper class to allow multiple frame arenas that operate independent from each other, as every arena needs
+     * its own thread local storage. Your frame arena allocator should use this class as schema.
+     */
+    template<class Allocator>
+    class FrameArenaSchemaHelper
+        : public FrameArenaSchema
+    {
+    public:
+        FrameArenaSchemaHelper(const Descriptor& desc = Descriptor())
+            : FrameArenaSchema(&GetThreadSlot)
+        {
+            Create(desc);
+        }
+
+    protected:
+        static FrameArenaThreadSlot& GetThreadSlot()
+        {
+            return m_threadSlot;
+        }
+
+        static AZ_THREAD_LOCAL FrameArenaThreadSlot m_threadSlot;
+    };
+
+    template<class Allocator>
+    AZ_THREAD_LOCAL FrameArenaThreadSlot FrameArenaSchemaHelper<Allocator>::m_threadSlot;
+}
@@ -84,6 +84,7 @@ namespace AZ
             {
                 AZ_PROFILE_MEMORY_ALLOC_EX(AZ::Debug::ProfileCategory::MemoryReserved, fileName, lineNum, ptr, byteSize, name ? name : GetName());
                 AZ_MEMORY_PROFILE(ProfileAllocation(ptr, byteSize, alignment, name, fileName, lineNum, suppressStackRecord));
+                SampleAllocation(ptr, byteSize, suppressStackRecord);
             }
 
             AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option") // conditional expression is constant
@@ -104,6 +105,7 @@ namespace AZ
             {
                 AZ_PROFILE_MEMORY_FREE(AZ::Debug::ProfileCategory::MemoryReserved, ptr);
                 AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
+                SampleDeallocation(ptr);
             }
 
             m_schema->DeAllocate(ptr, byteSize, alignment);
@@ -144,6 +146,7 @@ namespace AZ
             {
                 AZ_PROFILE_MEMORY_ALLOC(AZ::Debug::ProfileCategory::MemoryReserved, newPtr, newSize, GetName());
                 AZ_MEMORY_PROFILE(ProfileReallocationEnd(ptr, newPtr, newSize, newAlignment));
+                SampleReallocation(ptr, newPtr, newSize);
             }
 
             AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option") // conditional expression is constant
@@ -256,6 +256,7 @@ SystemAllocator::Allocate(size_type byteSize, size_type alignment, int flags, co
 
     AZ_PROFILE_MEMORY_ALLOC_EX(AZ::Debug::ProfileCategory::MemoryReserved, fileName, lineNum, address, byteSize, name);
     AZ_MEMORY_PROFILE(ProfileAllocation(address, byteSize, alignment, name, fileName, lineNum, suppressStackRecord + 1));
+    SampleAllocation(address, byteSize, suppressStackRecord + 1);
 
     return address;
 }
@@ -270,6 +271,7 @@ SystemAllocator::DeAllocate(pointer_type ptr, size_type byteSize, size_type alig
     byteSize = MemorySizeAdjustedUp(byteSize);
     AZ_PROFILE_MEMORY_FREE(AZ::Debug::ProfileCategory::MemoryReserved, ptr);
     AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
+    SampleDeallocation(ptr);
     m_allocator->DeAllocate(ptr, byteSize, alignment);
 }
 
@@ -287,6 +289,7 @@ SystemAllocator::ReAllocate(pointer_type ptr, size_type newSize, size_type newAl
     pointer_type newAddress = m_allocator->ReAllocate(ptr, newSize, newAlignment);
     AZ_PROFILE_MEMORY_ALLOC(AZ::Debug::ProfileCategory::MemoryReserved, newAddress, newSize, "SystemAllocator realloc");
     AZ_MEMORY_PROFILE(ProfileReallocationEnd(ptr, newAddress, newSize, newAlignment));
+    SampleReallocation(ptr, newAddress, newSize);
 
     return newAddress;
 }
@@ -83,33 +83,58 @@ namespace AZ
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (const Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            const bool hadCollision = keyValue.second->m_hashCollision;
-
-            if (useCount == 0)
+            for (const auto& keyValue : shard.m_dictionary)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
-                delete nameData;
-            }
-            else
-            {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                Internal::NameData* nameData = keyValue.second;
+                const int useCount = keyValue.second->m_useCount;
+                const bool hadCollision = keyValue.second->m_hashCollision;
+
+                if (useCount == 0)
+                {
+                    // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                    AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                }
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        return m_shards[hash >> (32 - ShardCountBits)];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash >> (32 - ShardCountBits)];
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t entryCount = 0;
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+            entryCount += shard.m_dictionary.size();
+        }
+        return entryCount;
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = GetShard(hash);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+        auto iter = shard.m_dictionary.find(hash);
+        if (iter != shard.m_dictionary.end())
         {
             return Name(iter->second);
         }
@@ -135,19 +160,25 @@ namespace AZ
             return AZStd::move(name);
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto iter = m_dictionary.find(hash);
+        // The name doesn't exist in the dictionary, so we have to lock and add it.
+        // Collision resolution probes consecutive hash values, which may live in different shards, so
+        // only the shard owning the hash currently being probed is locked. This is safe because an entry
+        // that has been flagged as colliding is never removed, so a probe sequence can't be invalidated
+        // by another thread once it has moved past an entry.
         bool collisionDetected = false;
         while (true)
         {
+            Shard& shard = GetShard(hash);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+
+            auto iter = shard.m_dictionary.find(hash);
+
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard.m_dictionary.end())
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                shard.m_dictionary.emplace(hash, nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -161,7 +192,6 @@ namespace AZ
                 collisionDetected = true;
                 iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
@@ -185,9 +215,10 @@ namespace AZ
             return;
         }
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        Shard& shard = GetShard(nameData->GetHash());
+        AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
+        // Check m_hashCollision again inside the shard's m_sharedMutex because a new collision could have happened
         // on another thread before taking the lock.
         if (nameData->m_hashCollision)
         {
@@ -201,10 +232,12 @@ namespace AZ
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
+            shard.m_dictionary.erase(nameData->GetHash());
             delete nameData;
         }
 
+        lock.unlock();
+
         ReportStats();
     }
 
@@ -223,34 +256,45 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            // Hold every shard for the duration of the report so the entries being tracked can't be released.
+            size_t entryCount = 0;
+            for (const Shard& shard : m_shards)
             {
-                const size_t nameLength = iter.second->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                shard.m_sharedMutex.lock_shared();
+                entryCount += shard.m_dictionary.size();
+            }
 
-                if (!longestName || longestName->m_name.size() < nameLength)
+            for (const Shard& shard : m_shards)
+            {
+                for (auto& iter : shard.m_dictionary)
                 {
-                    longestName = iter.second;
-                }
+                    const size_t nameLength = iter.second->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = iter.second;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = iter.second;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = iter.second;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = iter.second;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", entryCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -267,6 +311,11 @@ namespace AZ
                 AZ_TracePrintf("NameDictionary", "Most repeated name count:  %d\n", refCount);
             }
 
+            for (const Shard& shard : m_shards)
+            {
+                shard.m_sharedMutex.unlock_shared();
+            }
+
             reportUsage = false;
         }
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
@@ -43,6 +44,9 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! The dictionary is split into shards by the high bits of the name hash, each with its own lock,
+    //! so threads creating and releasing unrelated names don't serialize on a single mutex.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -90,8 +94,24 @@ namespace AZ
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+
+        // Returns the total number of entries across all shards.
+        size_t GetEntryCount() const;
+
+        static constexpr uint32_t ShardCountBits = 6;
+        static constexpr uint32_t ShardCount = 1 << ShardCountBits;
+
+        // A slice of the dictionary covering all hashes with the same high bits. Shards are aligned to
+        // a cache line so the mutexes of neighboring shards don't share one.
+        struct alignas(64) Shard
+        {
+            AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
+            mutable AZStd::shared_mutex m_sharedMutex;
+        };
+
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        AZStd::array<Shard, ShardCount> m_shards;
     };
 }
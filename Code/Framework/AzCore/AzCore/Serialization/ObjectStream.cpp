@@ -118,7 +118,12 @@ namespace AZ
             bool LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags);
 
             // returns true if an element was found at the requested level
-            bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement);
+            // if the load plan of the parent is provided, planElement is set when the element was resolved through it
+            bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement,
+                const SerializeContext::ClassLoadPlan* parentPlan = nullptr, const SerializeContext::ClassLoadPlan::Element** planElement = nullptr);
+            // copies a primitive binary value straight into dataAddress and consumes its end tag, see SerializeContext::ClassLoadPlan
+            // returns false if the element has child elements, which still have to be loaded
+            bool LoadDirectValue(const SerializeContext::ClassLoadPlan::Element& planElement, SerializeContext::DataElement& element, void* dataAddress);
             // used during load to skip the rest of the element including any subelements
             void SkipElement();
 
@@ -385,10 +390,14 @@ namespace AZ
 
             size_t currentContainerElementIndex = 0;    // used to load container elements
 
+            // Binary streams of the current version resolve the members of the class through its compiled load plan
+            const SerializeContext::ClassLoadPlan* loadPlan = (GetType() == ST_BINARY && m_version != 2) ? m_sc->FindClassLoadPlan(parentClassInfo) : nullptr;
+
             while (true)
             {
                 // reset the class info
                 const SerializeContext::ClassData* classData = nullptr;
+                const SerializeContext::ClassLoadPlan::Element* planElement = nullptr;
 
                 bool isConvertedData = false;
                 // read from the converted list (if we have something)
@@ -416,7 +425,7 @@ namespace AZ
                 }
                 else // read from the stream
                 {
-                    if (!ReadElement(*m_sc, classData, element, parentClassInfo, nextLevel, parentClassInfo == nullptr))
+                    if (!ReadElement(*m_sc, classData, element, parentClassInfo, nextLevel, parentClassInfo == nullptr, loadPlan, &planElement))
                     {
                         // we have reached the end of this branch, so exit the loop
                         break;
@@ -595,6 +604,11 @@ namespace AZ
                         dynamicElementMetadata.m_typeId = fieldContainer->m_typeId;
                         classElement = &dynamicElementMetadata;
                     }
+                    else if (planElement && planElement->m_classData == classData)
+                    {
+                        // The element stores exactly the reflected type of the member, which the load plan has already resolved
+                        classElement = planElement->m_classElement;
+                    }
                     else
                     {
                         for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
@@ -701,6 +715,19 @@ namespace AZ
                     }
                 }
 
+                // Primitive members are copied straight into the class, skipping the generic leaf load below
+                if (planElement && classElement == planElement->m_classElement && classData == planElement->m_classData &&
+                    planElement->m_directValueSize != 0 && planElement->m_directValueSize == element.m_dataSize &&
+                    element.m_version == classData->m_version && parentClassPtr)
+                {
+                    void* dataAddress = reinterpret_cast<char*>(parentClassPtr) + classElement->m_offset;
+                    if (!LoadDirectValue(*planElement, element, dataAddress))
+                    {
+                        result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                    }
+                    continue;
+                }
+
                 // Handle version conversions for non-custom serialized classes
                 if (element.m_version < classData->m_version && !classData->m_serializer)
                 {
@@ -1004,12 +1031,50 @@ namespace AZ
             return StorageAddressResult::Success;
         }
 
+        //=========================================================================
+        // LoadDirectValue
+        //=========================================================================
+        bool ObjectStreamImpl::LoadDirectValue(const SerializeContext::ClassLoadPlan::Element& planElement, SerializeContext::DataElement& element, void* dataAddress)
+        {
+            // The value has the same layout as the member, apart from the byte order
+            const size_t valueSize = planElement.m_directValueSize;
+            element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+            [[maybe_unused]] IO::SizeType nBytesRead = element.m_stream->Read(valueSize, dataAddress);
+            AZ_Assert(nBytesRead == valueSize, "Failed trying to read binary element value!");
+            switch (valueSize)
+            {
+            case sizeof(u16):
+                AZStd::endian_swap(*reinterpret_cast<u16*>(dataAddress));
+                break;
+            case sizeof(u32):
+                AZStd::endian_swap(*reinterpret_cast<u32*>(dataAddress));
+                break;
+            case sizeof(u64):
+                AZStd::endian_swap(*reinterpret_cast<u64*>(dataAddress));
+                break;
+            default:
+                break;
+            }
+
+            // Values have no child elements, so the next tag is the end of the element
+            u8 endTag = ST_BINARYFLAG_ELEMENT_END;
+            nBytesRead = m_stream->Read(sizeof(u8), &endTag);
+            AZ_Assert(nBytesRead == sizeof(u8), "Failed trying to read binary element tag!");
+            if (endTag != ST_BINARYFLAG_ELEMENT_END)
+            {
+                m_stream->Seek(-static_cast<IO::OffsetType>(sizeof(u8)), IO::GenericStream::ST_SEEK_CUR);
+                return false;
+            }
+            return true;
+        }
+
         //=========================================================================
         // ReadElement
         // [4/19/2012]
         //=========================================================================
         bool
-        ObjectStreamImpl::ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement)
+        ObjectStreamImpl::ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement,
+            const SerializeContext::ClassLoadPlan* parentPlan, const SerializeContext::ClassLoadPlan::Element** planElement)
         {
             AZ_Assert(element.m_stream != nullptr, "You must provide a stream to store the values!");
             element.m_version = 0;
@@ -1340,15 +1405,28 @@ namespace AZ
 
                 element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
 
-
-                // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
+                // members that store exactly their reflected type were already resolved by the load plan of the parent
+                const SerializeContext::ClassLoadPlan::Element* cachedElement = parentPlan ? parentPlan->FindElement(element.m_nameCrc) : nullptr;
+                if (cachedElement && cachedElement->m_classData && cachedElement->m_classElement->m_typeId == element.m_id)
                 {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                    cd = cachedElement->m_classData;
+                    element.m_id = cachedElement->m_typeId;
+                    if (planElement)
                     {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        *planElement = cachedElement;
+                    }
+                }
+                else
+                {
+                    // find the registered class data
+                    cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                    if (cd)
+                    {
+                        // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                        {
+                            element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        }
                     }
                 }
 
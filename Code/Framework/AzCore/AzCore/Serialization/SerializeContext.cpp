@@ -707,6 +707,122 @@ namespace AZ
         return enumToUnderlyingTypeIdIter != m_enumTypeIdToUnderlyingTypeIdMap.end() ? enumToUnderlyingTypeIdIter->second : enumTypeId;
     }
 
+    namespace LoadPlanInternal
+    {
+        template<class... Types>
+        size_t GetPrimitiveSize(const Uuid& typeId)
+        {
+            size_t size = 0;
+            (void)((typeId == AzTypeInfo<Types>::Uuid() ? (size = sizeof(Types), true) : false) || ...);
+            return size;
+        }
+
+        // Returns the size of members that are stored as a plain big endian value by one of the BinaryValueSerializers
+        // registered in the SerializeContext constructor, or 0 if the member has to be loaded through its ClassData.
+        size_t GetDirectValueSize(const SerializeContext::ClassElement& classElement, const SerializeContext::ClassData* classData)
+        {
+            if (!classData || (classElement.m_flags & SerializeContext::ClassElement::FLG_POINTER) ||
+                !classData->m_serializer || classData->m_eventHandler || classData->m_version != 0)
+            {
+                return 0;
+            }
+            return GetPrimitiveSize<char, AZ::s8, short, int, long, AZ::s64, unsigned char, unsigned short, unsigned int, unsigned long, AZ::u64,
+                float, double, bool>(classData->m_typeId);
+        }
+    } // namespace LoadPlanInternal
+
+    const SerializeContext::ClassLoadPlan::Element* SerializeContext::ClassLoadPlan::FindElement(u32 nameCrc) const
+    {
+        auto elementIt = AZStd::lower_bound(m_elements.begin(), m_elements.end(), nameCrc, [](const Element& element, u32 crc)
+        {
+            return element.m_nameCrc < crc;
+        });
+        return elementIt != m_elements.end() && elementIt->m_nameCrc == nameCrc ? &*elementIt : nullptr;
+    }
+
+    const SerializeContext::ClassLoadPlan* SerializeContext::FindClassLoadPlan(const ClassData* classData) const
+    {
+        if (!m_loadPlansEnabled || !classData || classData->m_container || classData->m_serializer || classData->IsDeprecated())
+        {
+            return nullptr;
+        }
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_loadPlanMutex);
+            auto planIt = m_loadPlans.find(classData);
+            if (planIt != m_loadPlans.end())
+            {
+                return planIt->second.get();
+            }
+        }
+
+        // Compile outside of the lock, if another thread compiled the same plan in the meantime its plan is kept
+        AZStd::unique_ptr<ClassLoadPlan> plan = CompileClassLoadPlan(classData);
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_loadPlanMutex);
+        auto insertResult = m_loadPlans.emplace(classData, AZStd::move(plan));
+        return insertResult.first->second.get();
+    }
+
+    AZStd::unique_ptr<SerializeContext::ClassLoadPlan> SerializeContext::CompileClassLoadPlan(const ClassData* classData) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        auto plan = AZStd::make_unique<ClassLoadPlan>();
+        plan->m_classData = classData;
+        plan->m_version = classData->m_version;
+        plan->m_elements.reserve(classData->m_elements.size());
+        for (const ClassElement& classElement : classData->m_elements)
+        {
+            auto elementIt = AZStd::lower_bound(plan->m_elements.begin(), plan->m_elements.end(), classElement.m_nameCrc,
+                [](const ClassLoadPlan::Element& element, u32 crc)
+            {
+                return element.m_nameCrc < crc;
+            });
+            if (elementIt != plan->m_elements.end() && elementIt->m_nameCrc == classElement.m_nameCrc)
+            {
+                // The ObjectStream uses the first element with a matching name
+                continue;
+            }
+
+            ClassLoadPlan::Element element;
+            element.m_nameCrc = classElement.m_nameCrc;
+            element.m_classElement = &classElement;
+            // Resolve the class data the same way the ObjectStream does for an element of the reflected type
+            element.m_classData = FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+            element.m_typeId = classElement.m_typeId;
+            if (element.m_classData)
+            {
+                if (GenericClassInfo* genericClassInfo = FindGenericClassInfo(element.m_classData->m_typeId))
+                {
+                    element.m_typeId = genericClassInfo->GetSpecializedTypeId();
+                }
+                if (element.m_classData->IsDeprecated())
+                {
+                    element.m_classData = nullptr;
+                }
+            }
+            element.m_directValueSize = LoadPlanInternal::GetDirectValueSize(classElement, element.m_classData);
+            plan->m_elements.insert(elementIt, element);
+        }
+        return plan;
+    }
+
+    void SerializeContext::SetLoadPlansEnabled(bool enabled)
+    {
+        m_loadPlansEnabled = enabled;
+    }
+
+    bool SerializeContext::AreLoadPlansEnabled() const
+    {
+        return m_loadPlansEnabled;
+    }
+
+    void SerializeContext::InvalidateLoadPlans()
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_loadPlanMutex);
+        m_loadPlans.clear();
+    }
+
     void SerializeContext::RegisterGenericClassInfo(const Uuid& classId, GenericClassInfo* genericClassInfo, const CreateAnyFunc& createAnyFunc)
     {
         if (!genericClassInfo)
@@ -714,6 +830,8 @@ namespace AZ
             return;
         }
 
+        InvalidateLoadPlans();
+
         if (IsRemovingReflection())
         {
             RemoveGenericClassInfo(genericClassInfo);
@@ -2795,6 +2913,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        InvalidateLoadPlans();
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
@@ -29,6 +29,7 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -1094,6 +1095,42 @@ namespace AZ
         */
         const TypeId& GetUnderlyingTypeId(const TypeId& enumTypeId) const;
 
+        /**
+         * Compiled layout of a reflected class, used by the ObjectStream to load binary data without searching the
+         * reflected elements and the class data of every element in the stream.
+         * A plan is compiled the first time the current version of a class is loaded, and is cached by the
+         * SerializeContext until the reflection changes.
+         */
+        struct ClassLoadPlan
+        {
+            struct Element
+            {
+                u32 m_nameCrc = 0;
+                const ClassElement* m_classElement = nullptr;
+                const ClassData* m_classData = nullptr; ///< Class data of stream elements that store exactly the reflected type of the member.
+                Uuid m_typeId; ///< Type id of those stream elements after the lookup of their GenericClassInfo.
+                size_t m_directValueSize = 0; ///< Non zero if the member is a primitive stored by value, which can be copied straight into the class.
+            };
+
+            /// Returns the element with the given name crc, or nullptr if the class has no such element.
+            const Element* FindElement(u32 nameCrc) const;
+
+            const ClassData* m_classData = nullptr;
+            unsigned int m_version = 0;
+            AZStd::vector<Element> m_elements; ///< Sorted by name crc.
+        };
+
+        /**
+         * Returns the load plan of a class with reflected elements, compiling it on first use.
+         * Returns nullptr for containers, classes with a custom serializer, or if load plans are disabled.
+         * This function is thread safe, but the reflection must not change while plans are in use.
+         */
+        const ClassLoadPlan* FindClassLoadPlan(const ClassData* classData) const;
+
+        /// Load plans are enabled by default, disable them to make the ObjectStream search the reflection for every element.
+        void SetLoadPlansEnabled(bool enabled);
+        bool AreLoadPlansEnabled() const;
+
     private:
 
         /// Enumerate function called to enumerate an azrtti hierarchy
@@ -1101,6 +1138,9 @@ namespace AZ
 
         /// Remove class data
         void RemoveClassData(ClassData* classData);
+        /// Drops all cached load plans, called whenever the reflection changes
+        void InvalidateLoadPlans();
+        AZStd::unique_ptr<ClassLoadPlan> CompileClassLoadPlan(const ClassData* classData) const;
         /// Removes the GenericClassInfo from the GenericClassInfoMap
         void RemoveGenericClassInfo(GenericClassInfo* genericClassInfo);
 
@@ -1337,6 +1377,10 @@ namespace AZ
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
 
+        mutable AZStd::shared_mutex m_loadPlanMutex;
+        mutable AZStd::unordered_map<const ClassData*, AZStd::unique_ptr<ClassLoadPlan>> m_loadPlans; ///< Compiled load plans, see FindClassLoadPlan
+        bool m_loadPlansEnabled = true;
+
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
 
@@ -1888,6 +1932,8 @@ namespace AZ
         const Uuid& typeUuid = AzTypeInfo<T>::Uuid();
         const char* name = AzTypeInfo<T>::Name();
 
+        InvalidateLoadPlans();
+
         if (IsRemovingReflection())
         {
             auto mapIt = m_uuidMap.find(typeUuid);
@@ -146,6 +146,31 @@ namespace AZ
             { AZ_UNUSED(path); AZ_UNUSED(valueName); AZ_UNUSED(type); AZ_UNUSED(value); }
         };
 
+        //! Caches the location of a value in the registry so it can be read repeatedly without resolving the JSON
+        //! pointer path on every call. Any modification to the registry invalidates the cached location, after which
+        //! the path is resolved again on the next read. Handles can be shared between threads as they're only
+        //! accessed while the registry is locked, and can be used with multiple registries.
+        class PathHandle
+        {
+        public:
+            PathHandle() = default;
+            explicit PathHandle(AZStd::string_view path)
+                : m_path(path)
+            {}
+
+            AZStd::string_view GetPath() const { return m_path; }
+
+        private:
+            friend class SettingsRegistryImpl;
+
+            AZStd::string m_path;
+            //! Location of the value in the registry the handle was last resolved against.
+            mutable const void* m_value{ nullptr };
+            //! Generation of the registry the handle was last resolved against. Generations are unique across all
+            //! registries in the process, so a matching generation also means the handle was resolved by the same registry.
+            mutable u64 m_generation{ 0 };
+        };
+
         SettingsRegistryInterface() = default;
         AZ_DISABLE_COPY_MOVE(SettingsRegistryInterface);
         virtual ~SettingsRegistryInterface() = default;
@@ -191,6 +216,20 @@ namespace AZ
         //! @return Whether or not the value was retrieved. An invalid path or type-mismatch will return false;
         virtual bool Get(AZStd::string& result, AZStd::string_view path) const = 0;
         virtual bool Get(FixedValueString& result, AZStd::string_view path) const = 0;
+
+        //! Versions of GetType and Get that read the value through a handle. The path of the handle is only resolved
+        //! the first time and after the registry has been modified, otherwise the value is read directly.
+        //! @param result The target to write the result to.
+        //! @param handle The handle with the path to the value.
+        //! @return Whether or not the value was retrieved. An invalid path or type-mismatch will return false;
+        virtual Type GetType(const PathHandle& handle) const = 0;
+        virtual bool Get(bool& result, const PathHandle& handle) const = 0;
+        virtual bool Get(s64& result, const PathHandle& handle) const = 0;
+        virtual bool Get(u64& result, const PathHandle& handle) const = 0;
+        virtual bool Get(double& result, const PathHandle& handle) const = 0;
+        virtual bool Get(AZStd::string& result, const PathHandle& handle) const = 0;
+        virtual bool Get(FixedValueString& result, const PathHandle& handle) const = 0;
+
         //! Gets the object value at the provided path serialized to the target struct/class. Classes retrieved
         //! through this call needs to be registered with the Serialize Context.
         //! Prefer to use GetObject(T& result, AZStd::string_view path) over this one.
@@ -96,6 +96,28 @@ namespace AZ::SettingsRegistryConsoleUtils
         ConsoleDumpSettingsRegistryValue(settingsRegistry, { "" });
     };
 
+    static void ConsoleStoreSettingsRegistrySnapshot(SettingsRegistryInterface& settingsRegistry, const ConsoleCommandContainer& commandArgs)
+    {
+        if (commandArgs.size() != 1)
+        {
+            AZ_Error("SettingsRegistryConsoleUtils", false, "The %s command requires exactly one file path argument.",
+                SettingsRegistryStoreSnapshot);
+            return;
+        }
+
+        SettingsRegistryInterface::Specializations specializations;
+        AZ::SettingsRegistryMergeUtils::QuerySpecializationsFromRegistry(settingsRegistry, specializations);
+
+        AZStd::string_view filePath = commandArgs.front();
+        if (AZ::SettingsRegistryMergeUtils::StoreSettingsRegistrySnapshot(settingsRegistry, filePath, specializations))
+        {
+            const auto snapshotOutput = AZ::SettingsRegistryInterface::FixedValueString::format(
+                R"(Successfully stored a snapshot of the global settings registry to "%.*s")" "\n",
+                aznumeric_cast<int>(filePath.size()), filePath.data());
+            AZ::Debug::Trace::Output("SettingsRegistry", snapshotOutput.c_str());
+        }
+    };
+
     [[nodiscard]] ConsoleFunctorHandle RegisterAzConsoleCommands(SettingsRegistryInterface& registry, AZ::IConsole& azConsole)
     {
         ConsoleFunctorHandle resultHandle{};
@@ -115,6 +137,10 @@ namespace AZ::SettingsRegistryConsoleUtils
         resultHandle.m_consoleFunctors.emplace_back(azConsole, SettingsRegistryDumpAll,
             R"(Dumps all values from the global settings registry)" "\n",
             ConsoleFunctorFlags::Null, AZ::TypeId::CreateNull(), registry, &ConsoleDumpAllSettingsRegistryValues);
+        resultHandle.m_consoleFunctors.emplace_back(azConsole, SettingsRegistryStoreSnapshot,
+            R"(Stores a binary snapshot of the settings merged from registry files that can be loaded at startup without parsing)" "\n"
+            R"(@param file_path - path of the snapshot file to write)" "\n",
+            ConsoleFunctorFlags::Null, AZ::TypeId::CreateNull(), registry, &ConsoleStoreSettingsRegistrySnapshot);
 
         return resultHandle;
     }
@@ -14,11 +14,19 @@
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 
 namespace AZ
 {
+    namespace SettingsRegistryImplInternal
+    {
+        //! Shared by all registries so a generation identifies both the registry and the state of its settings.
+        static AZStd::atomic<u64> s_nextGeneration{ 1 };
+    }
+
     template<typename T>
     bool SettingsRegistryImpl::SetValueInternal(AZStd::string_view path, T value, SettingsRegistryInterface::Type type)
     {
@@ -56,6 +64,7 @@ namespace AZ
                 static_assert(!AZStd::is_same_v<T, T>, "SettingsRegistryImpl::SetValueInternal called with unsupported type.");
             }
 
+            IncrementGeneration();
             m_notifiers.Signal(path, type);
             return true;
         }
@@ -75,52 +84,58 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
-            const rapidjson::Value* value = pointer.Get(m_settings);
-            if constexpr (AZStd::is_same_v<T, bool>)
-            {
-                if (value && value->IsBool())
-                {
-                    result = value->GetBool();
-                    return true;
-                }
-            }
-            else if constexpr (AZStd::is_same_v<T, s64>)
+            return ReadValueInternal(result, pointer.Get(m_settings));
+        }
+        return false;
+    }
+
+    template<typename T>
+    bool SettingsRegistryImpl::ReadValueInternal(T& result, const rapidjson::Value* value) const
+    {
+        if constexpr (AZStd::is_same_v<T, bool>)
+        {
+            if (value && value->IsBool())
             {
-                if (value && value->IsInt64())
-                {
-                    result = value->GetInt64();
-                    return true;
-                }
+                result = value->GetBool();
+                return true;
             }
-            else if constexpr (AZStd::is_same_v<T, u64>)
+        }
+        else if constexpr (AZStd::is_same_v<T, s64>)
+        {
+            if (value && value->IsInt64())
             {
-                if (value && value->IsUint64())
-                {
-                    result = value->GetUint64();
-                    return true;
-                }
+                result = value->GetInt64();
+                return true;
             }
-            else if constexpr (AZStd::is_same_v<T, double>)
+        }
+        else if constexpr (AZStd::is_same_v<T, u64>)
+        {
+            if (value && value->IsUint64())
             {
-                if (value && value->IsDouble())
-                {
-                    result = value->GetDouble();
-                    return true;
-                }
+                result = value->GetUint64();
+                return true;
             }
-            else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, SettingsRegistryInterface::FixedValueString>)
+        }
+        else if constexpr (AZStd::is_same_v<T, double>)
+        {
+            if (value && value->IsDouble())
             {
-                if (value && value->IsString())
-                {
-                    result.append(value->GetString(), value->GetStringLength());
-                    return true;
-                }
+                result = value->GetDouble();
+                return true;
             }
-            else
+        }
+        else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, SettingsRegistryInterface::FixedValueString>)
+        {
+            if (value && value->IsString())
             {
-                static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::GetValueInternal called with unsupported type.");
+                result.append(value->GetString(), value->GetStringLength());
+                return true;
             }
         }
+        else
+        {
+            static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::ReadValueInternal called with unsupported type.");
+        }
         return false;
     }
 
@@ -130,6 +145,12 @@ namespace AZ
 
         rapidjson::Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY);
         pointer.Create(m_settings, m_settings.GetAllocator()).SetArray();
+        IncrementGeneration();
+    }
+
+    void SettingsRegistryImpl::IncrementGeneration()
+    {
+        m_generation = SettingsRegistryImplInternal::s_nextGeneration.fetch_add(1, AZStd::memory_order_relaxed);
     }
 
     void SettingsRegistryImpl::SetContext(SerializeContext* context)
@@ -247,30 +268,102 @@ namespace AZ
             const rapidjson::Value* value = pointer.Get(m_settings);
             if (value)
             {
-                switch (value->GetType())
-                {
-                case rapidjson::Type::kNullType:
-                    return Type::Null;
-                case rapidjson::Type::kFalseType:
-                    return Type::Boolean;
-                case rapidjson::Type::kTrueType:
-                    return Type::Boolean;
-                case rapidjson::Type::kObjectType:
-                    return Type::Object;
-                case rapidjson::Type::kArrayType:
-                    return Type::Array;
-                case rapidjson::Type::kStringType:
-                    return Type::String;
-                case rapidjson::Type::kNumberType:
-                    return 
-                        value->IsDouble() ? Type::FloatingPoint :
-                        Type::Integer;
-                }
+                return GetValueType(*value);
             }
         }
         return Type::NoType;
     }
 
+    SettingsRegistryInterface::Type SettingsRegistryImpl::GetValueType(const rapidjson::Value& value)
+    {
+        switch (value.GetType())
+        {
+        case rapidjson::Type::kNullType:
+            return Type::Null;
+        case rapidjson::Type::kFalseType:
+            return Type::Boolean;
+        case rapidjson::Type::kTrueType:
+            return Type::Boolean;
+        case rapidjson::Type::kObjectType:
+            return Type::Object;
+        case rapidjson::Type::kArrayType:
+            return Type::Array;
+        case rapidjson::Type::kStringType:
+            return Type::String;
+        case rapidjson::Type::kNumberType:
+            return
+                value.IsDouble() ? Type::FloatingPoint :
+                Type::Integer;
+        }
+        return Type::NoType;
+    }
+
+    SettingsRegistryInterface::Type SettingsRegistryImpl::GetType(const PathHandle& handle) const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        const rapidjson::Value* value = ResolveHandle(handle);
+        return value ? GetValueType(*value) : Type::NoType;
+    }
+
+    bool SettingsRegistryImpl::Get(bool& result, const PathHandle& handle) const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        return ReadValueInternal(result, ResolveHandle(handle));
+    }
+
+    bool SettingsRegistryImpl::Get(s64& result, const PathHandle& handle) const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        return ReadValueInternal(result, ResolveHandle(handle));
+    }
+
+    bool SettingsRegistryImpl::Get(u64& result, const PathHandle& handle) const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        return ReadValueInternal(result, ResolveHandle(handle));
+    }
+
+    bool SettingsRegistryImpl::Get(double& result, const PathHandle& handle) const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        return ReadValueInternal(result, ResolveHandle(handle));
+    }
+
+    bool SettingsRegistryImpl::Get(AZStd::string& result, const PathHandle& handle) const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        return ReadValueInternal(result, ResolveHandle(handle));
+    }
+
+    bool SettingsRegistryImpl::Get(FixedValueString& result, const PathHandle& handle) const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        return ReadValueInternal(result, ResolveHandle(handle));
+    }
+
+    u64 SettingsRegistryImpl::GetGeneration() const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        return m_generation;
+    }
+
+    const rapidjson::Value* SettingsRegistryImpl::ResolveHandle(const PathHandle& handle) const
+    {
+        if (handle.m_generation != m_generation)
+        {
+            // The handle was resolved against another registry or the settings have changed since, which may have
+            // moved or removed the value.
+            handle.m_value = nullptr;
+            rapidjson::Pointer pointer(handle.m_path.c_str(), handle.m_path.size());
+            if (pointer.IsValid())
+            {
+                handle.m_value = pointer.Get(m_settings);
+            }
+            handle.m_generation = m_generation;
+        }
+        return static_cast<const rapidjson::Value*>(handle.m_value);
+    }
+
     bool SettingsRegistryImpl::Get(bool& result, AZStd::string_view path) const
     {
         AZStd::scoped_lock lock(m_settingMutex);
@@ -388,6 +481,7 @@ namespace AZ
             {
                 rapidjson::Value& setting = pointer.Create(m_settings, m_settings.GetAllocator());
                 setting = AZStd::move(store);
+                IncrementGeneration();
                 m_notifiers.Signal(path, Type::Object);
                 return true;
             }
@@ -411,6 +505,7 @@ namespace AZ
             return false;
         }
 
+        IncrementGeneration();
         return pointerPath.Erase(m_settings);
     }
 
@@ -534,6 +629,7 @@ namespace AZ
 
         JsonSerializationResult::ResultCode mergeResult =
             JsonSerialization::ApplyPatch(m_settings, m_settings.GetAllocator(), jsonPatch, mergeApproach);
+        IncrementGeneration();
         if (mergeResult.GetProcessing() != JsonSerializationResult::Processing::Completed)
         {
             AZ_Error("Settings Registry", false, "Failed to fully merge data into registry.");
@@ -563,6 +659,7 @@ namespace AZ
         }
 
         AZStd::scoped_lock lock(m_settingMutex);
+        IncrementGeneration();
 
         bool result = false;
         if (path[path.length()] == 0)
@@ -612,6 +709,10 @@ namespace AZ
 
         Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
 
+        // The file history is written while searching the folders, so the lock is held for the whole merge.
+        AZStd::scoped_lock lock(m_settingMutex);
+        IncrementGeneration();
+
         size_t additionalSpaceRequired = 3; // 3 is for the '/', '*' and 0
         if (!platform.empty())
         {
@@ -648,9 +749,14 @@ namespace AZ
             AZStd::string_view name = specializations.GetSpecialization(i);
             specialzationArray.PushBack(Value(name.data(), aznumeric_caster(name.length()), m_settings.GetAllocator()), m_settings.GetAllocator());
         }
-        pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
+        Value& folderHistory = pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
             .AddMember(StringRef("Folder"), Value(folderPath.c_str(), aznumeric_caster(folderPath.size()), m_settings.GetAllocator()), m_settings.GetAllocator())
             .AddMember(StringRef("Specializations"), AZStd::move(specialzationArray), m_settings.GetAllocator());
+        if (!platform.empty())
+        {
+            folderHistory.AddMember(StringRef("Platform"), Value(platform.data(), aznumeric_caster(platform.size()), m_settings.GetAllocator()),
+                m_settings.GetAllocator());
+        }
 
         auto callback = [this, &fileList, &specializations, &pointer, &folderPath](const char* filename, bool isFile) -> bool
         {
@@ -677,8 +783,6 @@ namespace AZ
         };
         SystemFile::FindFiles(folderPath.c_str(), callback);
 
-
-        AZStd::scoped_lock lock(m_settingMutex);
         if (!platform.empty())
         {
             // Move the folderPath prefix back to the supplied path before the wildcard
@@ -1020,6 +1124,8 @@ namespace AZ
         using namespace rapidjson;
 
         Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
+        // All paths below modify the settings, either by merging the file or by recording an error in the history.
+        IncrementGeneration();
 
         SystemFile file;
         if (!file.Open(path, SystemFile::OpenMode::SF_OPEN_READ_ONLY))
@@ -1154,6 +1260,137 @@ namespace AZ
         return true;
     }
 
+    bool SettingsRegistryImpl::StoreSnapshot(AZStd::vector<char>& output, const Specializations& specializations,
+        size_t firstHistoryEntry) const
+    {
+        using namespace rapidjson;
+
+        Pointer historyPointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY);
+        Document history(kArrayType);
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            if (const Value* registryHistory = historyPointer.Get(m_settings); registryHistory && registryHistory->IsArray())
+            {
+                for (rapidjson::SizeType i = aznumeric_cast<rapidjson::SizeType>(firstHistoryEntry); i < registryHistory->Size(); ++i)
+                {
+                    history.PushBack(Value((*registryHistory)[i], history.GetAllocator()), history.GetAllocator());
+                }
+            }
+        }
+
+        // Merge the files again in the order they were merged in. Folders and files that failed to merge are only
+        // copied to the history so the snapshot can detect files that are added to the folders or that are fixed.
+        SettingsRegistryImpl fileLayers;
+        fileLayers.m_applyPatchSettings = m_applyPatchSettings;
+        AZStd::vector<char> scratchBuffer;
+        constexpr size_t patchExtensionLength = AZStd::char_traits<char>::length(PatchExtension);
+        for (Value& entry : history.GetArray())
+        {
+            if (entry.IsString())
+            {
+                AZStd::string_view path(entry.GetString(), entry.GetStringLength());
+                const bool isPatch = path.size() > patchExtensionLength && path[path.size() - patchExtensionLength - 1] == '.' &&
+                    azstrnicmp(path.data() + path.size() - patchExtensionLength, PatchExtension, patchExtensionLength) == 0;
+                if (!fileLayers.MergeSettingsFile(path, isPatch ? Format::JsonPatch : Format::JsonMergePatch, "", &scratchBuffer))
+                {
+                    AZ_Error("Settings Registry", false, R"(Unable to merge registry file "%.*s" for the snapshot.)",
+                        aznumeric_cast<int>(path.size()), path.data());
+                    return false;
+                }
+            }
+            else if (entry.IsObject() && (entry.HasMember("Folder") || entry.HasMember("Error")))
+            {
+                if (Value* layerHistory = historyPointer.Get(fileLayers.m_settings); layerHistory && layerHistory->IsArray())
+                {
+                    layerHistory->PushBack(Value(entry, fileLayers.m_settings.GetAllocator()), fileLayers.m_settings.GetAllocator());
+                }
+            }
+        }
+
+        return SettingsRegistrySnapshot::Store(output, fileLayers.m_settings, specializations);
+    }
+
+    size_t SettingsRegistryImpl::GetFileHistorySize() const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        const rapidjson::Value* history = rapidjson::Pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY).Get(m_settings);
+        return history && history->IsArray() ? history->Size() : 0;
+    }
+
+    bool SettingsRegistryImpl::MergeSnapshot(AZStd::string_view snapshotData, const Specializations& specializations)
+    {
+        using namespace rapidjson;
+
+        SettingsRegistrySnapshot snapshot(snapshotData);
+        if (!snapshot.IsValid())
+        {
+            AZ_Warning("Settings Registry", false, "Provided data isn't a valid Settings Registry snapshot.");
+            return false;
+        }
+        if (!snapshot.IsUpToDate(specializations))
+        {
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+
+        Value settings;
+        snapshot.ToJson(settings, m_settings.GetAllocator());
+
+        // The file history is appended instead of overwritten so the history of the settings that were merged before
+        // the snapshot is kept.
+        Pointer historyPointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY);
+        Value history;
+        if (Value* snapshotHistory = historyPointer.Get(settings); snapshotHistory && snapshotHistory->IsArray())
+        {
+            history = *snapshotHistory; // Moves the history out of the snapshot settings.
+            historyPointer.Erase(settings);
+        }
+
+        MergeSnapshotValue(m_settings, settings);
+        IncrementGeneration();
+
+        if (history.IsArray())
+        {
+            Value& registryHistory = historyPointer.Create(m_settings, m_settings.GetAllocator());
+            if (!registryHistory.IsArray())
+            {
+                registryHistory.SetArray();
+            }
+            for (Value& entry : history.GetArray())
+            {
+                registryHistory.PushBack(entry, m_settings.GetAllocator());
+            }
+        }
+
+        m_notifiers.Signal("", Type::Object);
+
+        return true;
+    }
+
+    void SettingsRegistryImpl::MergeSnapshotValue(rapidjson::Value& target, rapidjson::Value& source)
+    {
+        if (target.IsObject() && source.IsObject())
+        {
+            for (auto& member : source.GetObject())
+            {
+                auto targetMember = target.FindMember(member.name);
+                if (targetMember != target.MemberEnd())
+                {
+                    MergeSnapshotValue(targetMember->value, member.value);
+                }
+                else
+                {
+                    target.AddMember(member.name, member.value, m_settings.GetAllocator());
+                }
+            }
+        }
+        else
+        {
+            target = source;
+        }
+    }
+
     void SettingsRegistryImpl::SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings)
     {
         m_applyPatchSettings = applyPatchSettings;
@@ -17,6 +17,7 @@
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
 
 // Using a define instead of a static string to avoid the need for temporary buffers to composite the full paths.
 #define AZ_SETTINGS_REGISTRY_HISTORY_KEY "/Amazon/AzCore/Runtime/Registry/FileHistory"
@@ -33,7 +34,7 @@ namespace AZ
         AZ_RTTI(AZ::SettingsRegistryImpl, "{E9C34190-F888-48CA-83C9-9F24B4E21D72}", AZ::SettingsRegistryInterface);
 
         static constexpr size_t MaxRegistryFolderEntries = 128;
-        
+
         SettingsRegistryImpl();
         AZ_DISABLE_COPY_MOVE(SettingsRegistryImpl);
         ~SettingsRegistryImpl() override = default;
@@ -56,6 +57,17 @@ namespace AZ
         bool Get(SettingsRegistryInterface::FixedValueString& result, AZStd::string_view path) const override;
         bool GetObject(void* result, Uuid resultTypeID, AZStd::string_view path) const override;
 
+        Type GetType(const PathHandle& handle) const override;
+        bool Get(bool& result, const PathHandle& handle) const override;
+        bool Get(s64& result, const PathHandle& handle) const override;
+        bool Get(u64& result, const PathHandle& handle) const override;
+        bool Get(double& result, const PathHandle& handle) const override;
+        bool Get(AZStd::string& result, const PathHandle& handle) const override;
+        bool Get(SettingsRegistryInterface::FixedValueString& result, const PathHandle& handle) const override;
+        //! Returns the generation of the settings, which changes every time the registry is modified. Generations are
+        //! taken from a counter shared by all registries in the process, so no two registries ever have the same generation.
+        u64 GetGeneration() const;
+
         bool Set(AZStd::string_view path, bool value) override;
         bool Set(AZStd::string_view path, s64 value) override;
         bool Set(AZStd::string_view path, u64 value) override;
@@ -77,6 +89,23 @@ namespace AZ
         void SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings) override;
         void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) override;
 
+        //! Stores the settings that were merged from registry files in the binary format of SettingsRegistrySnapshot.
+        //! The snapshot is built by merging the files in the file history again into an empty registry, so values that
+        //! were set at runtime or merged from the command line aren't stored.
+        //! @param output The buffer to write the snapshot to.
+        //! @param specializations The specializations that were used to merge the settings folders.
+        //! @param firstHistoryEntry Index of the first entry of the file history to include in the snapshot.
+        //! @return False if a registry file couldn't be merged again or the settings are too large for a snapshot.
+        bool StoreSnapshot(AZStd::vector<char>& output, const Specializations& specializations, size_t firstHistoryEntry = 0) const;
+        //! Returns the number of entries in the file history, which can be used as the first entry for StoreSnapshot.
+        size_t GetFileHistorySize() const;
+        //! Merges the settings from a binary snapshot into the registry without parsing any json. Values in the snapshot
+        //! overwrite existing values, objects are merged and the file history of the snapshot is appended.
+        //! @param snapshotData The snapshot as stored by StoreSnapshot.
+        //! @param specializations The specializations the settings folders would be merged with.
+        //! @return False if the snapshot is invalid or out of date, in which case nothing is merged.
+        bool MergeSnapshot(AZStd::string_view snapshotData, const Specializations& specializations);
+
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
         struct RegistryFile
@@ -92,6 +121,10 @@ namespace AZ
         bool SetValueInternal(AZStd::string_view path, T value, SettingsRegistryInterface::Type type);
         template<typename T>
         bool GetValueInternal(T& result, AZStd::string_view path) const;
+        template<typename T>
+        bool ReadValueInternal(T& result, const rapidjson::Value* value) const;
+        static Type GetValueType(const rapidjson::Value& value);
+        const rapidjson::Value* ResolveHandle(const PathHandle& handle) const;
         VisitResponse Visit(Visitor& visitor, StackedString& path, AZStd::string_view valueName,
             const rapidjson::Value& value) const;
 
@@ -100,10 +133,16 @@ namespace AZ
             const rapidjson::Pointer& historyPointer, AZStd::string_view folderPath);
         bool ExtractFileDescription(RegistryFile& output, const char* filename, const Specializations& specializations);
         bool MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer);
+        void MergeSnapshotValue(rapidjson::Value& target, rapidjson::Value& source);
+        //! Moves the settings to a new generation. Must be called with m_settingMutex locked whenever m_settings is modified.
+        void IncrementGeneration();
         
         mutable AZStd::recursive_mutex m_settingMutex;
         NotifyEvent m_notifiers;
         rapidjson::Document m_settings;
+        //! Replaced with a new generation whenever m_settings is modified, which invalidates the values cached in PathHandles.
+        //! Only changed while m_settingMutex is locked.
+        u64 m_generation{ 0 };
         JsonSerializerSettings m_serializationSettings;
         JsonDeserializerSettings m_deserializationSettings;
         JsonApplyPatchSettings m_applyPatchSettings;
@@ -7,14 +7,18 @@
  */
 
 #include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/MemoryMappedFile.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/JSON/prettywriter.h>
 #include <AzCore/JSON/writer.h>
+#include <AzCore/Platform.h>
 #include <AzCore/PlatformId/PlatformDefaults.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/Settings/CommandLine.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/wildcard.h>
@@ -1161,6 +1165,132 @@ namespace AZ::SettingsRegistryMergeUtils
         return visitor.Finalize();
     }
 
+    bool StoreSettingsRegistrySnapshot(SettingsRegistryInterface& registry, AZStd::string_view filePath,
+        const SettingsRegistryInterface::Specializations& specializations, size_t firstHistoryEntry)
+    {
+        auto registryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry);
+        if (!registryImpl)
+        {
+            AZ_Error("SettingsRegistryMergeUtils", false, "Snapshots can only be stored from a SettingsRegistryImpl.");
+            return false;
+        }
+
+        AZStd::vector<char> snapshot;
+        if (!registryImpl->StoreSnapshot(snapshot, specializations, firstHistoryEntry))
+        {
+            return false;
+        }
+
+        // Other processes may have the current snapshot memory mapped, so it's never written in place. The new snapshot
+        // is written to a temporary file in the same folder instead and then renamed over the current one.
+        AZ::IO::FixedMaxPath snapshotPath{ filePath };
+        AZ::IO::FixedMaxPath tempPath{ snapshotPath };
+        tempPath.Native() += AZ::IO::FixedMaxPathString::format(".%" PRIu32 ".tmp", AZ::Platform::GetCurrentProcessId());
+        {
+            IO::SystemFile tempFile;
+            if (!tempFile.Open(tempPath.c_str(),
+                IO::SystemFile::SF_OPEN_CREATE | IO::SystemFile::SF_OPEN_CREATE_PATH | IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Error("SettingsRegistryMergeUtils", false, R"(Unable to open Settings Registry snapshot "%s" for writing.)",
+                    tempPath.c_str());
+                return false;
+            }
+            if (tempFile.Write(snapshot.data(), snapshot.size()) != snapshot.size())
+            {
+                AZ_Error("SettingsRegistryMergeUtils", false, R"(Unable to write Settings Registry snapshot "%s".)", tempPath.c_str());
+                tempFile.Close();
+                IO::SystemFile::Delete(tempPath.c_str());
+                return false;
+            }
+        }
+
+        // Renaming fails on some platforms while another process has the snapshot mapped. That process keeps using its
+        // snapshot and the next launch tries again, so this isn't an error.
+        if (!IO::SystemFile::Rename(tempPath.c_str(), snapshotPath.c_str(), true))
+        {
+            AZ_Warning("SettingsRegistryMergeUtils", false, R"(Unable to replace Settings Registry snapshot "%s".)", snapshotPath.c_str());
+            IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool MergeSettingsToRegistry_Snapshot(SettingsRegistryInterface& registry, AZStd::string_view filePath,
+        const SettingsRegistryInterface::Specializations& specializations)
+    {
+        auto registryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry);
+        if (!registryImpl)
+        {
+            return false;
+        }
+
+        AZ::IO::FixedMaxPath snapshotPath{ filePath };
+        AZStd::shared_ptr<IO::MemoryMappedFile> snapshotFile = IO::MemoryMappedFile::Map(snapshotPath.c_str());
+        if (!snapshotFile)
+        {
+            return false;
+        }
+
+        // Reject truncated or foreign files before anything in the mapping is trusted.
+        AZStd::string_view snapshot(reinterpret_cast<const char*>(snapshotFile->GetData()), snapshotFile->GetSize());
+        if (!SettingsRegistrySnapshot::HasValidHeader(snapshot))
+        {
+            return false;
+        }
+        return registryImpl->MergeSnapshot(snapshot, specializations);
+    }
+
+    AZ::IO::FixedMaxPath GetSettingsRegistrySnapshotPath(const SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations)
+    {
+        AZ::IO::FixedMaxPath snapshotPath;
+        if (!registry.Get(snapshotPath.Native(), SnapshotPathKey) || snapshotPath.empty())
+        {
+            return {};
+        }
+
+        if (snapshotPath.IsRelative())
+        {
+            AZ::IO::FixedMaxPath projectUserPath;
+            if (registry.Get(projectUserPath.Native(), FilePathKey_ProjectUserPath))
+            {
+                snapshotPath = projectUserPath / snapshotPath;
+            }
+        }
+
+        const AZStd::string_view stem = snapshotPath.Stem().Native();
+        const AZStd::string_view extension = snapshotPath.Extension().Native();
+        const auto filename = AZ::IO::FixedMaxPathString::format("%.*s.%016" PRIx64 "%.*s",
+            aznumeric_cast<int>(stem.size()), stem.data(), SettingsRegistrySnapshot::HashSpecializations(specializations),
+            aznumeric_cast<int>(extension.size()), extension.data());
+        snapshotPath.ReplaceFilename(AZ::IO::PathView(filename));
+        return snapshotPath;
+    }
+
+    void MergeSettingsToRegistry_SnapshotOrFiles(SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations, const AZStd::function<void()>& mergeRegistryFiles)
+    {
+        auto registryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry);
+        const AZ::IO::FixedMaxPath snapshotPath = registryImpl ? GetSettingsRegistrySnapshotPath(registry, specializations)
+            : AZ::IO::FixedMaxPath{};
+        if (snapshotPath.empty())
+        {
+            mergeRegistryFiles();
+            return;
+        }
+
+        if (MergeSettingsToRegistry_Snapshot(registry, snapshotPath.Native(), specializations))
+        {
+            return;
+        }
+
+        // Only the files merged from here on are stored, so registry files that were merged earlier, such as the user
+        // registries, aren't baked into the snapshot.
+        const size_t firstHistoryEntry = registryImpl->GetFileHistorySize();
+        mergeRegistryFiles();
+        StoreSettingsRegistrySnapshot(registry, snapshotPath.Native(), specializations, firstHistoryEntry);
+    }
+
     bool IsPathAncestorDescendantOrEqual(AZStd::string_view candidatePath, AZStd::string_view inputPath)
     {
         AZ::IO::PathView candidateView{ candidatePath, AZ::IO::PosixPathSeparator };
@@ -68,6 +68,13 @@ namespace AZ::SettingsRegistryMergeUtils
     //! The value of the key has no meaning. Notification Handlers only need to check if the key was supplied
     inline static constexpr char CommandLineValueChangedKey[] = "/Amazon/AzCore/Runtime/CommandLineChanged";
 
+    //! Path of the binary snapshot that's used to merge the engine, gem and project registries at startup. Snapshots
+    //! aren't used if the key isn't set. A relative path is relative to the project user folder. The key needs to be set
+    //! before the registry folders are merged, for instance on the command line or in the o3de user registry.
+    //! Applications merge with different specializations, so the hash of the specializations is added to the file name
+    //! to give each of them their own snapshot. See GetSettingsRegistrySnapshotPath.
+    inline static constexpr char SnapshotPathKey[] = "/Amazon/AzCore/Settings/RegistrySnapshotPath";
+
     //! Root key where raw project settings (project.json) file is merged to settings registry
     inline static constexpr char ProjectSettingsRootKey[] = "/Amazon/Project/Settings";
 
@@ -256,6 +263,42 @@ namespace AZ::SettingsRegistryMergeUtils
     bool DumpSettingsRegistryToStream(SettingsRegistryInterface& registry, AZStd::string_view key,
         AZ::IO::GenericStream& stream, const DumperSettings& dumperSettings);
 
+    //! Stores a binary snapshot of the settings merged from registry files to the file at filePath. This is intended
+    //! to be run once the registry folders have been merged, so later launches can use MergeSettingsToRegistry_Snapshot
+    //! instead of scanning, parsing and merging every registry file again. Values that weren't merged from a registry
+    //! file, such as command line arguments, aren't stored.
+    //! @param specializations The specializations that were used to merge the registry folders.
+    //! @param firstHistoryEntry Index of the first entry in the file history of the registry to store. Use this to
+    //!     only store the files that were merged after a certain point.
+    //! The snapshot is written to a temporary file next to filePath which is then renamed over filePath, so other
+    //! processes that have the previous snapshot mapped keep reading a complete snapshot.
+    //! @return False if the registry isn't a SettingsRegistryImpl or the file couldn't be written.
+    bool StoreSettingsRegistrySnapshot(SettingsRegistryInterface& registry, AZStd::string_view filePath,
+        const SettingsRegistryInterface::Specializations& specializations, size_t firstHistoryEntry = 0);
+
+    //! Maps the snapshot file at filePath into memory and merges it into the registry without any json parsing.
+    //! The snapshot is rejected if any of the registry files or folders it was created from have changed since it was
+    //! stored, or if it was stored with different specializations.
+    //! @return False if the snapshot doesn't exist, is invalid or out of date. In that case nothing is merged and the
+    //!     registry folders need to be merged as usual.
+    bool MergeSettingsToRegistry_Snapshot(SettingsRegistryInterface& registry, AZStd::string_view filePath,
+        const SettingsRegistryInterface::Specializations& specializations);
+
+    //! Returns the path of the snapshot for the specializations, which is the path in SnapshotPathKey with the hash of the
+    //! specializations inserted before the extension, e.g. "registry.0123456789abcdef.snapshot".
+    //! @return The snapshot path or an empty path if SnapshotPathKey isn't set.
+    AZ::IO::FixedMaxPath GetSettingsRegistrySnapshotPath(const SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations);
+
+    //! Merges the registry files from mergeRegistryFiles, or the snapshot at the path in SnapshotPathKey instead if it's
+    //! up to date. If the snapshot is missing or stale, mergeRegistryFiles is called and a new snapshot of only the files
+    //! it merged is stored. Without a SnapshotPathKey, this calls mergeRegistryFiles. The snapshot is stored at the path
+    //! from GetSettingsRegistrySnapshotPath.
+    //! @param specializations The specializations mergeRegistryFiles merges the registry folders with.
+    //! @param mergeRegistryFiles Merges the registry folders that are covered by the snapshot into the registry.
+    void MergeSettingsToRegistry_SnapshotOrFiles(SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations, const AZStd::function<void()>& mergeRegistryFiles);
+
     //! Do not use this function for anything other than bootstrap settings. It is only here to provide compatibility
     //! with current functionality. Proper settings per platform should use the MergeSettingsFolder functionality.
     //! Gets the value using the provided rootPath + platform + keyName, if the platform key does not exist
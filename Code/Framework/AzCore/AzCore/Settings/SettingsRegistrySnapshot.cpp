@@ -0,0 +1,693 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/JSON/pointer.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::SettingsRegistrySnapshotInternal
+{
+    // Folders are stamped with the number of files and a hash of their names. The hashes of the names are added
+    // together so the order in which the file system returns the files doesn't matter.
+    static void StampFolder(const char* filter, u64& nameHash, u64& fileCount)
+    {
+        nameHash = 0;
+        fileCount = 0;
+        auto callback = [&nameHash, &fileCount](const char* filename, bool isFile) -> bool
+        {
+            if (isFile)
+            {
+                nameHash += SettingsRegistrySnapshot::HashPath(filename);
+                ++fileCount;
+            }
+            return true;
+        };
+        IO::SystemFile::FindFiles(filter, callback);
+    }
+
+    // Files are stamped with their modification time and size. Files that don't exist get a stamp that no existing
+    // file can have, so the file appearing later is detected as a change.
+    static constexpr u64 MissingFileStamp = AZStd::numeric_limits<u64>::max();
+    static void StampFile(const char* path, u64& stamp, u64& size)
+    {
+        if (IO::SystemFile::Exists(path))
+        {
+            stamp = IO::SystemFile::ModificationTime(path);
+            size = IO::SystemFile::Length(path);
+        }
+        else
+        {
+            stamp = MissingFileStamp;
+            size = 0;
+        }
+    }
+
+    // Compares a single token of a JSON pointer, which may contain the escape sequences "~0" and "~1", with a name.
+    static bool MatchesToken(AZStd::string_view token, AZStd::string_view name)
+    {
+        size_t nameIndex = 0;
+        for (size_t i = 0; i < token.size(); ++i, ++nameIndex)
+        {
+            char c = token[i];
+            if (c == '~')
+            {
+                if (i + 1 >= token.size())
+                {
+                    return false;
+                }
+                ++i;
+                switch (token[i])
+                {
+                case '0':
+                    c = '~';
+                    break;
+                case '1':
+                    c = '/';
+                    break;
+                default:
+                    return false;
+                }
+            }
+            if (nameIndex >= name.size() || name[nameIndex] != c)
+            {
+                return false;
+            }
+        }
+        return nameIndex == name.size();
+    }
+
+    template<typename T>
+    static const T* GetSection(const char* data, size_t& offset, size_t count)
+    {
+        const T* result = reinterpret_cast<const T*>(data + offset);
+        offset += count * sizeof(T);
+        return result;
+    }
+} // namespace AZ::SettingsRegistrySnapshotInternal
+
+namespace AZ
+{
+    bool SettingsRegistrySnapshot::Store(AZStd::vector<char>& output, const rapidjson::Value& settings,
+        const SettingsRegistryInterface::Specializations& specializations)
+    {
+        struct Builder
+        {
+            AZStd::vector<Source> m_sources;
+            AZStd::vector<Node> m_nodes;
+            AZStd::vector<u64> m_hashes;
+            AZStd::vector<char> m_strings;
+            AZStd::string m_path;
+
+            u32 AddString(const char* text, size_t length)
+            {
+                u32 offset = aznumeric_cast<u32>(m_strings.size());
+                m_strings.insert(m_strings.end(), text, text + length);
+                return offset;
+            }
+
+            void AddNode(const rapidjson::Value& value, AZStd::string_view name, u32 parent)
+            {
+                const u32 nodeIndex = aznumeric_cast<u32>(m_nodes.size());
+                m_hashes.push_back(HashPath(m_path));
+
+                Node node{};
+                node.m_nameOffset = AddString(name.data(), name.size());
+                node.m_nameLength = aznumeric_cast<u32>(name.size());
+                node.m_parent = parent;
+                switch (value.GetType())
+                {
+                case rapidjson::kNullType:
+                    node.m_type = NodeType::Null;
+                    break;
+                case rapidjson::kFalseType:
+                    node.m_type = NodeType::False;
+                    break;
+                case rapidjson::kTrueType:
+                    node.m_type = NodeType::True;
+                    break;
+                case rapidjson::kNumberType:
+                    if (value.IsDouble())
+                    {
+                        node.m_type = NodeType::Double;
+                        double number = value.GetDouble();
+                        memcpy(&node.m_value, &number, sizeof(number));
+                    }
+                    else if (value.IsInt64())
+                    {
+                        node.m_type = NodeType::Int64;
+                        node.m_value = static_cast<u64>(value.GetInt64());
+                    }
+                    else
+                    {
+                        node.m_type = NodeType::Uint64;
+                        node.m_value = value.GetUint64();
+                    }
+                    break;
+                case rapidjson::kStringType:
+                    node.m_type = NodeType::String;
+                    node.m_size = value.GetStringLength();
+                    node.m_value = AddString(value.GetString(), value.GetStringLength());
+                    break;
+                case rapidjson::kArrayType:
+                    node.m_type = NodeType::Array;
+                    node.m_size = value.Size();
+                    break;
+                case rapidjson::kObjectType:
+                    node.m_type = NodeType::Object;
+                    node.m_size = value.MemberCount();
+                    break;
+                default:
+                    AZ_Assert(false, "Unsupported json type %i found while storing Settings Registry snapshot.", value.GetType());
+                    node.m_type = NodeType::Null;
+                    break;
+                }
+                m_nodes.push_back(node);
+
+                const size_t pathLength = m_path.size();
+                if (value.IsArray())
+                {
+                    u32 index = 0;
+                    for (const rapidjson::Value& element : value.GetArray())
+                    {
+                        auto elementName = AZStd::fixed_string<16>::format("%u", index);
+                        m_path.push_back('/');
+                        m_path.append(elementName.c_str(), elementName.size());
+                        AddNode(element, elementName, nodeIndex);
+                        m_path.resize(pathLength);
+                        ++index;
+                    }
+                }
+                else if (value.IsObject())
+                {
+                    for (const auto& member : value.GetObject())
+                    {
+                        AZStd::string_view memberName(member.name.GetString(), member.name.GetStringLength());
+                        m_path.push_back('/');
+                        for (char c : memberName)
+                        {
+                            if (c == '~')
+                            {
+                                m_path += "~0";
+                            }
+                            else if (c == '/')
+                            {
+                                m_path += "~1";
+                            }
+                            else
+                            {
+                                m_path.push_back(c);
+                            }
+                        }
+                        AddNode(member.value, memberName, nodeIndex);
+                        m_path.resize(pathLength);
+                    }
+                }
+            }
+
+            void AddSource(const char* path, size_t pathLength, SourceType type)
+            {
+                Source source{};
+                source.m_pathOffset = AddString(path, pathLength);
+                source.m_pathLength = aznumeric_cast<u32>(pathLength);
+                source.m_type = type;
+                if (type == SourceType::Folder)
+                {
+                    SettingsRegistrySnapshotInternal::StampFolder(path, source.m_stamp, source.m_size);
+                }
+                else
+                {
+                    SettingsRegistrySnapshotInternal::StampFile(path, source.m_stamp, source.m_size);
+                }
+                m_sources.push_back(source);
+            }
+        };
+
+        Builder builder;
+
+        // Record the files and folders that were merged, as well as the files that failed to merge, so a stale
+        // snapshot can be detected when it's loaded.
+        rapidjson::Pointer historyPointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY);
+        if (const rapidjson::Value* history = historyPointer.Get(settings); history && history->IsArray())
+        {
+            for (const rapidjson::Value& entry : history->GetArray())
+            {
+                if (entry.IsString())
+                {
+                    builder.AddSource(entry.GetString(), entry.GetStringLength(), SourceType::File);
+                }
+                else if (entry.IsObject())
+                {
+                    auto folder = entry.FindMember("Folder");
+                    if (folder != entry.MemberEnd() && folder->value.IsString())
+                    {
+                        builder.AddSource(folder->value.GetString(), folder->value.GetStringLength(), SourceType::Folder);
+
+                        // Files in the Platform/<platform> subfolder are merged as part of the folder as well.
+                        auto platform = entry.FindMember("Platform");
+                        AZStd::string_view folderFilter(folder->value.GetString(), folder->value.GetStringLength());
+                        if (platform != entry.MemberEnd() && platform->value.IsString() && folderFilter.ends_with('*'))
+                        {
+                            IO::FixedMaxPathString platformFilter(folderFilter.substr(0, folderFilter.size() - 1));
+                            platformFilter += SettingsRegistryInterface::PlatformFolder;
+                            platformFilter.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+                            platformFilter.append(platform->value.GetString(), platform->value.GetStringLength());
+                            platformFilter.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+                            platformFilter.push_back('*');
+                            builder.AddSource(platformFilter.c_str(), platformFilter.size(), SourceType::Folder);
+                        }
+                    }
+                    else if (entry.HasMember("Error"))
+                    {
+                        auto path = entry.FindMember("Path");
+                        if (path != entry.MemberEnd() && path->value.IsString())
+                        {
+                            builder.AddSource(path->value.GetString(), path->value.GetStringLength(), SourceType::FailedFile);
+                        }
+                    }
+                }
+            }
+        }
+
+        builder.AddNode(settings, {}, NoParent);
+
+        if (builder.m_nodes.size() >= AZStd::numeric_limits<u32>::max() / 2 ||
+            builder.m_strings.size() > AZStd::numeric_limits<u32>::max())
+        {
+            AZ_Error("Settings Registry", false, "The Settings Registry is too large to be stored in a snapshot.");
+            return false;
+        }
+
+        // Build an index with a load factor of at most 50% so lookups only need to probe a few entries.
+        u32 indexCapacity = 1;
+        while (indexCapacity < builder.m_nodes.size() * 2)
+        {
+            indexCapacity <<= 1;
+        }
+        AZStd::vector<IndexEntry> index(indexCapacity, IndexEntry{});
+        const u32 indexMask = indexCapacity - 1;
+        for (u32 i = 0; i < builder.m_nodes.size(); ++i)
+        {
+            u32 slot = static_cast<u32>(builder.m_hashes[i]) & indexMask;
+            while (index[slot].m_node != 0)
+            {
+                slot = (slot + 1) & indexMask;
+            }
+            index[slot].m_hash = builder.m_hashes[i];
+            index[slot].m_node = i + 1;
+        }
+
+        Header header{};
+        header.m_magic = Magic;
+        header.m_version = Version;
+        header.m_specializationHash = HashSpecializations(specializations);
+        header.m_sourceCount = aznumeric_cast<u32>(builder.m_sources.size());
+        header.m_nodeCount = aznumeric_cast<u32>(builder.m_nodes.size());
+        header.m_indexCapacity = indexCapacity;
+        header.m_stringsSize = aznumeric_cast<u32>(builder.m_strings.size());
+
+        const size_t sourcesSize = builder.m_sources.size() * sizeof(Source);
+        const size_t nodesSize = builder.m_nodes.size() * sizeof(Node);
+        const size_t indexSize = index.size() * sizeof(IndexEntry);
+        output.clear();
+        output.resize_no_construct(sizeof(Header) + sourcesSize + nodesSize + indexSize + builder.m_strings.size());
+
+        char* target = output.data();
+        memcpy(target, &header, sizeof(Header));
+        target += sizeof(Header);
+        memcpy(target, builder.m_sources.data(), sourcesSize);
+        target += sourcesSize;
+        memcpy(target, builder.m_nodes.data(), nodesSize);
+        target += nodesSize;
+        memcpy(target, index.data(), indexSize);
+        target += indexSize;
+        memcpy(target, builder.m_strings.data(), builder.m_strings.size());
+        return true;
+    }
+
+    bool SettingsRegistrySnapshot::HasValidHeader(AZStd::string_view data)
+    {
+        if (data.size() < sizeof(Header) || (reinterpret_cast<uintptr_t>(data.data()) % alignof(Header)) != 0)
+        {
+            return false;
+        }
+
+        const Header* header = reinterpret_cast<const Header*>(data.data());
+        if (header->m_magic != Magic || header->m_version != Version)
+        {
+            return false;
+        }
+
+        const u64 expectedSize = sizeof(Header) +
+            u64{ header->m_sourceCount } * sizeof(Source) +
+            u64{ header->m_nodeCount } * sizeof(Node) +
+            u64{ header->m_indexCapacity } * sizeof(IndexEntry) +
+            header->m_stringsSize;
+        return expectedSize == data.size();
+    }
+
+    SettingsRegistrySnapshot::SettingsRegistrySnapshot(AZStd::string_view data)
+    {
+        using namespace SettingsRegistrySnapshotInternal;
+
+        if (!HasValidHeader(data))
+        {
+            return;
+        }
+
+        const Header* header = reinterpret_cast<const Header*>(data.data());
+        if (header->m_nodeCount == 0 || header->m_indexCapacity <= header->m_nodeCount ||
+            (header->m_indexCapacity & (header->m_indexCapacity - 1)) != 0)
+        {
+            return;
+        }
+
+        size_t offset = sizeof(Header);
+        const Source* sources = GetSection<Source>(data.data(), offset, header->m_sourceCount);
+        const Node* nodes = GetSection<Node>(data.data(), offset, header->m_nodeCount);
+        const IndexEntry* index = GetSection<IndexEntry>(data.data(), offset, header->m_indexCapacity);
+        const char* strings = data.data() + offset;
+
+        // Validate everything up front so lookups don't need to guard against corrupted data.
+        const u64 stringsSize = header->m_stringsSize;
+        for (u32 i = 0; i < header->m_sourceCount; ++i)
+        {
+            if (u64{ sources[i].m_pathOffset } + sources[i].m_pathLength > stringsSize)
+            {
+                return;
+            }
+        }
+        for (u32 i = 0; i < header->m_nodeCount; ++i)
+        {
+            const Node& node = nodes[i];
+            if (u64{ node.m_nameOffset } + node.m_nameLength > stringsSize ||
+                node.m_type >= NodeType::Count ||
+                (i == 0 ? node.m_parent != NoParent : node.m_parent >= i) ||
+                (node.m_type == NodeType::String && node.m_value + node.m_size > stringsSize))
+            {
+                return;
+            }
+        }
+        for (u32 i = 0; i < header->m_indexCapacity; ++i)
+        {
+            if (index[i].m_node > header->m_nodeCount)
+            {
+                return;
+            }
+        }
+
+        m_data = data;
+        m_header = header;
+        m_sources = sources;
+        m_nodes = nodes;
+        m_index = index;
+        m_strings = strings;
+    }
+
+    bool SettingsRegistrySnapshot::IsValid() const
+    {
+        return m_header != nullptr;
+    }
+
+    bool SettingsRegistrySnapshot::IsUpToDate(const SettingsRegistryInterface::Specializations& specializations) const
+    {
+        if (!IsValid() || m_header->m_specializationHash != HashSpecializations(specializations))
+        {
+            return false;
+        }
+
+        for (u32 i = 0; i < m_header->m_sourceCount; ++i)
+        {
+            const Source& source = m_sources[i];
+            AZStd::string_view sourcePath = GetString(source.m_pathOffset, source.m_pathLength);
+            if (sourcePath.size() >= IO::MaxPathLength)
+            {
+                return false;
+            }
+            IO::FixedMaxPathString path(sourcePath);
+
+            u64 stamp;
+            u64 size;
+            if (source.m_type == SourceType::Folder)
+            {
+                SettingsRegistrySnapshotInternal::StampFolder(path.c_str(), stamp, size);
+            }
+            else
+            {
+                SettingsRegistrySnapshotInternal::StampFile(path.c_str(), stamp, size);
+            }
+            if (stamp != source.m_stamp || size != source.m_size)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t SettingsRegistrySnapshot::GetValueCount() const
+    {
+        return IsValid() ? m_header->m_nodeCount : 0;
+    }
+
+    size_t SettingsRegistrySnapshot::GetSourceCount() const
+    {
+        return IsValid() ? m_header->m_sourceCount : 0;
+    }
+
+    SettingsRegistryInterface::Type SettingsRegistrySnapshot::GetType(AZStd::string_view path) const
+    {
+        using Type = SettingsRegistryInterface::Type;
+
+        const Node* node = FindNode(path);
+        if (!node)
+        {
+            return Type::NoType;
+        }
+
+        switch (node->m_type)
+        {
+        case NodeType::Null:
+            return Type::Null;
+        case NodeType::False:
+            // fall through
+        case NodeType::True:
+            return Type::Boolean;
+        case NodeType::Int64:
+            // fall through
+        case NodeType::Uint64:
+            return Type::Integer;
+        case NodeType::Double:
+            return Type::FloatingPoint;
+        case NodeType::String:
+            return Type::String;
+        case NodeType::Array:
+            return Type::Array;
+        case NodeType::Object:
+            return Type::Object;
+        default:
+            return Type::NoType;
+        }
+    }
+
+    bool SettingsRegistrySnapshot::Get(bool& result, AZStd::string_view path) const
+    {
+        const Node* node = FindNode(path);
+        if (node && (node->m_type == NodeType::False || node->m_type == NodeType::True))
+        {
+            result = node->m_type == NodeType::True;
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(s64& result, AZStd::string_view path) const
+    {
+        const Node* node = FindNode(path);
+        if (node && node->m_type == NodeType::Int64)
+        {
+            result = static_cast<s64>(node->m_value);
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(u64& result, AZStd::string_view path) const
+    {
+        const Node* node = FindNode(path);
+        if (node && (node->m_type == NodeType::Uint64 || (node->m_type == NodeType::Int64 && static_cast<s64>(node->m_value) >= 0)))
+        {
+            result = node->m_value;
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(double& result, AZStd::string_view path) const
+    {
+        const Node* node = FindNode(path);
+        if (node && node->m_type == NodeType::Double)
+        {
+            memcpy(&result, &node->m_value, sizeof(result));
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(AZStd::string_view& result, AZStd::string_view path) const
+    {
+        const Node* node = FindNode(path);
+        if (node && node->m_type == NodeType::String)
+        {
+            result = GetString(static_cast<u32>(node->m_value), node->m_size);
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::ToJson(rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator,
+        AZStd::string_view path) const
+    {
+        const Node* node = FindNode(path);
+        if (node)
+        {
+            ToJson(output, allocator, aznumeric_cast<u32>(node - m_nodes));
+            return true;
+        }
+        return false;
+    }
+
+    u64 SettingsRegistrySnapshot::HashPath(AZStd::string_view path)
+    {
+        return AZStd::hash<AZStd::string_view>{}(path);
+    }
+
+    u64 SettingsRegistrySnapshot::HashSpecializations(const SettingsRegistryInterface::Specializations& specializations)
+    {
+        size_t hash = 0;
+        const size_t count = specializations.GetCount();
+        for (size_t i = 0; i < count; ++i)
+        {
+            AZStd::hash_combine(hash, SettingsRegistryInterface::Specializations::Hash(specializations.GetSpecialization(i)));
+        }
+        return hash;
+    }
+
+    auto SettingsRegistrySnapshot::FindNode(AZStd::string_view path) const -> const Node*
+    {
+        if (!IsValid())
+        {
+            return nullptr;
+        }
+
+        const u64 hash = HashPath(path);
+        const u32 indexMask = m_header->m_indexCapacity - 1;
+        u32 slot = static_cast<u32>(hash) & indexMask;
+        for (u32 probe = 0; probe < m_header->m_indexCapacity; ++probe)
+        {
+            const IndexEntry& entry = m_index[slot];
+            if (entry.m_node == 0)
+            {
+                return nullptr;
+            }
+            if (entry.m_hash == hash && MatchesPath(m_nodes[entry.m_node - 1], path))
+            {
+                return &m_nodes[entry.m_node - 1];
+            }
+            slot = (slot + 1) & indexMask;
+        }
+        return nullptr;
+    }
+
+    bool SettingsRegistrySnapshot::MatchesPath(const Node& node, AZStd::string_view path) const
+    {
+        // Walk up the parents and compare their names with the tokens of the path, starting from the last token.
+        const Node* current = &node;
+        while (current->m_parent != NoParent)
+        {
+            size_t separator = path.rfind('/');
+            if (separator == AZStd::string_view::npos ||
+                !SettingsRegistrySnapshotInternal::MatchesToken(path.substr(separator + 1),
+                    GetString(current->m_nameOffset, current->m_nameLength)))
+            {
+                return false;
+            }
+            path = path.substr(0, separator);
+            current = &m_nodes[current->m_parent];
+        }
+        return path.empty();
+    }
+
+    AZStd::string_view SettingsRegistrySnapshot::GetString(u32 offset, u32 length) const
+    {
+        return AZStd::string_view(m_strings + offset, length);
+    }
+
+    u32 SettingsRegistrySnapshot::ToJson(rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, u32 nodeIndex) const
+    {
+        const Node& node = m_nodes[nodeIndex];
+        u32 next = nodeIndex + 1;
+        switch (node.m_type)
+        {
+        case NodeType::Null:
+            output.SetNull();
+            break;
+        case NodeType::False:
+            output.SetBool(false);
+            break;
+        case NodeType::True:
+            output.SetBool(true);
+            break;
+        case NodeType::Int64:
+            output.SetInt64(static_cast<int64_t>(node.m_value));
+            break;
+        case NodeType::Uint64:
+            output.SetUint64(node.m_value);
+            break;
+        case NodeType::Double:
+        {
+            double number;
+            memcpy(&number, &node.m_value, sizeof(number));
+            output.SetDouble(number);
+            break;
+        }
+        case NodeType::String:
+            output.SetString(m_strings + node.m_value, node.m_size, allocator);
+            break;
+        case NodeType::Array:
+            output.SetArray();
+            output.Reserve(node.m_size, allocator);
+            for (u32 i = 0; i < node.m_size && next < m_header->m_nodeCount; ++i)
+            {
+                rapidjson::Value element;
+                next = ToJson(element, allocator, next);
+                output.PushBack(element, allocator);
+            }
+            break;
+        case NodeType::Object:
+            output.SetObject();
+            for (u32 i = 0; i < node.m_size && next < m_header->m_nodeCount; ++i)
+            {
+                const Node& member = m_nodes[next];
+                rapidjson::Value name(m_strings + member.m_nameOffset, member.m_nameLength, allocator);
+                rapidjson::Value value;
+                next = ToJson(value, allocator, next);
+                output.AddMember(name, value, allocator);
+            }
+            break;
+        default:
+            output.SetNull();
+            break;
+        }
+        return next;
+    }
+} // namespace AZ
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    //! Read-only view over a binary snapshot of a fully merged Settings Registry.
+    //! A snapshot stores the settings as a flat, pre-ordered array of nodes together with a hashed index of the
+    //! JSON pointer of every node, so values can be looked up or turned back into a json document without any
+    //! text parsing. The snapshot also records the registry files and folders that contributed to the settings, as well
+    //! as the registry files that failed to merge, which is used to detect if the snapshot has gone stale.
+    //! All offsets in a snapshot are relative to its start, so a snapshot can be used directly from a memory mapped
+    //! file. The data is stored in the native byte order and isn't intended to be shared between platforms.
+    class SettingsRegistrySnapshot final
+    {
+    public:
+        static constexpr u32 Magic = 0x53524753; // "SGRS"
+        static constexpr u32 Version = 2;
+
+        //! Stores the provided settings in the binary snapshot format. The source files are collected from the
+        //! file history in the settings, which is found at AZ_SETTINGS_REGISTRY_HISTORY_KEY.
+        //! @param output The buffer to write the snapshot to. Any previous content will be replaced.
+        //! @param settings The root of the merged settings.
+        //! @param specializations The specializations that were used to merge the settings. A snapshot is only
+        //!     considered up to date if it's loaded with the same specializations.
+        //! @return False if the settings are too large to be stored in a snapshot.
+        static bool Store(AZStd::vector<char>& output, const rapidjson::Value& settings,
+            const SettingsRegistryInterface::Specializations& specializations);
+
+        //! Creates a view over the snapshot data. The data isn't copied and needs to remain valid for the lifetime
+        //! of the view. Use IsValid to check if the data is a valid snapshot.
+        explicit SettingsRegistrySnapshot(AZStd::string_view data);
+
+        //! Returns true if the data is a snapshot of the current version with consistent offsets and sizes.
+        bool IsValid() const;
+        //! Returns true if the data starts with a header of the current version and is exactly as large as that header
+        //! describes. This is a cheap check to reject truncated or partially written snapshots before creating a view.
+        static bool HasValidHeader(AZStd::string_view data);
+        //! Returns true if the snapshot was stored with the same specializations and none of the registry files or
+        //! folders it was created from have changed since. This accesses the file system but doesn't read any files.
+        bool IsUpToDate(const SettingsRegistryInterface::Specializations& specializations) const;
+
+        //! Returns the number of values, including objects and arrays, in the snapshot.
+        size_t GetValueCount() const;
+        //! Returns the number of registry files and folders that were recorded in the snapshot.
+        size_t GetSourceCount() const;
+
+        //! Returns the type of the value at the JSON pointer path or NoType if there's no value at the path.
+        SettingsRegistryInterface::Type GetType(AZStd::string_view path) const;
+        bool Get(bool& result, AZStd::string_view path) const;
+        bool Get(s64& result, AZStd::string_view path) const;
+        bool Get(u64& result, AZStd::string_view path) const;
+        bool Get(double& result, AZStd::string_view path) const;
+        //! Retrieves a string value. The result points into the snapshot data.
+        bool Get(AZStd::string_view& result, AZStd::string_view path) const;
+
+        //! Rebuilds the settings, or the value at the JSON pointer path, as a json value.
+        //! @return False if there's no value at the path.
+        bool ToJson(rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, AZStd::string_view path = "") const;
+
+        //! Calculates the hash that's used to look up a JSON pointer path in the index.
+        static u64 HashPath(AZStd::string_view path);
+        //! Calculates the hash that's used to check if a snapshot was stored with the same specializations.
+        static u64 HashSpecializations(const SettingsRegistryInterface::Specializations& specializations);
+
+    private:
+        enum class NodeType : u32
+        {
+            Null,
+            False,
+            True,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Array,
+            Object,
+
+            Count
+        };
+
+        enum class SourceType : u32
+        {
+            File,
+            Folder,
+            //! A registry file that couldn't be merged, for instance because it didn't exist yet.
+            FailedFile
+        };
+
+        struct Header
+        {
+            u32 m_magic;
+            u32 m_version;
+            u64 m_specializationHash;
+            u32 m_sourceCount;
+            u32 m_nodeCount;
+            u32 m_indexCapacity;
+            u32 m_stringsSize;
+        };
+
+        //! A registry file or folder that contributed to the settings. Files are checked by their modification time
+        //! and size. Folders are checked by the number of files in them and a hash of their names. Failed files are
+        //! checked the same way as files, but also invalidate the snapshot once a missing file appears.
+        struct Source
+        {
+            u32 m_pathOffset;
+            u32 m_pathLength;
+            SourceType m_type;
+            u32 m_padding;
+            u64 m_stamp;
+            u64 m_size;
+        };
+
+        //! A single value. Children of objects and arrays directly follow their parent and the subtree of a
+        //! preceding sibling. Array elements use their index as name so paths can be verified the same way.
+        struct Node
+        {
+            u32 m_nameOffset;
+            u32 m_nameLength;
+            u32 m_parent;
+            NodeType m_type;
+            //! Number of children for objects and arrays or the length of a string.
+            u32 m_size;
+            u32 m_padding;
+            //! The value of booleans and numbers or the string offset for strings.
+            u64 m_value;
+        };
+
+        struct IndexEntry
+        {
+            u64 m_hash;
+            //! Index of the node plus one, so zero marks an unused entry.
+            u32 m_node;
+            u32 m_padding;
+        };
+
+        static constexpr u32 NoParent = static_cast<u32>(-1);
+
+        const Node* FindNode(AZStd::string_view path) const;
+        bool MatchesPath(const Node& node, AZStd::string_view path) const;
+        AZStd::string_view GetString(u32 offset, u32 length) const;
+        //! Builds the json value for the node at the index and returns the index of the first node after its subtree.
+        u32 ToJson(rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, u32 nodeIndex) const;
+
+        AZStd::string_view m_data;
+        const Header* m_header{ nullptr };
+        const Source* m_sources{ nullptr };
+        const Node* m_nodes{ nullptr };
+        const IndexEntry* m_index{ nullptr };
+        const char* m_strings{ nullptr };
+    };
+} // namespace AZ
@@ -34,6 +34,14 @@ namespace AZ
         MOCK_CONST_METHOD2(Get, bool(FixedValueString&, AZStd::string_view));
         MOCK_CONST_METHOD3(GetObject, bool(void*, Uuid, AZStd::string_view));
 
+        MOCK_CONST_METHOD1(GetType, Type(const PathHandle&));
+        MOCK_CONST_METHOD2(Get, bool(bool&, const PathHandle&));
+        MOCK_CONST_METHOD2(Get, bool(s64&, const PathHandle&));
+        MOCK_CONST_METHOD2(Get, bool(u64&, const PathHandle&));
+        MOCK_CONST_METHOD2(Get, bool(double&, const PathHandle&));
+        MOCK_CONST_METHOD2(Get, bool(AZStd::string&, const PathHandle&));
+        MOCK_CONST_METHOD2(Get, bool(FixedValueString&, const PathHandle&));
+
         MOCK_METHOD2(Set, bool(AZStd::string_view, bool));
         MOCK_METHOD2(Set, bool(AZStd::string_view, s64));
         MOCK_METHOD2(Set, bool(AZStd::string_view, u64));
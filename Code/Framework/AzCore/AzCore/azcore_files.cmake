@@ -56,6 +56,9 @@ set(FILES
     Component/NamedEntityId.h
     Component/NonUniformScaleBus.cpp
     Component/NonUniformScaleBus.h
+    Component/ParallelTickBus.h
+    Component/ParallelTickScheduler.cpp
+    Component/ParallelTickScheduler.h
     Component/TickBus.h
     Component/TransformBus.h
     Console/Console.cpp
@@ -113,6 +116,8 @@ set(FILES
     Debug/EventTraceDriller.h
     Debug/EventTraceDriller.cpp
     Debug/EventTraceDrillerBus.h
+    Debug/TimelineRecorder.cpp
+    Debug/TimelineRecorder.h
     Debug/Timer.h
     Debug/Trace.cpp
     Debug/Trace.h
@@ -175,6 +180,8 @@ set(FILES
     IO/IStreamerTypes.cpp
     IO/GenericStreams.cpp
     IO/GenericStreams.h
+    IO/MemoryMappedFile.cpp
+    IO/MemoryMappedFile.h
     IO/Path/Path.cpp
     IO/Path/Path.h
     IO/Path/Path.inl
@@ -193,6 +200,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/PrefetchCache.h
+    IO/Streamer/PrefetchCache.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -221,6 +230,8 @@ set(FILES
     Jobs/Internal/JobManagerWorkStealing.cpp
     Jobs/Internal/JobManagerWorkStealing.h
     Jobs/Internal/JobNotify.h
+    Jobs/Internal/ProcessorTopology.h
+    Jobs/Internal/WorkStealingDeque.h
     Jobs/Job.h
     Jobs/JobCancelGroup.h
     Jobs/JobCompletion.h
@@ -238,6 +249,8 @@ set(FILES
     Jobs/LegacyJobExecutor.h
     Jobs/MultipleDependentJob.h
     Jobs/task_group.h
+    Jobs/TaskGraph.cpp
+    Jobs/TaskGraph.h
     Math/Aabb.cpp
     Math/Aabb.h
     Math/Aabb.inl
@@ -257,6 +270,7 @@ set(FILES
     Math/Geometry2DUtils.h
     Math/Guid.h
     Math/Internal/MathTypes.h
+    Math/Internal/SimdMathBatch_simd.inl
     Math/Internal/SimdMathVec1_neon.inl
     Math/Internal/SimdMathVec1_scalar.inl
     Math/Internal/SimdMathVec1_sse.inl
@@ -269,6 +283,8 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
+    Math/Internal/SimdMathVec16_avx512.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -319,10 +335,16 @@ set(FILES
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
     Math/SimdMath.h
+    Math/SimdMathBatch.cpp
+    Math/SimdMathBatch.h
+    Math/SimdMathBatch_Avx2.cpp
+    Math/SimdMathBatch_Avx512.cpp
     Math/SimdMathVec1.h
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
+    Math/SimdMathVec16.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -359,6 +381,8 @@ set(FILES
     Math/ToString.cpp
     Memory/AllocationRecords.cpp
     Memory/AllocationRecords.h
+    Memory/AllocationSampler.cpp
+    Memory/AllocationSampler.h
     Memory/AllocatorBase.cpp
     Memory/AllocatorBase.h
     Memory/AllocatorManager.cpp
@@ -373,6 +397,9 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.h
+    Memory/FrameArenaSchema.cpp
+    Memory/FrameArenaSchema.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -556,6 +583,8 @@ set(FILES
     Settings/SettingsRegistryMergeUtils.h
     Settings/SettingsRegistryScriptUtils.cpp
     Settings/SettingsRegistryScriptUtils.h
+    Settings/SettingsRegistrySnapshot.cpp
+    Settings/SettingsRegistrySnapshot.h
     State/HSM.cpp
     State/HSM.h
     Statistics/NamedRunningStatistic.h
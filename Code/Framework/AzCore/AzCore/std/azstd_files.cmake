@@ -51,6 +51,9 @@ set(FILES
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
+    containers/flat_hash_table.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
@@ -58,6 +61,7 @@ set(FILES
     containers/list.h
     containers/map.h
     containers/node_handle.h
+    containers/node_hash_map.h
     containers/queue.h
     containers/rbtree.h
     containers/ring_buffer.h
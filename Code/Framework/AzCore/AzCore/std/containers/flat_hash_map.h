@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        //! Slot of a flat_hash_map. Elements are exposed as pair<const Key, MappedType>, but are moved between slots as
+        //! pair<Key, MappedType> when the table grows, so keys only need to be movable. Both pairs have the same layout.
+        template<class Key, class MappedType>
+        union FlatHashMapSlot
+        {
+            FlatHashMapSlot() {}
+            ~FlatHashMapSlot() {}
+
+            AZStd::pair<const Key, MappedType> m_value;
+            AZStd::pair<Key, MappedType> m_mutableValue;
+        };
+
+        template<class Key, class MappedType>
+        struct FlatHashMapPolicy
+        {
+            using key_type = Key;
+            using mapped_type = MappedType;
+            using value_type = AZStd::pair<const Key, MappedType>;
+            using init_type = AZStd::pair<Key, MappedType>;
+            using slot_type = FlatHashMapSlot<Key, MappedType>;
+
+            static const key_type& key(const slot_type& slot) { return slot.m_value.first; }
+            static const key_type& key_of(const value_type& value) { return value.first; }
+            static const key_type& key_of(const init_type& value) { return value.first; }
+            static value_type& element(slot_type& slot) { return slot.m_value; }
+
+            template<class Allocator, class... Args>
+            static void construct(Allocator&, slot_type* slot, Args&&... args)
+            {
+                new (&slot->m_value) value_type(AZStd::forward<Args>(args)...);
+            }
+            template<class Allocator>
+            static void destroy(Allocator&, slot_type* slot)
+            {
+                slot->m_value.~value_type();
+            }
+            template<class Allocator>
+            static void transfer(Allocator&, slot_type* destination, slot_type* source)
+            {
+                new (&destination->m_mutableValue) init_type(AZStd::move(source->m_mutableValue));
+                source->m_mutableValue.~init_type();
+            }
+        };
+
+        //! Map interface on top of the flat hash table, shared by flat_hash_map and node_hash_map.
+        template<class Policy, class Hasher, class EqualKey, class Allocator>
+        class flat_hash_map_base
+            : public flat_hash_table<Policy, Hasher, EqualKey, Allocator>
+        {
+            using base_type = flat_hash_table<Policy, Hasher, EqualKey, Allocator>;
+
+        public:
+            using key_type = typename base_type::key_type;
+            using mapped_type = typename Policy::mapped_type;
+            using value_type = typename base_type::value_type;
+            using size_type = typename base_type::size_type;
+            using iterator = typename base_type::iterator;
+            using const_iterator = typename base_type::const_iterator;
+            using pair_iter_bool = typename base_type::pair_iter_bool;
+
+            using base_type::base_type;
+
+            //! Constructs the element in place from args if the key isn't in the map. The arguments aren't moved from otherwise.
+            template<class... Args>
+            pair_iter_bool try_emplace(const key_type& key, Args&&... args)
+            {
+                return this->emplace_with_key(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(key), AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+            }
+            template<class... Args>
+            pair_iter_bool try_emplace(key_type&& key, Args&&... args)
+            {
+                return this->emplace_with_key(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)), AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+            }
+            template<class... Args>
+            iterator try_emplace(const_iterator, const key_type& key, Args&&... args)
+            {
+                return try_emplace(key, AZStd::forward<Args>(args)...).first;
+            }
+            template<class... Args>
+            iterator try_emplace(const_iterator, key_type&& key, Args&&... args)
+            {
+                return try_emplace(AZStd::move(key), AZStd::forward<Args>(args)...).first;
+            }
+
+            template<class M>
+            pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+            {
+                pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+                if (!result.second)
+                {
+                    result.first->second = AZStd::forward<M>(value);
+                }
+                return result;
+            }
+            template<class M>
+            pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+            {
+                pair_iter_bool result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+                if (!result.second)
+                {
+                    result.first->second = AZStd::forward<M>(value);
+                }
+                return result;
+            }
+
+            mapped_type& operator[](const key_type& key)
+            {
+                return try_emplace(key).first->second;
+            }
+            mapped_type& operator[](key_type&& key)
+            {
+                return try_emplace(AZStd::move(key)).first->second;
+            }
+
+            template<class ComparableToKey>
+            mapped_type& at(const ComparableToKey& key)
+            {
+                iterator it = this->find(key);
+                AZ_Assert(it != this->end(), "Key not found in map.");
+                return it->second;
+            }
+            template<class ComparableToKey>
+            const mapped_type& at(const ComparableToKey& key) const
+            {
+                const_iterator it = this->find(key);
+                AZ_Assert(it != this->end(), "Key not found in map.");
+                return it->second;
+            }
+        };
+    } // namespace Internal
+
+    /**
+     * Hash map with open addressing that stores its elements inline in a flat array (see Internal::flat_hash_table).
+     * Compared to unordered_map it needs no allocation per element and lookups touch far fewer cache lines, which makes
+     * it a good default for maps with small keys and values. Unlike unordered_map, iterators, pointers and references
+     * to elements are invalidated when the map grows and by rehash. Use node_hash_map if stable references are needed.
+     * Lookup functions accept any type if both the Hasher and EqualKey declare is_transparent.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public Internal::flat_hash_map_base<Internal::FlatHashMapPolicy<Key, MappedType>, Hasher, EqualKey, Allocator>
+    {
+        using base_type = Internal::flat_hash_map_base<Internal::FlatHashMapPolicy<Key, MappedType>, Hasher, EqualKey, Allocator>;
+
+    public:
+        using value_type = typename base_type::value_type;
+        using size_type = typename base_type::size_type;
+        using hasher = typename base_type::hasher;
+        using key_equal = typename base_type::key_equal;
+        using allocator_type = typename base_type::allocator_type;
+
+        using base_type::base_type;
+
+        flat_hash_map() = default;
+        explicit flat_hash_map(const allocator_type& allocator)
+            : base_type(0, hasher(), key_equal(), allocator)
+        {}
+        template<class InputIterator>
+        flat_hash_map(InputIterator first, InputIterator last, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(first, last);
+        }
+        flat_hash_map(AZStd::initializer_list<value_type> list, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(list);
+        }
+
+        flat_hash_map& operator=(AZStd::initializer_list<value_type> list)
+        {
+            this->clear();
+            this->insert(list);
+            return *this;
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& lhs, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    typename flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>::size_type erase_if(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        for (auto it = container.begin(); it != container.end();)
+        {
+            if (predicate(*it))
+            {
+                it = container.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return originalSize - container.size();
+    }
+} // namespace AZStd
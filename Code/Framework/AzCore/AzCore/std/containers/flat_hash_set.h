@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key>
+        struct FlatHashSetPolicy
+        {
+            using key_type = Key;
+            using value_type = Key;
+            using init_type = Key;
+            using slot_type = Key;
+
+            static const key_type& key(const slot_type& slot) { return slot; }
+            static const key_type& key_of(const value_type& value) { return value; }
+            static value_type& element(slot_type& slot) { return slot; }
+
+            template<class Allocator, class... Args>
+            static void construct(Allocator&, slot_type* slot, Args&&... args)
+            {
+                new (slot) value_type(AZStd::forward<Args>(args)...);
+            }
+            template<class Allocator>
+            static void destroy(Allocator&, slot_type* slot)
+            {
+                slot->~value_type();
+            }
+            template<class Allocator>
+            static void transfer(Allocator&, slot_type* destination, slot_type* source)
+            {
+                new (destination) value_type(AZStd::move(*source));
+                source->~value_type();
+            }
+        };
+    } // namespace Internal
+
+    /**
+     * Hash set with open addressing that stores its keys inline in a flat array (see Internal::flat_hash_table).
+     * Iterators, pointers and references are invalidated when the set grows and by rehash. Keys must not be modified
+     * through iterators. Lookup functions accept any type if both the Hasher and EqualKey declare is_transparent.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public Internal::flat_hash_table<Internal::FlatHashSetPolicy<Key>, Hasher, EqualKey, Allocator>
+    {
+        using base_type = Internal::flat_hash_table<Internal::FlatHashSetPolicy<Key>, Hasher, EqualKey, Allocator>;
+
+    public:
+        using value_type = typename base_type::value_type;
+        using size_type = typename base_type::size_type;
+        using hasher = typename base_type::hasher;
+        using key_equal = typename base_type::key_equal;
+        using allocator_type = typename base_type::allocator_type;
+
+        using base_type::base_type;
+
+        flat_hash_set() = default;
+        explicit flat_hash_set(const allocator_type& allocator)
+            : base_type(0, hasher(), key_equal(), allocator)
+        {}
+        template<class InputIterator>
+        flat_hash_set(InputIterator first, InputIterator last, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(first, last);
+        }
+        flat_hash_set(AZStd::initializer_list<value_type> list, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(list);
+        }
+
+        flat_hash_set& operator=(AZStd::initializer_list<value_type> list)
+        {
+            this->clear();
+            this->insert(list);
+            return *this;
+        }
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& lhs, flat_hash_set<Key, Hasher, EqualKey, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator, class Predicate>
+    typename flat_hash_set<Key, Hasher, EqualKey, Allocator>::size_type erase_if(flat_hash_set<Key, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        for (auto it = container.begin(); it != container.end();)
+        {
+            if (predicate(*it))
+            {
+                it = container.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return originalSize - container.size();
+    }
+} // namespace AZStd
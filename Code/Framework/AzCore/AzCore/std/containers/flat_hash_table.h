@@ -0,0 +1,796 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/tuple.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/typetraits/is_convertible.h>
+#include <AzCore/std/typetraits/remove_cvref.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <emmintrin.h>
+#endif
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        /**
+         * Control bytes of the flat hash table. Every slot in the table has one control byte that's either one of the
+         * special values below or, for a slot that holds an element, the lower 7 bits of the element's hash (H2).
+         * Empty and deleted slots have the high bit set so groups of them can be found with a single movemask.
+         */
+        using flat_ctrl_t = signed char;
+        constexpr flat_ctrl_t FlatCtrlEmpty = -128;    // 0b10000000
+        constexpr flat_ctrl_t FlatCtrlDeleted = -2;    // 0b11111110
+        constexpr flat_ctrl_t FlatCtrlSentinel = -1;   // 0b11111111, stored one past the last slot to stop iteration.
+
+        constexpr bool FlatCtrlIsFull(flat_ctrl_t ctrl) { return ctrl >= 0; }
+
+        //! Control block for tables without any slots. Only the sentinel is needed as lookups on empty tables exit early.
+        inline flat_ctrl_t* FlatEmptyCtrl()
+        {
+            alignas(16) static const flat_ctrl_t s_emptyCtrl[1] = { FlatCtrlSentinel };
+            return const_cast<flat_ctrl_t*>(s_emptyCtrl);
+        }
+
+        //! Iterates over the set bits of a group match. Shift converts a bit position into a slot position, which is
+        //! needed for the portable implementation where every slot is represented by a byte.
+        template<class T, int Shift>
+        class FlatBitMask
+        {
+        public:
+            explicit FlatBitMask(T mask) : m_mask(mask) {}
+
+            explicit operator bool() const { return m_mask != 0; }
+            unsigned int LowestBitSet() const
+            {
+                if constexpr (sizeof(T) == 8)
+                {
+                    return static_cast<unsigned int>(az_ctz_u64(m_mask)) >> Shift;
+                }
+                else
+                {
+                    return static_cast<unsigned int>(az_ctz_u32(m_mask)) >> Shift;
+                }
+            }
+
+            FlatBitMask begin() const { return *this; }
+            FlatBitMask end() const { return FlatBitMask(0); }
+            unsigned int operator*() const { return LowestBitSet(); }
+            FlatBitMask& operator++() { m_mask &= (m_mask - 1); return *this; }
+            bool operator!=(const FlatBitMask& rhs) const { return m_mask != rhs.m_mask; }
+
+        private:
+            T m_mask;
+        };
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        //! Group of 16 control bytes that are compared in parallel with SSE2.
+        struct FlatGroup
+        {
+            static constexpr size_t Width = 16;
+
+            explicit FlatGroup(const flat_ctrl_t* ctrl)
+                : m_ctrl(_mm_load_si128(reinterpret_cast<const __m128i*>(ctrl)))
+            {}
+
+            //! Slots whose control byte matches the H2 of a hash.
+            FlatBitMask<AZ::u32, 0> Match(flat_ctrl_t h2) const
+            {
+                return FlatBitMask<AZ::u32, 0>(static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl))));
+            }
+            FlatBitMask<AZ::u32, 0> MatchEmpty() const
+            {
+                return FlatBitMask<AZ::u32, 0>(static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(FlatCtrlEmpty), m_ctrl))));
+            }
+            FlatBitMask<AZ::u32, 0> MatchEmptyOrDeleted() const
+            {
+                return FlatBitMask<AZ::u32, 0>(static_cast<AZ::u32>(_mm_movemask_epi8(m_ctrl)));
+            }
+
+            __m128i m_ctrl;
+        };
+#else
+        //! Group of 8 control bytes that are compared in parallel inside a 64-bit register. Match can report false
+        //! positives for bytes next to a real match, which is fine because every candidate is compared by key.
+        struct FlatGroup
+        {
+            static constexpr size_t Width = 8;
+            static constexpr AZ::u64 Lsbs = 0x0101010101010101ull;
+            static constexpr AZ::u64 Msbs = 0x8080808080808080ull;
+
+            explicit FlatGroup(const flat_ctrl_t* ctrl)
+            {
+                memcpy(&m_ctrl, ctrl, sizeof(m_ctrl));
+            }
+
+            FlatBitMask<AZ::u64, 3> Match(flat_ctrl_t h2) const
+            {
+                AZ::u64 x = m_ctrl ^ (Lsbs * static_cast<AZ::u8>(h2));
+                return FlatBitMask<AZ::u64, 3>((x - Lsbs) & ~x & Msbs);
+            }
+            FlatBitMask<AZ::u64, 3> MatchEmpty() const
+            {
+                // Only the empty byte has the high bit set while bit 1 is cleared.
+                return FlatBitMask<AZ::u64, 3>(m_ctrl & (~m_ctrl << 6) & Msbs);
+            }
+            FlatBitMask<AZ::u64, 3> MatchEmptyOrDeleted() const
+            {
+                return FlatBitMask<AZ::u64, 3>(m_ctrl & Msbs);
+            }
+
+            AZ::u64 m_ctrl;
+        };
+#endif
+
+        /**
+         * Open addressing hash table in the style of "Swiss tables". Elements are stored directly in a single array of
+         * slots which is paired with an array of one byte control values. A lookup hashes the key once, uses the upper
+         * bits (H1) to select a group of slots and compares the lower 7 bits (H2) against the control bytes of the full
+         * group at once, so keys only need to be compared for slots that are very likely to match. Groups are probed
+         * quadratically until a group with an empty slot is found.
+         *
+         * The Policy describes how elements are stored in a slot and has the following interface:
+         *  - key_type, value_type, slot_type
+         *  - init_type, a mutable version of value_type used for temporaries (pair<Key, T> for maps)
+         *  - static const key_type& key(const slot_type&)
+         *  - static const key_type& key_of(const value_type&) and key_of(const init_type&)
+         *  - static value_type& element(slot_type&)
+         *  - static void construct(allocator_type&, slot_type*, Args&&...)
+         *  - static void destroy(allocator_type&, slot_type*)
+         *  - static void transfer(allocator_type&, slot_type* destination, slot_type* source)
+         *
+         * Iterators and references are invalidated by any insert that causes the table to grow, unless the Policy stores
+         * the elements outside of the slots (see node_hash_map).
+         */
+        template<class Policy, class Hasher, class EqualKey, class Allocator>
+        class flat_hash_table
+        {
+            using this_type = flat_hash_table<Policy, Hasher, EqualKey, Allocator>;
+            using slot_type = typename Policy::slot_type;
+
+            template<class ComparableToKey>
+            static constexpr bool is_key_comparable_v = (Internal::is_transparent<EqualKey, ComparableToKey>::value && Internal::is_transparent<Hasher, ComparableToKey>::value)
+                || AZStd::is_convertible_v<ComparableToKey, typename Policy::key_type>;
+
+        public:
+            using key_type = typename Policy::key_type;
+            using value_type = typename Policy::value_type;
+            using hasher = Hasher;
+            using key_equal = EqualKey;
+            using allocator_type = Allocator;
+            using size_type = AZStd::size_t;
+            using difference_type = AZStd::ptrdiff_t;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+
+            template<bool IsConst>
+            class iterator_impl
+            {
+                friend class flat_hash_table;
+                friend class iterator_impl<!IsConst>;
+            public:
+                using iterator_category = AZStd::forward_iterator_tag;
+                using value_type = typename Policy::value_type;
+                using difference_type = AZStd::ptrdiff_t;
+                using reference = AZStd::conditional_t<IsConst, const value_type&, value_type&>;
+                using pointer = AZStd::conditional_t<IsConst, const value_type*, value_type*>;
+
+                iterator_impl() = default;
+                //! Allows conversion from iterator to const_iterator.
+                template<bool OtherConst, class = AZStd::enable_if_t<IsConst && !OtherConst>>
+                iterator_impl(const iterator_impl<OtherConst>& rhs)
+                    : m_ctrl(rhs.m_ctrl)
+                    , m_slot(rhs.m_slot)
+                {}
+
+                reference operator*() const { return Policy::element(*m_slot); }
+                pointer operator->() const { return &Policy::element(*m_slot); }
+
+                iterator_impl& operator++()
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                    SkipEmptyOrDeleted();
+                    return *this;
+                }
+                iterator_impl operator++(int)
+                {
+                    iterator_impl result = *this;
+                    ++(*this);
+                    return result;
+                }
+
+                bool operator==(const iterator_impl& rhs) const { return m_ctrl == rhs.m_ctrl; }
+                bool operator!=(const iterator_impl& rhs) const { return m_ctrl != rhs.m_ctrl; }
+
+            private:
+                iterator_impl(flat_ctrl_t* ctrl, slot_type* slot)
+                    : m_ctrl(ctrl)
+                    , m_slot(slot)
+                {}
+
+                void SkipEmptyOrDeleted()
+                {
+                    // The sentinel is larger than empty and deleted, so this stops at either a full slot or the end.
+                    while (*m_ctrl < FlatCtrlSentinel)
+                    {
+                        ++m_ctrl;
+                        ++m_slot;
+                    }
+                }
+
+                flat_ctrl_t* m_ctrl{ nullptr };
+                slot_type* m_slot{ nullptr };
+            };
+
+            using iterator = iterator_impl<false>;
+            using const_iterator = iterator_impl<true>;
+            using pair_iter_bool = AZStd::pair<iterator, bool>;
+
+            explicit flat_hash_table(size_type bucketCount = 0, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+                const allocator_type& allocator = allocator_type())
+                : m_hasher(hash)
+                , m_keyEqual(keyEqual)
+                , m_allocator(allocator)
+            {
+                if (bucketCount > 0)
+                {
+                    reserve(bucketCount);
+                }
+            }
+
+            flat_hash_table(const flat_hash_table& rhs)
+                : m_hasher(rhs.m_hasher)
+                , m_keyEqual(rhs.m_keyEqual)
+                , m_allocator(rhs.m_allocator)
+            {
+                copy_from(rhs);
+            }
+
+            flat_hash_table(flat_hash_table&& rhs)
+                : m_hasher(AZStd::move(rhs.m_hasher))
+                , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+                , m_allocator(AZStd::move(rhs.m_allocator))
+            {
+                steal_from(rhs);
+            }
+
+            ~flat_hash_table()
+            {
+                destroy_and_deallocate();
+            }
+
+            flat_hash_table& operator=(const flat_hash_table& rhs)
+            {
+                if (this != &rhs)
+                {
+                    destroy_and_deallocate();
+                    m_hasher = rhs.m_hasher;
+                    m_keyEqual = rhs.m_keyEqual;
+                    m_allocator = rhs.m_allocator;
+                    copy_from(rhs);
+                }
+                return *this;
+            }
+
+            flat_hash_table& operator=(flat_hash_table&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    destroy_and_deallocate();
+                    m_hasher = AZStd::move(rhs.m_hasher);
+                    m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                    m_allocator = AZStd::move(rhs.m_allocator);
+                    steal_from(rhs);
+                }
+                return *this;
+            }
+
+            iterator begin()
+            {
+                iterator result(m_ctrl, m_slots);
+                result.SkipEmptyOrDeleted();
+                return result;
+            }
+            const_iterator begin() const { return const_cast<this_type*>(this)->begin(); }
+            const_iterator cbegin() const { return begin(); }
+            iterator end() { return iterator(m_ctrl + m_capacity, nullptr); }
+            const_iterator end() const { return const_cast<this_type*>(this)->end(); }
+            const_iterator cend() const { return end(); }
+
+            bool empty() const { return m_size == 0; }
+            size_type size() const { return m_size; }
+            size_type max_size() const { return m_allocator.get_max_size() / sizeof(slot_type); }
+            //! Number of slots in the table. Tables are grown when more than 7/8th of the slots are in use.
+            size_type capacity() const { return m_capacity; }
+            size_type bucket_count() const { return m_capacity; }
+            float load_factor() const { return m_capacity > 0 ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f; }
+            float max_load_factor() const { return 7.0f / 8.0f; }
+
+            hasher hash_function() const { return m_hasher; }
+            key_equal key_eq() const { return m_keyEqual; }
+            allocator_type& get_allocator() { return m_allocator; }
+            const allocator_type& get_allocator() const { return m_allocator; }
+            void set_allocator(const allocator_type& allocator)
+            {
+                AZ_Assert(m_capacity == 0, "Allocator can only be changed while the table has no memory allocated.");
+                m_allocator = allocator;
+            }
+
+            void clear()
+            {
+                if (m_capacity == 0)
+                {
+                    return;
+                }
+                destroy_elements();
+                reset_ctrl();
+                m_size = 0;
+                m_growthLeft = MaxLoad(m_capacity);
+            }
+
+            //! Makes sure at least count elements can be stored without growing the table.
+            void reserve(size_type count)
+            {
+                if (count > MaxLoad(m_capacity))
+                {
+                    resize(CapacityForCount(count));
+                }
+            }
+
+            //! Rehashes the table into the smallest capacity that can hold max(count, size()) elements.
+            void rehash(size_type count)
+            {
+                size_type newCapacity = CapacityForCount(AZStd::max(count, m_size));
+                if (newCapacity == 0)
+                {
+                    destroy_and_deallocate();
+                    m_ctrl = FlatEmptyCtrl();
+                    m_slots = nullptr;
+                    m_capacity = 0;
+                    m_growthLeft = 0;
+                }
+                else
+                {
+                    resize(newCapacity);
+                }
+            }
+
+            void swap(flat_hash_table& rhs)
+            {
+                AZStd::swap(m_ctrl, rhs.m_ctrl);
+                AZStd::swap(m_slots, rhs.m_slots);
+                AZStd::swap(m_capacity, rhs.m_capacity);
+                AZStd::swap(m_size, rhs.m_size);
+                AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+                AZStd::swap(m_hasher, rhs.m_hasher);
+                AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+                AZStd::swap(m_allocator, rhs.m_allocator);
+            }
+
+            template<class ComparableToKey>
+            auto find(const ComparableToKey& key) -> enable_if_t<is_key_comparable_v<ComparableToKey>, iterator>
+            {
+                size_type index;
+                return find_index(key, HashKey(key), index) ? iterator_at(index) : end();
+            }
+            template<class ComparableToKey>
+            auto find(const ComparableToKey& key) const -> enable_if_t<is_key_comparable_v<ComparableToKey>, const_iterator>
+            {
+                return const_cast<this_type*>(this)->find(key);
+            }
+            template<class ComparableToKey>
+            auto contains(const ComparableToKey& key) const -> enable_if_t<is_key_comparable_v<ComparableToKey>, bool>
+            {
+                size_type index;
+                return find_index(key, HashKey(key), index);
+            }
+            template<class ComparableToKey>
+            auto count(const ComparableToKey& key) const -> enable_if_t<is_key_comparable_v<ComparableToKey>, size_type>
+            {
+                return contains(key) ? 1 : 0;
+            }
+            template<class ComparableToKey>
+            auto equal_range(const ComparableToKey& key) -> enable_if_t<is_key_comparable_v<ComparableToKey>, AZStd::pair<iterator, iterator>>
+            {
+                iterator it = find(key);
+                if (it == end())
+                {
+                    return { it, it };
+                }
+                iterator next = it;
+                return { it, ++next };
+            }
+            template<class ComparableToKey>
+            auto equal_range(const ComparableToKey& key) const -> enable_if_t<is_key_comparable_v<ComparableToKey>, AZStd::pair<const_iterator, const_iterator>>
+            {
+                auto result = const_cast<this_type*>(this)->equal_range(key);
+                return { result.first, result.second };
+            }
+
+            pair_iter_bool insert(const value_type& value)
+            {
+                return emplace_with_key(Policy::key_of(value), value);
+            }
+            pair_iter_bool insert(value_type&& value)
+            {
+                return emplace_with_key(Policy::key_of(value), AZStd::move(value));
+            }
+            iterator insert(const_iterator, const value_type& value)
+            {
+                return insert(value).first;
+            }
+            iterator insert(const_iterator, value_type&& value)
+            {
+                return insert(AZStd::move(value)).first;
+            }
+            template<class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                {
+                    emplace(*first);
+                }
+            }
+            void insert(AZStd::initializer_list<value_type> list)
+            {
+                reserve(m_size + list.size());
+                insert(list.begin(), list.end());
+            }
+
+            template<class... Args>
+            pair_iter_bool emplace(Args&&... args)
+            {
+                // The key is needed before a slot can be picked, so arguments that aren't the value type itself are
+                // used to construct a temporary that is moved into the table if the key isn't there yet.
+                if constexpr (sizeof...(Args) == 1
+                    && ((AZStd::is_same_v<AZStd::remove_cvref_t<Args>, value_type> || AZStd::is_same_v<AZStd::remove_cvref_t<Args>, typename Policy::init_type>) && ...))
+                {
+                    return emplace_with_key(Policy::key_of(args...), AZStd::forward<Args>(args)...);
+                }
+                else
+                {
+                    typename Policy::init_type value(AZStd::forward<Args>(args)...);
+                    return emplace_with_key(Policy::key_of(value), AZStd::move(value));
+                }
+            }
+            template<class... Args>
+            iterator emplace_hint(const_iterator, Args&&... args)
+            {
+                return emplace(AZStd::forward<Args>(args)...).first;
+            }
+
+            iterator erase(const_iterator it)
+            {
+                AZ_Assert(it != end(), "Erasing an invalid iterator.");
+                size_type index = static_cast<size_type>(it.m_ctrl - m_ctrl);
+                erase_index(index);
+                iterator next(m_ctrl + index + 1, m_slots + index + 1);
+                next.SkipEmptyOrDeleted();
+                return next;
+            }
+            iterator erase(iterator it)
+            {
+                return erase(const_iterator(it));
+            }
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                while (first != last)
+                {
+                    first = erase(first);
+                }
+                return iterator(last.m_ctrl, last.m_slot);
+            }
+            template<class ComparableToKey>
+            auto erase(const ComparableToKey& key) -> enable_if_t<is_key_comparable_v<ComparableToKey> && !AZStd::is_convertible_v<const ComparableToKey&, const_iterator>, size_type>
+            {
+                size_type index;
+                if (find_index(key, HashKey(key), index))
+                {
+                    erase_index(index);
+                    return 1;
+                }
+                return 0;
+            }
+
+        protected:
+            iterator iterator_at(size_type index) { return iterator(m_ctrl + index, m_slots + index); }
+
+            //! Constructs a new element from args if no element with the key exists. The arguments aren't touched otherwise.
+            template<class K, class... Args>
+            pair_iter_bool emplace_with_key(const K& key, Args&&... args)
+            {
+                size_t hash = HashKey(key);
+                size_type index;
+                if (find_index(key, hash, index))
+                {
+                    return { iterator_at(index), false };
+                }
+                index = prepare_insert(hash);
+                Policy::construct(m_allocator, m_slots + index, AZStd::forward<Args>(args)...);
+                return { iterator_at(index), true };
+            }
+
+            template<class K>
+            bool find_index(const K& key, size_t hash, size_type& index) const
+            {
+                if (m_size == 0)
+                {
+                    return false;
+                }
+                const size_type groupMask = (m_capacity / FlatGroup::Width) - 1;
+                const flat_ctrl_t h2 = H2(hash);
+                size_type groupIndex = H1(hash) & groupMask;
+                for (size_type step = 1; ; ++step)
+                {
+                    const size_type groupOffset = groupIndex * FlatGroup::Width;
+                    FlatGroup group(m_ctrl + groupOffset);
+                    for (unsigned int bit : group.Match(h2))
+                    {
+                        if (m_keyEqual(Policy::key(m_slots[groupOffset + bit]), key))
+                        {
+                            index = groupOffset + bit;
+                            return true;
+                        }
+                    }
+                    if (group.MatchEmpty())
+                    {
+                        return false;
+                    }
+                    // Triangular probing visits every group exactly once when the number of groups is a power of two.
+                    groupIndex = (groupIndex + step) & groupMask;
+                }
+            }
+
+            size_type find_first_non_full(size_t hash) const
+            {
+                const size_type groupMask = (m_capacity / FlatGroup::Width) - 1;
+                size_type groupIndex = H1(hash) & groupMask;
+                for (size_type step = 1; ; ++step)
+                {
+                    FlatGroup group(m_ctrl + groupIndex * FlatGroup::Width);
+                    if (auto mask = group.MatchEmptyOrDeleted())
+                    {
+                        return groupIndex * FlatGroup::Width + mask.LowestBitSet();
+                    }
+                    groupIndex = (groupIndex + step) & groupMask;
+                }
+            }
+
+            //! Claims a slot for a new element with the provided hash. The caller has to construct the element in the slot.
+            size_type prepare_insert(size_t hash)
+            {
+                if (m_capacity == 0)
+                {
+                    resize(FlatGroup::Width);
+                }
+                size_type index = find_first_non_full(hash);
+                if (m_growthLeft == 0 && m_ctrl[index] != FlatCtrlDeleted)
+                {
+                    // Reclaim deleted slots in place if the table is mostly tombstones, otherwise double the capacity.
+                    resize(m_size < MaxLoad(m_capacity) / 2 ? m_capacity : m_capacity * 2);
+                    index = find_first_non_full(hash);
+                }
+                if (m_ctrl[index] == FlatCtrlEmpty)
+                {
+                    --m_growthLeft;
+                }
+                m_ctrl[index] = H2(hash);
+                ++m_size;
+                return index;
+            }
+
+            void erase_index(size_type index)
+            {
+                Policy::destroy(m_allocator, m_slots + index);
+                --m_size;
+                // If the group already has an empty slot no probe sequence continues past it, so the slot can be marked
+                // empty again instead of leaving a tombstone behind.
+                const size_type groupOffset = index & ~(FlatGroup::Width - 1);
+                if (FlatGroup(m_ctrl + groupOffset).MatchEmpty())
+                {
+                    m_ctrl[index] = FlatCtrlEmpty;
+                    ++m_growthLeft;
+                }
+                else
+                {
+                    m_ctrl[index] = FlatCtrlDeleted;
+                }
+            }
+
+        private:
+            static constexpr size_type MaxLoad(size_type capacity) { return capacity - capacity / 8; }
+            static constexpr size_type SlotOffset(size_type capacity)
+            {
+                // The control bytes are followed by the sentinel after which the slots start at their natural alignment.
+                return (capacity + 1 + alignof(slot_type) - 1) & ~(alignof(slot_type) - 1);
+            }
+            static constexpr size_type AllocationAlignment()
+            {
+                return alignof(slot_type) > FlatGroup::Width ? alignof(slot_type) : FlatGroup::Width;
+            }
+            static constexpr size_type AllocationSize(size_type capacity) { return SlotOffset(capacity) + capacity * sizeof(slot_type); }
+
+            static size_type CapacityForCount(size_type count)
+            {
+                if (count == 0)
+                {
+                    return 0;
+                }
+                size_type capacity = FlatGroup::Width;
+                while (MaxLoad(capacity) < count)
+                {
+                    capacity *= 2;
+                }
+                return capacity;
+            }
+
+            static size_t MixHash(size_t hash)
+            {
+                // Many hashers, such as the one for integers, return the value unchanged. Mix the bits so both H1 and
+                // H2 are well distributed.
+                AZ::u64 mixed = static_cast<AZ::u64>(hash) * 0x9E3779B97F4A7C15ull;
+                return static_cast<size_t>(mixed ^ (mixed >> 32));
+            }
+            static size_type H1(size_t hash) { return static_cast<size_type>(hash >> 7); }
+            static flat_ctrl_t H2(size_t hash) { return static_cast<flat_ctrl_t>(hash & 0x7f); }
+
+            template<class K>
+            size_t HashKey(const K& key) const { return MixHash(m_hasher(key)); }
+
+            void reset_ctrl()
+            {
+                memset(m_ctrl, static_cast<unsigned char>(FlatCtrlEmpty), m_capacity);
+                m_ctrl[m_capacity] = FlatCtrlSentinel;
+            }
+
+            void allocate(size_type capacity)
+            {
+                AZ_Assert((capacity & (capacity - 1)) == 0 && capacity >= FlatGroup::Width, "Flat hash table capacity has to be a power of two.");
+                void* memory = m_allocator.allocate(AllocationSize(capacity), AllocationAlignment());
+                m_ctrl = reinterpret_cast<flat_ctrl_t*>(memory);
+                m_slots = reinterpret_cast<slot_type*>(reinterpret_cast<char*>(memory) + SlotOffset(capacity));
+                m_capacity = capacity;
+                m_growthLeft = MaxLoad(capacity);
+                reset_ctrl();
+            }
+
+            void deallocate(flat_ctrl_t* ctrl, size_type capacity)
+            {
+                if (capacity > 0)
+                {
+                    m_allocator.deallocate(ctrl, AllocationSize(capacity), AllocationAlignment());
+                }
+            }
+
+            void resize(size_type newCapacity)
+            {
+                flat_ctrl_t* oldCtrl = m_ctrl;
+                slot_type* oldSlots = m_slots;
+                const size_type oldCapacity = m_capacity;
+
+                allocate(newCapacity);
+                for (size_type i = 0; i < oldCapacity; ++i)
+                {
+                    if (FlatCtrlIsFull(oldCtrl[i]))
+                    {
+                        size_t hash = HashKey(Policy::key(oldSlots[i]));
+                        size_type index = find_first_non_full(hash);
+                        m_ctrl[index] = H2(hash);
+                        Policy::transfer(m_allocator, m_slots + index, oldSlots + i);
+                    }
+                }
+                m_growthLeft -= m_size;
+                deallocate(oldCtrl, oldCapacity);
+            }
+
+            void destroy_elements()
+            {
+                for (size_type i = 0; i < m_capacity; ++i)
+                {
+                    if (FlatCtrlIsFull(m_ctrl[i]))
+                    {
+                        Policy::destroy(m_allocator, m_slots + i);
+                    }
+                }
+            }
+
+            void destroy_and_deallocate()
+            {
+                if (m_capacity > 0)
+                {
+                    destroy_elements();
+                    deallocate(m_ctrl, m_capacity);
+                }
+                m_ctrl = FlatEmptyCtrl();
+                m_slots = nullptr;
+                m_capacity = 0;
+                m_size = 0;
+                m_growthLeft = 0;
+            }
+
+            void copy_from(const flat_hash_table& rhs)
+            {
+                if (rhs.m_size == 0)
+                {
+                    return;
+                }
+                allocate(CapacityForCount(rhs.m_size));
+                for (size_type i = 0; i < rhs.m_capacity; ++i)
+                {
+                    if (FlatCtrlIsFull(rhs.m_ctrl[i]))
+                    {
+                        size_t hash = HashKey(Policy::key(rhs.m_slots[i]));
+                        size_type index = find_first_non_full(hash);
+                        m_ctrl[index] = H2(hash);
+                        Policy::construct(m_allocator, m_slots + index, Policy::element(rhs.m_slots[i]));
+                    }
+                }
+                m_size = rhs.m_size;
+                m_growthLeft -= m_size;
+            }
+
+            void steal_from(flat_hash_table& rhs)
+            {
+                m_ctrl = rhs.m_ctrl;
+                m_slots = rhs.m_slots;
+                m_capacity = rhs.m_capacity;
+                m_size = rhs.m_size;
+                m_growthLeft = rhs.m_growthLeft;
+                rhs.m_ctrl = FlatEmptyCtrl();
+                rhs.m_slots = nullptr;
+                rhs.m_capacity = 0;
+                rhs.m_size = 0;
+                rhs.m_growthLeft = 0;
+            }
+
+            flat_ctrl_t* m_ctrl{ FlatEmptyCtrl() };
+            slot_type* m_slots{ nullptr };
+            size_type m_capacity{ 0 };
+            size_type m_size{ 0 };
+            size_type m_growthLeft{ 0 };
+            hasher m_hasher;
+            key_equal m_keyEqual;
+            allocator_type m_allocator;
+        };
+
+        template<class Policy, class Hasher, class EqualKey, class Allocator>
+        bool operator==(const flat_hash_table<Policy, Hasher, EqualKey, Allocator>& lhs, const flat_hash_table<Policy, Hasher, EqualKey, Allocator>& rhs)
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+            for (const auto& value : lhs)
+            {
+                auto it = rhs.find(Policy::key_of(value));
+                if (it == rhs.end() || !(*it == value))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<class Policy, class Hasher, class EqualKey, class Allocator>
+        bool operator!=(const flat_hash_table<Policy, Hasher, EqualKey, Allocator>& lhs, const flat_hash_table<Policy, Hasher, EqualKey, Allocator>& rhs)
+        {
+            return !(lhs == rhs);
+        }
+    } // namespace Internal
+} // namespace AZStd
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_map.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        //! Stores a pointer to a separately allocated element in every slot, so elements never move.
+        template<class Key, class MappedType>
+        struct NodeHashMapPolicy
+        {
+            using key_type = Key;
+            using mapped_type = MappedType;
+            using value_type = AZStd::pair<const Key, MappedType>;
+            using init_type = AZStd::pair<Key, MappedType>;
+            using slot_type = value_type*;
+
+            static const key_type& key(const slot_type& slot) { return slot->first; }
+            static const key_type& key_of(const value_type& value) { return value.first; }
+            static const key_type& key_of(const init_type& value) { return value.first; }
+            static value_type& element(slot_type slot) { return *slot; }
+
+            template<class Allocator, class... Args>
+            static void construct(Allocator& allocator, slot_type* slot, Args&&... args)
+            {
+                void* memory = allocator.allocate(sizeof(value_type), alignof(value_type));
+                *slot = new (memory) value_type(AZStd::forward<Args>(args)...);
+            }
+            template<class Allocator>
+            static void destroy(Allocator& allocator, slot_type* slot)
+            {
+                (*slot)->~value_type();
+                allocator.deallocate(*slot, sizeof(value_type), alignof(value_type));
+            }
+            template<class Allocator>
+            static void transfer(Allocator&, slot_type* destination, slot_type* source)
+            {
+                *destination = *source;
+            }
+        };
+    } // namespace Internal
+
+    /**
+     * Hash map that uses the same open addressing table as flat_hash_map, but allocates every element separately.
+     * Pointers and references to elements stay valid until the element is erased, which makes it a drop-in replacement
+     * for unordered_map in code that holds on to elements, while still getting the faster probing. Iterators are
+     * invalidated when the map grows.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class node_hash_map
+        : public Internal::flat_hash_map_base<Internal::NodeHashMapPolicy<Key, MappedType>, Hasher, EqualKey, Allocator>
+    {
+        using base_type = Internal::flat_hash_map_base<Internal::NodeHashMapPolicy<Key, MappedType>, Hasher, EqualKey, Allocator>;
+
+    public:
+        using value_type = typename base_type::value_type;
+        using size_type = typename base_type::size_type;
+        using hasher = typename base_type::hasher;
+        using key_equal = typename base_type::key_equal;
+        using allocator_type = typename base_type::allocator_type;
+
+        using base_type::base_type;
+
+        node_hash_map() = default;
+        explicit node_hash_map(const allocator_type& allocator)
+            : base_type(0, hasher(), key_equal(), allocator)
+        {}
+        template<class InputIterator>
+        node_hash_map(InputIterator first, InputIterator last, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(first, last);
+        }
+        node_hash_map(AZStd::initializer_list<value_type> list, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(list);
+        }
+
+        node_hash_map& operator=(AZStd::initializer_list<value_type> list)
+        {
+            this->clear();
+            this->insert(list);
+            return *this;
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    void swap(node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& lhs, node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    typename node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>::size_type erase_if(node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        for (auto it = container.begin(); it != container.end();)
+        {
+            if (predicate(*it))
+            {
+                it = container.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return originalSize - container.size();
+    }
+} // namespace AZStd
@@ -302,6 +302,27 @@ namespace Platform
         return 0;
     }
 
+    SystemFile::SizeType ReadVectored(FileHandleType handle, const SystemFile* systemFile, SizeType offset,
+        const SystemFile::ReadVector* buffers, size_t numBuffers)
+    {
+        // Files can be stored in the APK, so go through the regular stream functions.
+        SizeType totalRead = 0;
+        if (handle != PlatformSpecificInvalidHandle)
+        {
+            Seek(handle, systemFile, aznumeric_cast<SystemFile::SeekSizeType>(offset), SystemFile::SF_SEEK_BEGIN);
+            for (size_t i = 0; i < numBuffers; ++i)
+            {
+                SizeType numRead = Read(handle, systemFile, buffers[i].m_size, buffers[i].m_buffer);
+                totalRead += numRead;
+                if (numRead != buffers[i].m_size)
+                {
+                    break;
+                }
+            }
+        }
+        return totalRead;
+    }
+
     SystemFile::SizeType Write(FileHandleType handle, const SystemFile* systemFile, const void* buffer, SizeType byteSize)
     {
         if (handle != PlatformSpecificInvalidHandle)
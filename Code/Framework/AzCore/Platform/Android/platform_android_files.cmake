@@ -33,6 +33,7 @@ set(FILES
     ../Common/Default/AzCore/IO/Streamer/StreamerConfiguration_Default.cpp
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.cpp
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
+    ../Common/UnixLike/AzCore/IO/MemoryMappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
@@ -40,6 +41,7 @@ set(FILES
     AzCore/IO/SystemFile_Android.cpp
     AzCore/IO/SystemFile_Android.h
     AzCore/IO/SystemFile_Platform.h
+    ../Common/Default/AzCore/Jobs/Internal/ProcessorTopology_Default.cpp
     AzCore/IPC/SharedMemory_Platform.h
     ../Common/Unimplemented/AzCore/Memory/OverrunDetectionAllocator_Unimplemented.h
     ../Common/UnixLike/AzCore/Memory/OSAllocator_UnixLike.h
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/ProcessorTopology.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        AZStd::vector<AZ::u32> GetProcessorTopologyDomains()
+        {
+            return {};
+        }
+
+        int GetCurrentProcessorIndex()
+        {
+            return -1;
+        }
+    } // namespace Internal
+} // namespace AZ
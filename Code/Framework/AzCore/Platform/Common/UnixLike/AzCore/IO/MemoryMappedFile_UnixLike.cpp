@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace AZ::IO::Platform
+{
+    bool MapFile(const char* absolutePath, const u8*& data, u64& size, [[maybe_unused]] uintptr_t& platformHandle)
+    {
+        int fileDescriptor = open(absolutePath, O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        bool result = false;
+        struct stat fileStats;
+        if (fstat(fileDescriptor, &fileStats) == 0 && fileStats.st_size > 0)
+        {
+            void* address = mmap(nullptr, aznumeric_cast<size_t>(fileStats.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+            if (address != MAP_FAILED)
+            {
+                data = reinterpret_cast<const u8*>(address);
+                size = aznumeric_cast<u64>(fileStats.st_size);
+                result = true;
+            }
+        }
+        // The mapping keeps its own reference to the file, so the descriptor is no longer needed.
+        close(fileDescriptor);
+        return result;
+    }
+
+    void UnmapFile(const u8* data, u64 size, [[maybe_unused]] uintptr_t platformHandle)
+    {
+        munmap(const_cast<u8*>(data), aznumeric_cast<size_t>(size));
+    }
+} // namespace AZ::IO::Platform
@@ -20,6 +20,7 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <errno.h>
 #include <dirent.h>
 
@@ -200,6 +201,77 @@ namespace Platform
         return 0;
     }
 
+    SystemFile::SizeType ReadVectored(FileHandleType handle, const SystemFile* systemFile, SizeType offset,
+        const SystemFile::ReadVector* buffers, size_t numBuffers)
+    {
+        if (handle == PlatformSpecificInvalidHandle)
+        {
+            return 0;
+        }
+
+        SizeType totalRead = 0;
+#if AZ_TRAIT_SYSTEMFILE_PREADV_IS_DEFINED
+        // Number of buffers submitted per call, well below IOV_MAX on all supported platforms.
+        constexpr size_t MaxVectorsPerRead = 64;
+        struct iovec vectors[MaxVectorsPerRead];
+
+        size_t bufferIndex = 0;
+        SizeType bufferOffset = 0; // Number of bytes already read into the buffer at bufferIndex.
+        while (bufferIndex < numBuffers)
+        {
+            size_t numVectors = 0;
+            for (size_t i = bufferIndex; i < numBuffers && numVectors < MaxVectorsPerRead; ++i, ++numVectors)
+            {
+                SizeType skip = (i == bufferIndex) ? bufferOffset : 0;
+                vectors[numVectors].iov_base = reinterpret_cast<char*>(buffers[i].m_buffer) + skip;
+                vectors[numVectors].iov_len = buffers[i].m_size - skip;
+            }
+
+            ssize_t bytesRead = preadv(handle, vectors, aznumeric_cast<int>(numVectors), aznumeric_cast<off_t>(offset + totalRead));
+            if (bytesRead == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                EBUS_EVENT(FileIOEventBus, OnError, systemFile, nullptr, errno);
+                break;
+            }
+            if (bytesRead == 0)
+            {
+                break; // End of file.
+            }
+            totalRead += bytesRead;
+
+            // Advance past the buffers that have been filled. A short read continues in the middle of a buffer.
+            SizeType remaining = aznumeric_cast<SizeType>(bytesRead);
+            while (bufferIndex < numBuffers && remaining >= buffers[bufferIndex].m_size - bufferOffset)
+            {
+                remaining -= buffers[bufferIndex].m_size - bufferOffset;
+                bufferOffset = 0;
+                ++bufferIndex;
+            }
+            bufferOffset += remaining;
+        }
+#else
+        for (size_t i = 0; i < numBuffers; ++i)
+        {
+            ssize_t bytesRead = pread(handle, buffers[i].m_buffer, buffers[i].m_size, aznumeric_cast<off_t>(offset + totalRead));
+            if (bytesRead == -1)
+            {
+                EBUS_EVENT(FileIOEventBus, OnError, systemFile, nullptr, errno);
+                break;
+            }
+            totalRead += bytesRead;
+            if (aznumeric_cast<SizeType>(bytesRead) != buffers[i].m_size)
+            {
+                break;
+            }
+        }
+#endif // AZ_TRAIT_SYSTEMFILE_PREADV_IS_DEFINED
+        return totalRead;
+    }
+
     SystemFile::SizeType Write(FileHandleType handle, const SystemFile* systemFile, const void* buffer, SizeType byteSize)
     {
         if (handle != PlatformSpecificInvalidHandle)
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO::Platform
+{
+    bool MapFile(const char* absolutePath, const u8*& data, u64& size, uintptr_t& platformHandle)
+    {
+        wchar_t fileNameW[AZ_MAX_PATH_LEN];
+        size_t numCharsConverted;
+        if (mbstowcs_s(&numCharsConverted, fileNameW, absolutePath, AZ_ARRAY_SIZE(fileNameW) - 1) != 0)
+        {
+            return false;
+        }
+
+        HANDLE file = CreateFileW(fileNameW, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        bool result = false;
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+        {
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (address != nullptr)
+                {
+                    data = reinterpret_cast<const u8*>(address);
+                    size = aznumeric_cast<u64>(fileSize.QuadPart);
+                    platformHandle = reinterpret_cast<uintptr_t>(mapping);
+                    result = true;
+                }
+                else
+                {
+                    CloseHandle(mapping);
+                }
+            }
+        }
+        // The mapping object keeps its own reference to the file, so the file handle is no longer needed.
+        CloseHandle(file);
+        return result;
+    }
+
+    void UnmapFile(const u8* data, [[maybe_unused]] u64 size, uintptr_t platformHandle)
+    {
+        UnmapViewOfFile(data);
+        CloseHandle(reinterpret_cast<HANDLE>(platformHandle));
+    }
+} // namespace AZ::IO::Platform
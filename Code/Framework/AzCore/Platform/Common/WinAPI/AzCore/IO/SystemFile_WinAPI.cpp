@@ -360,6 +360,36 @@ namespace Platform
         return 0;
     }
 
+    SystemFile::SizeType ReadVectored(FileHandleType handle, const SystemFile* systemFile, SizeType offset,
+        const SystemFile::ReadVector* buffers, size_t numBuffers)
+    {
+        // ReadFileScatter requires unbuffered handles and page sized buffers, so read each buffer with a positioned read.
+        SizeType totalRead = 0;
+        if (handle != PlatformSpecificInvalidHandle)
+        {
+            for (size_t i = 0; i < numBuffers; ++i)
+            {
+                SizeType readOffset = offset + totalRead;
+                OVERLAPPED overlapped = {};
+                overlapped.Offset = static_cast<DWORD>(readOffset);
+                overlapped.OffsetHigh = static_cast<DWORD>(readOffset >> 32);
+
+                DWORD dwNumBytesRead = 0;
+                if (!ReadFile(handle, buffers[i].m_buffer, static_cast<DWORD>(buffers[i].m_size), &dwNumBytesRead, &overlapped))
+                {
+                    EBUS_EVENT(FileIOEventBus, OnError, systemFile, nullptr, (int)GetLastError());
+                    break;
+                }
+                totalRead += dwNumBytesRead;
+                if (dwNumBytesRead != buffers[i].m_size)
+                {
+                    break;
+                }
+            }
+        }
+        return totalRead;
+    }
+
     SystemFile::SizeType Write(FileHandleType handle, const SystemFile* systemFile, const void* buffer, SizeType byteSize)
     {
         if (handle != PlatformSpecificInvalidHandle)
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveUring_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxUringStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (!StorageDriveLinuxUring::IsAvailable())
+        {
+            AZ_Warning("Streamer", false, "io_uring isn't available, reads will be handled by the next storage drive.\n");
+            return parent;
+        }
+
+        StorageDriveLinuxUring::ConstructionOptions options;
+        options.m_enableDirectReads = m_enableDirectReads;
+        options.m_hasSeekPenalty = m_hasSeekPenalty;
+        options.m_minimalReporting = m_minimalReporting;
+
+        auto stackEntry = AZStd::make_shared<StorageDriveLinuxUring>(m_maxFileHandles, m_queueDepth,
+            hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize, m_overcommit, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxUringStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxUringStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxUringStorageDriveConfig::m_maxFileHandles)
+                ->Field("QueueDepth", &LinuxUringStorageDriveConfig::m_queueDepth)
+                ->Field("Overcommit", &LinuxUringStorageDriveConfig::m_overcommit)
+                ->Field("EnableDirectReads", &LinuxUringStorageDriveConfig::m_enableDirectReads)
+                ->Field("HasSeekPenalty", &LinuxUringStorageDriveConfig::m_hasSeekPenalty)
+                ->Field("MinimalReporting", &LinuxUringStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
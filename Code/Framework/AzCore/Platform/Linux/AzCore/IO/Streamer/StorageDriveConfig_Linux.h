@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    //! Configuration for the io_uring based storage drive. The drive is placed on top of the generic StorageDrive. If
+    //! io_uring isn't available, for instance because the kernel is too old or io_uring has been disabled, no entry is
+    //! added and all requests are handled by the generic storage drive.
+    class LinuxUringStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxUringStorageDriveConfig, "{4B1E3A0C-7D62-4F8A-9C55-2E7B0D9A6F31}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxUringStorageDriveConfig, SystemAllocator, 0);
+
+        ~LinuxUringStorageDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxFileHandles{ 32 };
+        AZ::u32 m_queueDepth{ 32 };
+        AZ::s32 m_overcommit{ 8 };
+        bool m_enableDirectReads{ true };
+        bool m_hasSeekPenalty{ false };
+        bool m_minimalReporting{ false };
+    };
+} // namespace AZ::IO
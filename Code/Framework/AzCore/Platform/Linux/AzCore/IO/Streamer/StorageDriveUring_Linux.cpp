@@ -0,0 +1,1296 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDriveUring_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+// Older C libraries don't provide the system call numbers yet. These are the same for all architectures.
+#if !defined(__NR_io_uring_setup)
+#define __NR_io_uring_setup 425
+#endif
+#if !defined(__NR_io_uring_enter)
+#define __NR_io_uring_enter 426
+#endif
+#if !defined(__NR_io_uring_register)
+#define __NR_io_uring_register 427
+#endif
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinuxUring::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // Ring
+    //
+
+    //! Minimal wrapper around the submission and completion queues of an io_uring instance. The system calls are used
+    //! directly so there's no dependency on liburing. The ring is only accessed from the streamer thread.
+    class StorageDriveLinuxUring::Ring
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(Ring, SystemAllocator, 0);
+
+        Ring() = default;
+        ~Ring();
+
+        static int Setup(u32 entries, io_uring_params& params)
+        {
+            return aznumeric_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        }
+
+        bool Initialize(u32 entries);
+        bool RegisterEventFileDescriptor(int eventFileDescriptor);
+
+        //! Returns the next free submission queue entry or null if the submission queue is full.
+        io_uring_sqe* GetSubmissionEntry();
+        //! Submits all entries that have been queued since the last call.
+        void Submit();
+        //! Blocks until at least the given number of completions are available. Returns false if waiting failed.
+        bool WaitForCompletions(u32 minComplete);
+
+        //! Calls the callback with the user data and result of every available completion.
+        template<typename Callback>
+        size_t ReapCompletions(Callback&& callback);
+
+    private:
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        io_uring_cqe* m_completionEntries{ nullptr };
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+        size_t m_submissionEntriesSize{ 0 };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        u32 m_submissionMask{ 0 };
+        u32 m_completionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+        u32 m_localSubmissionTail{ 0 };
+        u32 m_numToSubmit{ 0 };
+
+        int m_ringFileDescriptor{ -1 };
+    };
+
+    StorageDriveLinuxUring::Ring::~Ring()
+    {
+        if (m_submissionEntries)
+        {
+            munmap(m_submissionEntries, m_submissionEntriesSize);
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            munmap(m_completionRing, m_completionRingSize);
+        }
+        if (m_submissionRing)
+        {
+            munmap(m_submissionRing, m_submissionRingSize);
+        }
+        if (m_ringFileDescriptor >= 0)
+        {
+            close(m_ringFileDescriptor);
+        }
+    }
+
+    bool StorageDriveLinuxUring::Ring::Initialize(u32 entries)
+    {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        m_ringFileDescriptor = Setup(entries, params);
+        if (m_ringFileDescriptor < 0)
+        {
+            AZ_Error("StorageDriveLinuxUring", false, "io_uring_setup failed with error: %s\n", strerror(errno));
+            return false;
+        }
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFileDescriptor, IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            AZ_Error("StorageDriveLinuxUring", false, "Failed to map the io_uring submission queue: %s\n", strerror(errno));
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ringFileDescriptor, IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                AZ_Error("StorageDriveLinuxUring", false, "Failed to map the io_uring completion queue: %s\n", strerror(errno));
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries = mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFileDescriptor, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            AZ_Error("StorageDriveLinuxUring", false, "Failed to map the io_uring submission entries: %s\n", strerror(errno));
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        u8* submissionRing = reinterpret_cast<u8*>(m_submissionRing);
+        m_submissionHead = reinterpret_cast<u32*>(submissionRing + params.sq_off.head);
+        m_submissionTail = reinterpret_cast<u32*>(submissionRing + params.sq_off.tail);
+        m_submissionMask = *reinterpret_cast<u32*>(submissionRing + params.sq_off.ring_mask);
+        m_submissionEntryCount = params.sq_entries;
+        m_localSubmissionTail = *m_submissionTail;
+
+        // Submission entries are always used in order, so the indirection array can be filled once.
+        u32* submissionArray = reinterpret_cast<u32*>(submissionRing + params.sq_off.array);
+        for (u32 i = 0; i < params.sq_entries; ++i)
+        {
+            submissionArray[i] = i;
+        }
+
+        u8* completionRing = reinterpret_cast<u8*>(m_completionRing);
+        m_completionHead = reinterpret_cast<u32*>(completionRing + params.cq_off.head);
+        m_completionTail = reinterpret_cast<u32*>(completionRing + params.cq_off.tail);
+        m_completionMask = *reinterpret_cast<u32*>(completionRing + params.cq_off.ring_mask);
+        m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionRing + params.cq_off.cqes);
+
+        return true;
+    }
+
+    bool StorageDriveLinuxUring::Ring::RegisterEventFileDescriptor(int eventFileDescriptor)
+    {
+        return syscall(__NR_io_uring_register, m_ringFileDescriptor, IORING_REGISTER_EVENTFD, &eventFileDescriptor, 1) == 0;
+    }
+
+    io_uring_sqe* StorageDriveLinuxUring::Ring::GetSubmissionEntry()
+    {
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        if (m_localSubmissionTail - head >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        io_uring_sqe* entry = &m_submissionEntries[m_localSubmissionTail & m_submissionMask];
+        memset(entry, 0, sizeof(io_uring_sqe));
+        m_localSubmissionTail++;
+        m_numToSubmit++;
+        return entry;
+    }
+
+    void StorageDriveLinuxUring::Ring::Submit()
+    {
+        if (m_numToSubmit == 0)
+        {
+            return;
+        }
+
+        // Publish the new entries to the kernel before entering.
+        __atomic_store_n(m_submissionTail, m_localSubmissionTail, __ATOMIC_RELEASE);
+
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinuxUring::Submit io_uring_enter");
+        long result = syscall(__NR_io_uring_enter, m_ringFileDescriptor, m_numToSubmit, 0, 0, nullptr, 0);
+        if (result >= 0)
+        {
+            m_numToSubmit -= aznumeric_cast<u32>(result);
+        }
+        else if (errno != EAGAIN && errno != EBUSY && errno != EINTR)
+        {
+            AZ_Error("StorageDriveLinuxUring", false, "io_uring_enter failed with error: %s\n", strerror(errno));
+        }
+        // In case of EAGAIN, EBUSY or EINTR the remaining entries will be submitted during the next call.
+    }
+
+    bool StorageDriveLinuxUring::Ring::WaitForCompletions(u32 minComplete)
+    {
+        long result = syscall(__NR_io_uring_enter, m_ringFileDescriptor, 0, minComplete, IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (result < 0 && errno != EINTR)
+        {
+            AZ_Error("StorageDriveLinuxUring", false, "Waiting for io_uring completions failed with error: %s\n", strerror(errno));
+            return false;
+        }
+        return true;
+    }
+
+    template<typename Callback>
+    size_t StorageDriveLinuxUring::Ring::ReapCompletions(Callback&& callback)
+    {
+        u32 head = *m_completionHead;
+        const u32 tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+        size_t count = 0;
+        while (head != tail)
+        {
+            const io_uring_cqe& entry = m_completionEntries[head & m_completionMask];
+            callback(entry.user_data, entry.res);
+            ++head;
+            ++count;
+        }
+        // Release the entries back to the kernel.
+        __atomic_store_n(m_completionHead, head, __ATOMIC_RELEASE);
+        return count;
+    }
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinuxUring::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableDirectReads(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // ReadSlot
+    //
+
+    void StorageDriveLinuxUring::ReadSlot::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    u64 StorageDriveLinuxUring::ReadSlot::GetRemainingBytes() const
+    {
+        u64 remaining = 0;
+        for (size_t i = m_firstIoVector; i < m_ioVectors.size(); ++i)
+        {
+            remaining += m_ioVectors[i].iov_len;
+        }
+        return remaining;
+    }
+
+    void StorageDriveLinuxUring::ReadSlot::AdvanceIoVectors(u64 bytesRead)
+    {
+        while (bytesRead > 0 && m_firstIoVector < m_ioVectors.size())
+        {
+            iovec& ioVector = m_ioVectors[m_firstIoVector];
+            if (bytesRead < ioVector.iov_len)
+            {
+                ioVector.iov_base = reinterpret_cast<u8*>(ioVector.iov_base) + bytesRead;
+                ioVector.iov_len -= bytesRead;
+                return;
+            }
+            bytesRead -= ioVector.iov_len;
+            ++m_firstIoVector;
+        }
+    }
+
+    void StorageDriveLinuxUring::ReadSlot::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        // Keep the memory of the io vectors around so it can be reused by the next read.
+        AZStd::vector<iovec> ioVectors = AZStd::move(m_ioVectors);
+        ioVectors.clear();
+        *this = ReadSlot{};
+        m_ioVectors = AZStd::move(ioVectors);
+    }
+
+    //
+    // StorageDriveLinuxUring
+    //
+
+    bool StorageDriveLinuxUring::IsAvailable()
+    {
+        static const bool isAvailable = []()
+        {
+            io_uring_params params;
+            memset(&params, 0, sizeof(params));
+            int ringFileDescriptor = Ring::Setup(1, params);
+            if (ringFileDescriptor < 0)
+            {
+                // ENOSYS if the kernel doesn't support io_uring, EPERM if it has been disabled or blocked by a seccomp filter.
+                return false;
+            }
+            close(ringFileDescriptor);
+            // IORING_OP_READV and IORING_REGISTER_EVENTFD are available since the first version. IORING_OP_ASYNC_CANCEL
+            // is used for cancellations and was introduced together with IORING_FEAT_NODROP.
+            return (params.features & IORING_FEAT_NODROP) != 0;
+        }();
+        return isAvailable;
+    }
+
+    StorageDriveLinuxUring::StorageDriveLinuxUring(u32 maxFileHandles, u32 queueDepth, size_t physicalSectorSize,
+        size_t logicalSectorSize, s32 overCommit, ConstructionOptions options)
+        : StreamStackEntry("Storage drive (io_uring)")
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_queueDepth(queueDepth)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinuxUring", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinuxUring", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinuxUring", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinuxUring requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 1;
+            AZ_Warning("StorageDriveLinuxUring", false, "Received queue depth of 0 for %s. Picking a depth of 1 instead.\n", m_name.c_str());
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinuxUring", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        if (maxFileHandles == 0)
+        {
+            maxFileHandles = 1;
+        }
+        m_fileCache_lastTimeUsed.resize(maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+        m_fileCache_paths.resize(maxFileHandles);
+        m_fileCache_fileDescriptors.resize(maxFileHandles, -1);
+        m_fileCache_activeReads.resize(maxFileHandles, 0);
+        m_fileCache_isDirect.resize(maxFileHandles, false);
+        m_readSlots.resize(m_queueDepth);
+
+        // Every active read can have a cancellation in flight as well, so reserve twice the queue depth. This guarantees
+        // that there's always room in the submission queue and the completion queue can't overflow.
+        m_ring = AZStd::make_unique<Ring>();
+        m_eventFileDescriptor = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (!m_ring->Initialize(m_queueDepth * 2) || m_eventFileDescriptor < 0 ||
+            !m_ring->RegisterEventFileDescriptor(m_eventFileDescriptor))
+        {
+            AZ_Error("StorageDriveLinuxUring", false, "Failed to initialize io_uring for %s. All requests will be forwarded.\n",
+                m_name.c_str());
+            m_ring.reset();
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+    }
+
+    StorageDriveLinuxUring::~StorageDriveLinuxUring()
+    {
+        AZ_Error("StorageDriveLinuxUring", m_activeReads_Count == 0, "%s destroyed while there are still %u reads in flight.\n",
+            m_name.c_str(), m_activeReads_Count);
+
+        if (m_ring && m_activeReads_Count > 0)
+        {
+            // The kernel tears the ring down asynchronously, so reads that are still in flight could write into the output
+            // and internal buffers after they've been released. Cancel the reads and wait for them to finish before closing
+            // the ring. The streamer context is destroyed before the stack, so the requests themselves can't be completed
+            // anymore, which is also true for any requests that are still pending.
+            for (size_t readSlot = 0; readSlot < m_readSlots.size(); ++readSlot)
+            {
+                if (m_readSlots[readSlot].m_isActive)
+                {
+                    io_uring_sqe* entry = m_ring->GetSubmissionEntry();
+                    if (entry)
+                    {
+                        entry->opcode = IORING_OP_ASYNC_CANCEL;
+                        entry->fd = -1;
+                        entry->addr = readSlot;
+                        entry->user_data = IgnoredUserData;
+                    }
+                }
+            }
+            m_ring->Submit();
+
+            while (m_activeReads_Count > 0 && m_ring->WaitForCompletions(1))
+            {
+                m_ring->ReapCompletions([this](u64 userData, [[maybe_unused]] s32 result)
+                    {
+                        if (userData != IgnoredUserData && m_readSlots[userData].m_isActive)
+                        {
+                            m_readSlots[userData].m_isActive = false;
+                            m_activeReads_Count--;
+                        }
+                    });
+            }
+        }
+        m_ring.reset();
+        for (ReadSlot& slot : m_readSlots)
+        {
+            slot.Clear();
+        }
+        for (int file : m_fileCache_fileDescriptors)
+        {
+            if (file >= 0)
+            {
+                close(file);
+            }
+        }
+        // The streamer context is destroyed before the stack, so the event file descriptor is closed without unregistering it.
+        if (m_eventFileDescriptor >= 0)
+        {
+            close(m_eventFileDescriptor);
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    void StorageDriveLinuxUring::SetContext(StreamerContext& context)
+    {
+        StreamStackEntry::SetContext(context);
+        if (m_ring && !m_hasRegisteredEvent)
+        {
+            // Completions signal the event, which wakes up the streamer thread if it's waiting for work.
+            m_hasRegisteredEvent = m_context->GetStreamerThreadSynchronizer().RegisterEventFileDescriptor(m_eventFileDescriptor);
+            if (!m_hasRegisteredEvent)
+            {
+                AZ_Error("StorageDriveLinuxUring", false, "Unable to register completion event for %s. All requests will be forwarded.\n",
+                    m_name.c_str());
+                m_ring.reset();
+            }
+        }
+    }
+
+    void StorageDriveLinuxUring::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (m_ring)
+        {
+            if (AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+            {
+                auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                    readRequest.m_offset, readRequest.m_size);
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+            else if (AZStd::holds_alternative<FileRequest::ReadRangesRequestData>(request->GetCommand()))
+            {
+                auto& rangesRequest = AZStd::get<FileRequest::ReadRangesRequestData>(request->GetCommand());
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateReadRanges(request, rangesRequest.m_path, rangesRequest.m_ranges.data(), rangesRequest.m_ranges.size());
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinuxUring::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        if (!m_ring)
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
+            {
+                QueueReadRanges(request, args);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+            {
+                Report(args);
+            }
+            // File exists checks and meta data retrieval are synchronous calls, so they're left to the next entry.
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinuxUring::ExecuteRequests()
+    {
+        if (!m_ring)
+        {
+            return StreamStackEntry::ExecuteRequests();
+        }
+
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        // Fill up the queue with as many reads as there are slots available, then submit them all with a single system call.
+        while (!m_pendingReadRequests.empty() && m_activeReads_Count < m_queueDepth)
+        {
+            size_t readSlot = FindAvailableReadSlot();
+            AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read count indicates there's a read slot available, but no read slot was found.");
+            FileRequest* request = m_pendingReadRequests.front();
+            if (!ReadRequest(request, readSlot))
+            {
+                break;
+            }
+            m_pendingReadRequests.pop_front();
+            hasWorked = true;
+        }
+        m_ring->Submit();
+        if (hasWorked)
+        {
+            m_queueDepthAverage.PushEntry(m_activeReads_Count);
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinuxUring::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        if (m_ring)
+        {
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+            status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && (m_activeReads_Count == 0);
+        }
+    }
+
+    void StorageDriveLinuxUring::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+        if (!m_ring)
+        {
+            return;
+        }
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // The read time average is measured over periods where reads are in flight, so it already includes the benefit of
+        // having multiple reads in flight. Active reads finish based on when they started and pending reads can start
+        // as soon as the first slot frees up.
+        u64 totalBytesRead = m_readSizeAverage.GetTotal();
+        double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+        AZStd::chrono::system_clock::time_point earliestSlot = AZStd::chrono::system_clock::time_point::max();
+        for (ReadSlot& slot : m_readSlots)
+        {
+            if (slot.m_isActive)
+            {
+                auto endTime = slot.m_startTime +
+                    AZStd::chrono::microseconds(aznumeric_cast<u64>((slot.m_requiredBytes * totalReadTimeUSec) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                slot.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::system_clock::time_point::max())
+        {
+            now = AZStd::max(now, earliestSlot);
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinuxUring::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.GetTotalSize();
+                offset = args.GetStartOffset();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    AZStd::chrono::microseconds fileOpenCloseTimeAverage = m_fileOpenCloseTimeAverage.CalculateAverage();
+                    startTime += fileOpenCloseTimeAverage;
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / totalBytesRead));
+            activeOffset = offset + readSize;
+            activeFile = targetFile;
+            request->SetEstimatedCompletion(startTime);
+        }
+    }
+
+    void StorageDriveLinuxUring::QueueReadRanges(FileRequest* request, const FileRequest::ReadRangesData& data)
+    {
+        if (data.m_numRanges == 0)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        // The ranges have been sorted by offset by the scheduler. Ranges that are adjacent or only separated by a small gap
+        // are combined into a single vectored read, the same way the generic storage drive does. Overlapping ranges or
+        // large gaps start a new read, and the separate reads can be in flight at the same time.
+        size_t rangeIndex = 0;
+        while (rangeIndex < data.m_numRanges)
+        {
+            const size_t firstRange = rangeIndex;
+            u64 readEnd = data.m_baseOffset + data.m_ranges[rangeIndex].m_offset + data.m_ranges[rangeIndex].m_size;
+            for (++rangeIndex; rangeIndex < data.m_numRanges && rangeIndex - firstRange < s_maxRangesPerRead; ++rangeIndex)
+            {
+                const IStreamerTypes::ReadRange& range = data.m_ranges[rangeIndex];
+                const u64 rangeStart = data.m_baseOffset + range.m_offset;
+                if (rangeStart < readEnd || rangeStart - readEnd > s_maxCoalescedGap)
+                {
+                    break;
+                }
+                readEnd = rangeStart + range.m_size;
+            }
+
+            const size_t numRangesInRead = rangeIndex - firstRange;
+            FileRequest* read = m_context->GetNewInternalRequest();
+            if (numRangesInRead == 1)
+            {
+                // A single range can be read directly into its output.
+                const IStreamerTypes::ReadRange& range = data.m_ranges[firstRange];
+                read->CreateRead(request, range.m_output, range.m_size, data.m_path, data.m_baseOffset + range.m_offset, range.m_size,
+                    data.m_sharedRead);
+            }
+            else
+            {
+                read->CreateReadRanges(request, data.m_path, data.m_ranges + firstRange, numRangesInRead, data.m_baseOffset,
+                    data.m_sharedRead);
+            }
+            m_pendingReadRequests.push_back(read);
+            m_rangesPerReadAverage.PushEntry(numRangesInRead);
+        }
+    }
+
+    s32 StorageDriveLinuxUring::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) - m_activeReads_Count;
+    }
+
+    auto StorageDriveLinuxUring::OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const RequestPath& path)
+        -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file descriptor and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_fileDescriptors[cacheIndex];
+            AZ_Assert(file >= 0, "Found the file '%s' in cache, but file descriptor is invalid.\n", path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            bool isDirect = false;
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinuxUring::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                if (m_constructionOptions.m_enableDirectReads)
+                {
+                    file = open(path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+                    isDirect = file >= 0;
+                }
+                if (file < 0)
+                {
+                    // Direct reads are optional, for instance tmpfs doesn't support them, so fall back to buffered reads.
+                    file = open(path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC);
+                }
+
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                if (m_fileCache_fileDescriptors[cacheIndex] >= 0)
+                {
+                    close(m_fileCache_fileDescriptors[cacheIndex]);
+                }
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_fileDescriptors[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_isDirect[cacheIndex] = isDirect;
+            m_fileCache_paths[cacheIndex] = path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        fileDescriptor = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinuxUring::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinuxUring::ReadRequest %s", m_name.c_str());
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        auto rangesData = AZStd::get_if<FileRequest::ReadRangesData>(&request->GetCommand());
+        AZ_Assert(data || rangesData, "Read request in StorageDriveLinuxUring doesn't contain read data or read ranges data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, data ? data->m_path : rangesData->m_path))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        ReadSlot& slot = m_readSlots[readSlot];
+        slot.m_request = request;
+        slot.m_fileCacheIndex = fileCacheSlot;
+        if (data)
+        {
+            PrepareRead(slot, *data, m_fileCache_isDirect[fileCacheSlot]);
+        }
+        else
+        {
+            PrepareReadRanges(slot, *rangesData, m_fileCache_isDirect[fileCacheSlot]);
+        }
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        slot.m_startTime = now;
+        slot.m_isActive = true;
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = slot.m_readOffset + slot.GetRemainingBytes();
+
+        SubmitRead(readSlot);
+        return true;
+    }
+
+    void StorageDriveLinuxUring::PrepareRead(ReadSlot& slot, const FileRequest::ReadData& data, bool isDirect)
+    {
+        u64 readSize = data.m_size;
+        u64 readOffs = data.m_offset;
+        void* output = data.m_output;
+
+        if (isDirect)
+        {
+            // O_DIRECT requires the address, offset and size to be aligned. If any of them isn't, read the surrounding
+            // sectors into an aligned buffer and copy the requested part back after the read completes. See the
+            // Windows storage drive for a detailed explanation of the adjustments.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data.m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data.m_offset, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data.m_offset - readOffs;
+                slot.m_copyBackOffset = offsetCorrection;
+                readSize = data.m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data.m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                slot.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                output = slot.m_sectorAlignedOutput;
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        slot.m_ioVectors.push_back(iovec{ output, readSize });
+        slot.m_readOffset = readOffs;
+        slot.m_requiredBytes = slot.m_copyBackOffset + data.m_size;
+    }
+
+    void StorageDriveLinuxUring::PrepareReadRanges(ReadSlot& slot, const FileRequest::ReadRangesData& data, bool isDirect)
+    {
+        const u64 readStart = data.GetStartOffset();
+        const u64 readEnd = data.GetEndOffset();
+
+        if (isDirect)
+        {
+            // O_DIRECT requires every buffer in the vector to be aligned, which the outputs of individual ranges rarely are,
+            // so read the aligned span into an internal buffer and scatter it to the outputs after the read completes.
+            const u64 alignedStart = AZ_SIZE_ALIGN_DOWN(readStart, m_logicalSectorSize);
+            const u64 alignedSize = AZ_SIZE_ALIGN_UP(readEnd - alignedStart, m_logicalSectorSize);
+            slot.AllocateAlignedBuffer(alignedSize, m_physicalSectorSize);
+            slot.m_ioVectors.push_back(iovec{ slot.m_sectorAlignedOutput, alignedSize });
+            slot.m_readOffset = alignedStart;
+            slot.m_copyBackOffset = readStart - alignedStart;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+        else
+        {
+            // Scatter the read directly into the outputs. The data in the gaps is read into a scratch buffer and discarded,
+            // which is cheaper than issuing another read.
+            u64 rangeEnd = readStart;
+            for (size_t i = 0; i < data.m_numRanges; ++i)
+            {
+                const IStreamerTypes::ReadRange& range = data.m_ranges[i];
+                const u64 rangeStart = data.m_baseOffset + range.m_offset;
+                if (rangeStart > rangeEnd)
+                {
+                    if (m_gapBuffer.empty())
+                    {
+                        m_gapBuffer.resize_no_construct(s_maxCoalescedGap);
+                    }
+                    slot.m_ioVectors.push_back(iovec{ m_gapBuffer.data(), rangeStart - rangeEnd });
+                }
+                slot.m_ioVectors.push_back(iovec{ range.m_output, range.m_size });
+                rangeEnd = rangeStart + range.m_size;
+            }
+            slot.m_readOffset = readStart;
+        }
+        slot.m_requiredBytes = slot.m_copyBackOffset + (readEnd - readStart);
+    }
+
+    void StorageDriveLinuxUring::SubmitRead(size_t readSlot)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+
+        // The submission queue holds twice the queue depth, so there's always room for the reads in flight.
+        io_uring_sqe* entry = m_ring->GetSubmissionEntry();
+        AZ_Assert(entry, "No room in the io_uring submission queue even though a read slot was available.");
+        entry->opcode = IORING_OP_READV;
+        entry->fd = m_fileCache_fileDescriptors[slot.m_fileCacheIndex];
+        entry->addr = reinterpret_cast<u64>(&slot.m_ioVectors[slot.m_firstIoVector]);
+        entry->len = aznumeric_cast<u32>(slot.m_ioVectors.size() - slot.m_firstIoVector);
+        entry->off = slot.m_readOffset;
+        entry->user_data = readSlot;
+    }
+
+    bool StorageDriveLinuxUring::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now ask the kernel to cancel any reads in flight. If the read already
+        // completed the cancellation fails and the read will finish normally.
+        for (size_t readSlot = 0; readSlot < m_readSlots.size(); ++readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            if (slot.m_isActive && slot.m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                io_uring_sqe* entry = m_ring->GetSubmissionEntry();
+                if (!entry)
+                {
+                    AZ_Error("StorageDriveLinuxUring", false, "No room in the io_uring submission queue to cancel a read.\n");
+                    continue;
+                }
+                entry->opcode = IORING_OP_ASYNC_CANCEL;
+                entry->fd = -1;
+                entry->addr = readSlot;
+                entry->user_data = IgnoredUserData;
+            }
+        }
+        m_ring->Submit();
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinuxUring::FlushCache(const RequestPath& filePath)
+    {
+        size_t cacheIndex = FindInFileHandleCache(filePath);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            if (m_fileCache_fileDescriptors[cacheIndex] >= 0)
+            {
+                AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                    filePath.GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                close(m_fileCache_fileDescriptors[cacheIndex]);
+                m_fileCache_fileDescriptors[cacheIndex] = -1;
+            }
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_isDirect[cacheIndex] = false;
+            m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+            m_fileCache_paths[cacheIndex].Clear();
+            if (m_activeCacheSlot == cacheIndex)
+            {
+                m_activeCacheSlot = InvalidFileCacheIndex;
+            }
+        }
+    }
+
+    void StorageDriveLinuxUring::FlushEntireCache()
+    {
+        for (size_t cacheIndex = 0; cacheIndex < m_fileCache_fileDescriptors.size(); ++cacheIndex)
+        {
+            if (m_fileCache_fileDescriptors[cacheIndex] >= 0)
+            {
+                AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                    m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                close(m_fileCache_fileDescriptors[cacheIndex]);
+                m_fileCache_fileDescriptors[cacheIndex] = -1;
+            }
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_isDirect[cacheIndex] = false;
+            m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+            m_fileCache_paths[cacheIndex].Clear();
+        }
+        m_activeCacheSlot = InvalidFileCacheIndex;
+    }
+
+    bool StorageDriveLinuxUring::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        size_t numCompletions = m_ring->ReapCompletions([this](u64 userData, s32 result)
+            {
+                if (userData != IgnoredUserData)
+                {
+                    ProcessCompletion(aznumeric_cast<size_t>(userData), result);
+                }
+            });
+        return numCompletions > 0;
+    }
+
+    void StorageDriveLinuxUring::ProcessCompletion(size_t readSlot, s32 result)
+    {
+        AZ_Assert(readSlot < m_readSlots.size() && m_readSlots[readSlot].m_isActive,
+            "io_uring returned a completion for read slot %zu which isn't active.", readSlot);
+        ReadSlot& slot = m_readSlots[readSlot];
+
+        if (result == -ECANCELED)
+        {
+            constexpr bool encounteredError = false;
+            FinalizeSingleRequest(readSlot, true, encounteredError);
+        }
+        else if (result == -EAGAIN || result == -EINTR)
+        {
+            SubmitRead(readSlot);
+        }
+        else if (result < 0)
+        {
+            AZ_Warning("StorageDriveLinuxUring", false, "Async file read operation failed with error: %s\n", strerror(-result));
+            constexpr bool encounteredError = true;
+            FinalizeSingleRequest(readSlot, false, encounteredError);
+        }
+        else
+        {
+            u64 bytesRead = aznumeric_cast<u64>(result);
+            slot.m_bytesRead += bytesRead;
+            if (bytesRead > 0 && bytesRead < slot.GetRemainingBytes() && slot.m_bytesRead < slot.m_requiredBytes)
+            {
+                // Short read, continue with the remainder. A read of 0 bytes means the end of the file was reached.
+                slot.AdvanceIoVectors(bytesRead);
+                slot.m_readOffset += bytesRead;
+                SubmitRead(readSlot);
+            }
+            else
+            {
+                constexpr bool encounteredError = false;
+                FinalizeSingleRequest(readSlot, false, encounteredError);
+            }
+        }
+    }
+
+    void StorageDriveLinuxUring::FinalizeSingleRequest(size_t readSlot, bool isCanceled, bool encounteredError)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+
+        m_activeReads_ByteCount += slot.m_bytesRead;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        bool isSuccess = !isCanceled && !encounteredError && (slot.m_requiredBytes <= slot.m_bytesRead);
+        if (slot.m_sectorAlignedOutput && isSuccess)
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(slot.m_sectorAlignedOutput) + slot.m_copyBackOffset;
+            if (auto readCommand = AZStd::get_if<FileRequest::ReadData>(&slot.m_request->GetCommand()); readCommand)
+            {
+                ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+            }
+            else
+            {
+                auto rangesCommand = AZStd::get_if<FileRequest::ReadRangesData>(&slot.m_request->GetCommand());
+                AZ_Assert(rangesCommand != nullptr, "Request stored with the read slot did not contain a read or read ranges request.");
+                const u64 readStart = rangesCommand->GetStartOffset();
+                for (size_t i = 0; i < rangesCommand->m_numRanges; ++i)
+                {
+                    const IStreamerTypes::ReadRange& range = rangesCommand->m_ranges[i];
+                    ::memcpy(range.m_output, offsetAddress + (rangesCommand->m_baseOffset + range.m_offset - readStart), range.m_size);
+                }
+            }
+        }
+
+        slot.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(slot.m_request);
+
+        m_fileCache_activeReads[slot.m_fileCacheIndex]--;
+        slot.Clear();
+    }
+
+    size_t StorageDriveLinuxUring::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinuxUring::FindAvailableFileHandleCacheIndex() const
+    {
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_fileCache_lastTimeUsed.size(); ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinuxUring::FindAvailableReadSlot() const
+    {
+        for (size_t i = 0; i < m_readSlots.size(); ++i)
+        {
+            if (!m_readSlots[i].m_isActive)
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    void StorageDriveLinuxUring::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_ring)
+        {
+            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateFloat(m_name, "In-flight reads (avg.)", m_queueDepthAverage.CalculateAverage()));
+            if (m_rangesPerReadAverage.GetNumRecorded() > 0)
+            {
+                statistics.push_back(Statistic::CreateFloat(m_name, "Ranges per read (avg.)", m_rangesPerReadAverage.CalculateAverage()));
+            }
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentage(m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage()));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinuxUring::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            for (size_t i = 0; i < m_fileCache_fileDescriptors.size(); ++i)
+            {
+                if (m_fileCache_fileDescriptors[i] >= 0)
+                {
+                    AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
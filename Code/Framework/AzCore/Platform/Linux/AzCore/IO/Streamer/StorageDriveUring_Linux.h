@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <sys/uio.h>
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO
+{
+    //! Storage drive for Linux that uses io_uring to keep multiple reads in flight at the same time. Reads are submitted
+    //! to the kernel without blocking the streamer thread, which allows NVMe drives in particular to reach their full
+    //! bandwidth. Requests that can't be handled, for instance because the file couldn't be opened, are forwarded to the
+    //! next entry in the stack, so this entry is expected to be placed on top of the generic StorageDrive.
+    class StorageDriveLinuxUring
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Open files with O_DIRECT to bypass the page cache. This results in faster reads the first time a file is
+            //! read, but subsequent reads can't be serviced from the page cache. Direct reads require the output buffer,
+            //! file offset and read size to be aligned to the sector size. Unaligned reads are read into an internal
+            //! aligned buffer and copied to the output. File systems that don't support O_DIRECT use buffered reads.
+            u8 m_enableDirectReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Returns true if the running kernel supports io_uring and the process is allowed to use it.
+        static bool IsAvailable();
+
+        //! Creates an instance of a storage device that uses io_uring.
+        //! @param maxFileHandles The maximum number of file handles that are cached.
+        //! @param queueDepth The maximum number of reads that are in flight at the same time.
+        //! @param physicalSectorSize The sector size of the device. When direct reads are used the output buffer needs to
+        //!     be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size of the device. When direct reads are used the read offset and
+        //!     size need to be aligned to this value.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinuxUring(u32 maxFileHandles, u32 queueDepth, size_t physicalSectorSize, size_t logicalSectorSize,
+            s32 overCommit, ConstructionOptions options);
+        ~StorageDriveLinuxUring() override;
+
+        void SetContext(StreamerContext& context) override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        class Ring;
+
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        //! User data for submissions that don't belong to a read slot, such as cancellations.
+        inline static constexpr u64 IgnoredUserData = std::numeric_limits<u64>::max();
+        //! The largest gap between two ranges of a ranges request that will be read and discarded to
+        //! combine the ranges into a single read.
+        inline static constexpr u64 s_maxCoalescedGap = 16 * 1024;
+        //! The maximum number of ranges combined into a single read. Together with the gaps this stays well below IOV_MAX.
+        inline static constexpr size_t s_maxRangesPerRead = 256;
+
+        struct ReadSlot
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr }; // Internally allocated buffer that is sector aligned.
+            AZStd::vector<iovec> m_ioVectors; // The buffers the read is scattered to.
+            size_t m_firstIoVector{ 0 }; // The first buffer of the part of the read that hasn't been completed yet.
+            u64 m_readOffset{ 0 }; // The file offset of the part of the read that hasn't been completed yet.
+            u64 m_bytesRead{ 0 };
+            u64 m_requiredBytes{ 0 }; // The number of bytes that need to be read, including the alignment correction at the start.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileCacheIndex{ InvalidFileCacheIndex };
+            bool m_isActive{ false };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            //! Returns the number of bytes in the buffers that haven't been filled yet.
+            u64 GetRemainingBytes() const;
+            //! Moves the start of the remaining buffers forward after a short read.
+            void AdvanceIoVectors(u64 bytesRead);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        OpenFileResult OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const RequestPath& path);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        void PrepareRead(ReadSlot& slot, const FileRequest::ReadData& data, bool isDirect);
+        void PrepareReadRanges(ReadSlot& slot, const FileRequest::ReadRangesData& data, bool isDirect);
+        void SubmitRead(size_t readSlot);
+        void ProcessCompletion(size_t readSlot, s32 result);
+        void QueueReadRanges(FileRequest* request, const FileRequest::ReadRangesData& data);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot() const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, bool isCanceled, bool encounteredError);
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_queueDepthAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_rangesPerReadAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        AZStd::unique_ptr<Ring> m_ring;
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::vector<ReadSlot> m_readSlots;
+        //! Scratch buffer that receives the data in the gaps between coalesced ranges. The data is discarded, so reads in
+        //! flight at the same time can share it.
+        AZStd::vector<u8> m_gapBuffer;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_fileDescriptors;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isDirect;
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        u64 m_activeOffset{ 0 };
+        int m_eventFileDescriptor{ -1 };
+        u32 m_queueDepth{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_hasRegisteredEvent{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/utils.h>
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_events[0] = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        AZ_Assert(m_events[0] >= 0, "Failed to create a required event for IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_events[0] >= 0)
+        {
+            ::close(m_events[0]);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_events[0] >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        pollfd fileDescriptors[MaxIoEvents + 1];
+        for (size_t i = 0; i < m_eventCount; ++i)
+        {
+            fileDescriptors[i].fd = m_events[i];
+            fileDescriptors[i].events = POLLIN;
+            fileDescriptors[i].revents = 0;
+        }
+
+        int result = ::poll(fileDescriptors, m_eventCount, -1);
+        if (result > 0)
+        {
+            for (size_t i = 0; i < m_eventCount; ++i)
+            {
+                if (fileDescriptors[i].revents & POLLIN)
+                {
+                    // Reset the event so the next suspend will wait again.
+                    eventfd_t value;
+                    ::eventfd_read(fileDescriptors[i].fd, &value);
+                }
+            }
+        }
+        else
+        {
+            AZ_Assert(result == 0 || errno == EINTR, "Unexpected wait result: %i (Error: %i).", result, errno);
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_events[0] >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_events[0], 1);
+    }
+
+    bool StreamerContextThreadSync::RegisterEventFileDescriptor(int fileDescriptor)
+    {
+        if (m_eventCount <= MaxIoEvents)
+        {
+            m_events[m_eventCount++] = fileDescriptor;
+            return true;
+        }
+        AZ_Assert(false, "There are no more slots available to register a new IO event in.");
+        return false;
+    }
+
+    void StreamerContextThreadSync::UnregisterEventFileDescriptor(int fileDescriptor)
+    {
+        for (size_t i = 1; i < m_eventCount; ++i)
+        {
+            if (m_events[i] == fileDescriptor)
+            {
+                m_eventCount--;
+                AZStd::swap(m_events[i], m_events[m_eventCount]);
+                return;
+            }
+        }
+        AZ_Assert(false, "IO event couldn't be unregistered as it wasn't found.");
+    }
+} // namespace AZ::Platform
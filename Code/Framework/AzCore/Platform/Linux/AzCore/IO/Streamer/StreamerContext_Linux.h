@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Puts the streamer thread to sleep until it's woken up by another thread or until one of the registered
+    //! file descriptors becomes readable. Stream stack entries that complete their work asynchronously, such as the
+    //! io_uring storage drive, register an eventfd here so the streamer thread wakes up when their I/O completes.
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 15;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Adds a file descriptor to wait on while suspended. The descriptor needs to be an eventfd as the counter
+        //! will be reset when the descriptor wakes up the streamer thread.
+        bool RegisterEventFileDescriptor(int fileDescriptor);
+        void UnregisterEventFileDescriptor(int fileDescriptor);
+
+    private:
+        // Note: The first file descriptor is reserved for the synchronization of the scheduler thread with the
+        // rest of the engine. The remaining file descriptors are registered by Streamer's internals.
+        int m_events[MaxIoEvents + 1];
+        size_t m_eventCount{ 1 }; // The first event is for external wake up calls.
+    };
+} // namespace AZ::Platform
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/ProcessorTopology.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/utils.h>
+
+#include <sched.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        namespace Platform
+        {
+            // Reads a single integer from a sysfs file, returns false if the file doesn't exist or can't be parsed.
+            static bool ReadSysfsValue(const char* path, int& value)
+            {
+                AZ::IO::SystemFile sysfsFile;
+                if (!sysfsFile.Open(path, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    return false;
+                }
+
+                char buffer[32];
+                const AZ::IO::SystemFile::SizeType numRead = sysfsFile.Read(sizeof(buffer) - 1, buffer);
+                if (numRead == 0)
+                {
+                    return false;
+                }
+                buffer[numRead] = 0;
+
+                char* end = nullptr;
+                value = static_cast<int>(strtol(buffer, &end, 10));
+                return end != buffer;
+            }
+        } // namespace Platform
+
+        AZStd::vector<AZ::u32> GetProcessorTopologyDomains()
+        {
+            const long processorCount = sysconf(_SC_NPROCESSORS_CONF);
+            if (processorCount <= 0)
+            {
+                return {};
+            }
+
+            // Map every (socket, last level cache) pair to a compact domain id.
+            AZStd::map<AZStd::pair<int, int>, AZ::u32> domainIds;
+            AZStd::vector<AZ::u32> domains;
+            domains.reserve(processorCount);
+            for (long processor = 0; processor < processorCount; ++processor)
+            {
+                using PathString = AZStd::fixed_string<128>;
+                PathString path = PathString::format("/sys/devices/system/cpu/cpu%ld/topology/physical_package_id", processor);
+                int packageId = 0;
+                if (!Platform::ReadSysfsValue(path.c_str(), packageId))
+                {
+                    // Offline processors don't report a topology, they can't run our threads so the domain doesn't matter.
+                    packageId = -1;
+                }
+
+                // index3 is the L3 cache on most systems, processors that don't report one are grouped by socket only.
+                path = PathString::format("/sys/devices/system/cpu/cpu%ld/cache/index3/id", processor);
+                int cacheId = 0;
+                if (!Platform::ReadSysfsValue(path.c_str(), cacheId))
+                {
+                    cacheId = -1;
+                }
+
+                auto domainIt = domainIds.emplace(AZStd::make_pair(packageId, cacheId), static_cast<AZ::u32>(domainIds.size())).first;
+                domains.push_back(domainIt->second);
+            }
+
+            return domains;
+        }
+
+        int GetCurrentProcessorIndex()
+        {
+            return sched_getcpu();
+        }
+    } // namespace Internal
+} // namespace AZ
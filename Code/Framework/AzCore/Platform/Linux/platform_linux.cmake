@@ -19,3 +19,16 @@ set(LY_BUILD_DEPENDENCIES
         dl
         atomic
 )
+
+# The wide batch math kernels are only called after checking the cpu supports their instruction set at runtime.
+ly_add_source_properties(
+    SOURCES AzCore/Math/SimdMathBatch_Avx2.cpp
+    PROPERTY COMPILE_OPTIONS
+    VALUES -mavx2 -mfma
+)
+
+ly_add_source_properties(
+    SOURCES AzCore/Math/SimdMathBatch_Avx512.cpp
+    PROPERTY COMPILE_OPTIONS
+    VALUES -mavx512f -mavx2 -mfma
+)
@@ -31,9 +31,15 @@ set(FILES
     ../Common/UnixLike/AzCore/Debug/StackTracer_UnixLike.cpp
     ../Common/UnixLike/AzCore/Debug/Trace_UnixLike.cpp
     AzCore/Debug/Trace_Linux.cpp
-    ../Common/Default/AzCore/IO/Streamer/StreamerConfiguration_Default.cpp
-    ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.cpp
-    ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
+    AzCore/IO/Streamer/StorageDriveConfig_Linux.cpp
+    AzCore/IO/Streamer/StorageDriveConfig_Linux.h
+    AzCore/IO/Streamer/StorageDriveUring_Linux.cpp
+    AzCore/IO/Streamer/StorageDriveUring_Linux.h
+    AzCore/IO/Streamer/StreamerConfiguration_Linux.cpp
+    AzCore/IO/Streamer/StreamerContext_Linux.cpp
+    AzCore/IO/Streamer/StreamerContext_Linux.h
+    AzCore/IO/Streamer/StreamerContext_Platform.h
+    ../Common/UnixLike/AzCore/IO/MemoryMappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
@@ -41,6 +47,7 @@ set(FILES
     ../Common/UnixLikeDefault/AzCore/IO/SystemFile_UnixLikeDefault.cpp
     AzCore/IO/SystemFile_Linux.cpp
     AzCore/IO/SystemFile_Platform.h
+    AzCore/Jobs/Internal/ProcessorTopology_Linux.cpp
     AzCore/IPC/SharedMemory_Platform.h
     ../Common/Unimplemented/AzCore/Memory/OverrunDetectionAllocator_Unimplemented.h
     ../Common/UnixLike/AzCore/Memory/OSAllocator_UnixLike.h
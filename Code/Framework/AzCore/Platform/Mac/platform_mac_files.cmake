@@ -35,12 +35,14 @@ set(FILES
     ../Common/Default/AzCore/IO/Streamer/StreamerConfiguration_Default.cpp
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.cpp
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
+    ../Common/UnixLike/AzCore/IO/MemoryMappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
     ../Common/UnixLikeDefault/AzCore/IO/SystemFile_UnixLikeDefault.cpp
     AzCore/IO/Streamer/StreamerContext_Platform.h
     AzCore/IO/SystemFile_Platform.h
+    ../Common/Default/AzCore/Jobs/Internal/ProcessorTopology_Default.cpp
     AzCore/IPC/SharedMemory_Platform.h
     AzCore/IPC/SharedMemory_Mac.h
     AzCore/IPC/SharedMemory_Mac.cpp
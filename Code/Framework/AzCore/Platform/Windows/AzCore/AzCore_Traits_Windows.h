@@ -13,6 +13,7 @@
 #define AZ_TRAIT_USE_PLATFORM_SIMD_SCALAR 0
 #define AZ_TRAIT_USE_PLATFORM_SIMD_NEON 0
 #define AZ_TRAIT_USE_PLATFORM_SIMD_SSE 1
+#define AZ_TRAIT_USE_PLATFORM_SIMD_AVX 1
 
 // OS traits ...
 #define AZ_TRAIT_OS_ALLOW_MULTICAST 1
@@ -88,6 +89,7 @@
 #define AZ_TRAIT_SUPPORTS_MICROSOFT_PPL 1
 #define AZ_TRAIT_SYSTEMFILE_INVALID_HANDLE INVALID_HANDLE_VALUE
 #define AZ_TRAIT_SYSTEMFILE_FSYNC_IS_DEFINED 0
+#define AZ_TRAIT_SYSTEMFILE_PREADV_IS_DEFINED 0
 #define AZ_TRAIT_SYSTEMFILE_UNIX_LIKE_PLATFORM_IS_WRITEABLE_DEFINED_ELSEWHERE 0
 #define AZ_TRAIT_TEST_ROOT_FOLDER ""
 #define AZ_TRAIT_TEST_SUPPORT_DLOPEN 0
@@ -183,6 +183,28 @@ namespace AZ::IO
                 return;
             }
         }
+        else if (AZStd::holds_alternative<FileRequest::ReadRangesRequestData>(request->GetCommand()))
+        {
+            auto& rangesRequest = AZStd::get<FileRequest::ReadRangesRequestData>(request->GetCommand());
+            if (IsServicedByThisDrive(rangesRequest.m_path.GetAbsolutePath()))
+            {
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateReadRanges(request, rangesRequest.m_path, rangesRequest.m_ranges.data(), rangesRequest.m_ranges.size());
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+        }
+        else if (AZStd::holds_alternative<FileRequest::MapFileRequestData>(request->GetCommand()))
+        {
+            auto& mapRequest = AZStd::get<FileRequest::MapFileRequestData>(request->GetCommand());
+            if (IsServicedByThisDrive(mapRequest.m_path.GetAbsolutePath()))
+            {
+                FileRequest* mapFile = m_context->GetNewInternalRequest();
+                mapFile->CreateMapFile(request, mapRequest.m_path, &mapRequest.m_view, mapRequest.m_offset, mapRequest.m_size);
+                m_context->PushPreparedRequest(mapFile);
+                return;
+            }
+        }
         StreamStackEntry::PrepareRequest(request);
     }
 
@@ -202,8 +224,17 @@ namespace AZ::IO
                     return;
                 }
             }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    QueueReadRanges(request, args);
+                    return;
+                }
+            }
             else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
-                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData> ||
+                AZStd::is_same_v<Command, FileRequest::MapFileData>)
             {
                 if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
                 {
@@ -268,6 +299,12 @@ namespace AZ::IO
                     m_pendingRequests.pop_front();
                     return true;
                 }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::MapFileData>)
+                {
+                    MapFileRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
                 else
                 {
                     AZ_Assert(false, "A request was added to StorageDriveWin's pending queue that isn't supported.");
@@ -359,6 +396,12 @@ namespace AZ::IO
                 readSize = args.m_size;
                 offset = args.m_offset;
             }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.GetTotalSize();
+                offset = args.GetStartOffset();
+            }
             else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
             {
                 targetFile = &args.m_compressionInfo.m_archiveFilename;
@@ -404,6 +447,27 @@ namespace AZ::IO
         request->SetEstimatedCompletion(startTime);
     }
 
+    void StorageDriveWin::QueueReadRanges(FileRequest* request, const FileRequest::ReadRangesData& data)
+    {
+        // Reads are issued as overlapped unbuffered reads, which can already run in parallel on the available
+        // I/O channels, so ranges are read individually instead of combined into a single scatter read.
+        if (data.m_numRanges == 0)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        for (size_t i = 0; i < data.m_numRanges; ++i)
+        {
+            const IStreamerTypes::ReadRange& range = data.m_ranges[i];
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, range.m_output, range.m_size, data.m_path, data.m_baseOffset + range.m_offset, range.m_size,
+                data.m_sharedRead);
+            m_pendingReadRequests.push_back(read);
+        }
+    }
+
     void StorageDriveWin::EstimateCompletionTimeForRequestChecked(FileRequest* request,
         AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
     {
@@ -411,6 +475,7 @@ namespace AZ::IO
         {
             using Command = AZStd::decay_t<decltype(args)>;
             if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                          AZStd::is_same_v<Command, FileRequest::ReadRangesData> ||
                           AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
             {
                 if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
@@ -888,8 +953,22 @@ namespace AZ::IO
         m_context->MarkRequestAsCompleted(request);
     }
 
+    void StorageDriveWin::MapFileRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        auto& data = AZStd::get<FileRequest::MapFileData>(request->GetCommand());
+        AZ_Assert(IsServicedByThisDrive(data.m_path.GetAbsolutePath()),
+            "A map file request was queued on a StorageDriveWin that doesn't service the file.");
+        *data.m_output = m_mappedFiles.CreateView(data.m_path.GetAbsolutePath(), data.m_offset, data.m_size);
+        request->SetStatus(data.m_output->IsValid() ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
     void StorageDriveWin::FlushCache(const RequestPath& filePath)
     {
+        m_mappedFiles.Flush(filePath.GetAbsolutePath());
+
         if (m_cachesInitialized)
         {
             size_t cacheIndex = FindInFileHandleCache(filePath);
@@ -918,6 +997,8 @@ namespace AZ::IO
 
     void StorageDriveWin::FlushEntireCache()
     {
+        m_mappedFiles.FlushAll();
+
         if (m_cachesInitialized)
         {
             // Clear file handle cache
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/PlatformIncl.h>
+#include <AzCore/IO/MemoryMappedFile.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
@@ -86,6 +87,8 @@ namespace AZ::IO
         inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
         inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
         inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        //! The maximum number of files that are kept mapped for map file requests.
+        inline static constexpr size_t MaxMappedFiles = 16;
 
         struct FileReadStatus
         {
@@ -114,9 +117,11 @@ namespace AZ::IO
         OpenFileResult OpenFile(HANDLE& fileHandle, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data);
         bool ReadRequest(FileRequest* request);
         bool ReadRequest(FileRequest* request, size_t readSlot);
+        void QueueReadRanges(FileRequest* request, const FileRequest::ReadRangesData& data);
         bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
         void FileExistsRequest(FileRequest* request);
         void FileMetaDataRetrievalRequest(FileRequest* request);
+        void MapFileRequest(FileRequest* request);
         size_t FindInFileHandleCache(const RequestPath& filePath) const;
         size_t FindAvailableFileHandleCacheIndex() const;
         size_t FindAvailableReadSlot();
@@ -168,6 +173,8 @@ namespace AZ::IO
 
         AZStd::vector<AZStd::string> m_drivePaths;
 
+        MemoryMappedFileCache m_mappedFiles{ MaxMappedFiles };
+
         size_t m_activeReads_ByteCount{ 0 };
 
         size_t m_physicalSectorSize{ 0 };
@@ -11,3 +11,30 @@
 # NOTE: functions in cmake are global, therefore adding functions to this file
 # is being avoided to prevent overriding functions declared in other targets platfrom
 # specific cmake files
+
+# The wide batch math kernels are only called after checking the cpu supports their instruction set at runtime.
+if(PAL_TRAIT_COMPILER_ID STREQUAL "MSVC")
+    ly_add_source_properties(
+        SOURCES AzCore/Math/SimdMathBatch_Avx2.cpp
+        PROPERTY COMPILE_OPTIONS
+        VALUES /arch:AVX2
+    )
+
+    ly_add_source_properties(
+        SOURCES AzCore/Math/SimdMathBatch_Avx512.cpp
+        PROPERTY COMPILE_OPTIONS
+        VALUES /arch:AVX512
+    )
+else()
+    ly_add_source_properties(
+        SOURCES AzCore/Math/SimdMathBatch_Avx2.cpp
+        PROPERTY COMPILE_OPTIONS
+        VALUES -mavx2 -mfma
+    )
+
+    ly_add_source_properties(
+        SOURCES AzCore/Math/SimdMathBatch_Avx512.cpp
+        PROPERTY COMPILE_OPTIONS
+        VALUES -mavx512f -mavx2 -mfma
+    )
+endif()
@@ -34,6 +34,7 @@ set(FILES
     ../Common/WinAPI/AzCore/Debug/Trace_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.h
+    ../Common/WinAPI/AzCore/IO/MemoryMappedFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.h
     AzCore/IO/SystemFile_Platform.h
@@ -44,6 +45,7 @@ set(FILES
     AzCore/IO/Streamer/StreamerConfiguration_Windows.h
     AzCore/IO/Streamer/StreamerConfiguration_Windows.cpp
     AzCore/IO/Streamer/StreamerContext_Platform.h
+    ../Common/Default/AzCore/Jobs/Internal/ProcessorTopology_Default.cpp
     AzCore/IPC/SharedMemory_Platform.h
     AzCore/IPC/SharedMemory_Windows.h
     AzCore/IPC/SharedMemory_Windows.cpp
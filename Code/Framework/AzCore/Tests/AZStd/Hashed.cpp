@@ -12,6 +12,10 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
+#include <AzCore/std/containers/node_hash_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -2080,6 +2084,142 @@ namespace UnitTest
         EXPECT_EQ(0, HashedContainerTransparentTestInternal::s_allAssignmentCount);
     }
 
+    TEST_F(HashedContainers, FlatHashMap_RandomOperations_MatchUnorderedMap)
+    {
+        AZStd::flat_hash_map<int, int> flatMap;
+        AZStd::unordered_map<int, int> referenceMap;
+        for (int i = 0; i < 20000; ++i)
+        {
+            int key = rand() % 500;
+            switch (rand() % 3)
+            {
+            case 0:
+                flatMap[key] = i;
+                referenceMap[key] = i;
+                break;
+            case 1:
+                EXPECT_EQ(referenceMap.erase(key), flatMap.erase(key));
+                break;
+            case 2:
+            {
+                auto flatIt = flatMap.find(key);
+                auto referenceIt = referenceMap.find(key);
+                ASSERT_EQ(referenceIt == referenceMap.end(), flatIt == flatMap.end());
+                if (referenceIt != referenceMap.end())
+                {
+                    EXPECT_EQ(referenceIt->second, flatIt->second);
+                }
+                break;
+            }
+            }
+            ASSERT_EQ(referenceMap.size(), flatMap.size());
+        }
+
+        size_t numIterated = 0;
+        for (const auto& [key, value] : flatMap)
+        {
+            ++numIterated;
+            EXPECT_EQ(referenceMap[key], value);
+        }
+        EXPECT_EQ(referenceMap.size(), numIterated);
+    }
+
+    TEST_F(HashedContainers, FlatHashMap_GrowCopyAndClear_ElementsArePreserved)
+    {
+        AZStd::flat_hash_map<AZStd::string, int> flatMap;
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_TRUE(flatMap.try_emplace(AZStd::string::format("%d", i), i).second);
+        }
+        EXPECT_FALSE(flatMap.try_emplace(AZStd::string("10"), -1).second);
+        EXPECT_EQ(10, flatMap.at(AZStd::string("10")));
+        EXPECT_LE(flatMap.load_factor(), flatMap.max_load_factor());
+
+        AZStd::flat_hash_map<AZStd::string, int> copy(flatMap);
+        EXPECT_EQ(flatMap, copy);
+        copy.insert_or_assign(AZStd::string("10"), -1);
+        EXPECT_EQ(-1, copy.at(AZStd::string("10")));
+        EXPECT_NE(flatMap, copy);
+
+        AZStd::flat_hash_map<AZStd::string, int> moved(AZStd::move(flatMap));
+        EXPECT_TRUE(flatMap.empty());
+        EXPECT_EQ(1000, moved.size());
+
+        moved.clear();
+        EXPECT_TRUE(moved.empty());
+        EXPECT_EQ(moved.begin(), moved.end());
+        EXPECT_FALSE(moved.contains(AZStd::string("10")));
+    }
+
+    static_assert(AZStd::is_same_v<AZStd::flat_hash_map<int, int>::value_type, AZStd::pair<const int, int>>);
+    static_assert(AZStd::is_same_v<AZStd::node_hash_map<int, int>::value_type, AZStd::pair<const int, int>>);
+    static_assert(AZStd::is_const_v<AZStd::remove_reference_t<decltype(AZStd::declval<AZStd::flat_hash_map<int, int>::iterator>()->first)>>,
+        "Keys of a flat_hash_map must not be modifiable through an iterator");
+    static_assert(AZStd::is_const_v<AZStd::remove_reference_t<decltype(AZStd::declval<AZStd::node_hash_map<int, int>::iterator>()->first)>>,
+        "Keys of a node_hash_map must not be modifiable through an iterator");
+
+    TEST_F(HashedContainers, FlatHashMap_MoveOnlyKeys_ArePreservedWhenGrowing)
+    {
+        AZStd::flat_hash_map<AZStd::unique_ptr<int>, int> flatMap;
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_TRUE(flatMap.emplace(AZStd::make_unique<int>(i), i).second);
+        }
+        EXPECT_EQ(100, flatMap.size());
+        for (const auto& [key, value] : flatMap)
+        {
+            ASSERT_NE(nullptr, key);
+            EXPECT_EQ(*key, value);
+        }
+    }
+
+    TEST_F(HashedContainers, FlatHashSet_EraseDuringIteration_RemovesOnlyMatchingElements)
+    {
+        AZStd::flat_hash_set<int> flatSet;
+        for (int i = 0; i < 256; ++i)
+        {
+            flatSet.insert(i);
+        }
+        EXPECT_EQ(128, AZStd::erase_if(flatSet, [](int value) { return (value & 1) != 0; }));
+        EXPECT_EQ(128, flatSet.size());
+        for (int i = 0; i < 256; ++i)
+        {
+            EXPECT_EQ((i & 1) == 0, flatSet.contains(i));
+        }
+    }
+
+    TEST_F(HashedContainers, FlatHashSet_TransparentFind_DoesNotConstructKey)
+    {
+        using namespace HashedContainerTransparentTestInternal;
+        AZStd::flat_hash_set<TrackConstructorCalls, AZStd::hash<TrackConstructorCalls>, AZStd::equal_to<>> flatSet;
+        flatSet.emplace(1);
+        flatSet.emplace(2);
+        flatSet.emplace(3);
+
+        s_allConstructorCount = 0;
+        EXPECT_NE(flatSet.end(), flatSet.find(2));
+        EXPECT_EQ(flatSet.end(), flatSet.find(4));
+        EXPECT_TRUE(flatSet.contains(3));
+        EXPECT_EQ(1, flatSet.erase(1));
+        EXPECT_EQ(0, s_allConstructorCount);
+        s_allConstructorCount = 0;
+    }
+
+    TEST_F(HashedContainers, NodeHashMap_Grow_ReferencesRemainValid)
+    {
+        AZStd::node_hash_map<int, int> nodeMap;
+        int& firstValue = nodeMap[0];
+        firstValue = 42;
+        for (int i = 1; i < 1000; ++i)
+        {
+            nodeMap[i] = i;
+        }
+        EXPECT_EQ(&firstValue, &nodeMap[0]);
+        EXPECT_EQ(42, firstValue);
+        EXPECT_EQ(1, nodeMap.erase(500));
+        EXPECT_EQ(999, nodeMap.size());
+    }
+
 #if defined(HAVE_BENCHMARK)
     template <template <typename...> class Hash>
     void Benchmark_Lookup(benchmark::State& state)
@@ -2173,6 +2313,54 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
+
+    void Benchmark_NodeHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::node_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_NodeHashMapLookup);
+
+    void Benchmark_NodeHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::node_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_NodeHashMapInsert);
+
+    void Benchmark_NodeHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::node_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_NodeHashMapErase);
+
+    void Benchmark_NodeHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::node_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_NodeHashMapThrash);
 #endif
 } // namespace UnitTest
 
@@ -2276,5 +2464,50 @@ namespace Benchmark
     }
     BENCHMARK(BM_UnorderedMap_InsertDuplicatesViaBracket);
 
+    using FlatHashMap = AZStd::flat_hash_map<int, A>;
+
+    // BM_FlatHashMap_InsertUniqueViaXXX: same as the unordered map benchmarks above, using the open addressing map
+    static void BM_FlatHashMap_InsertUniqueViaEmplace(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map.emplace(mapKey, A()).first->second;
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertUniqueViaEmplace);
+
+    static void BM_FlatHashMap_InsertUniqueViaBracket(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map[mapKey];
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertUniqueViaBracket);
+
+    static void BM_FlatHashMap_InsertDuplicatesViaBracket(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map[mapKey % kModuloForDuplicates];
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertDuplicatesViaBracket);
+
 } // namespace Benchmark
 #endif // HAVE_BENCHMARK
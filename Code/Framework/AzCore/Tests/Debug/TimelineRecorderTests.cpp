@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/TimelineRecorder.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class TimelineRecorderTestRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        virtual void First() = 0;
+        virtual void Second(int value) = 0;
+    };
+    using TimelineRecorderTestRequestBus = AZ::EBus<TimelineRecorderTestRequests>;
+
+    class TimelineRecorderTestHandler
+        : public TimelineRecorderTestRequestBus::Handler
+    {
+    public:
+        TimelineRecorderTestHandler() { TimelineRecorderTestRequestBus::Handler::BusConnect(); }
+        ~TimelineRecorderTestHandler() override { TimelineRecorderTestRequestBus::Handler::BusDisconnect(); }
+
+        void First() override {}
+        void Second(int) override {}
+    };
+
+    class TimelineRecorderTests
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        void TearDown() override
+        {
+            AZ::Debug::TimelineRecorder::Stop();
+            ScopedAllocatorSetupFixture::TearDown();
+        }
+
+        static size_t CountOccurrences(const AZStd::string& text, const char* pattern)
+        {
+            size_t count = 0;
+            for (size_t offset = text.find(pattern); offset != AZStd::string::npos; offset = text.find(pattern, offset + 1))
+            {
+                ++count;
+            }
+            return count;
+        }
+    };
+
+    TEST_F(TimelineRecorderTests, RecordScopes_MultipleThreads_AllScopesAreExported)
+    {
+        AZ::Debug::TimelineRecorder::Start(1024);
+        {
+            AZ_TIMELINE_SCOPE("Test", "TimelineRecorderTests_MainThreadScope");
+        }
+        AZStd::thread threads[2];
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread([]()
+            {
+                AZ_TIMELINE_SCOPE("Test", "TimelineRecorderTests_WorkerScope");
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        AZ::Debug::TimelineRecorder::Stop();
+
+        AZStd::string trace;
+        AZ::Debug::TimelineRecorder::WriteChromeTrace(trace, 60.0f);
+        EXPECT_EQ(0, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+        EXPECT_EQ(1, CountOccurrences(trace, "\"TimelineRecorderTests_MainThreadScope\""));
+        EXPECT_EQ(2, CountOccurrences(trace, "\"TimelineRecorderTests_WorkerScope\""));
+        EXPECT_NE(AZStd::string::npos, trace.find("\"ph\":\"X\""));
+    }
+
+    TEST_F(TimelineRecorderTests, RecordScope_NotRecording_ScopeIsNotExported)
+    {
+        {
+            AZ_TIMELINE_SCOPE("Test", "TimelineRecorderTests_IgnoredScope");
+        }
+
+        AZStd::string trace;
+        AZ::Debug::TimelineRecorder::WriteChromeTrace(trace, 60.0f);
+        EXPECT_EQ(AZStd::string::npos, trace.find("TimelineRecorderTests_IgnoredScope"));
+    }
+
+    TEST_F(TimelineRecorderTests, RecordScope_NameWithQuotes_NameIsEscaped)
+    {
+        AZ::Debug::TimelineRecorder::Start(1024);
+        {
+            AZ_TIMELINE_SCOPE("Test", "TimelineRecorderTests_\"Quoted\"");
+        }
+        AZ::Debug::TimelineRecorder::Stop();
+
+        AZStd::string trace;
+        AZ::Debug::TimelineRecorder::WriteChromeTrace(trace, 60.0f);
+        EXPECT_NE(AZStd::string::npos, trace.find("\"TimelineRecorderTests_\\\"Quoted\\\"\""));
+    }
+
+    TEST_F(TimelineRecorderTests, RecordEvent_OlderThanWindow_EventIsNotExported)
+    {
+        AZ::Debug::TimelineRecorder::Start(1024);
+        const AZStd::sys_time_t now = AZ::Debug::TimelineRecorder::GetTicks();
+        const AZStd::sys_time_t oneMinute = AZStd::GetTimeTicksPerSecond() * 60;
+        AZ::Debug::TimelineRecorder::RecordEvent("Test", "TimelineRecorderTests_OldEvent", now - 2 * oneMinute, now - oneMinute);
+        AZ::Debug::TimelineRecorder::RecordEvent("Test", "TimelineRecorderTests_RecentEvent", now - 1, now);
+        AZ::Debug::TimelineRecorder::Stop();
+
+        AZStd::string trace;
+        AZ::Debug::TimelineRecorder::WriteChromeTrace(trace, 10.0f);
+        EXPECT_EQ(AZStd::string::npos, trace.find("TimelineRecorderTests_OldEvent"));
+        EXPECT_NE(AZStd::string::npos, trace.find("TimelineRecorderTests_RecentEvent"));
+    }
+
+    TEST_F(TimelineRecorderTests, RecordEBusDispatch_DifferentFunctions_DispatchesShareTheBusName)
+    {
+        TimelineRecorderTestHandler handler;
+        AZ::Debug::TimelineRecorder::Start(1024);
+        TimelineRecorderTestRequestBus::Broadcast(&TimelineRecorderTestRequests::First);
+        TimelineRecorderTestRequestBus::Broadcast(&TimelineRecorderTestRequests::Second, 1);
+        AZ::Debug::TimelineRecorder::Stop();
+
+        AZStd::string trace;
+        AZ::Debug::TimelineRecorder::WriteChromeTrace(trace, 60.0f);
+        EXPECT_EQ(2, CountOccurrences(trace, TimelineRecorderTestRequestBus::GetName()));
+    }
+} // namespace UnitTest
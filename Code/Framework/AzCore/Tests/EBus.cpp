@@ -45,7 +45,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool handlerSnapshot = false>
     class Traits
         : public AZ::EBusTraits
     {
@@ -53,6 +53,7 @@ namespace BusImplementation
         static const AZ::EBusAddressPolicy AddressPolicy = addressPolicy;
         static const AZ::EBusHandlerPolicy HandlerPolicy = handlerPolicy;
         static const bool LocklessDispatch = locklessDispatch;
+        static constexpr bool EnableHandlerSnapshot = handlerSnapshot;
 
         // Allow queuing
         static const bool EnableEventQueue = true;
@@ -193,13 +194,17 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool handlerSnapshot = false>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, handlerSnapshot>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
     namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
 
+#define EBUS_TEST_SNAPSHOT_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                                   \
+    using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy, false, true>;   \
+    namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
+
 // Predefined benchmark bus instantiations
 // Single
 EBUS_TEST_ALIAS(OneToOne, Single, Single)
@@ -213,6 +218,11 @@ EBUS_TEST_ALIAS(ManyToManyOrdered, ById, MultipleAndOrdered)
 EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
+// With EBusTraits::EnableHandlerSnapshot
+EBUS_TEST_SNAPSHOT_ALIAS(OneToManySnapshot, Single, Multiple)
+EBUS_TEST_SNAPSHOT_ALIAS(OneToManyOrderedSnapshot, Single, MultipleAndOrdered)
+EBUS_TEST_SNAPSHOT_ALIAS(ManyToManySnapshot, ById, Multiple)
+EBUS_TEST_SNAPSHOT_ALIAS(ManyOrderedToManyOrderedSnapshot, ByIdAndOrdered, MultipleAndOrdered)
 
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
@@ -362,11 +372,13 @@ namespace UnitTest
 {
     using BusTypesId = ::testing::Types<
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyToManySnapshot, ManyOrderedToManyOrderedSnapshot>;
     using BusTypesAll = ::testing::Types<
         OneToOne,         OneToMany,         OneToManyOrdered,
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        OneToManySnapshot, OneToManyOrderedSnapshot, ManyToManySnapshot, ManyOrderedToManyOrderedSnapshot>;
 
     template <typename Bus>
     class EBusTestAll
@@ -564,7 +576,8 @@ namespace UnitTest
 
     using BusTypesIdMultiHandlers = ::testing::Types<
         ManyToMany, ManyToManyOrdered,
-        ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyToManySnapshot, ManyOrderedToManyOrderedSnapshot>;
     template <typename Bus>
     class EBusTestIdMultiHandlers
         : public EBusTestAll<Bus>
@@ -3840,6 +3853,80 @@ namespace UnitTest
         EXPECT_EQ(1, lastHandler.m_numOnEvents);
     }
 
+    struct HandlerSnapshotInterface
+        : public AZ::EBusTraits
+    {
+        static const EBusHandlerPolicy HandlerPolicy = EBusHandlerPolicy::Multiple;
+        static constexpr bool EnableHandlerSnapshot = true;
+
+        virtual void OnEvent() = 0;
+    };
+
+    using HandlerSnapshotBus = AZ::EBus<HandlerSnapshotInterface>;
+
+    struct HandlerSnapshotHandler
+        : public HandlerSnapshotBus::Handler
+    {
+        void OnEvent() override
+        {
+            ++m_numOnEvents;
+            if (m_handlerToDisconnect)
+            {
+                m_handlerToDisconnect->BusDisconnect();
+            }
+            if (m_handlerToConnect)
+            {
+                m_handlerToConnect->BusConnect();
+            }
+        }
+
+        HandlerSnapshotHandler* m_handlerToDisconnect = nullptr;
+        HandlerSnapshotHandler* m_handlerToConnect = nullptr;
+        unsigned int m_numOnEvents = 0;
+    };
+
+    TEST_F(EBus, HandlerSnapshot_DisconnectDuringBroadcast_DisconnectedHandlerIsNotCalled)
+    {
+        HandlerSnapshotHandler firstHandler;
+        HandlerSnapshotHandler secondHandler;
+        firstHandler.m_handlerToDisconnect = &secondHandler;
+        secondHandler.m_handlerToDisconnect = &firstHandler;
+        firstHandler.BusConnect();
+        secondHandler.BusConnect();
+
+        // Whichever handler is called first disconnects the other one
+        HandlerSnapshotBus::Broadcast(&HandlerSnapshotBus::Events::OnEvent);
+        EXPECT_EQ(1, firstHandler.m_numOnEvents + secondHandler.m_numOnEvents);
+        EXPECT_NE(firstHandler.BusIsConnected(), secondHandler.BusIsConnected());
+
+        HandlerSnapshotBus::Broadcast(&HandlerSnapshotBus::Events::OnEvent);
+        EXPECT_EQ(2, firstHandler.m_numOnEvents + secondHandler.m_numOnEvents);
+    }
+
+    TEST_F(EBus, HandlerSnapshot_ConnectDuringBroadcast_HandlerIsCalledFromNextBroadcast)
+    {
+        HandlerSnapshotHandler firstHandler;
+        HandlerSnapshotHandler secondHandler;
+        firstHandler.m_handlerToConnect = &secondHandler;
+        firstHandler.BusConnect();
+
+        HandlerSnapshotBus::Broadcast(&HandlerSnapshotBus::Events::OnEvent);
+        EXPECT_TRUE(secondHandler.BusIsConnected());
+        EXPECT_EQ(1, firstHandler.m_numOnEvents);
+        EXPECT_EQ(0, secondHandler.m_numOnEvents);
+
+        firstHandler.m_handlerToConnect = nullptr;
+        HandlerSnapshotBus::Broadcast(&HandlerSnapshotBus::Events::OnEvent);
+        EXPECT_EQ(2, firstHandler.m_numOnEvents);
+        EXPECT_EQ(1, secondHandler.m_numOnEvents);
+
+        secondHandler.BusDisconnect();
+        HandlerSnapshotBus::Broadcast(&HandlerSnapshotBus::Events::OnEvent);
+        EXPECT_EQ(3, firstHandler.m_numOnEvents);
+        EXPECT_EQ(1, secondHandler.m_numOnEvents);
+        firstHandler.BusDisconnect();
+    }
+
     struct DisconnectAssertInterface
         : public AZ::EBusTraits
     {
@@ -4174,6 +4261,17 @@ namespace Benchmark
 // Register a benchmark for all bus permutations
 #define BUS_BENCHMARK_REGISTER_ALL(fn) BUS_BENCHMARK_PRIVATE_LIST_ALL(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
 
+// Register a benchmark for the buses with EBusTraits::EnableHandlerSnapshot requiring ids, to compare against the same policies without it
+#define BUS_BENCHMARK_REGISTER_SNAPSHOT_ID(fn)                                              \
+    BUS_BENCHMARK_PRIVATE_REGISTER(fn, ManyToManySnapshot, ManyToMany)                      \
+    BUS_BENCHMARK_PRIVATE_REGISTER(fn, ManyOrderedToManyOrderedSnapshot, ManyToMany)
+
+// Register a benchmark for all buses with EBusTraits::EnableHandlerSnapshot
+#define BUS_BENCHMARK_REGISTER_SNAPSHOT_ALL(fn)                                             \
+    BUS_BENCHMARK_PRIVATE_REGISTER(fn, OneToManySnapshot, OneToMany)                        \
+    BUS_BENCHMARK_PRIVATE_REGISTER(fn, OneToManyOrderedSnapshot, OneToMany)                 \
+    BUS_BENCHMARK_REGISTER_SNAPSHOT_ID(fn)
+
     //////////////////////////////////////////////////////////////////////////
     // Single Threaded Events/Broadcasts
     //////////////////////////////////////////////////////////////////////////
@@ -4261,6 +4359,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ALL(BM_EBus_Broadcast);
+    BUS_BENCHMARK_REGISTER_SNAPSHOT_ALL(BM_EBus_Broadcast);
 
     template <typename Bus>
     static void BM_EBus_BroadcastResult(::benchmark::State& state)
@@ -4275,6 +4374,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ALL(BM_EBus_BroadcastResult);
+    BUS_BENCHMARK_REGISTER_SNAPSHOT_ALL(BM_EBus_BroadcastResult);
 
     template <typename Bus>
     static void BM_EBus_Event(::benchmark::State& state)
@@ -4287,6 +4387,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_Event);
+    BUS_BENCHMARK_REGISTER_SNAPSHOT_ID(BM_EBus_Event);
 
     template <typename Bus>
     static void BM_EBus_EventResult(::benchmark::State& state)
@@ -4301,6 +4402,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventResult);
+    BUS_BENCHMARK_REGISTER_SNAPSHOT_ID(BM_EBus_EventResult);
 
     template <typename Bus>
     static void BM_EBus_EventCached(::benchmark::State& state)
@@ -4317,6 +4419,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventCached);
+    BUS_BENCHMARK_REGISTER_SNAPSHOT_ID(BM_EBus_EventCached);
 
     template <typename Bus>
     static void BM_EBus_EventCachedResult(::benchmark::State& state)
@@ -4335,6 +4438,26 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventCachedResult);
+    BUS_BENCHMARK_REGISTER_SNAPSHOT_ID(BM_EBus_EventCachedResult);
+
+    // Dispatch right after a connection change, which has to rebuild the handler snapshot on buses that keep one
+    template <typename Bus>
+    static void BM_EBus_BroadcastAfterConnect(::benchmark::State& state)
+    {
+        s_benchmarkEBusEnv<Bus>.Connect(state);
+        constexpr bool connectOnConstruct{ false };
+        Handler<Bus> handler{ 0, connectOnConstruct };
+
+        while (state.KeepRunning())
+        {
+            handler.Connect();
+            Bus::Broadcast(&Bus::Events::OnEvent);
+            handler.Disconnect();
+        }
+        s_benchmarkEBusEnv<Bus>.Disconnect(state);
+    }
+    BUS_BENCHMARK_PRIVATE_REGISTER(BM_EBus_BroadcastAfterConnect, OneToMany, OneToMany);
+    BUS_BENCHMARK_PRIVATE_REGISTER(BM_EBus_BroadcastAfterConnect, OneToManySnapshot, OneToMany);
 
     //////////////////////////////////////////////////////////////////////////
     // Broadcast/Event Queuing
@@ -13,7 +13,9 @@
 #include <AzCore/Jobs/LegacyJobExecutor.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/task_group.h>
+#include <AzCore/Jobs/TaskGraph.h>
 #include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/Internal/WorkStealingDeque.h>
 #include <AzCore/std/delegate/delegate.h>
 #include <AzCore/std/bind/bind.h>
 
@@ -1652,6 +1654,208 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class TaskGraphTest
+        : public DefaultJobManagerSetupFixture
+    {
+    };
+
+    TEST_F(TaskGraphTest, SubmitAndWait_RespectsDependencies)
+    {
+        // Diamond: a -> (b, c) -> d
+        AZStd::atomic_int order{ 0 };
+        AZStd::atomic_int a{ -1 }, b{ -1 }, c{ -1 }, d{ -1 };
+
+        AZ::TaskGraph graph;
+        AZ::TaskGraph::TaskId taskA = graph.AddTask("A", [&]() { a = order++; });
+        AZ::TaskGraph::TaskId taskB = graph.AddTask("B", [&]() { b = order++; });
+        AZ::TaskGraph::TaskId taskC = graph.AddTask("C", [&]() { c = order++; });
+        AZ::TaskGraph::TaskId taskD = graph.AddTask("D", [&]() { d = order++; });
+        graph.AddDependency(taskA, taskB);
+        graph.AddDependency(taskA, taskC);
+        graph.AddDependency(taskB, taskD);
+        graph.AddDependency(taskC, taskD);
+        ASSERT_TRUE(graph.Compile());
+
+        // The compiled graph can be submitted repeatedly
+        for (int run = 0; run < 100; ++run)
+        {
+            order = 0;
+            graph.SubmitAndWait();
+
+            EXPECT_EQ(0, a.load());
+            EXPECT_LT(a.load(), b.load());
+            EXPECT_LT(a.load(), c.load());
+            EXPECT_EQ(3, d.load());
+        }
+    }
+
+    TEST_F(TaskGraphTest, SubmitAndWait_RunsIndependentTasks)
+    {
+        constexpr int TaskCount = 256;
+        AZStd::atomic_int runCount{ 0 };
+
+        AZ::TaskGraph graph;
+        for (int i = 0; i < TaskCount; ++i)
+        {
+            graph.AddTask("Independent", [&runCount]() { ++runCount; });
+        }
+        ASSERT_TRUE(graph.Compile());
+
+        graph.Submit();
+        graph.Wait();
+        EXPECT_EQ(TaskCount, runCount.load());
+    }
+
+    TEST_F(TaskGraphTest, Compile_WithCycle_Fails)
+    {
+        AZ::TaskGraph graph;
+        AZ::TaskGraph::TaskId taskA = graph.AddTask("A", []() {});
+        AZ::TaskGraph::TaskId taskB = graph.AddTask("B", []() {});
+        AZ::TaskGraph::TaskId taskC = graph.AddTask("C", []() {});
+        graph.AddDependency(taskA, taskB);
+        graph.AddDependency(taskB, taskC);
+        graph.AddDependency(taskC, taskB);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(graph.Compile());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+        EXPECT_FALSE(graph.IsCompiled());
+    }
+
+    TEST_F(TaskGraphTest, GetCriticalPath_ReturnsLongestChain)
+    {
+        // a -> b -> d is the slow chain, c is independent and fast
+        auto sleepFor = [](int milliseconds)
+        {
+            return [milliseconds]() { AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(milliseconds)); };
+        };
+
+        AZ::TaskGraph graph;
+        graph.SetTimingEnabled(true);
+        AZ::TaskGraph::TaskId taskA = graph.AddTask("A", sleepFor(5));
+        AZ::TaskGraph::TaskId taskB = graph.AddTask("B", sleepFor(20));
+        AZ::TaskGraph::TaskId taskC = graph.AddTask("C", sleepFor(1));
+        AZ::TaskGraph::TaskId taskD = graph.AddTask("D", sleepFor(5));
+        graph.AddDependency(taskA, taskB);
+        graph.AddDependency(taskB, taskD);
+        graph.AddDependency(taskC, taskD);
+        ASSERT_TRUE(graph.Compile());
+        graph.SubmitAndWait();
+
+        AZStd::sys_time_t criticalPathDuration = 0;
+        const AZStd::vector<AZ::TaskGraph::TaskId> criticalPath = graph.GetCriticalPath(&criticalPathDuration);
+        ASSERT_EQ(3, criticalPath.size());
+        EXPECT_EQ(taskA, criticalPath[0]);
+        EXPECT_EQ(taskB, criticalPath[1]);
+        EXPECT_EQ(taskD, criticalPath[2]);
+        EXPECT_GE(criticalPathDuration, graph.GetTaskTiming(taskB).GetDuration());
+        EXPECT_GE(graph.GetTaskTiming(taskB).m_start, graph.GetTaskTiming(taskA).m_end);
+    }
+
+    TEST_F(TaskGraphTest, SubmitAndWait_CancelledMidGraph_Completes)
+    {
+        // a -> b -> c, a cancels the graph so b and c are skipped, but the submission still completes
+        JobCancelGroup cancelGroup;
+        JobContext context(m_jobContext->GetJobManager(), cancelGroup);
+        AZStd::atomic_int runCount{ 0 };
+
+        AZ::TaskGraph graph(&context);
+        AZ::TaskGraph::TaskId taskA = graph.AddTask("A", [&]() { ++runCount; cancelGroup.Cancel(); });
+        AZ::TaskGraph::TaskId taskB = graph.AddTask("B", [&]() { ++runCount; });
+        AZ::TaskGraph::TaskId taskC = graph.AddTask("C", [&]() { ++runCount; });
+        graph.AddDependency(taskA, taskB);
+        graph.AddDependency(taskB, taskC);
+        ASSERT_TRUE(graph.Compile());
+
+        graph.SubmitAndWait();
+        EXPECT_EQ(1, runCount.load());
+
+        // Once the group is reset the graph runs all of its tasks again
+        cancelGroup.Reset();
+        runCount = 0;
+        graph.SubmitAndWait();
+        EXPECT_EQ(3, runCount.load());
+    }
+
+    class WorkStealingDequeTest
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(WorkStealingDequeTest, StealTop_ReturnsElementsInPushOrder)
+    {
+        AZ::Internal::WorkStealingDeque<int*> deque(4);
+        int values[10];
+        for (int& value : values)
+        {
+            deque.PushBottom(&value); // grows the deque past its initial capacity
+        }
+
+        for (int& value : values)
+        {
+            EXPECT_EQ(&value, deque.StealTop());
+        }
+        EXPECT_TRUE(deque.IsEmpty());
+        EXPECT_EQ(nullptr, deque.StealTop());
+    }
+
+    TEST_F(WorkStealingDequeTest, ConcurrentSteals_EveryElementIsTakenOnce)
+    {
+        constexpr int NumElements = 100000;
+        constexpr int NumThieves = 4;
+
+        AZStd::vector<int> values(NumElements, 0);
+        AZStd::vector<AZStd::atomic_int> takenCounts(NumElements);
+        for (AZStd::atomic_int& takenCount : takenCounts)
+        {
+            takenCount = 0;
+        }
+
+        AZ::Internal::WorkStealingDeque<int*> deque(16);
+        AZStd::atomic_bool pushingDone{ false };
+        auto takeElements = [&]()
+        {
+            while (!pushingDone || !deque.IsEmpty())
+            {
+                if (int* value = deque.StealTop())
+                {
+                    ++takenCounts[value - values.data()];
+                }
+            }
+        };
+
+        AZStd::vector<AZStd::thread> thieves;
+        for (int i = 0; i < NumThieves; ++i)
+        {
+            thieves.emplace_back(takeElements);
+        }
+
+        // The owner pushes and takes elements as well, the same way the job system does
+        for (int i = 0; i < NumElements; ++i)
+        {
+            deque.PushBottom(&values[i]);
+            if ((i % 3) == 0)
+            {
+                if (int* value = deque.StealTop())
+                {
+                    ++takenCounts[value - values.data()];
+                }
+            }
+        }
+        pushingDone = true;
+        takeElements();
+
+        for (AZStd::thread& thief : thieves)
+        {
+            thief.join();
+        }
+
+        for (int i = 0; i < NumElements; ++i)
+        {
+            EXPECT_EQ(1, takenCounts[i].load()) << "Element " << i << " was taken the wrong number of times";
+        }
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -1704,7 +1908,7 @@ namespace Benchmark
         static const AZ::u32 MEDIUM_NUMBER_OF_JOBS = 1024;
         static const AZ::u32 LARGE_NUMBER_OF_JOBS = 16384;
 
-        void SetUp([[maybe_unused]] ::benchmark::State& state) override
+        void SetUp(::benchmark::State& state) override
         {
             AllocatorInstance<PoolAllocator>::Create();
             AllocatorInstance<ThreadPoolAllocator>::Create();
@@ -1715,7 +1919,7 @@ namespace Benchmark
             threadDesc.m_cpuId = 0; // Don't set processors IDs on windows
 #endif // AZ_TRAIT_SET_JOB_PROCESSOR_ID
 
-            const AZ::u32 numWorkerThreads = AZStd::thread::hardware_concurrency();
+            const AZ::u32 numWorkerThreads = GetNumWorkerThreads(state);
             for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
             {
                 desc.m_workerThreads.push_back(threadDesc);
@@ -1765,6 +1969,11 @@ namespace Benchmark
         }
 
     protected:
+        virtual AZ::u32 GetNumWorkerThreads([[maybe_unused]] const ::benchmark::State& state) const
+        {
+            return AZStd::thread::hardware_concurrency();
+        }
+
         inline void RunCalculatePiJob(AZ::s32 depth, AZ::s8 priority)
         {
             (aznew TestJobCalculatePi(depth, priority, m_jobContext))->Start();
@@ -2012,6 +2221,130 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+
+    // Measures how job throughput scales with the number of worker threads. The jobs are forked from a job running on
+    // a worker, so they go through the workers' local queues and are spread over the other workers by stealing.
+    class JobScalingBenchmarkFixture : public JobBenchmarkFixture
+    {
+    public:
+        static void WorkerThreadCounts(::benchmark::internal::Benchmark* benchmark)
+        {
+            const int maxWorkerThreads = static_cast<int>(AZStd::thread::hardware_concurrency());
+            for (int numWorkerThreads = 1; numWorkerThreads < maxWorkerThreads; numWorkerThreads *= 2)
+            {
+                benchmark->Arg(numWorkerThreads);
+            }
+            benchmark->Arg(maxWorkerThreads);
+            benchmark->ArgName("workers");
+            benchmark->UseRealTime();
+        }
+
+    protected:
+        AZ::u32 GetNumWorkerThreads(const ::benchmark::State& state) const override
+        {
+            return static_cast<AZ::u32>(state.range(0));
+        }
+
+        void RunForkedCalculatePiJobs(AZ::u32 numberOfJobs, AZ::s32 depth)
+        {
+            Job* rootJob = CreateJobFunction([this, numberOfJobs, depth]()
+                {
+                    Job* currentJob = m_jobManager->GetCurrentJob();
+                    for (AZ::u32 i = 0; i < numberOfJobs; ++i)
+                    {
+                        currentJob->StartAsChild(aznew TestJobCalculatePi(depth, 0, m_jobContext));
+                    }
+                    currentJob->WaitForChildren();
+                }, true, m_jobContext);
+            rootJob->StartAndWaitForCompletion();
+        }
+    };
+
+    BENCHMARK_DEFINE_F(JobScalingBenchmarkFixture, RunLargeNumberOfLightWeightForkedJobs)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            RunForkedCalculatePiJobs(LARGE_NUMBER_OF_JOBS, LIGHT_WEIGHT_JOB_CALCULATE_PI_DEPTH);
+        }
+        state.SetItemsProcessed(state.iterations() * LARGE_NUMBER_OF_JOBS);
+    }
+    BENCHMARK_REGISTER_F(JobScalingBenchmarkFixture, RunLargeNumberOfLightWeightForkedJobs)->Apply(&JobScalingBenchmarkFixture::WorkerThreadCounts);
+
+    BENCHMARK_DEFINE_F(JobScalingBenchmarkFixture, RunLargeNumberOfMediumWeightForkedJobs)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            RunForkedCalculatePiJobs(LARGE_NUMBER_OF_JOBS, MEDIUM_WEIGHT_JOB_CALCULATE_PI_DEPTH);
+        }
+        state.SetItemsProcessed(state.iterations() * LARGE_NUMBER_OF_JOBS);
+    }
+    BENCHMARK_REGISTER_F(JobScalingBenchmarkFixture, RunLargeNumberOfMediumWeightForkedJobs)->Apply(&JobScalingBenchmarkFixture::WorkerThreadCounts);
+
+    BENCHMARK_DEFINE_F(JobScalingBenchmarkFixture, RunLargeNumberOfMediumWeightJobs)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            RunMultipleCalculatePiJobsWithDefaultPriority(LARGE_NUMBER_OF_JOBS, MEDIUM_WEIGHT_JOB_CALCULATE_PI_DEPTH);
+        }
+        state.SetItemsProcessed(state.iterations() * LARGE_NUMBER_OF_JOBS);
+    }
+    BENCHMARK_REGISTER_F(JobScalingBenchmarkFixture, RunLargeNumberOfMediumWeightJobs)->Apply(&JobScalingBenchmarkFixture::WorkerThreadCounts);
+
+    // Compares wiring up jobs by hand every frame with submitting a precompiled TaskGraph.
+    // Each frame runs a number of stages, each stage fans out to medium weight jobs which all have to complete before the next stage.
+    class TaskGraphBenchmarkFixture : public JobBenchmarkFixture
+    {
+    public:
+        static constexpr AZ::u32 Stages = 4;
+        static constexpr AZ::u32 JobsPerStage = 64;
+    };
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, HandWiredJobStages)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            // Jobs are allocated and wired up every frame, each stage is joined before the next one starts
+            for (AZ::u32 stage = 0; stage < Stages; ++stage)
+            {
+                JobCompletion completion(m_jobContext);
+                for (AZ::u32 i = 0; i < JobsPerStage; ++i)
+                {
+                    Job* job = CreateJobFunction([]() { benchmark::DoNotOptimize(CalculatePi(MEDIUM_WEIGHT_JOB_CALCULATE_PI_DEPTH)); }, true, m_jobContext);
+                    job->SetDependent(&completion);
+                    job->Start();
+                }
+                completion.StartAndWaitForCompletion();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * Stages * JobsPerStage);
+    }
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, PrecompiledTaskGraph)(benchmark::State& state)
+    {
+        TaskGraph graph(m_jobContext);
+        TaskGraph::TaskId previousJoin = TaskGraph::InvalidTaskId;
+        for (AZ::u32 stage = 0; stage < Stages; ++stage)
+        {
+            const TaskGraph::TaskId join = graph.AddTask("Join", []() {});
+            for (AZ::u32 i = 0; i < JobsPerStage; ++i)
+            {
+                const TaskGraph::TaskId task = graph.AddTask("Work", []() { benchmark::DoNotOptimize(CalculatePi(MEDIUM_WEIGHT_JOB_CALCULATE_PI_DEPTH)); });
+                if (previousJoin != TaskGraph::InvalidTaskId)
+                {
+                    graph.AddDependency(previousJoin, task);
+                }
+                graph.AddDependency(task, join);
+            }
+            previousJoin = join;
+        }
+        graph.Compile();
+
+        for (auto _ : state)
+        {
+            graph.SubmitAndWait();
+        }
+        state.SetItemsProcessed(state.iterations() * Stages * JobsPerStage);
+    }
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
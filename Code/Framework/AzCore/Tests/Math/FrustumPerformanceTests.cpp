@@ -7,10 +7,15 @@
  */
 
 #include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMathBatch.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+#include "SimdMathBatchBenchmarks.h"
+
 #if defined(HAVE_BENCHMARK)
 
+#include <memory>
 #include <random>
 #include <benchmark/benchmark.h>
 
@@ -39,6 +44,22 @@ namespace Benchmark
                 data.aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f + data.aabbMin;
                 return data;
             });
+
+            // Structure of arrays copies of the boxes for the batch kernels.
+            for (size_t i = 0; i < 3; ++i)
+            {
+                m_aabbMinSoa[i].resize(m_dataArray.size());
+                m_aabbMaxSoa[i].resize(m_dataArray.size());
+            }
+            for (size_t index = 0; index < m_dataArray.size(); ++index)
+            {
+                for (int i = 0; i < 3; ++i)
+                {
+                    m_aabbMinSoa[i][index] = m_dataArray[index].aabbMin.GetElement(i);
+                    m_aabbMaxSoa[i][index] = m_dataArray[index].aabbMax.GetElement(i);
+                }
+            }
+            m_results.reset(new bool[m_dataArray.size()]);
         }
 
         struct Data
@@ -50,6 +71,9 @@ namespace Benchmark
         };
 
         std::vector<Data> m_dataArray;
+        std::vector<float> m_aabbMinSoa[3];
+        std::vector<float> m_aabbMaxSoa[3];
+        std::unique_ptr<bool[]> m_results;
         AZ::Frustum m_testFrustum;
     };
 
@@ -76,6 +100,33 @@ namespace Benchmark
             }
         }
     }
+
+    BENCHMARK_F(BM_MathFrustum, AabbOverlaps)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (auto& data : m_dataArray)
+            {
+                bool result = AZ::ShapeIntersection::Overlaps(m_testFrustum, AZ::Aabb::CreateFromMinMax(data.aabbMin, data.aabbMax));
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_DEFINE_F(BM_MathFrustum, BatchAabbOverlaps)(benchmark::State& state)
+    {
+        ScopedBatchInstructionSet instructionSet(state);
+        AZ::Simd::Batch::ConstAabbArray aabbs;
+        aabbs.m_min = AZ::Simd::Batch::ConstVec3Array(m_aabbMinSoa[0].data(), m_aabbMinSoa[1].data(), m_aabbMinSoa[2].data());
+        aabbs.m_max = AZ::Simd::Batch::ConstVec3Array(m_aabbMaxSoa[0].data(), m_aabbMaxSoa[1].data(), m_aabbMaxSoa[2].data());
+        for (auto _ : state)
+        {
+            AZ::Simd::Batch::Overlaps(m_testFrustum, aabbs, m_results.get(), m_dataArray.size());
+            benchmark::DoNotOptimize(m_results.get());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BM_MathFrustum, BatchAabbOverlaps)->Apply(BatchInstructionSetArguments);
 }
 
 #endif
@@ -9,7 +9,11 @@
 #if defined(HAVE_BENCHMARK)
 
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdMathBatch.h>
 #include <AzCore/UnitTest/TestTypes.h>
+
+#include "SimdMathBatchBenchmarks.h"
+
 #include <random>
 
 namespace Benchmark
@@ -41,6 +45,25 @@ namespace Benchmark
                 quatData.w = unif(rng);
                 return quatData;
             });
+
+            // Structure of arrays copies of the test data for the batch kernels.
+            const size_t count = m_quatDataArray.size();
+            for (size_t i = 0; i < 4; ++i)
+            {
+                m_q1Soa[i].resize(count);
+                m_q2Soa[i].resize(count);
+                m_resultSoa[i].resize(count);
+            }
+            m_xSoa.resize(count);
+            for (size_t index = 0; index < count; ++index)
+            {
+                for (int i = 0; i < 4; ++i)
+                {
+                    m_q1Soa[i][index] = m_quatDataArray[index].q1.GetElement(i);
+                    m_q2Soa[i][index] = m_quatDataArray[index].q2.GetElement(i);
+                }
+                m_xSoa[index] = m_quatDataArray[index].x;
+            }
         }
 
         struct QuatData
@@ -56,6 +79,10 @@ namespace Benchmark
         };
 
         std::vector<QuatData> m_quatDataArray;
+        std::vector<float> m_q1Soa[4];
+        std::vector<float> m_q2Soa[4];
+        std::vector<float> m_xSoa;
+        std::vector<float> m_resultSoa[4];
     };
 
     BENCHMARK_F(BM_MathQuaternion, SplatFloatConstruction)(benchmark::State& state)
@@ -544,6 +571,21 @@ namespace Benchmark
         }
     }
 
+    BENCHMARK_DEFINE_F(BM_MathQuaternion, BatchSlerp)(benchmark::State& state)
+    {
+        ScopedBatchInstructionSet instructionSet(state);
+        const AZ::Simd::Batch::ConstQuaternionArray from(m_q1Soa[0].data(), m_q1Soa[1].data(), m_q1Soa[2].data(), m_q1Soa[3].data());
+        const AZ::Simd::Batch::ConstQuaternionArray to(m_q2Soa[0].data(), m_q2Soa[1].data(), m_q2Soa[2].data(), m_q2Soa[3].data());
+        const AZ::Simd::Batch::QuaternionArray output{ m_resultSoa[0].data(), m_resultSoa[1].data(), m_resultSoa[2].data(), m_resultSoa[3].data() };
+        for (auto _ : state)
+        {
+            AZ::Simd::Batch::Slerp(from, to, m_xSoa.data(), output, m_quatDataArray.size());
+            benchmark::DoNotOptimize(m_resultSoa[0].data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BM_MathQuaternion, BatchSlerp)->Apply(BatchInstructionSetArguments);
+
     BENCHMARK_F(BM_MathQuaternion, OperatorEquality)(benchmark::State& state)
     {
         for (auto _ : state)
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/SimdMathBatch.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Runs the batch math kernels with the instruction set given by the first benchmark argument for the lifetime of
+    //! the scope, so the instruction sets can be compared on the same machine. Instruction sets the cpu doesn't
+    //! support are reported as skipped instead of silently measuring a narrower one.
+    class ScopedBatchInstructionSet
+    {
+    public:
+        explicit ScopedBatchInstructionSet(benchmark::State& state)
+            : m_previousInstructionSet(AZ::Simd::Batch::GetInstructionSet())
+        {
+            const auto requested = static_cast<AZ::Simd::Batch::InstructionSet>(state.range(0));
+            const AZ::Simd::Batch::InstructionSet selected = AZ::Simd::Batch::SetInstructionSet(requested);
+            if (selected != requested)
+            {
+                state.SkipWithError("Instruction set isn't supported on this machine");
+                return;
+            }
+            state.SetLabel(AZ::Simd::Batch::GetInstructionSetName(selected));
+        }
+
+        ~ScopedBatchInstructionSet()
+        {
+            AZ::Simd::Batch::SetInstructionSet(m_previousInstructionSet);
+        }
+
+    private:
+        AZ::Simd::Batch::InstructionSet m_previousInstructionSet;
+    };
+
+    //! Registers one run per instruction set, use together with ScopedBatchInstructionSet.
+    inline void BatchInstructionSetArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgName("InstructionSet")->DenseRange(
+            static_cast<int>(AZ::Simd::Batch::InstructionSet::Default), static_cast<int>(AZ::Simd::Batch::InstructionSet::Avx512));
+    }
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
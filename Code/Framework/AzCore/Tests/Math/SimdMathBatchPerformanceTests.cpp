@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/SimdMathBatch.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include "SimdMathBatchBenchmarks.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_MathSimdMathBatch
+        : public benchmark::Fixture
+    {
+    public:
+        static constexpr size_t VertexCount = 10000;
+        static constexpr size_t JointCount = 64;
+        static constexpr size_t InfluenceCount = 4;
+
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+
+            m_joints.resize(JointCount);
+            for (AZ::Matrix3x4& joint : m_joints)
+            {
+                const AZ::Quaternion rotation = AZ::Quaternion(unif(rng), unif(rng), unif(rng), unif(rng)).GetNormalized();
+                joint = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(rotation, AZ::Vector3(unif(rng), unif(rng), unif(rng)));
+            }
+
+            m_jointIndices.resize(VertexCount * InfluenceCount);
+            m_jointWeights.resize(VertexCount * InfluenceCount);
+            for (size_t vertex = 0; vertex < VertexCount; ++vertex)
+            {
+                for (size_t influence = 0; influence < InfluenceCount; ++influence)
+                {
+                    m_jointIndices[influence * VertexCount + vertex] = static_cast<uint32_t>(rng() % JointCount);
+                    m_jointWeights[influence * VertexCount + vertex] = 1.0f / InfluenceCount;
+                }
+            }
+
+            for (size_t i = 0; i < 3; ++i)
+            {
+                m_positions[i].resize(VertexCount);
+                m_normals[i].resize(VertexCount);
+                m_outputPositions[i].resize(VertexCount);
+                m_outputNormals[i].resize(VertexCount);
+                for (size_t vertex = 0; vertex < VertexCount; ++vertex)
+                {
+                    m_positions[i][vertex] = unif(rng) * 100.0f;
+                    m_normals[i][vertex] = unif(rng);
+                }
+            }
+
+            m_permutationTable.resize(512);
+            std::iota(m_permutationTable.begin(), m_permutationTable.begin() + 256, 0);
+            std::shuffle(m_permutationTable.begin(), m_permutationTable.begin() + 256, rng);
+            std::copy(m_permutationTable.begin(), m_permutationTable.begin() + 256, m_permutationTable.begin() + 256);
+            m_noise.resize(VertexCount);
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            m_joints = {};
+            m_jointIndices = {};
+            m_jointWeights = {};
+            for (size_t i = 0; i < 3; ++i)
+            {
+                m_positions[i] = {};
+                m_normals[i] = {};
+                m_outputPositions[i] = {};
+                m_outputNormals[i] = {};
+            }
+            m_permutationTable = {};
+            m_noise = {};
+        }
+
+    protected:
+        AZ::Simd::Batch::SkinInfluenceArray GetInfluences() const
+        {
+            AZ::Simd::Batch::SkinInfluenceArray influences;
+            influences.m_jointIndices = m_jointIndices.data();
+            influences.m_jointWeights = m_jointWeights.data();
+            influences.m_influenceCount = InfluenceCount;
+            return influences;
+        }
+
+        static AZ::Simd::Batch::Vec3Array GetVec3Array(std::vector<float> (&soa)[3])
+        {
+            return AZ::Simd::Batch::Vec3Array{ soa[0].data(), soa[1].data(), soa[2].data() };
+        }
+
+        std::vector<AZ::Matrix3x4> m_joints;
+        std::vector<uint32_t> m_jointIndices;
+        std::vector<float> m_jointWeights;
+        std::vector<float> m_positions[3];
+        std::vector<float> m_normals[3];
+        std::vector<float> m_outputPositions[3];
+        std::vector<float> m_outputNormals[3];
+        std::vector<int32_t> m_permutationTable;
+        std::vector<float> m_noise;
+    };
+
+    BENCHMARK_F(BM_MathSimdMathBatch, SkinPositionsAndNormals)(benchmark::State& state)
+    {
+        // Per vertex baseline with the regular math types.
+        for (auto _ : state)
+        {
+            for (size_t vertex = 0; vertex < VertexCount; ++vertex)
+            {
+                AZ::Matrix3x4 blended = AZ::Matrix3x4::CreateZero();
+                for (size_t influence = 0; influence < InfluenceCount; ++influence)
+                {
+                    const size_t index = influence * VertexCount + vertex;
+                    blended += m_joints[m_jointIndices[index]] * m_jointWeights[index];
+                }
+                const AZ::Vector3 position = blended * AZ::Vector3(m_positions[0][vertex], m_positions[1][vertex], m_positions[2][vertex]);
+                const AZ::Vector3 normal =
+                    blended.TransformVector(AZ::Vector3(m_normals[0][vertex], m_normals[1][vertex], m_normals[2][vertex])).GetNormalized();
+                benchmark::DoNotOptimize(position);
+                benchmark::DoNotOptimize(normal);
+            }
+        }
+    }
+
+    BENCHMARK_DEFINE_F(BM_MathSimdMathBatch, BatchSkinPositionsAndNormals)(benchmark::State& state)
+    {
+        ScopedBatchInstructionSet instructionSet(state);
+        for (auto _ : state)
+        {
+            AZ::Simd::Batch::SkinPositionsAndNormals(m_joints.data(), GetInfluences(), GetVec3Array(m_positions), GetVec3Array(m_normals),
+                GetVec3Array(m_outputPositions), GetVec3Array(m_outputNormals), VertexCount);
+            benchmark::DoNotOptimize(m_outputPositions[0].data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BM_MathSimdMathBatch, BatchSkinPositionsAndNormals)->Apply(BatchInstructionSetArguments);
+
+    BENCHMARK_DEFINE_F(BM_MathSimdMathBatch, BatchPerlinNoise)(benchmark::State& state)
+    {
+        ScopedBatchInstructionSet instructionSet(state);
+        for (auto _ : state)
+        {
+            AZ::Simd::Batch::PerlinNoise(m_permutationTable.data(), GetVec3Array(m_positions), m_noise.data(), VertexCount);
+            benchmark::DoNotOptimize(m_noise.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BM_MathSimdMathBatch, BatchPerlinNoise)->Apply(BatchInstructionSetArguments);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,552 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMathBatch.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    //! Structure of arrays storage for the batch tests, with one vector per component.
+    template <size_t ComponentCount>
+    struct SoaData
+    {
+        explicit SoaData(size_t count)
+        {
+            for (auto& component : m_components)
+            {
+                component.resize(count, 0.0f);
+            }
+        }
+
+        float* operator[](size_t component)
+        {
+            return m_components[component].data();
+        }
+
+        const float* operator[](size_t component) const
+        {
+            return m_components[component].data();
+        }
+
+        std::vector<float> m_components[ComponentCount];
+    };
+
+    //! Runs every test with each instruction set. Instruction sets the cpu doesn't support fall back to the widest
+    //! one that it does, so those runs repeat the tests of a narrower instruction set.
+    class MATH_SimdMathBatch
+        : public ::testing::TestWithParam<Simd::Batch::InstructionSet>
+    {
+    protected:
+        void SetUp() override
+        {
+            m_previousInstructionSet = Simd::Batch::GetInstructionSet();
+            Simd::Batch::SetInstructionSet(GetParam());
+        }
+
+        void TearDown() override
+        {
+            Simd::Batch::SetInstructionSet(m_previousInstructionSet);
+        }
+
+        // Not a multiple of any simd width, so the partial last block is always tested as well.
+        static constexpr size_t Count = 37;
+        static constexpr float Tolerance = 0.0001f;
+
+        float Random(float min, float max)
+        {
+            return std::uniform_real_distribution<float>(min, max)(m_rng);
+        }
+
+        Vector3 RandomVector3(float min, float max)
+        {
+            return Vector3(Random(min, max), Random(min, max), Random(min, max));
+        }
+
+        Quaternion RandomQuaternion()
+        {
+            return Quaternion(Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f)).GetNormalized();
+        }
+
+        Transform RandomTransform()
+        {
+            return Transform(RandomVector3(-10.0f, 10.0f), RandomQuaternion(), Random(0.5f, 2.0f));
+        }
+
+        static void StoreVector3(SoaData<3>& data, size_t index, const Vector3& value)
+        {
+            data[0][index] = value.GetX();
+            data[1][index] = value.GetY();
+            data[2][index] = value.GetZ();
+        }
+
+        static Vector3 LoadVector3(const SoaData<3>& data, size_t index)
+        {
+            return Vector3(data[0][index], data[1][index], data[2][index]);
+        }
+
+        static void StoreQuaternion(SoaData<4>& data, size_t index, const Quaternion& value)
+        {
+            data[0][index] = value.GetX();
+            data[1][index] = value.GetY();
+            data[2][index] = value.GetZ();
+            data[3][index] = value.GetW();
+        }
+
+        static Quaternion LoadQuaternion(const SoaData<4>& data, size_t index)
+        {
+            return Quaternion(data[0][index], data[1][index], data[2][index], data[3][index]);
+        }
+
+        static void StoreTransform(SoaData<8>& data, size_t index, const Transform& value)
+        {
+            data[0][index] = value.GetRotation().GetX();
+            data[1][index] = value.GetRotation().GetY();
+            data[2][index] = value.GetRotation().GetZ();
+            data[3][index] = value.GetRotation().GetW();
+            data[4][index] = value.GetUniformScale();
+            data[5][index] = value.GetTranslation().GetX();
+            data[6][index] = value.GetTranslation().GetY();
+            data[7][index] = value.GetTranslation().GetZ();
+        }
+
+        static Transform LoadTransform(const SoaData<8>& data, size_t index)
+        {
+            return Transform(
+                Vector3(data[5][index], data[6][index], data[7][index]),
+                Quaternion(data[0][index], data[1][index], data[2][index], data[3][index]),
+                data[4][index]);
+        }
+
+        static Simd::Batch::Vec3Array GetVec3Array(SoaData<3>& data)
+        {
+            return Simd::Batch::Vec3Array{ data[0], data[1], data[2] };
+        }
+
+        static Simd::Batch::QuaternionArray GetQuaternionArray(SoaData<4>& data)
+        {
+            return Simd::Batch::QuaternionArray{ data[0], data[1], data[2], data[3] };
+        }
+
+        static Simd::Batch::TransformArray GetTransformArray(SoaData<8>& data)
+        {
+            Simd::Batch::TransformArray result;
+            result.m_rotation = Simd::Batch::QuaternionArray{ data[0], data[1], data[2], data[3] };
+            result.m_scale = data[4];
+            result.m_translation = Simd::Batch::Vec3Array{ data[5], data[6], data[7] };
+            return result;
+        }
+
+        SoaData<3> CreateRandomVectors(float min, float max)
+        {
+            SoaData<3> result(Count);
+            for (size_t i = 0; i < Count; ++i)
+            {
+                StoreVector3(result, i, RandomVector3(min, max));
+            }
+            return result;
+        }
+
+        std::mt19937 m_rng{ 1 };
+        Simd::Batch::InstructionSet m_previousInstructionSet = Simd::Batch::InstructionSet::Default;
+    };
+
+    namespace SimdMathBatchTestsDetails
+    {
+        // Scalar reference of Ken Perlin's improved noise, same as GradientSignal::PerlinImprovedNoise::GenerateNoise.
+        float Gradient(int32_t hash, float x, float y, float z)
+        {
+            switch (hash & 0xF)
+            {
+            case 0x0: return  x + y;
+            case 0x1: return -x + y;
+            case 0x2: return  x - y;
+            case 0x3: return -x - y;
+            case 0x4: return  x + z;
+            case 0x5: return -x + z;
+            case 0x6: return  x - z;
+            case 0x7: return -x - z;
+            case 0x8: return  y + z;
+            case 0x9: return -y + z;
+            case 0xA: return  y - z;
+            case 0xB: return -y - z;
+            case 0xC: return  y + x;
+            case 0xD: return -y + z;
+            case 0xE: return  y - x;
+            default:  return -y - z;
+            }
+        }
+
+        float Fade(float t)
+        {
+            return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+        }
+
+        float Lerp(float a, float b, float t)
+        {
+            return a + t * (b - a);
+        }
+
+        float PerlinNoise(const int32_t* p, float x, float y, float z)
+        {
+            const int32_t fx = static_cast<int32_t>(std::floor(x));
+            const int32_t fy = static_cast<int32_t>(std::floor(y));
+            const int32_t fz = static_cast<int32_t>(std::floor(z));
+            const float xf = x - fx;
+            const float yf = y - fy;
+            const float zf = z - fz;
+            const int32_t xi0 = fx & 255;
+            const int32_t yi0 = fy & 255;
+            const int32_t zi0 = fz & 255;
+            const int32_t xi1 = xi0 + 1;
+            const int32_t yi1 = yi0 + 1;
+            const int32_t zi1 = zi0 + 1;
+            const float u = Fade(xf);
+            const float v = Fade(yf);
+            const float w = Fade(zf);
+
+            const float x1 = Lerp(Gradient(p[p[p[xi0] + yi0] + zi0], xf, yf, zf), Gradient(p[p[p[xi1] + yi0] + zi0], xf - 1.0f, yf, zf), u);
+            const float x2 = Lerp(Gradient(p[p[p[xi0] + yi1] + zi0], xf, yf - 1.0f, zf), Gradient(p[p[p[xi1] + yi1] + zi0], xf - 1.0f, yf - 1.0f, zf), u);
+            const float y1 = Lerp(x1, x2, v);
+            const float x3 = Lerp(Gradient(p[p[p[xi0] + yi0] + zi1], xf, yf, zf - 1.0f), Gradient(p[p[p[xi1] + yi0] + zi1], xf - 1.0f, yf, zf - 1.0f), u);
+            const float x4 = Lerp(Gradient(p[p[p[xi0] + yi1] + zi1], xf, yf - 1.0f, zf - 1.0f), Gradient(p[p[p[xi1] + yi1] + zi1], xf - 1.0f, yf - 1.0f, zf - 1.0f), u);
+            const float y2 = Lerp(x3, x4, v);
+            return (Lerp(y1, y2, w) + 1.0f) * 0.5f;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, TransformPoints_Transform_MatchesTransformPoint)
+    {
+        const Transform transform = RandomTransform();
+        SoaData<3> points = CreateRandomVectors(-100.0f, 100.0f);
+        SoaData<3> output(Count);
+
+        Simd::Batch::TransformPoints(transform, GetVec3Array(points), GetVec3Array(output), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Vector3 expected = transform.TransformPoint(LoadVector3(points, i));
+            EXPECT_TRUE(LoadVector3(output, i).IsClose(expected, Tolerance * 100.0f)) << "Point " << i;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, TransformPoints_Matrix3x4_MatchesMatrixMultiply)
+    {
+        Matrix3x4 matrix = Matrix3x4::CreateFromTransform(RandomTransform());
+        matrix.MultiplyByScale(Vector3(1.0f, 2.0f, 3.0f));
+        SoaData<3> points = CreateRandomVectors(-10.0f, 10.0f);
+        SoaData<3> output(Count);
+
+        Simd::Batch::TransformPoints(matrix, GetVec3Array(points), GetVec3Array(output), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Vector3 expected = matrix * LoadVector3(points, i);
+            EXPECT_TRUE(LoadVector3(output, i).IsClose(expected, Tolerance * 10.0f)) << "Point " << i;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, TransformPoints_InPlace_MatchesTransformPoint)
+    {
+        const Transform transform = RandomTransform();
+        SoaData<3> points = CreateRandomVectors(-10.0f, 10.0f);
+        const SoaData<3> original = points;
+
+        Simd::Batch::TransformPoints(transform, GetVec3Array(points), GetVec3Array(points), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Vector3 expected = transform.TransformPoint(LoadVector3(original, i));
+            EXPECT_TRUE(LoadVector3(points, i).IsClose(expected, Tolerance * 10.0f)) << "Point " << i;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, TransformVectors_IgnoresTranslation)
+    {
+        const Transform transform = RandomTransform();
+        const Matrix3x4 matrix = Matrix3x4::CreateFromTransform(transform);
+        SoaData<3> vectors = CreateRandomVectors(-10.0f, 10.0f);
+        SoaData<3> transformOutput(Count);
+        SoaData<3> matrixOutput(Count);
+
+        Simd::Batch::TransformVectors(transform, GetVec3Array(vectors), GetVec3Array(transformOutput), Count);
+        Simd::Batch::TransformVectors(matrix, GetVec3Array(vectors), GetVec3Array(matrixOutput), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Vector3 vector = LoadVector3(vectors, i);
+            EXPECT_TRUE(LoadVector3(transformOutput, i).IsClose(transform.TransformVector(vector), Tolerance * 10.0f)) << "Vector " << i;
+            EXPECT_TRUE(LoadVector3(matrixOutput, i).IsClose(matrix.TransformVector(vector), Tolerance * 10.0f)) << "Vector " << i;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, TransformNormals_Transform_RotatesAndNormalizes)
+    {
+        const Transform transform = RandomTransform();
+        SoaData<3> normals = CreateRandomVectors(-1.0f, 1.0f);
+        SoaData<3> output(Count);
+
+        Simd::Batch::TransformNormals(transform, GetVec3Array(normals), GetVec3Array(output), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Vector3 expected = transform.GetRotation().TransformVector(LoadVector3(normals, i)).GetNormalized();
+            EXPECT_TRUE(LoadVector3(output, i).IsClose(expected, Tolerance)) << "Normal " << i;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, TransformNormals_NonUniformScale_NormalsStayPerpendicular)
+    {
+        Matrix3x4 matrix = Matrix3x4::CreateFromTransform(RandomTransform());
+        matrix.MultiplyByScale(Vector3(0.5f, 2.0f, 4.0f));
+
+        // Build normals together with a tangent of their surface and check they're still perpendicular afterwards.
+        SoaData<3> normals(Count);
+        SoaData<3> tangents(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Vector3 normal = RandomVector3(-1.0f, 1.0f).GetNormalized();
+            StoreVector3(normals, i, normal);
+            StoreVector3(tangents, i, normal.GetOrthogonalVector());
+        }
+        SoaData<3> output(Count);
+
+        Simd::Batch::TransformNormals(matrix, GetVec3Array(normals), GetVec3Array(output), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Vector3 normal = LoadVector3(output, i);
+            const Vector3 tangent = matrix.TransformVector(LoadVector3(tangents, i));
+            EXPECT_NEAR(normal.GetLength(), 1.0f, Tolerance) << "Normal " << i;
+            EXPECT_NEAR(normal.Dot(tangent.GetNormalized()), 0.0f, Tolerance) << "Normal " << i;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, MultiplyTransforms_MatchesTransformMultiply)
+    {
+        SoaData<8> lhs(Count);
+        SoaData<8> rhs(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            StoreTransform(lhs, i, RandomTransform());
+            StoreTransform(rhs, i, RandomTransform());
+        }
+        SoaData<8> output(Count);
+
+        Simd::Batch::MultiplyTransforms(GetTransformArray(lhs), GetTransformArray(rhs), GetTransformArray(output), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Transform expected = LoadTransform(lhs, i) * LoadTransform(rhs, i);
+            EXPECT_TRUE(LoadTransform(output, i).IsClose(expected, Tolerance * 10.0f)) << "Transform " << i;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, Overlaps_Frustum_MatchesShapeIntersection)
+    {
+        const Frustum frustum(ViewFrustumAttributes(Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
+
+        SoaData<3> minimums(Count);
+        SoaData<3> maximums(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Vector3 min = RandomVector3(-60.0f, 60.0f) + Vector3(0.0f, 50.0f, 0.0f);
+            StoreVector3(minimums, i, min);
+            StoreVector3(maximums, i, min + RandomVector3(0.0f, 10.0f));
+        }
+        bool output[Count];
+
+        Simd::Batch::ConstAabbArray aabbs;
+        aabbs.m_min = GetVec3Array(minimums);
+        aabbs.m_max = GetVec3Array(maximums);
+        Simd::Batch::Overlaps(frustum, aabbs, output, Count);
+
+        size_t overlapCount = 0;
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Aabb aabb = Aabb::CreateFromMinMax(LoadVector3(minimums, i), LoadVector3(maximums, i));
+            EXPECT_EQ(output[i], ShapeIntersection::Overlaps(frustum, aabb)) << "Aabb " << i;
+            overlapCount += output[i] ? 1 : 0;
+        }
+        // Make sure both results are covered.
+        EXPECT_GT(overlapCount, 0);
+        EXPECT_LT(overlapCount, Count);
+    }
+
+    TEST_P(MATH_SimdMathBatch, Slerp_MatchesQuaternionSlerp)
+    {
+        SoaData<4> from(Count);
+        SoaData<4> to(Count);
+        std::vector<float> t(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Quaternion quaternion = RandomQuaternion();
+            StoreQuaternion(from, i, quaternion);
+            // Include quaternions that are equal and in opposite hemispheres to cover the linear fallback and the
+            // shortest path handling.
+            switch (i % 4)
+            {
+            case 0:
+                StoreQuaternion(to, i, quaternion);
+                break;
+            case 1:
+                StoreQuaternion(to, i, -quaternion);
+                break;
+            default:
+                StoreQuaternion(to, i, RandomQuaternion());
+                break;
+            }
+            t[i] = Random(0.0f, 1.0f);
+        }
+        SoaData<4> output(Count);
+        SoaData<4> constantOutput(Count);
+
+        Simd::Batch::Slerp(GetQuaternionArray(from), GetQuaternionArray(to), t.data(), GetQuaternionArray(output), Count);
+        Simd::Batch::Slerp(GetQuaternionArray(from), GetQuaternionArray(to), 0.25f, GetQuaternionArray(constantOutput), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Quaternion start = LoadQuaternion(from, i);
+            const Quaternion end = LoadQuaternion(to, i);
+            EXPECT_TRUE(LoadQuaternion(output, i).IsClose(start.Slerp(end, t[i]), Tolerance)) << "Quaternion " << i;
+            EXPECT_TRUE(LoadQuaternion(constantOutput, i).IsClose(start.Slerp(end, 0.25f), Tolerance)) << "Quaternion " << i;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, SkinPositionsAndNormals_MatchesBlendedMatrix)
+    {
+        constexpr size_t JointCount = 6;
+        constexpr size_t InfluenceCount = 4;
+        Matrix3x4 joints[JointCount];
+        for (Matrix3x4& joint : joints)
+        {
+            joint = Matrix3x4::CreateFromTransform(RandomTransform());
+        }
+
+        std::vector<uint32_t> jointIndices(InfluenceCount * Count);
+        std::vector<float> jointWeights(InfluenceCount * Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            float totalWeight = 0.0f;
+            for (size_t influence = 0; influence < InfluenceCount; ++influence)
+            {
+                jointIndices[influence * Count + i] = static_cast<uint32_t>(m_rng() % JointCount);
+                jointWeights[influence * Count + i] = Random(0.0f, 1.0f);
+                totalWeight += jointWeights[influence * Count + i];
+            }
+            for (size_t influence = 0; influence < InfluenceCount; ++influence)
+            {
+                jointWeights[influence * Count + i] /= totalWeight;
+            }
+        }
+        Simd::Batch::SkinInfluenceArray influences;
+        influences.m_jointIndices = jointIndices.data();
+        influences.m_jointWeights = jointWeights.data();
+        influences.m_influenceCount = InfluenceCount;
+
+        SoaData<3> positions = CreateRandomVectors(-10.0f, 10.0f);
+        SoaData<3> normals(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            StoreVector3(normals, i, RandomVector3(-1.0f, 1.0f).GetNormalized());
+        }
+        SoaData<3> outputPositions(Count);
+        SoaData<3> outputNormals(Count);
+        SoaData<3> positionsOnly(Count);
+
+        Simd::Batch::SkinPositionsAndNormals(joints, influences, GetVec3Array(positions), GetVec3Array(normals),
+            GetVec3Array(outputPositions), GetVec3Array(outputNormals), Count);
+        Simd::Batch::SkinPositions(joints, influences, GetVec3Array(positions), GetVec3Array(positionsOnly), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            Matrix3x4 blended = Matrix3x4::CreateZero();
+            for (size_t influence = 0; influence < InfluenceCount; ++influence)
+            {
+                blended += joints[jointIndices[influence * Count + i]] * jointWeights[influence * Count + i];
+            }
+            const Vector3 expectedPosition = blended * LoadVector3(positions, i);
+            const Vector3 expectedNormal = blended.TransformVector(LoadVector3(normals, i)).GetNormalized();
+            EXPECT_TRUE(LoadVector3(outputPositions, i).IsClose(expectedPosition, Tolerance * 10.0f)) << "Vertex " << i;
+            EXPECT_TRUE(LoadVector3(positionsOnly, i).IsClose(expectedPosition, Tolerance * 10.0f)) << "Vertex " << i;
+            EXPECT_TRUE(LoadVector3(outputNormals, i).IsClose(expectedNormal, Tolerance)) << "Vertex " << i;
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, PerlinNoise_MatchesScalarReference)
+    {
+        int32_t permutationTable[512];
+        std::iota(permutationTable, permutationTable + 256, 0);
+        std::shuffle(permutationTable, permutationTable + 256, m_rng);
+        std::copy(permutationTable, permutationTable + 256, permutationTable + 256);
+
+        // Negative coordinates and coordinates past the 256 cell period are both covered.
+        SoaData<3> positions = CreateRandomVectors(-300.0f, 300.0f);
+        // Noise is always 0.5 on the lattice points.
+        StoreVector3(positions, 0, Vector3(3.0f, -7.0f, 12.0f));
+        std::vector<float> output(Count);
+
+        Simd::Batch::PerlinNoise(permutationTable, GetVec3Array(positions), output.data(), Count);
+
+        EXPECT_NEAR(output[0], 0.5f, Tolerance);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const float expected = SimdMathBatchTestsDetails::PerlinNoise(permutationTable, positions[0][i], positions[1][i], positions[2][i]);
+            EXPECT_NEAR(output[i], expected, Tolerance) << "Position " << i;
+            EXPECT_GE(output[i], 0.0f);
+            EXPECT_LE(output[i], 1.0f);
+        }
+    }
+
+    TEST_P(MATH_SimdMathBatch, ZeroCount_DoesNothing)
+    {
+        const Transform transform = RandomTransform();
+        Simd::Batch::TransformPoints(transform, Simd::Batch::ConstVec3Array(), Simd::Batch::Vec3Array(), 0);
+        Simd::Batch::Overlaps(Frustum(), Simd::Batch::ConstAabbArray(), nullptr, 0);
+    }
+
+    TEST(MATH_SimdMathBatchInstructionSet, SetInstructionSet_ClampsToSupported)
+    {
+        const Simd::Batch::InstructionSet previous = Simd::Batch::GetInstructionSet();
+        const Simd::Batch::InstructionSet supported = Simd::Batch::GetSupportedInstructionSet();
+
+        EXPECT_EQ(Simd::Batch::SetInstructionSet(Simd::Batch::InstructionSet::Default), Simd::Batch::InstructionSet::Default);
+        EXPECT_EQ(Simd::Batch::GetInstructionSet(), Simd::Batch::InstructionSet::Default);
+        EXPECT_EQ(Simd::Batch::SetInstructionSet(Simd::Batch::InstructionSet::Avx512), supported);
+        EXPECT_EQ(Simd::Batch::GetInstructionSet(), supported);
+
+        Simd::Batch::SetInstructionSet(previous);
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        MATH_SimdMathBatch, MATH_SimdMathBatch,
+        ::testing::Values(Simd::Batch::InstructionSet::Default, Simd::Batch::InstructionSet::Avx2, Simd::Batch::InstructionSet::Avx512),
+        [](const ::testing::TestParamInfo<Simd::Batch::InstructionSet>& info) -> std::string
+        {
+            switch (info.param)
+            {
+            case Simd::Batch::InstructionSet::Avx2:
+                return "Avx2";
+            case Simd::Batch::InstructionSet::Avx512:
+                return "Avx512";
+            default:
+                return "Default";
+            }
+        });
+}
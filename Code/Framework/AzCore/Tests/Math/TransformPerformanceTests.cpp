@@ -12,8 +12,11 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdMathBatch.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+#include "SimdMathBatchBenchmarks.h"
+
 #include <random>
 #include <benchmark/benchmark.h>
 
@@ -50,6 +53,57 @@ namespace Benchmark
                 testData.index = distInt(rng) % 3;
                 return testData;
             });
+
+            // Structure of arrays copies of the test data for the batch kernels.
+            const size_t count = m_testDataArray.size();
+            for (size_t i = 0; i < 3; ++i)
+            {
+                m_v3Soa[i].resize(count);
+                m_v3ResultSoa[i].resize(count);
+            }
+            for (size_t i = 0; i < 8; ++i)
+            {
+                m_t1Soa[i].resize(count);
+                m_t2Soa[i].resize(count);
+                m_transformResultSoa[i].resize(count);
+            }
+            for (size_t index = 0; index < count; ++index)
+            {
+                const TestData& testData = m_testDataArray[index];
+                for (int i = 0; i < 3; ++i)
+                {
+                    m_v3Soa[i][index] = testData.v3.GetElement(i);
+                }
+                StoreTransform(testData.t1, m_t1Soa, index);
+                StoreTransform(testData.t2, m_t2Soa, index);
+            }
+        }
+
+        static void StoreTransform(const AZ::Transform& transform, std::vector<float> (&soa)[8], size_t index)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                soa[i][index] = transform.GetRotation().GetElement(i);
+            }
+            soa[4][index] = transform.GetUniformScale();
+            for (int i = 0; i < 3; ++i)
+            {
+                soa[5 + i][index] = transform.GetTranslation().GetElement(i);
+            }
+        }
+
+        static AZ::Simd::Batch::Vec3Array GetVec3Array(std::vector<float> (&soa)[3])
+        {
+            return AZ::Simd::Batch::Vec3Array{ soa[0].data(), soa[1].data(), soa[2].data() };
+        }
+
+        static AZ::Simd::Batch::TransformArray GetTransformArray(std::vector<float> (&soa)[8])
+        {
+            AZ::Simd::Batch::TransformArray result;
+            result.m_rotation = AZ::Simd::Batch::QuaternionArray{ soa[0].data(), soa[1].data(), soa[2].data(), soa[3].data() };
+            result.m_scale = soa[4].data();
+            result.m_translation = AZ::Simd::Batch::Vec3Array{ soa[5].data(), soa[6].data(), soa[7].data() };
+            return result;
         }
 
         struct TestData
@@ -66,6 +120,11 @@ namespace Benchmark
         };
 
         std::vector<TestData> m_testDataArray;
+        std::vector<float> m_v3Soa[3];
+        std::vector<float> m_v3ResultSoa[3];
+        std::vector<float> m_t1Soa[8];
+        std::vector<float> m_t2Soa[8];
+        std::vector<float> m_transformResultSoa[8];
     };
 
     BENCHMARK_F(BM_MathTransform, CreateIdentity)(benchmark::State& state)
@@ -403,6 +462,19 @@ namespace Benchmark
         }
     }
 
+    BENCHMARK_DEFINE_F(BM_MathTransform, BatchMultiplyTransform)(benchmark::State& state)
+    {
+        ScopedBatchInstructionSet instructionSet(state);
+        for (auto _ : state)
+        {
+            AZ::Simd::Batch::MultiplyTransforms(GetTransformArray(m_t1Soa), GetTransformArray(m_t2Soa),
+                GetTransformArray(m_transformResultSoa), m_testDataArray.size());
+            benchmark::DoNotOptimize(m_transformResultSoa[0].data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BM_MathTransform, BatchMultiplyTransform)->Apply(BatchInstructionSetArguments);
+
     BENCHMARK_F(BM_MathTransform, TransformPointVector3)(benchmark::State& state)
     {
         for (auto _ : state)
@@ -415,6 +487,19 @@ namespace Benchmark
         }
     }
 
+    BENCHMARK_DEFINE_F(BM_MathTransform, BatchTransformPointVector3)(benchmark::State& state)
+    {
+        ScopedBatchInstructionSet instructionSet(state);
+        const AZ::Transform& transform = m_testDataArray.front().t1;
+        for (auto _ : state)
+        {
+            AZ::Simd::Batch::TransformPoints(transform, GetVec3Array(m_v3Soa), GetVec3Array(m_v3ResultSoa), m_testDataArray.size());
+            benchmark::DoNotOptimize(m_v3ResultSoa[0].data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BM_MathTransform, BatchTransformPointVector3)->Apply(BatchInstructionSetArguments);
+
     BENCHMARK_F(BM_MathTransform, TransformPointVector4)(benchmark::State& state)
     {
         for (auto _ : state)
@@ -439,6 +524,19 @@ namespace Benchmark
         }
     }
 
+    BENCHMARK_DEFINE_F(BM_MathTransform, BatchTransformVector)(benchmark::State& state)
+    {
+        ScopedBatchInstructionSet instructionSet(state);
+        const AZ::Transform& transform = m_testDataArray.front().t1;
+        for (auto _ : state)
+        {
+            AZ::Simd::Batch::TransformVectors(transform, GetVec3Array(m_v3Soa), GetVec3Array(m_v3ResultSoa), m_testDataArray.size());
+            benchmark::DoNotOptimize(m_v3ResultSoa[0].data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BM_MathTransform, BatchTransformVector)->Apply(BatchInstructionSetArguments);
+
     BENCHMARK_F(BM_MathTransform, GetInverse)(benchmark::State& state)
     {
         for (auto _ : state)
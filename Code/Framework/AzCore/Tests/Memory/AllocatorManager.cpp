@@ -6,10 +6,14 @@
  *
  */
 
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Memory/AllocatorOverrideShim.h>
 #include <AzCore/Memory/MallocSchema.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzTest/Utils.h>
 
 using namespace AZ;
 
@@ -176,4 +180,137 @@ namespace UnitTest
         RunTests();
     }
 
+    class AllocationSamplerTests
+        : public AllocatorsTestFixture
+    {
+    public:
+        void TearDown() override
+        {
+            AllocatorManager::Instance().SetAllocationSamplingInterval(0);
+            AllocatorManager::Instance().GetAllocationSampler()->Reset();
+            AllocatorsTestFixture::TearDown();
+        }
+
+        static double GetEstimatedLiveBytes(const IAllocator* allocator)
+        {
+            double liveBytes = 0.0;
+            AllocatorManager::Instance().GetAllocationSampler()->EnumerateCallSites([&liveBytes](const Debug::AllocationSampler::CallSite& callSite)
+            {
+                liveBytes += callSite.m_estimatedLiveBytes;
+                return true;
+            }, allocator);
+            return liveBytes;
+        }
+
+        static AZ::u64 GetLiveSampleBytes(const IAllocator* allocator)
+        {
+            AZ::u64 liveSampleBytes = 0;
+            AllocatorManager::Instance().GetAllocationSampler()->EnumerateCallSites([&liveSampleBytes](const Debug::AllocationSampler::CallSite& callSite)
+            {
+                liveSampleBytes += callSite.m_liveSampleBytes;
+                return true;
+            }, allocator);
+            return liveSampleBytes;
+        }
+    };
+
+    TEST_F(AllocationSamplerTests, SampledAllocations_EstimateLiveHeap)
+    {
+        constexpr size_t AllocationSize = 256;
+        constexpr size_t NumAllocations = 16 * 1024;
+        AllocatorManager::Instance().SetAllocationSamplingInterval(16 * 1024);
+        Debug::AllocationSampler* sampler = AllocatorManager::Instance().GetAllocationSampler();
+        ASSERT_NE(nullptr, sampler);
+        sampler->Reset();
+
+        IAllocator* systemAllocator = &AllocatorInstance<SystemAllocator>::GetAllocator();
+        AZStd::vector<void*> allocations;
+        allocations.reserve(NumAllocations);
+        for (size_t i = 0; i < NumAllocations; ++i)
+        {
+            allocations.push_back(azmalloc(AllocationSize));
+        }
+
+        // 4MB allocated with one sample every 16KB on average, the estimate is well within a factor of two.
+        const double liveBytes = GetEstimatedLiveBytes(systemAllocator);
+        EXPECT_GT(liveBytes, 0.5 * AllocationSize * NumAllocations);
+        EXPECT_LT(liveBytes, 2.0 * AllocationSize * NumAllocations);
+
+        for (void* allocation : allocations)
+        {
+            azfree(allocation);
+        }
+        EXPECT_EQ(0, GetLiveSampleBytes(systemAllocator));
+        EXPECT_NEAR(0.0, GetEstimatedLiveBytes(systemAllocator), 1.0);
+
+        // Allocations since sampling started are still reported.
+        bool hasAllocationSamples = false;
+        sampler->EnumerateCallSites([&hasAllocationSamples](const Debug::AllocationSampler::CallSite& callSite)
+        {
+            hasAllocationSamples = callSite.m_numAllocationSamples > 0;
+            return !hasAllocationSamples;
+        }, systemAllocator);
+        EXPECT_TRUE(hasAllocationSamples);
+    }
+
+    TEST_F(AllocationSamplerTests, SamplingDisabled_RecordsNothing)
+    {
+        AllocatorManager::Instance().SetAllocationSamplingInterval(1);
+        AllocatorManager::Instance().SetAllocationSamplingInterval(0);
+        Debug::AllocationSampler* sampler = AllocatorManager::Instance().GetAllocationSampler();
+        ASSERT_NE(nullptr, sampler);
+        sampler->Reset();
+
+        void* allocation = azmalloc(1024 * 1024);
+        azfree(allocation);
+
+        size_t numCallSites = 0;
+        sampler->EnumerateCallSites([&numCallSites](const Debug::AllocationSampler::CallSite&)
+        {
+            ++numCallSites;
+            return true;
+        });
+        EXPECT_EQ(0, numCallSites);
+    }
+
+    TEST_F(AllocationSamplerTests, RemoveAllocator_DiscardsItsSamples)
+    {
+        AllocatorManager::Instance().SetAllocationSamplingInterval(1024);
+        Debug::AllocationSampler* sampler = AllocatorManager::Instance().GetAllocationSampler();
+        sampler->Reset();
+
+        IAllocator* systemAllocator = &AllocatorInstance<SystemAllocator>::GetAllocator();
+        // Reset redraws this thread's sample distance from a mean of 1KB, it's always far below 1MB.
+        void* allocation = azmalloc(1024 * 1024);
+        EXPECT_GT(GetLiveSampleBytes(systemAllocator), 0);
+
+        // Call sites of an unregistered allocator would reference a destroyed allocator.
+        sampler->RemoveAllocator(systemAllocator);
+        size_t numCallSites = 0;
+        sampler->EnumerateCallSites([&numCallSites](const Debug::AllocationSampler::CallSite&)
+        {
+            ++numCallSites;
+            return true;
+        }, systemAllocator);
+        EXPECT_EQ(0, numCallSites);
+
+        // Freeing memory whose sample was discarded is fine.
+        azfree(allocation);
+        EXPECT_EQ(0, GetLiveSampleBytes(systemAllocator));
+    }
+
+    TEST_F(AllocationSamplerTests, WriteHeapProfile_WritesPprofHeader)
+    {
+        AllocatorManager::Instance().SetAllocationSamplingInterval(1024);
+        void* allocation = azmalloc(64 * 1024);
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string filePath = tempDirectory.Resolve("heap.prof");
+        EXPECT_TRUE(AllocatorManager::Instance().GetAllocationSampler()->WriteHeapProfile(filePath.c_str()));
+        azfree(allocation);
+
+        char header[64] = {};
+        EXPECT_GT(AZ::IO::SystemFile::Read(filePath.c_str(), header, sizeof(header) - 1), 0);
+        EXPECT_EQ(0, strncmp(header, "heap profile:", strlen("heap profile:")));
+    }
 }
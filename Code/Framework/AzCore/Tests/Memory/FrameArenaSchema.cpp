@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        static constexpr size_t ChunkSize = 16 * 1024;
+
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            FrameArenaAllocator::Descriptor desc;
+            desc.m_chunkSize = ChunkSize;
+            desc.m_maxChunksPerThread = 4;
+            AllocatorInstance<FrameArenaAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<FrameArenaAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        FrameArenaAllocator& GetAllocator()
+        {
+            return static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator());
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_RespectsAlignmentAndSize)
+    {
+        static const AZStd::pair<size_t, size_t> sizeAndAlignments[] =
+        {
+            { 1, 1 },
+            { 16, 8 },
+            { 15, 1 },
+            { 100, 16 },
+            { 64, 64 },
+            { 1024, 128 },
+            { 3, 4 },
+        };
+
+        AZStd::vector<AZStd::pair<char*, size_t>> allocations;
+        for (const auto& sizeAndAlignment : sizeAndAlignments)
+        {
+            char* ptr = reinterpret_cast<char*>(GetAllocator().Allocate(sizeAndAlignment.first, sizeAndAlignment.second));
+            ASSERT_NE(nullptr, ptr);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(ptr) % sizeAndAlignment.second);
+            memset(ptr, static_cast<int>(allocations.size()), sizeAndAlignment.first);
+            allocations.emplace_back(ptr, sizeAndAlignment.first);
+        }
+        EXPECT_GE(GetAllocator().NumAllocatedBytes(), 1 + 16 + 15 + 100 + 64 + 1024 + 3);
+
+        // No allocation overlaps another one
+        for (size_t i = 0; i < allocations.size(); ++i)
+        {
+            for (size_t j = 0; j < allocations[i].second; ++j)
+            {
+                EXPECT_EQ(static_cast<char>(i), allocations[i].first[j]);
+            }
+            GetAllocator().DeAllocate(allocations[i].first, allocations[i].second);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ResetFrame_ReusesMemory)
+    {
+        void* firstFrame = GetAllocator().Allocate(256, 16);
+        void* firstFrameSecond = GetAllocator().Allocate(256, 16);
+        GetAllocator().DeAllocate(firstFrameSecond, 256);
+        GetAllocator().DeAllocate(firstFrame, 256);
+        const size_t capacity = GetAllocator().Capacity();
+        EXPECT_EQ(ChunkSize, capacity);
+
+        const AZ::u32 frameIndex = GetAllocator().GetFrameIndex();
+        GetAllocator().ResetFrame();
+        EXPECT_EQ(frameIndex + 1, GetAllocator().GetFrameIndex());
+
+        void* secondFrame = GetAllocator().Allocate(256, 16);
+        EXPECT_EQ(firstFrame, secondFrame);
+        EXPECT_EQ(capacity, GetAllocator().Capacity());
+        GetAllocator().DeAllocate(secondFrame, 256);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ResetFrame_ReusesChunksOfPreviousFrames)
+    {
+        constexpr size_t AllocationSize = 1024;
+        constexpr size_t NumAllocations = 3 * ChunkSize / AllocationSize;
+
+        size_t firstFrameCapacity = 0;
+        for (int frame = 0; frame < 4; ++frame)
+        {
+            AZStd::vector<void*> allocations;
+            for (size_t i = 0; i < NumAllocations; ++i)
+            {
+                allocations.push_back(GetAllocator().Allocate(AllocationSize, 8));
+                ASSERT_NE(nullptr, allocations.back());
+            }
+            for (void* allocation : allocations)
+            {
+                GetAllocator().DeAllocate(allocation, AllocationSize);
+            }
+            GetAllocator().ResetFrame();
+
+            // The chunks allocated in the first frame are reused by the later frames
+            if (frame == 0)
+            {
+                firstFrameCapacity = GetAllocator().Capacity();
+            }
+            EXPECT_EQ(firstFrameCapacity, GetAllocator().Capacity());
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_LargeOrOverBudget_FallsBack)
+    {
+        // Too large for a chunk
+        const size_t largeSize = 4 * ChunkSize;
+        char* large = reinterpret_cast<char*>(GetAllocator().Allocate(largeSize, 16));
+        ASSERT_NE(nullptr, large);
+        memset(large, 0xab, largeSize);
+        EXPECT_EQ(0, GetAllocator().Capacity());
+        EXPECT_GE(GetAllocator().NumAllocatedBytes(), largeSize);
+
+        // More than the thread's chunk budget
+        AZStd::vector<void*> allocations;
+        for (size_t i = 0; i < 8 * ChunkSize / 1024; ++i)
+        {
+            allocations.push_back(GetAllocator().Allocate(1024, 8));
+            ASSERT_NE(nullptr, allocations.back());
+        }
+        EXPECT_EQ(4 * ChunkSize, GetAllocator().Capacity());
+
+        for (void* allocation : allocations)
+        {
+            GetAllocator().DeAllocate(allocation, 1024);
+        }
+        GetAllocator().DeAllocate(large, largeSize);
+        GetAllocator().ResetFrame();
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ResizeAndDeAllocate_MostRecentAllocation_InPlace)
+    {
+        void* first = GetAllocator().Allocate(64, 8);
+        void* second = GetAllocator().Allocate(64, 8);
+
+        // Only the most recent allocation can grow
+        EXPECT_EQ(0, GetAllocator().Resize(first, 128));
+        EXPECT_EQ(128, GetAllocator().Resize(second, 128));
+        EXPECT_EQ(128, GetAllocator().AllocationSize(second));
+
+        // Deallocating the most recent allocation gives the memory back
+        GetAllocator().DeAllocate(second, 128);
+        void* third = GetAllocator().Allocate(64, 8);
+        EXPECT_EQ(second, third);
+
+        GetAllocator().DeAllocate(third, 64);
+        GetAllocator().DeAllocate(first, 64);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, StdAllocator_WorksWithContainers)
+    {
+        {
+            AZStd::vector<int, FrameArenaStdAllocator> values;
+            for (int i = 0; i < 10000; ++i)
+            {
+                values.push_back(i);
+            }
+            for (int i = 0; i < 10000; ++i)
+            {
+                EXPECT_EQ(i, values[i]);
+            }
+        }
+        GetAllocator().ResetFrame();
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_FromMultipleThreads_UsesSeparateChunks)
+    {
+        constexpr size_t NumThreads = 4;
+        constexpr size_t NumAllocations = 1000;
+        AZStd::atomic_int numFailures{ 0 };
+
+        auto threadFunction = [this, &numFailures](char value)
+        {
+            for (int repeat = 0; repeat < 3; ++repeat)
+            {
+                AZStd::vector<char*> allocations;
+                for (size_t i = 0; i < NumAllocations; ++i)
+                {
+                    char* ptr = reinterpret_cast<char*>(GetAllocator().Allocate(32, 8));
+                    memset(ptr, value, 32);
+                    allocations.push_back(ptr);
+                }
+                for (char* ptr : allocations)
+                {
+                    for (size_t i = 0; i < 32; ++i)
+                    {
+                        if (ptr[i] != value)
+                        {
+                            ++numFailures;
+                        }
+                    }
+                    GetAllocator().DeAllocate(ptr, 32);
+                }
+            }
+        };
+
+        AZStd::thread threads[NumThreads];
+        for (size_t i = 0; i < NumThreads; ++i)
+        {
+            threads[i] = AZStd::thread(AZStd::bind(threadFunction, static_cast<char>(i + 1)));
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, numFailures.load());
+        EXPECT_GE(GetAllocator().Capacity(), NumThreads * ChunkSize);
+        GetAllocator().ResetFrame();
+    }
+
+#if defined(AZ_DEBUG_BUILD)
+    TEST_F(FrameArenaAllocatorTest, DeAllocate_Overrun_Asserts)
+    {
+        char* ptr = reinterpret_cast<char*>(GetAllocator().Allocate(16, 8));
+        ptr[16] = 0;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        GetAllocator().DeAllocate(ptr, 16);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, DeAllocate_Twice_Asserts)
+    {
+        void* first = GetAllocator().Allocate(16, 8);
+        void* second = GetAllocator().Allocate(16, 8);
+        GetAllocator().DeAllocate(first, 16);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        GetAllocator().DeAllocate(first, 16);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        GetAllocator().DeAllocate(second, 16);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, DeAllocate_AfterResetFrame_DoesNotCountAsLive)
+    {
+        class WarningCounter
+            : public AZ::Debug::TraceMessageBus::Handler
+        {
+        public:
+            WarningCounter() { BusConnect(); }
+            ~WarningCounter() override { BusDisconnect(); }
+
+            bool OnPreWarning(const char* window, const char*, int, const char*, const char*) override
+            {
+                if (azstricmp(window, "FrameArenaSchema") == 0)
+                {
+                    ++m_numWarnings;
+                    return true;
+                }
+                return false;
+            }
+
+            int m_numWarnings = 0;
+        };
+
+        WarningCounter warningCounter;
+        void* arenaAllocation = GetAllocator().Allocate(16, 8);
+        void* fallbackAllocation = GetAllocator().Allocate(ChunkSize, 8);
+        GetAllocator().ResetFrame();
+        EXPECT_EQ(1, warningCounter.m_numWarnings);
+
+        // Frees of a previous frame's memory were already reported, they must not be taken off the current frame.
+        // The fallback block was released with its frame, so it must also be recognized without reading its memory.
+        void* currentFallbackAllocation = GetAllocator().Allocate(ChunkSize, 8);
+        GetAllocator().DeAllocate(arenaAllocation, 16);
+        GetAllocator().DeAllocate(fallbackAllocation, ChunkSize);
+        void* allocation = GetAllocator().Allocate(16, 8);
+        GetAllocator().DeAllocate(allocation, 16);
+        GetAllocator().DeAllocate(currentFallbackAllocation, ChunkSize);
+        GetAllocator().ResetFrame();
+        EXPECT_EQ(1, warningCounter.m_numWarnings);
+    }
+#endif // AZ_DEBUG_BUILD
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Allocates and releases a frame worth of small scratch allocations, as a culling or replication pass would.
+    class FrameArenaBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t AllocationsPerFrame = 1024;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        template<class Allocator>
+        static void RunFrame(size_t frame)
+        {
+            void* allocations[AllocationsPerFrame];
+            for (size_t i = 0; i < AllocationsPerFrame; ++i)
+            {
+                allocations[i] = AZ::AllocatorInstance<Allocator>::Get().Allocate(16 + ((i + frame) % 16) * 16, 16);
+            }
+            benchmark::DoNotOptimize(allocations);
+            for (size_t i = 0; i < AllocationsPerFrame; ++i)
+            {
+                AZ::AllocatorInstance<Allocator>::Get().DeAllocate(allocations[i]);
+            }
+        }
+    };
+
+    BENCHMARK_F(FrameArenaBenchmarkFixture, SystemAllocatorFrame)(benchmark::State& state)
+    {
+        size_t frame = 0;
+        for (auto _ : state)
+        {
+            RunFrame<AZ::SystemAllocator>(frame++);
+        }
+        state.SetItemsProcessed(state.iterations() * AllocationsPerFrame);
+    }
+
+    BENCHMARK_F(FrameArenaBenchmarkFixture, FrameArenaAllocatorFrame)(benchmark::State& state)
+    {
+        size_t frame = 0;
+        for (auto _ : state)
+        {
+            RunFrame<AZ::FrameArenaAllocator>(frame++);
+            static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator()).ResetFrame();
+        }
+        state.SetItemsProcessed(state.iterations() * AllocationsPerFrame);
+    }
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -48,14 +48,20 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        //! Returns a copy of the entries from all of the dictionary's shards
+        static AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> GetDictionary()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> dictionary;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                dictionary.insert(shard.m_dictionary.begin(), shard.m_dictionary.end());
+            }
+            return dictionary;
         }
         
         static size_t GetEntryCount()
         {
-            return GetDictionary().size();
+            return AZ::NameDictionary::Instance().GetEntryCount();
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -268,9 +274,9 @@ namespace UnitTest
         EXPECT_EQ(NameDictionaryTester::GetEntryCount(), localDictionary.size());
 
         // Make sure all entries in the localDictionary got copied into the globalDictionary
+        const auto globalDictionary = NameDictionaryTester::GetDictionary();
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
             auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
                 return entry.second->GetName() == nameString;
             });
@@ -833,3 +839,102 @@ namespace UnitTest
     }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Measures MakeName/release throughput of the NameDictionary with multiple threads.
+    //! Only thread 0 sets up and tears down the environment; the other threads don't enter the
+    //! timing loop until setup is complete.
+    class NameDictionaryBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t NamesPerThread = 1024;
+        static constexpr int MaxThreads = 32;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                AZ::NameDictionary::Create();
+
+                m_nameStrings = AZStd::make_unique<AZStd::vector<AZStd::string>>();
+                m_nameStrings->reserve(NamesPerThread * MaxThreads);
+                for (size_t i = 0; i < NamesPerThread * MaxThreads; ++i)
+                {
+                    m_nameStrings->push_back(AZStd::string::format("BenchmarkName_%zu", i));
+                }
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                m_existingNames.reset();
+                m_nameStrings.reset();
+                AZ::NameDictionary::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+        }
+
+    protected:
+        void KeepNamesAlive()
+        {
+            m_existingNames = AZStd::make_unique<AZStd::vector<AZ::Name>>();
+            m_existingNames->reserve(m_nameStrings->size());
+            for (const AZStd::string& nameString : *m_nameStrings)
+            {
+                m_existingNames->push_back(AZ::Name(nameString));
+            }
+        }
+
+        // Each thread works on its own range of strings so the benchmarks measure contention on the
+        // dictionary itself rather than on shared NameData reference counts.
+        AZStd::string_view GetNameString(const ::benchmark::State& state, size_t index) const
+        {
+            return (*m_nameStrings)[state.thread_index * NamesPerThread + (index % NamesPerThread)];
+        }
+
+        AZStd::unique_ptr<AZStd::vector<AZStd::string>> m_nameStrings;
+        AZStd::unique_ptr<AZStd::vector<AZ::Name>> m_existingNames;
+    };
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeExistingName)(::benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            KeepNamesAlive();
+        }
+
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            AZ::Name name(GetNameString(state, index++));
+            benchmark::DoNotOptimize(name.GetHash());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeExistingName)
+        ->ThreadRange(1, NameDictionaryBenchmarkFixture::MaxThreads)
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeAndReleaseName)(::benchmark::State& state)
+    {
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            // The name isn't referenced anywhere else, so every iteration adds and then removes a dictionary entry
+            AZ::Name name(GetNameString(state, index++));
+            benchmark::DoNotOptimize(name.GetHash());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeAndReleaseName)
+        ->ThreadRange(1, NameDictionaryBenchmarkFixture::MaxThreads)
+        ->UseRealTime();
+}
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/Component/ParallelTickScheduler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    static const AZ::Crc32 PhysicsGroup = AZ_CRC_CE("ParallelTickTest_Physics");
+    static const AZ::Crc32 AnimationGroup = AZ_CRC_CE("ParallelTickTest_Animation");
+    static const AZ::Crc32 AudioGroup = AZ_CRC_CE("ParallelTickTest_Audio");
+    static const ComponentServiceType TransformService = AZ_CRC_CE("ParallelTickTest_TransformService");
+
+    // ParallelTickBus handler that runs a callback when ticked.
+    struct ParallelTicker
+        : public ParallelTickBus::Handler
+    {
+        ParallelTicker(AZ::Crc32 group, AZStd::function<void()> callback)
+            : m_group(group)
+            , m_callback(AZStd::move(callback))
+        {
+            BusConnect();
+        }
+        ~ParallelTicker() override
+        {
+            BusDisconnect();
+        }
+
+        void OnParallelTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+        {
+            m_callback();
+        }
+        AZ::Crc32 GetTickGroup() override { return m_group; }
+
+        AZ::Crc32 m_group;
+        AZStd::function<void()> m_callback;
+    };
+
+    class ParallelTickBusTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+            m_scheduler = AZStd::make_unique<ParallelTickScheduler>();
+        }
+
+        void TearDown() override
+        {
+            StopJobManager();
+            m_scheduler.reset();
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+
+        void StartJobManager(unsigned int numWorkerThreads)
+        {
+            JobManagerDesc desc;
+            for (unsigned int i = 0; i < numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext);
+        }
+
+        void StopJobManager()
+        {
+            if (m_jobManager)
+            {
+                JobContext::SetGlobalContext(nullptr);
+                delete m_jobContext;
+                delete m_jobManager;
+                m_jobContext = nullptr;
+                m_jobManager = nullptr;
+            }
+        }
+
+        void RegisterGroup(AZ::Crc32 id, const char* name, int order, AZStd::vector<ComponentServiceType> reads, AZStd::vector<ComponentServiceType> writes)
+        {
+            ParallelTickGroupDescriptor group;
+            group.m_id = id;
+            group.m_name = name;
+            group.m_order = order;
+            group.m_reads = AZStd::move(reads);
+            group.m_writes = AZStd::move(writes);
+            ParallelTickRequestBus::Broadcast(&ParallelTickRequests::RegisterTickGroup, group);
+        }
+
+        void Tick()
+        {
+            m_scheduler->Tick(0.0f, ScriptTimePoint());
+        }
+
+    protected:
+        AZStd::unique_ptr<ParallelTickScheduler> m_scheduler;
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+    };
+
+    TEST_F(ParallelTickBusTest, Tick_WithoutJobManager_DependentGroupsTickInOrder)
+    {
+        RegisterGroup(AnimationGroup, "Animation", TICK_ANIMATION, { TransformService }, {});
+        RegisterGroup(PhysicsGroup, "Physics", TICK_PHYSICS, {}, { TransformService });
+
+        AZStd::vector<AZ::Crc32> tickedGroups;
+        ParallelTicker physics(PhysicsGroup, [&tickedGroups]() { tickedGroups.push_back(PhysicsGroup); });
+        ParallelTicker animation(AnimationGroup, [&tickedGroups]() { tickedGroups.push_back(AnimationGroup); });
+        ParallelTicker unregistered(AZ_CRC_CE("ParallelTickTest_Unregistered"), [&tickedGroups]() { tickedGroups.push_back(AZ::Crc32()); });
+
+        Tick();
+
+        // Unregistered groups tick in the default group, at TICK_DEFAULT
+        ASSERT_EQ(3, tickedGroups.size());
+        EXPECT_EQ(AnimationGroup, tickedGroups[0]);
+        EXPECT_EQ(PhysicsGroup, tickedGroups[1]);
+        EXPECT_EQ(AZ::Crc32(), tickedGroups[2]);
+    }
+
+    TEST_F(ParallelTickBusTest, Tick_IndependentGroups_TickAtTheSameTime)
+    {
+        StartJobManager(2);
+        RegisterGroup(PhysicsGroup, "Physics", TICK_PHYSICS, {}, { TransformService });
+        RegisterGroup(AudioGroup, "Audio", TICK_PHYSICS, {}, {});
+
+        // Each handler waits for the other one to start, which only succeeds if both groups run at the same time
+        AZStd::atomic_bool physicsStarted{ false };
+        AZStd::atomic_bool audioStarted{ false };
+        auto waitFor = [](const AZStd::atomic_bool& started)
+        {
+            const auto timeout = AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(5);
+            while (!started && AZStd::chrono::system_clock::now() < timeout)
+            {
+                AZStd::this_thread::yield();
+            }
+            return started.load();
+        };
+        bool physicsSawAudio = false;
+        bool audioSawPhysics = false;
+        ParallelTicker physics(PhysicsGroup, [&]() { physicsStarted = true; physicsSawAudio = waitFor(audioStarted); });
+        ParallelTicker audio(AudioGroup, [&]() { audioStarted = true; audioSawPhysics = waitFor(physicsStarted); });
+
+        Tick();
+
+        EXPECT_TRUE(physicsSawAudio);
+        EXPECT_TRUE(audioSawPhysics);
+    }
+
+    TEST_F(ParallelTickBusTest, Tick_DependentGroups_KeepOrderOnJobManager)
+    {
+        StartJobManager(4);
+        RegisterGroup(PhysicsGroup, "Physics", TICK_PHYSICS, {}, { TransformService });
+        RegisterGroup(AnimationGroup, "Animation", TICK_ANIMATION, {}, { TransformService });
+        RegisterGroup(AudioGroup, "Audio", TICK_UI, { TransformService }, {});
+
+        AZStd::atomic_int order{ 0 };
+        int physicsOrder = -1;
+        int animationOrder = -1;
+        int audioOrder = -1;
+        ParallelTicker audio(AudioGroup, [&]() { audioOrder = order++; });
+        ParallelTicker physics(PhysicsGroup, [&]() { physicsOrder = order++; });
+        ParallelTicker animation(AnimationGroup, [&]() { animationOrder = order++; });
+
+        for (int frame = 0; frame < 100; ++frame)
+        {
+            order = 0;
+            Tick();
+            EXPECT_EQ(0, animationOrder);
+            EXPECT_EQ(1, physicsOrder);
+            EXPECT_EQ(2, audioOrder);
+        }
+    }
+
+    TEST_F(ParallelTickBusTest, UnregisterTickGroup_HandlersMoveToDefaultGroup)
+    {
+        StartJobManager(2);
+        RegisterGroup(PhysicsGroup, "Physics", TICK_PHYSICS, {}, { TransformService });
+
+        int physicsTicks = 0;
+        ParallelTicker physics(PhysicsGroup, [&physicsTicks]() { ++physicsTicks; });
+
+        Tick();
+        ParallelTickRequestBus::Broadcast(&ParallelTickRequests::UnregisterTickGroup, PhysicsGroup);
+        Tick();
+        EXPECT_EQ(2, physicsTicks);
+    }
+} // namespace UnitTest
@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDriveUring_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::s32 TestOverCommit = 0;
+
+    //
+    // StorageDriveLinuxUring Tests
+    //
+
+    //! The tests run with both direct and buffered reads. File systems that don't support O_DIRECT, such as tmpfs, fall back
+    //! to buffered reads, in which case both variations test the buffered path.
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "DummyUring.bin";
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StorageDriveLinuxUring> m_storageDrive{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetUp() override
+        {
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+            m_context = new AZ::IO::StreamerContext();
+
+            // The kernel may not support io_uring or it may be blocked, in which case the tests have nothing to verify.
+            if (StorageDriveLinuxUring::IsAvailable())
+            {
+                m_storageDrive = CreateStorageDrive();
+                m_storageDrive->SetContext(*m_context);
+            }
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            AZ::IO::SystemFile::Delete(m_dummyFilepath.c_str());
+        }
+
+        AZStd::shared_ptr<StorageDriveLinuxUring> CreateStorageDrive()
+        {
+            StorageDriveLinuxUring::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_enableDirectReads = GetParam();
+            options.m_minimalReporting = true;
+
+            return AZStd::make_shared<StorageDriveLinuxUring>(TestMaxFileHandles, TestQueueDepth, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestOverCommit, options);
+        }
+
+        // Creates a file where every byte holds the lower 8 bits of its offset, plus one for every 256 bytes, so reads from
+        // the wrong offset can be detected.
+        void CreateDummyFile(size_t fileSize)
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+
+            AZStd::unique_ptr<u8[]> buffer(new u8[fileSize]);
+            for (size_t i = 0; i < fileSize; ++i)
+            {
+                buffer[i] = GetExpectedByte(i);
+            }
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        static u8 GetExpectedByte(u64 offset)
+        {
+            return aznumeric_cast<u8>((offset + (offset >> 8)) & 0xff);
+        }
+
+        static void VerifyData(const u8* buffer, u64 offset, u64 size)
+        {
+            for (u64 i = 0; i < size; ++i)
+            {
+                if (buffer[i] != GetExpectedByte(offset + i))
+                {
+                    ADD_FAILURE() << "Byte " << i << " of the read from offset " << offset << " doesn't match the file.";
+                    return;
+                }
+            }
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        double GetStatistic(const char* name) const
+        {
+            AZStd::vector<Statistic> statistics;
+            m_storageDrive->CollectStatistics(statistics);
+            for (const Statistic& statistic : statistics)
+            {
+                if (statistic.GetName() == name)
+                {
+                    return statistic.GetFloatValue();
+                }
+            }
+            return 0.0;
+        }
+
+        void ReadRanges(const IStreamerTypes::ReadRange* ranges, size_t numRanges, IStreamerTypes::RequestStatus expectedStatus)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateReadRanges(nullptr, m_dummyRequestPath, ranges, numRanges);
+            request->SetCompletionCallback([expectedStatus](const FileRequest& request)
+                {
+                    EXPECT_EQ(expectedStatus, request.GetStatus());
+                });
+            m_storageDrive->QueueRequest(request);
+            WaitTillCompleted();
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+
+            // Create the "TestFiles" dir in the bin directory if it doesn't exist...
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                if (!AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    return;
+                }
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_AlignedRead_ReturnsCorrectData)
+    {
+        if (!m_storageDrive)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 64_kib;
+        CreateDummyFile(fileSize);
+
+        u8* buffer = reinterpret_cast<u8*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, fileSize, m_dummyRequestPath, 0, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        VerifyData(buffer, 0, fileSize);
+        azfree(buffer);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedRead_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        if (!m_storageDrive)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 16_kib;
+        constexpr u64 unalignedOffset = 1001;
+        constexpr u64 unalignedSize = 3003;
+        constexpr u8 guardByte = 0xcd;
+        CreateDummyFile(fileSize);
+
+        // Offset the output by a byte so the address isn't aligned either.
+        AZStd::unique_ptr<u8[]> buffer(new u8[unalignedSize + 2]);
+        ::memset(buffer.get(), guardByte, unalignedSize + 2);
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get() + 1, unalignedSize, m_dummyRequestPath, unalignedOffset, unalignedSize);
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        EXPECT_EQ(guardByte, buffer[0]);
+        VerifyData(buffer.get() + 1, unalignedOffset, unalignedSize);
+        EXPECT_EQ(guardByte, buffer[unalignedSize + 1]);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_IsForwardedAndFails)
+    {
+        if (!m_storageDrive)
+        {
+            return;
+        }
+
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".missing");
+
+        u8 buffer[16];
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), path, 0, sizeof(buffer));
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadRangesRequest_NearbyRanges_CoalescedIntoSingleReadWithCorrectData)
+    {
+        if (!m_storageDrive)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 64_kib;
+        CreateDummyFile(fileSize);
+
+        // Adjacent ranges and ranges separated by small gaps, none of them aligned.
+        constexpr size_t numRanges = 4;
+        constexpr u64 offsets[numRanges] = { 100, 350, 1000, 9000 };
+        constexpr u64 sizes[numRanges] = { 250, 600, 4000, 777 };
+        AZStd::unique_ptr<u8[]> outputs[numRanges];
+        IStreamerTypes::ReadRange ranges[numRanges];
+        for (size_t i = 0; i < numRanges; ++i)
+        {
+            outputs[i].reset(new u8[sizes[i]]);
+            ranges[i] = IStreamerTypes::ReadRange{ outputs[i].get(), offsets[i], sizes[i] };
+        }
+
+        ReadRanges(ranges, numRanges, IStreamerTypes::RequestStatus::Completed);
+
+        for (size_t i = 0; i < numRanges; ++i)
+        {
+            VerifyData(outputs[i].get(), offsets[i], sizes[i]);
+        }
+        EXPECT_DOUBLE_EQ(aznumeric_cast<double>(numRanges), GetStatistic("Ranges per read (avg.)"));
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadRangesRequest_LargeGapsAndOverlaps_SplitIntoSeparateReadsWithCorrectData)
+    {
+        if (!m_storageDrive)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 256_kib;
+        CreateDummyFile(fileSize);
+
+        // The second range overlaps the first and the third range is too far away to be coalesced with the second, so
+        // every range becomes its own read.
+        constexpr size_t numRanges = 3;
+        constexpr u64 offsets[numRanges] = { 10, 20, 200000 };
+        constexpr u64 sizes[numRanges] = { 30, 5000, 1234 };
+        AZStd::unique_ptr<u8[]> outputs[numRanges];
+        IStreamerTypes::ReadRange ranges[numRanges];
+        for (size_t i = 0; i < numRanges; ++i)
+        {
+            outputs[i].reset(new u8[sizes[i]]);
+            ranges[i] = IStreamerTypes::ReadRange{ outputs[i].get(), offsets[i], sizes[i] };
+        }
+
+        ReadRanges(ranges, numRanges, IStreamerTypes::RequestStatus::Completed);
+
+        for (size_t i = 0; i < numRanges; ++i)
+        {
+            VerifyData(outputs[i].get(), offsets[i], sizes[i]);
+        }
+        EXPECT_DOUBLE_EQ(1.0, GetStatistic("Ranges per read (avg.)"));
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadRangesRequest_RangePastEndOfFile_ReportsFailure)
+    {
+        if (!m_storageDrive)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(fileSize);
+
+        u8 first[64];
+        u8 second[64];
+        IStreamerTypes::ReadRange ranges[] = {
+            IStreamerTypes::ReadRange{ first, 0, sizeof(first) },
+            IStreamerTypes::ReadRange{ second, fileSize - 32, sizeof(second) } };
+
+        ReadRanges(ranges, AZ_ARRAY_SIZE(ranges), IStreamerTypes::RequestStatus::Failed);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, CancelRequest_CancelParallelReadsUsingIStreamer_AllReadsFinishCompletedOrCanceled)
+    {
+        if (!m_storageDrive)
+        {
+            return;
+        }
+
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = 100;
+        CreateDummyFile(numChunks * chunkSize);
+
+        // Use a drive that hasn't been connected to the test context yet, so it registers its completion event with the
+        // context of the scheduler.
+        m_storageDrive = CreateStorageDrive();
+        auto streamer = AZStd::make_unique<Streamer>(AZStd::thread_desc{}, AZStd::make_unique<Scheduler>(m_storageDrive));
+
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+        AZStd::vector<FileRequestPtr> requests;
+        AZStd::vector<FileRequestPtr> cancels;
+        AZStd::binary_semaphore waitForReads;
+        AZStd::atomic_size_t numReadCallbacks = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            requests.push_back(streamer->Read(m_dummyRequestPath.GetRelativePath(), buffers[i].get(), chunkSize, chunkSize,
+                IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, i * chunkSize));
+            streamer->SetRequestCompleteCallback(requests[i], [&numReadCallbacks, &waitForReads, &streamer](FileRequestHandle request)
+                {
+                    auto status = streamer->GetRequestStatus(request);
+                    EXPECT_TRUE(status == IStreamerTypes::RequestStatus::Completed || status == IStreamerTypes::RequestStatus::Canceled);
+                    if (++numReadCallbacks == numChunks)
+                    {
+                        waitForReads.release();
+                    }
+                });
+            cancels.push_back(streamer->Cancel(requests[i]));
+        }
+
+        streamer->QueueRequestBatch(requests);
+        streamer->QueueRequestBatch(AZStd::move(cancels));
+
+        EXPECT_TRUE(waitForReads.try_acquire_for(AZStd::chrono::seconds(5)));
+        EXPECT_EQ(numChunks, numReadCallbacks);
+        streamer.reset();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, Destructor_ReadsInFlight_ReadsAreDrainedBeforeBuffersAreReleased)
+    {
+        if (!m_storageDrive)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 1_mib;
+        constexpr size_t numReads = TestQueueDepth;
+        CreateDummyFile(fileSize);
+
+        AZStd::unique_ptr<u8[]> buffers[numReads];
+        for (size_t i = 0; i < numReads; ++i)
+        {
+            buffers[i].reset(new u8[fileSize]);
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i].get(), fileSize, m_dummyRequestPath, 0, fileSize);
+            m_storageDrive->QueueRequest(request);
+        }
+        m_storageDrive->ExecuteRequests();
+
+        // The drive reports that it was destroyed with reads in flight, but may only return once the kernel has stopped
+        // writing to the output buffers.
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive.reset();
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        Streamer_StorageDriveLinuxTests, Streamer_StorageDriveLinuxTestFixture, ::testing::Bool(),
+        [](const ::testing::TestParamInfo<bool>& info)
+        {
+            return info.param ? "DirectReads" : "BufferedReads";
+        });
+} // namespace AZ::IO
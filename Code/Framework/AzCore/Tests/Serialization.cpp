@@ -65,6 +65,10 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Utils/Utils.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace SerializeTestClasses {
     class MyClassBase1
     {
@@ -7697,6 +7701,196 @@ namespace UnitTest
         EXPECT_EQ(ClassThatAllocatesMemoryInDefaultCtor::InstanceTracker::s_instanceCount, 0);
     }
 
+    // Class with members of every kind the binary load plan handles: primitives that are copied directly,
+    // classes with a serializer, containers, nested classes and pointers.
+    struct LoadPlanNestedClass
+    {
+        AZ_TYPE_INFO(LoadPlanNestedClass, "{9B5E2C21-4A5F-4C52-8E63-25F1C8F0F7B6}");
+        AZ_CLASS_ALLOCATOR(LoadPlanNestedClass, AZ::SystemAllocator, 0);
+
+        static void Reflect(SerializeContext& sc)
+        {
+            sc.Class<LoadPlanNestedClass>()
+                ->Field("Value", &LoadPlanNestedClass::m_value)
+                ->Field("Name", &LoadPlanNestedClass::m_name);
+        }
+
+        bool operator==(const LoadPlanNestedClass& rhs) const { return m_value == rhs.m_value && m_name == rhs.m_name; }
+
+        AZ::s64 m_value = 0;
+        AZStd::string m_name;
+    };
+
+    struct LoadPlanTestClass
+    {
+        AZ_TYPE_INFO(LoadPlanTestClass, "{0F0B8A3C-7C3C-4C8B-9E84-4E3C0A3E6F61}");
+        AZ_CLASS_ALLOCATOR(LoadPlanTestClass, AZ::SystemAllocator, 0);
+
+        ~LoadPlanTestClass()
+        {
+            delete m_pointer;
+        }
+
+        static void Reflect(SerializeContext& sc)
+        {
+            LoadPlanNestedClass::Reflect(sc);
+            sc.Class<LoadPlanTestClass>()
+                ->Version(2)
+                ->Field("Char", &LoadPlanTestClass::m_char)
+                ->Field("Short", &LoadPlanTestClass::m_short)
+                ->Field("UnsignedShort", &LoadPlanTestClass::m_unsignedShort)
+                ->Field("Int", &LoadPlanTestClass::m_int)
+                ->Field("UnsignedInt", &LoadPlanTestClass::m_unsignedInt)
+                ->Field("S64", &LoadPlanTestClass::m_s64)
+                ->Field("U64", &LoadPlanTestClass::m_u64)
+                ->Field("Float", &LoadPlanTestClass::m_float)
+                ->Field("Double", &LoadPlanTestClass::m_double)
+                ->Field("Bool", &LoadPlanTestClass::m_bool)
+                ->Field("Vector3", &LoadPlanTestClass::m_vector3)
+                ->Field("Uuid", &LoadPlanTestClass::m_uuid)
+                ->Field("Values", &LoadPlanTestClass::m_values)
+                ->Field("Nested", &LoadPlanTestClass::m_nested)
+                ->Field("NestedArray", &LoadPlanTestClass::m_nestedArray)
+                ->Field("Pointer", &LoadPlanTestClass::m_pointer);
+        }
+
+        void Fill()
+        {
+            m_char = 'x';
+            m_short = -1234;
+            m_unsignedShort = 54321;
+            m_int = -123456789;
+            m_unsignedInt = 0xDEADBEEF;
+            m_s64 = -1234567890123ll;
+            m_u64 = 0x0123456789ABCDEFull;
+            m_float = 3.25f;
+            m_double = -1.0 / 3.0;
+            m_bool = true;
+            m_vector3 = AZ::Vector3(1.0f, 2.0f, 3.0f);
+            m_uuid = AZ::Uuid("{6D3D5D44-2B1A-4C8E-8C54-95D0E1E0B5C4}");
+            m_values = { 1, 2, 3, 5, 8 };
+            m_nested.m_value = 42;
+            m_nested.m_name = "Nested";
+            m_nestedArray.resize(3);
+            m_nestedArray[1].m_value = 7;
+            m_pointer = aznew LoadPlanNestedClass();
+            m_pointer->m_name = "Pointer";
+        }
+
+        void ExpectEqual(const LoadPlanTestClass& rhs) const
+        {
+            EXPECT_EQ(m_char, rhs.m_char);
+            EXPECT_EQ(m_short, rhs.m_short);
+            EXPECT_EQ(m_unsignedShort, rhs.m_unsignedShort);
+            EXPECT_EQ(m_int, rhs.m_int);
+            EXPECT_EQ(m_unsignedInt, rhs.m_unsignedInt);
+            EXPECT_EQ(m_s64, rhs.m_s64);
+            EXPECT_EQ(m_u64, rhs.m_u64);
+            EXPECT_EQ(m_float, rhs.m_float);
+            EXPECT_EQ(m_double, rhs.m_double);
+            EXPECT_EQ(m_bool, rhs.m_bool);
+            EXPECT_TRUE(m_vector3.IsClose(rhs.m_vector3));
+            EXPECT_EQ(m_uuid, rhs.m_uuid);
+            EXPECT_EQ(m_values, rhs.m_values);
+            EXPECT_EQ(m_nested, rhs.m_nested);
+            EXPECT_EQ(m_nestedArray, rhs.m_nestedArray);
+            ASSERT_NE(nullptr, rhs.m_pointer);
+            EXPECT_EQ(*m_pointer, *rhs.m_pointer);
+        }
+
+        char m_char = 0;
+        short m_short = 0;
+        unsigned short m_unsignedShort = 0;
+        int m_int = 0;
+        unsigned int m_unsignedInt = 0;
+        AZ::s64 m_s64 = 0;
+        AZ::u64 m_u64 = 0;
+        float m_float = 0.0f;
+        double m_double = 0.0;
+        bool m_bool = false;
+        AZ::Vector3 m_vector3 = AZ::Vector3::CreateZero();
+        AZ::Uuid m_uuid = AZ::Uuid::CreateNull();
+        AZStd::vector<int> m_values;
+        LoadPlanNestedClass m_nested;
+        AZStd::vector<LoadPlanNestedClass> m_nestedArray;
+        LoadPlanNestedClass* m_pointer = nullptr;
+    };
+
+    TEST_F(Serialization, BinaryLoadPlan_LoadsSameDataAsGenericLoad)
+    {
+        LoadPlanTestClass::Reflect(*m_serializeContext);
+
+        LoadPlanTestClass source;
+        source.Fill();
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(AZ::Utils::SaveObjectToStream(stream, ObjectStream::ST_BINARY, &source, m_serializeContext.get()));
+
+        for (bool loadPlansEnabled : { true, false })
+        {
+            m_serializeContext->SetLoadPlansEnabled(loadPlansEnabled);
+            LoadPlanTestClass loaded;
+            ASSERT_TRUE(AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), loaded, m_serializeContext.get()));
+            source.ExpectEqual(loaded);
+        }
+        m_serializeContext->SetLoadPlansEnabled(true);
+
+        const SerializeContext::ClassLoadPlan* plan = m_serializeContext->FindClassLoadPlan(m_serializeContext->FindClassData(azrtti_typeid<LoadPlanTestClass>()));
+        ASSERT_NE(nullptr, plan);
+        EXPECT_EQ(2, plan->m_version);
+        EXPECT_EQ(16, plan->m_elements.size());
+        const SerializeContext::ClassLoadPlan::Element* floatElement = plan->FindElement(AZ_CRC_CE("Float"));
+        ASSERT_NE(nullptr, floatElement);
+        EXPECT_EQ(sizeof(float), floatElement->m_directValueSize);
+        const SerializeContext::ClassLoadPlan::Element* pointerElement = plan->FindElement(AZ_CRC_CE("Pointer"));
+        ASSERT_NE(nullptr, pointerElement);
+        EXPECT_EQ(0, pointerElement->m_directValueSize);
+        EXPECT_EQ(nullptr, plan->FindElement(AZ_CRC_CE("Missing")));
+
+        // Containers and classes with a serializer are loaded without a plan
+        EXPECT_EQ(nullptr, m_serializeContext->FindClassLoadPlan(m_serializeContext->FindClassData(azrtti_typeid<float>())));
+        EXPECT_EQ(nullptr, m_serializeContext->FindClassLoadPlan(m_serializeContext->FindClassData(azrtti_typeid<AZStd::vector<int>>())));
+
+        m_serializeContext->EnableRemoveReflection();
+        LoadPlanTestClass::Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(Serialization, BinaryLoadPlan_ReflectionChange_RecompilesPlan)
+    {
+        LoadPlanNestedClass::Reflect(*m_serializeContext);
+        LoadPlanNestedClass source;
+        source.m_value = 1234;
+        source.m_name = "Source";
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(AZ::Utils::SaveObjectToStream(stream, ObjectStream::ST_BINARY, &source, m_serializeContext.get()));
+
+        LoadPlanNestedClass loaded;
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), loaded, m_serializeContext.get()));
+        EXPECT_EQ(source, loaded);
+
+        // Reflect the class again without the value, the stale plan must not be used to load it
+        m_serializeContext->EnableRemoveReflection();
+        LoadPlanNestedClass::Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+        m_serializeContext->Class<LoadPlanNestedClass>()
+            ->Field("Name", &LoadPlanNestedClass::m_name);
+
+        LoadPlanNestedClass reloaded;
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), reloaded, m_serializeContext.get()));
+        EXPECT_EQ(0, reloaded.m_value);
+        EXPECT_EQ(source.m_name, reloaded.m_name);
+
+        const SerializeContext::ClassLoadPlan* plan = m_serializeContext->FindClassLoadPlan(m_serializeContext->FindClassData(azrtti_typeid<LoadPlanNestedClass>()));
+        ASSERT_NE(nullptr, plan);
+        EXPECT_EQ(1, plan->m_elements.size());
+
+        m_serializeContext->EnableRemoveReflection();
+        LoadPlanNestedClass::Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
     // Test that loading containers in-place clears any existing data in the
     // containers (
     template <typename T>
@@ -8154,3 +8348,159 @@ namespace UnitTest
     }
 }
 
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Approximates the mix of data the AssetBundler loads from binary object streams: many small catalog-like
+    // records dominated by primitive members, numeric heavy mesh descriptions and material property lists.
+    struct BenchmarkAssetInfo
+    {
+        AZ_TYPE_INFO(BenchmarkAssetInfo, "{5B0F3E4E-8E61-4D55-9F7C-1B3C36B0B9B1}");
+
+        AZ::Uuid m_assetGuid = AZ::Uuid::CreateNull();
+        AZ::u32 m_subId = 0;
+        AZ::Uuid m_assetType = AZ::Uuid::CreateNull();
+        AZStd::string m_relativePath;
+        AZ::u64 m_sizeBytes = 0;
+        AZ::u64 m_modificationTime = 0;
+        AZ::u32 m_platformFlags = 0;
+        bool m_isCompressed = false;
+        AZStd::vector<AZ::u32> m_dependencies;
+    };
+
+    struct BenchmarkMeshLod
+    {
+        AZ_TYPE_INFO(BenchmarkMeshLod, "{0E5D4C0A-83D1-4B0B-9C60-9F2B1F1B4A52}");
+
+        float m_screenCoverage = 0.0f;
+        AZ::u32 m_vertexCount = 0;
+        AZ::u32 m_indexCount = 0;
+        AZ::u32 m_materialSlot = 0;
+        AZ::Vector3 m_aabbMin = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_aabbMax = AZ::Vector3::CreateZero();
+        bool m_castShadows = true;
+    };
+
+    struct BenchmarkMaterialProperty
+    {
+        AZ_TYPE_INFO(BenchmarkMaterialProperty, "{A7E3E2B8-39B4-4E7E-B1E6-2C2B50A0C8D3}");
+
+        AZ::u32 m_nameCrc = 0;
+        int m_type = 0;
+        float m_value = 0.0f;
+        bool m_enabled = true;
+    };
+
+    struct BenchmarkAssetMix
+    {
+        AZ_TYPE_INFO(BenchmarkAssetMix, "{3C1C8B33-0C4F-4F84-A9B5-8E6B0E7D4D17}");
+        AZ_CLASS_ALLOCATOR(BenchmarkAssetMix, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& sc)
+        {
+            sc.Class<BenchmarkAssetInfo>()
+                ->Field("AssetGuid", &BenchmarkAssetInfo::m_assetGuid)
+                ->Field("SubId", &BenchmarkAssetInfo::m_subId)
+                ->Field("AssetType", &BenchmarkAssetInfo::m_assetType)
+                ->Field("RelativePath", &BenchmarkAssetInfo::m_relativePath)
+                ->Field("SizeBytes", &BenchmarkAssetInfo::m_sizeBytes)
+                ->Field("ModificationTime", &BenchmarkAssetInfo::m_modificationTime)
+                ->Field("PlatformFlags", &BenchmarkAssetInfo::m_platformFlags)
+                ->Field("IsCompressed", &BenchmarkAssetInfo::m_isCompressed)
+                ->Field("Dependencies", &BenchmarkAssetInfo::m_dependencies);
+            sc.Class<BenchmarkMeshLod>()
+                ->Field("ScreenCoverage", &BenchmarkMeshLod::m_screenCoverage)
+                ->Field("VertexCount", &BenchmarkMeshLod::m_vertexCount)
+                ->Field("IndexCount", &BenchmarkMeshLod::m_indexCount)
+                ->Field("MaterialSlot", &BenchmarkMeshLod::m_materialSlot)
+                ->Field("AabbMin", &BenchmarkMeshLod::m_aabbMin)
+                ->Field("AabbMax", &BenchmarkMeshLod::m_aabbMax)
+                ->Field("CastShadows", &BenchmarkMeshLod::m_castShadows);
+            sc.Class<BenchmarkMaterialProperty>()
+                ->Field("Name", &BenchmarkMaterialProperty::m_nameCrc)
+                ->Field("Type", &BenchmarkMaterialProperty::m_type)
+                ->Field("Value", &BenchmarkMaterialProperty::m_value)
+                ->Field("Enabled", &BenchmarkMaterialProperty::m_enabled);
+            sc.Class<BenchmarkAssetMix>()
+                ->Field("Assets", &BenchmarkAssetMix::m_assets)
+                ->Field("MeshLods", &BenchmarkAssetMix::m_meshLods)
+                ->Field("MaterialProperties", &BenchmarkAssetMix::m_materialProperties);
+        }
+
+        AZStd::vector<BenchmarkAssetInfo> m_assets;
+        AZStd::vector<BenchmarkMeshLod> m_meshLods;
+        AZStd::vector<BenchmarkMaterialProperty> m_materialProperties;
+    };
+
+    class BM_ObjectStream
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            BenchmarkAssetMix::Reflect(*m_serializeContext);
+
+            BenchmarkAssetMix assetMix;
+            const size_t assetCount = aznumeric_cast<size_t>(state.range(0));
+            for (size_t i = 0; i < assetCount; ++i)
+            {
+                BenchmarkAssetInfo& asset = assetMix.m_assets.emplace_back();
+                asset.m_assetGuid = AZ::Uuid::CreateRandom();
+                asset.m_subId = aznumeric_cast<AZ::u32>(i);
+                asset.m_assetType = AZ::Uuid::CreateRandom();
+                asset.m_relativePath = AZStd::string::format("objects/props/prop_%zu.azmodel", i);
+                asset.m_sizeBytes = i * 4096;
+                asset.m_modificationTime = i * 1000;
+                asset.m_dependencies = { 1, 2, 3 };
+
+                BenchmarkMeshLod& lod = assetMix.m_meshLods.emplace_back();
+                lod.m_vertexCount = aznumeric_cast<AZ::u32>(i * 3);
+                lod.m_indexCount = aznumeric_cast<AZ::u32>(i * 6);
+                lod.m_aabbMax = AZ::Vector3(1.0f);
+
+                for (int property = 0; property < 4; ++property)
+                {
+                    BenchmarkMaterialProperty& materialProperty = assetMix.m_materialProperties.emplace_back();
+                    materialProperty.m_nameCrc = aznumeric_cast<AZ::u32>(i * 4 + property);
+                    materialProperty.m_value = aznumeric_cast<float>(property);
+                }
+            }
+
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+            AZ::Utils::SaveObjectToStream(stream, AZ::ObjectStream::ST_BINARY, &assetMix, m_serializeContext.get());
+            m_serializeContext->SetLoadPlansEnabled(state.range(1) != 0);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_buffer = {};
+            m_serializeContext.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<char> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(BM_ObjectStream, LoadBinaryAssetMix)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            BenchmarkAssetMix assetMix;
+            AZ::Utils::LoadObjectFromBufferInPlace(m_buffer.data(), m_buffer.size(), assetMix, m_serializeContext.get());
+            benchmark::DoNotOptimize(assetMix.m_assets.data());
+        }
+        state.SetBytesProcessed(state.iterations() * m_buffer.size());
+    }
+
+    BENCHMARK_REGISTER_F(BM_ObjectStream, LoadBinaryAssetMix)
+        ->ArgNames({ "Assets", "LoadPlans" })
+        ->Args({ 1000, 0 })
+        ->Args({ 1000, 1 })
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
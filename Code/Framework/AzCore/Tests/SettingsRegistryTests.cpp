@@ -7,19 +7,26 @@
  */
 
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Math/Uuid.h>
+#include <AzCore/Platform.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <AZTestShared/Utils/Utils.h>
 
+#include <cinttypes>
+
 namespace SettingsRegistryTests
 {
     class TestClass
@@ -1756,4 +1763,670 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    //
+    // PathHandle
+    //
+
+    TEST_F(SettingsRegistryTest, GetWithHandle_ExistingValues_SameResultAsPath)
+    {
+        m_registry->Set("/Deep/Nested/Boolean", true);
+        m_registry->Set("/Deep/Nested/Integer", AZ::s64{ -42 });
+        m_registry->Set("/Deep/Nested/Unsigned", AZ::u64{ 42 });
+        m_registry->Set("/Deep/Nested/Double", 4.2);
+        m_registry->Set("/Deep/Nested/String", "value");
+
+        bool boolean = false;
+        EXPECT_TRUE(m_registry->Get(boolean, AZ::SettingsRegistryImpl::PathHandle("/Deep/Nested/Boolean")));
+        EXPECT_TRUE(boolean);
+        AZ::s64 integer = 0;
+        EXPECT_TRUE(m_registry->Get(integer, AZ::SettingsRegistryImpl::PathHandle("/Deep/Nested/Integer")));
+        EXPECT_EQ(-42, integer);
+        AZ::u64 unsignedInteger = 0;
+        EXPECT_TRUE(m_registry->Get(unsignedInteger, AZ::SettingsRegistryImpl::PathHandle("/Deep/Nested/Unsigned")));
+        EXPECT_EQ(42, unsignedInteger);
+        double floatingPoint = 0.0;
+        EXPECT_TRUE(m_registry->Get(floatingPoint, AZ::SettingsRegistryImpl::PathHandle("/Deep/Nested/Double")));
+        EXPECT_DOUBLE_EQ(4.2, floatingPoint);
+        AZStd::string string;
+        EXPECT_TRUE(m_registry->Get(string, AZ::SettingsRegistryImpl::PathHandle("/Deep/Nested/String")));
+        EXPECT_STREQ("value", string.c_str());
+        AZ::SettingsRegistryInterface::FixedValueString fixedString;
+        EXPECT_TRUE(m_registry->Get(fixedString, AZ::SettingsRegistryImpl::PathHandle("/Deep/Nested/String")));
+        EXPECT_STREQ("value", fixedString.c_str());
+
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, m_registry->GetType(AZ::SettingsRegistryImpl::PathHandle("/Deep/Nested")));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType(AZ::SettingsRegistryImpl::PathHandle("/Deep/Missing")));
+        EXPECT_FALSE(m_registry->Get(integer, AZ::SettingsRegistryImpl::PathHandle("/Deep/Nested/String")));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithHandle_RegistryModifiedBetweenReads_HandleReadsCurrentValue)
+    {
+        AZ::SettingsRegistryImpl::PathHandle handle("/Object/Value");
+
+        AZ::s64 value = 0;
+        EXPECT_FALSE(m_registry->Get(value, handle));
+
+        m_registry->Set("/Object/Value", AZ::s64{ 1 });
+        EXPECT_TRUE(m_registry->Get(value, handle));
+        EXPECT_EQ(1, value);
+
+        // Adding siblings can relocate the members of the object, so the handle needs to pick up the new location.
+        for (AZ::s64 i = 0; i < 64; ++i)
+        {
+            m_registry->Set(AZStd::string::format("/Object/Sibling%lld", static_cast<long long>(i)), i);
+        }
+        EXPECT_TRUE(m_registry->Get(value, handle));
+        EXPECT_EQ(1, value);
+
+        m_registry->MergeSettings(R"({ "Object": { "Value": 2 } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch);
+        EXPECT_TRUE(m_registry->Get(value, handle));
+        EXPECT_EQ(2, value);
+
+        EXPECT_TRUE(m_registry->Remove("/Object"));
+        EXPECT_FALSE(m_registry->Get(value, handle));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithHandle_HandleUsedWithDifferentRegistries_ReadsFromEachRegistry)
+    {
+        AZ::SettingsRegistryImpl otherRegistry;
+        m_registry->Set("/Value", AZ::s64{ 1 });
+        otherRegistry.Set("/Value", AZ::s64{ 2 });
+
+        AZ::SettingsRegistryImpl::PathHandle handle("/Value");
+        AZ::s64 value = 0;
+        EXPECT_TRUE(m_registry->Get(value, handle));
+        EXPECT_EQ(1, value);
+        EXPECT_TRUE(otherRegistry.Get(value, handle));
+        EXPECT_EQ(2, value);
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithHandle_RegistryRecreatedAtSameAddress_HandleReadsNewRegistry)
+    {
+        AZStd::aligned_storage_for_t<AZ::SettingsRegistryImpl> storage;
+        AZ::SettingsRegistryImpl::PathHandle handle("/Value");
+        AZ::s64 value = 0;
+
+        auto* registry = new (&storage) AZ::SettingsRegistryImpl();
+        registry->Set("/Value", AZ::s64{ 1 });
+        EXPECT_TRUE(registry->Get(value, handle));
+        EXPECT_EQ(1, value);
+        registry->~SettingsRegistryImpl();
+
+        // The new registry has gone through the same modifications, but must not reuse the location cached for the old one.
+        registry = new (&storage) AZ::SettingsRegistryImpl();
+        registry->Set("/Value", AZ::s64{ 2 });
+        EXPECT_TRUE(registry->Get(value, handle));
+        EXPECT_EQ(2, value);
+        registry->~SettingsRegistryImpl();
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithHandle_ThroughInterface_ReadsValue)
+    {
+        m_registry->Set("/Value", "value");
+
+        const AZ::SettingsRegistryInterface& registry = *m_registry;
+        AZ::SettingsRegistryInterface::PathHandle handle("/Value");
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, registry.GetType(handle));
+        AZ::SettingsRegistryInterface::FixedValueString value;
+        EXPECT_TRUE(registry.Get(value, handle));
+        EXPECT_EQ("value", value);
+    }
+
+    TEST_F(SettingsRegistryTest, GetGeneration_DifferentRegistries_GenerationsAreUnique)
+    {
+        AZ::SettingsRegistryImpl otherRegistry;
+        EXPECT_NE(m_registry->GetGeneration(), otherRegistry.GetGeneration());
+
+        m_registry->Set("/Value", true);
+        otherRegistry.Set("/Value", true);
+        EXPECT_NE(m_registry->GetGeneration(), otherRegistry.GetGeneration());
+    }
+
+    TEST_F(SettingsRegistryTest, GetGeneration_MergeSettingsFolderFails_GenerationIncreases)
+    {
+        AZ::u64 generation = m_registry->GetGeneration();
+        constexpr AZStd::fixed_string<AZ::IO::MaxPathLength + 1> path(AZ::IO::MaxPathLength + 1, 'a');
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(m_registry->MergeSettingsFolder(path, {}, {}, nullptr));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_LT(generation, m_registry->GetGeneration());
+    }
+
+    TEST_F(SettingsRegistryTest, GetGeneration_RegistryModified_GenerationIncreases)
+    {
+        AZ::u64 generation = m_registry->GetGeneration();
+        bool value = false;
+        m_registry->Get(value, "/Value");
+        EXPECT_EQ(generation, m_registry->GetGeneration());
+
+        m_registry->Set("/Value", true);
+        EXPECT_LT(generation, m_registry->GetGeneration());
+    }
+
+    //
+    // Snapshots
+    //
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_SnapshotOfMergedFolder_SameSettingsAsMergedFolder)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "MemoryRoot": true, "Name": "root", "Values": [ 1, 2.5, null ] })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1, "MemoryEditor": true, "Large": 18446744073709551615 })");
+        CreateTestFile("Memory.test.setreg", R"({ "Memory": 2, "Special~Name/Key": "escaped" })");
+
+        m_testFolder->push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        *m_testFolder += AZ::SettingsRegistryInterface::RegistryFolder;
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(*m_testFolder, { "editor", "test" }, {}, nullptr));
+
+        AZStd::vector<char> snapshot;
+        ASSERT_TRUE(m_registry->StoreSnapshot(snapshot, { "editor", "test" }));
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        size_t notifyCount = 0;
+        auto notifier = snapshotRegistry.RegisterNotifier([&notifyCount](AZStd::string_view, AZ::SettingsRegistryInterface::Type)
+            {
+                notifyCount++;
+            });
+        ASSERT_TRUE(snapshotRegistry.MergeSnapshot(AZStd::string_view(snapshot.data(), snapshot.size()), { "editor", "test" }));
+        EXPECT_EQ(1, notifyCount);
+
+        AZ::s64 memory = -1;
+        EXPECT_TRUE(snapshotRegistry.Get(memory, "/Memory"));
+        EXPECT_EQ(2, memory);
+        bool flag = false;
+        EXPECT_TRUE(snapshotRegistry.Get(flag, "/MemoryEditor"));
+        EXPECT_TRUE(flag);
+        AZ::u64 large = 0;
+        EXPECT_TRUE(snapshotRegistry.Get(large, "/Large"));
+        EXPECT_EQ(18446744073709551615ull, large);
+        double floatingPoint = 0.0;
+        EXPECT_TRUE(snapshotRegistry.Get(floatingPoint, "/Values/1"));
+        EXPECT_DOUBLE_EQ(2.5, floatingPoint);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, snapshotRegistry.GetType("/Values/2"));
+        AZStd::string name;
+        EXPECT_TRUE(snapshotRegistry.Get(name, "/Name"));
+        EXPECT_STREQ("root", name.c_str());
+        AZStd::string escaped;
+        EXPECT_TRUE(snapshotRegistry.Get(escaped, "/Special~0Name~1Key"));
+        EXPECT_STREQ("escaped", escaped.c_str());
+
+        // The file history of the snapshot is appended to the history of the registry.
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, snapshotRegistry.GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/0"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, snapshotRegistry.GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/3"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshotRegistry.GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/4"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_ExistingSettings_SnapshotValuesOverwriteAndObjectsAreMerged)
+    {
+        AZStd::string path = CreateTestFile("Source.setreg", R"({ "Object": { "Overwritten": "snapshot", "Added": true } })");
+        AZ::SettingsRegistryImpl source;
+        ASSERT_TRUE(source.MergeSettingsFile(path, AZ::SettingsRegistryInterface::Format::JsonMergePatch, {}, nullptr));
+
+        AZStd::vector<char> snapshot;
+        ASSERT_TRUE(source.StoreSnapshot(snapshot, {}));
+
+        m_registry->Set("/Object/Overwritten", "registry");
+        m_registry->Set("/Object/Kept", AZ::s64{ 42 });
+        ASSERT_TRUE(m_registry->MergeSnapshot(AZStd::string_view(snapshot.data(), snapshot.size()), {}));
+
+        AZStd::string overwritten;
+        EXPECT_TRUE(m_registry->Get(overwritten, "/Object/Overwritten"));
+        EXPECT_STREQ("snapshot", overwritten.c_str());
+        bool added = false;
+        EXPECT_TRUE(m_registry->Get(added, "/Object/Added"));
+        EXPECT_TRUE(added);
+        AZ::s64 kept = 0;
+        EXPECT_TRUE(m_registry->Get(kept, "/Object/Kept"));
+        EXPECT_EQ(42, kept);
+    }
+
+    TEST_F(SettingsRegistryTest, SettingsRegistrySnapshot_LookupValues_ValuesFoundWithoutRebuildingSettings)
+    {
+        AZStd::string path = CreateTestFile("Settings.setreg",
+            R"({ "Settings": { "Integer": -7, "String": "value", "Nested": { "Boolean": true } } })");
+        ASSERT_TRUE(m_registry->MergeSettingsFile(path, AZ::SettingsRegistryInterface::Format::JsonMergePatch, {}, nullptr));
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(m_registry->StoreSnapshot(data, {}));
+
+        AZ::SettingsRegistrySnapshot snapshot(AZStd::string_view(data.data(), data.size()));
+        ASSERT_TRUE(snapshot.IsValid());
+        EXPECT_TRUE(snapshot.IsUpToDate({}));
+        EXPECT_FALSE(snapshot.IsUpToDate({ "editor" }));
+
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, snapshot.GetType(""));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, snapshot.GetType("/Settings/Nested"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshot.GetType("/Settings/Missing"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshot.GetType("/Nested/Boolean"));
+
+        AZ::s64 integer = 0;
+        EXPECT_TRUE(snapshot.Get(integer, "/Settings/Integer"));
+        EXPECT_EQ(-7, integer);
+        AZ::u64 unsignedInteger = 0;
+        EXPECT_FALSE(snapshot.Get(unsignedInteger, "/Settings/Integer"));
+        AZStd::string_view string;
+        EXPECT_TRUE(snapshot.Get(string, "/Settings/String"));
+        EXPECT_EQ("value", string);
+        bool boolean = false;
+        EXPECT_TRUE(snapshot.Get(boolean, "/Settings/Nested/Boolean"));
+        EXPECT_TRUE(boolean);
+        EXPECT_FALSE(snapshot.Get(boolean, "/Settings/String"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_InvalidData_ReturnsFalse)
+    {
+        AZStd::vector<char> data;
+        ASSERT_TRUE(m_registry->StoreSnapshot(data, {}));
+        data.pop_back();
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        EXPECT_FALSE(snapshotRegistry.MergeSnapshot(AZStd::string_view(data.data(), data.size()), {}));
+        EXPECT_FALSE(snapshotRegistry.MergeSnapshot("not a snapshot", {}));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_DifferentSpecializations_ReturnsFalseAndNothingMerged)
+    {
+        AZStd::string path = CreateTestFile("Value.setreg", R"({ "Value": true })");
+        ASSERT_TRUE(m_registry->MergeSettingsFile(path, AZ::SettingsRegistryInterface::Format::JsonMergePatch, {}, nullptr));
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(m_registry->StoreSnapshot(data, { "editor" }));
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        EXPECT_FALSE(snapshotRegistry.MergeSnapshot(AZStd::string_view(data.data(), data.size()), { "editor", "test" }));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshotRegistry.GetType("/Value"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_SourceFileChanged_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+
+        AZStd::string folder = AZStd::string::format("%s%c%s", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR,
+            AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(folder, {}, {}, nullptr));
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(m_registry->StoreSnapshot(data, {}));
+        AZ::SettingsRegistrySnapshot snapshot(AZStd::string_view(data.data(), data.size()));
+        EXPECT_EQ(2, snapshot.GetSourceCount());
+        EXPECT_TRUE(snapshot.IsUpToDate({}));
+
+        CreateTestFile("Memory.setreg", R"({ "Memory": 100 })");
+        EXPECT_FALSE(snapshot.IsUpToDate({}));
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        EXPECT_FALSE(snapshotRegistry.MergeSnapshot(AZStd::string_view(data.data(), data.size()), {}));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_FileAddedToFolder_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+
+        AZStd::string folder = AZStd::string::format("%s%c%s", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR,
+            AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(folder, {}, {}, nullptr));
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(m_registry->StoreSnapshot(data, {}));
+        AZ::SettingsRegistrySnapshot snapshot(AZStd::string_view(data.data(), data.size()));
+        EXPECT_TRUE(snapshot.IsUpToDate({}));
+
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1 })");
+        EXPECT_FALSE(snapshot.IsUpToDate({}));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_FileAddedToPlatformFolder_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        CreateTestFile("Platform/Test/Memory.setreg", R"({ "Memory": 1 })");
+
+        AZStd::string folder = AZStd::string::format("%s%c%s", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR,
+            AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(folder, {}, "Test", nullptr));
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(m_registry->StoreSnapshot(data, {}));
+        AZ::SettingsRegistrySnapshot snapshot(AZStd::string_view(data.data(), data.size()));
+        // The folder, its platform folder and the two files.
+        EXPECT_EQ(4, snapshot.GetSourceCount());
+        EXPECT_TRUE(snapshot.IsUpToDate({}));
+
+        CreateTestFile("Platform/Test/Memory.editor.setreg", R"({ "Memory": 2 })");
+        EXPECT_FALSE(snapshot.IsUpToDate({}));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_MissingFileCreated_ReturnsFalse)
+    {
+        AZStd::string memoryPath = CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        AZStd::string missingPath = AZStd::string::format("%s/%s/Missing.setreg", m_testFolder->c_str(),
+            AZ::SettingsRegistryInterface::RegistryFolder);
+
+        ASSERT_TRUE(m_registry->MergeSettingsFile(memoryPath, AZ::SettingsRegistryInterface::Format::JsonMergePatch, {}, nullptr));
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(m_registry->MergeSettingsFile(missingPath, AZ::SettingsRegistryInterface::Format::JsonMergePatch, {}, nullptr));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(m_registry->StoreSnapshot(data, {}));
+        AZ::SettingsRegistrySnapshot snapshot(AZStd::string_view(data.data(), data.size()));
+        EXPECT_EQ(2, snapshot.GetSourceCount());
+        EXPECT_TRUE(snapshot.IsUpToDate({}));
+
+        CreateTestFile("Missing.setreg", R"({ "Memory": 1 })");
+        EXPECT_FALSE(snapshot.IsUpToDate({}));
+    }
+
+    TEST_F(SettingsRegistryTest, StoreSnapshot_RuntimeAndEarlierValues_OnlyValuesFromIncludedFilesAreStored)
+    {
+        AZStd::string earlierPath = CreateTestFile("Earlier.setreg", R"({ "Earlier": true, "Shared": "earlier" })");
+        AZStd::string laterPath = CreateTestFile("Later.setreg", R"({ "Later": true, "Shared": "later" })");
+
+        ASSERT_TRUE(m_registry->MergeSettingsFile(earlierPath, AZ::SettingsRegistryInterface::Format::JsonMergePatch, {}, nullptr));
+        const size_t firstHistoryEntry = m_registry->GetFileHistorySize();
+        ASSERT_TRUE(m_registry->MergeSettingsFile(laterPath, AZ::SettingsRegistryInterface::Format::JsonMergePatch, {}, nullptr));
+        m_registry->Set("/Runtime", true);
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(m_registry->StoreSnapshot(data, {}, firstHistoryEntry));
+        AZ::SettingsRegistrySnapshot snapshot(AZStd::string_view(data.data(), data.size()));
+        ASSERT_TRUE(snapshot.IsValid());
+        EXPECT_EQ(1, snapshot.GetSourceCount());
+
+        bool later = false;
+        EXPECT_TRUE(snapshot.Get(later, "/Later"));
+        EXPECT_TRUE(later);
+        AZStd::string_view shared;
+        EXPECT_TRUE(snapshot.Get(shared, "/Shared"));
+        EXPECT_EQ("later", shared);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshot.GetType("/Earlier"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshot.GetType("/Runtime"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsToRegistry_Snapshot_StoredSnapshotFile_SettingsMerged)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "MemoryRoot": true })");
+        CreateTestFile("Memory.test.setreg", R"({ "Memory": 2, "MemoryTest": true })");
+
+        AZStd::string folder = AZStd::string::format("%s%c%s", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR,
+            AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(folder, { "test" }, {}, nullptr));
+
+        AZStd::string snapshotPath = AZStd::string::format("%s%cregistry.snapshot", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR);
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::StoreSettingsRegistrySnapshot(*m_registry, snapshotPath, { "test" }));
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_Snapshot(snapshotRegistry, snapshotPath, { "test" }));
+        AZ::s64 memory = -1;
+        EXPECT_TRUE(snapshotRegistry.Get(memory, "/Memory"));
+        EXPECT_EQ(2, memory);
+
+        AZ::SettingsRegistryImpl missingRegistry;
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_Snapshot(missingRegistry,
+            AZStd::string::format("%s%cmissing.snapshot", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR), { "test" }));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsToRegistry_Snapshot_TruncatedSnapshotFile_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+
+        AZStd::string folder = AZStd::string::format("%s%c%s", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR,
+            AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(folder, {}, {}, nullptr));
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(m_registry->StoreSnapshot(data, {}));
+        EXPECT_TRUE(AZ::SettingsRegistrySnapshot::HasValidHeader(AZStd::string_view(data.data(), data.size())));
+        EXPECT_FALSE(AZ::SettingsRegistrySnapshot::HasValidHeader(AZStd::string_view(data.data(), data.size() / 2)));
+
+        AZStd::string snapshotPath = AZStd::string::format("%s%cregistry.snapshot", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR);
+        {
+            AZ::IO::SystemFile file;
+            ASSERT_TRUE(file.Open(snapshotPath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+            ASSERT_EQ(data.size() / 2, file.Write(data.data(), data.size() / 2));
+        }
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_Snapshot(snapshotRegistry, snapshotPath, {}));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshotRegistry.GetType("/Memory"));
+
+        // Storing replaces the truncated snapshot through a temporary file that doesn't remain afterwards.
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::StoreSettingsRegistrySnapshot(*m_registry, snapshotPath, {}));
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists(AZStd::string::format("%s.%" PRIu32 ".tmp", snapshotPath.c_str(),
+            AZ::Platform::GetCurrentProcessId()).c_str()));
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_Snapshot(snapshotRegistry, snapshotPath, {}));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsToRegistry_SnapshotOrFiles_SnapshotPathSet_FilesOnlyMergedUntilSnapshotIsStored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        CreateTestFile("Memory.test.setreg", R"({ "Memory": 2 })");
+
+        AZStd::string folder = AZStd::string::format("%s%c%s", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR,
+            AZ::SettingsRegistryInterface::RegistryFolder);
+        AZStd::string snapshotPath = AZStd::string::format("%s%cregistry.snapshot", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR);
+
+        auto mergeWithSnapshot = [&folder, &snapshotPath](AZ::SettingsRegistryImpl& registry) -> size_t
+        {
+            size_t mergeCount = 0;
+            registry.Set(AZ::SettingsRegistryMergeUtils::SnapshotPathKey, snapshotPath);
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_SnapshotOrFiles(registry, { "test" },
+                [&registry, &folder, &mergeCount]()
+                {
+                    registry.MergeSettingsFolder(folder, { "test" }, {}, nullptr);
+                    ++mergeCount;
+                });
+            return mergeCount;
+        };
+
+        EXPECT_EQ(1, mergeWithSnapshot(*m_registry));
+        EXPECT_TRUE(AZ::IO::SystemFile::Exists(
+            AZ::SettingsRegistryMergeUtils::GetSettingsRegistrySnapshotPath(*m_registry, { "test" }).c_str()));
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        EXPECT_EQ(0, mergeWithSnapshot(snapshotRegistry));
+        AZ::s64 memory = -1;
+        EXPECT_TRUE(snapshotRegistry.Get(memory, "/Memory"));
+        EXPECT_EQ(2, memory);
+
+        CreateTestFile("Memory.test.setreg", R"({ "Memory": 3 })");
+        AZ::SettingsRegistryImpl staleRegistry;
+        EXPECT_EQ(1, mergeWithSnapshot(staleRegistry));
+        EXPECT_TRUE(staleRegistry.Get(memory, "/Memory"));
+        EXPECT_EQ(3, memory);
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsToRegistry_SnapshotOrFiles_DifferentSpecializations_EachUsesItsOwnSnapshot)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        CreateTestFile("Memory.game.setreg", R"({ "Memory": 1 })");
+
+        AZStd::string folder = AZStd::string::format("%s%c%s", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR,
+            AZ::SettingsRegistryInterface::RegistryFolder);
+        AZStd::string snapshotPath = AZStd::string::format("%s%cregistry.snapshot", m_testFolder->c_str(), AZ_CORRECT_DATABASE_SEPARATOR);
+
+        auto mergeWithSnapshot = [&folder, &snapshotPath](const AZ::SettingsRegistryInterface::Specializations& specializations,
+            AZ::s64& memory) -> size_t
+        {
+            AZ::SettingsRegistryImpl registry;
+            size_t mergeCount = 0;
+            registry.Set(AZ::SettingsRegistryMergeUtils::SnapshotPathKey, snapshotPath);
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_SnapshotOrFiles(registry, specializations,
+                [&registry, &folder, &specializations, &mergeCount]()
+                {
+                    registry.MergeSettingsFolder(folder, specializations, {}, nullptr);
+                    ++mergeCount;
+                });
+            registry.Get(memory, "/Memory");
+            return mergeCount;
+        };
+
+        AZ::SettingsRegistryImpl pathRegistry;
+        pathRegistry.Set(AZ::SettingsRegistryMergeUtils::SnapshotPathKey, snapshotPath);
+        EXPECT_NE(AZ::SettingsRegistryMergeUtils::GetSettingsRegistrySnapshotPath(pathRegistry, { "editor" }),
+            AZ::SettingsRegistryMergeUtils::GetSettingsRegistrySnapshotPath(pathRegistry, { "game" }));
+
+        AZ::s64 memory = -1;
+        EXPECT_EQ(1, mergeWithSnapshot({ "editor" }, memory));
+        EXPECT_EQ(0, memory);
+        EXPECT_EQ(1, mergeWithSnapshot({ "game" }, memory));
+        EXPECT_EQ(1, memory);
+
+        // Alternating between the applications no longer replaces the other application's snapshot.
+        EXPECT_EQ(0, mergeWithSnapshot({ "editor" }, memory));
+        EXPECT_EQ(0, memory);
+        EXPECT_EQ(0, mergeWithSnapshot({ "game" }, memory));
+        EXPECT_EQ(1, memory);
+    }
 } // namespace SettingsRegistryTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Compares merging a folder of registry files with merging a snapshot of the same settings. The number of registry
+    // files is the benchmark argument.
+    class SettingsRegistrySnapshotBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t KeysPerFile = 64;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_folder = AZStd::string::format("%sSettingsRegistrySnapshotBenchmark_%s%c%s", UnitTest::GetTestFolderPath().c_str(),
+                AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str(), AZ_CORRECT_DATABASE_SEPARATOR,
+                AZ::SettingsRegistryInterface::RegistryFolder);
+
+            const size_t fileCount = aznumeric_cast<size_t>(state.range(0));
+            for (size_t file = 0; file < fileCount; ++file)
+            {
+                AZStd::string content = AZStd::string::format(R"({ "Gem%zu": {)", file);
+                for (size_t key = 0; key < KeysPerFile; ++key)
+                {
+                    content += AZStd::string::format(R"(%s "Key%zu": { "Value": %zu, "Name": "Setting %zu" })",
+                        key == 0 ? "" : ",", key, key, key);
+                }
+                content += "} }";
+
+                AZStd::string path = AZStd::string::format("%s%cGem%zu.setreg", m_folder.c_str(), AZ_CORRECT_DATABASE_SEPARATOR, file);
+                AZ::IO::SystemFile registryFile;
+                if (registryFile.Open(path.c_str(),
+                    AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+                {
+                    registryFile.Write(content.data(), content.size());
+                }
+            }
+
+            AZ::SettingsRegistryImpl registry;
+            registry.MergeSettingsFolder(m_folder, {}, {});
+            registry.StoreSnapshot(m_snapshot, {});
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            SettingsRegistryTests::SettingsRegistryTest::DeleteFolderRecursive(m_folder);
+            AZStd::string().swap(m_folder);
+            AZStd::vector<char>().swap(m_snapshot);
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::string m_folder;
+        AZStd::vector<char> m_snapshot;
+    };
+
+    BENCHMARK_DEFINE_F(SettingsRegistrySnapshotBenchmarkFixture, BM_SettingsRegistry_MergeSettingsFolder)(benchmark::State& state)
+    {
+        AZStd::vector<char> scratchBuffer;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::SettingsRegistryImpl registry;
+            registry.MergeSettingsFolder(m_folder, {}, {}, "", &scratchBuffer);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SettingsRegistrySnapshotBenchmarkFixture, BM_SettingsRegistry_MergeSettingsFolder)
+        ->ArgName("Files")->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SettingsRegistrySnapshotBenchmarkFixture, BM_SettingsRegistry_MergeSnapshot)(benchmark::State& state)
+    {
+        const AZStd::string_view snapshot(m_snapshot.data(), m_snapshot.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::SettingsRegistryImpl registry;
+            registry.MergeSnapshot(snapshot, {});
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["SnapshotBytes"] = aznumeric_cast<double>(m_snapshot.size());
+    }
+    BENCHMARK_REGISTER_F(SettingsRegistrySnapshotBenchmarkFixture, BM_SettingsRegistry_MergeSnapshot)
+        ->ArgName("Files")->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+    // Reads a value at the bottom of a deep hierarchy where every level has a number of siblings. The depth of the
+    // hierarchy is the benchmark argument.
+    class SettingsRegistryDeepKeyBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t SiblingsPerLevel = 32;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            const size_t depth = aznumeric_cast<size_t>(state.range(0));
+            AZStd::string path;
+            for (size_t level = 0; level < depth; ++level)
+            {
+                for (size_t sibling = 0; sibling < SiblingsPerLevel; ++sibling)
+                {
+                    m_registry->Set(AZStd::string::format("%s/Sibling%zu", path.c_str(), sibling), AZ::s64{ 0 });
+                }
+                path += AZStd::string::format("/Level%zu", level);
+            }
+            m_path = path + "/Value";
+            m_registry->Set(m_path, AZ::s64{ 42 });
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_registry.reset();
+            AZStd::string().swap(m_path);
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_registry;
+        AZStd::string m_path;
+    };
+
+    BENCHMARK_DEFINE_F(SettingsRegistryDeepKeyBenchmarkFixture, BM_SettingsRegistry_GetDeepKeyWithPath)(benchmark::State& state)
+    {
+        AZ::s64 value = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_registry->Get(value, m_path);
+            benchmark::DoNotOptimize(value);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(SettingsRegistryDeepKeyBenchmarkFixture, BM_SettingsRegistry_GetDeepKeyWithPath)
+        ->ArgName("Depth")->Arg(2)->Arg(8)->Arg(16);
+
+    BENCHMARK_DEFINE_F(SettingsRegistryDeepKeyBenchmarkFixture, BM_SettingsRegistry_GetDeepKeyWithHandle)(benchmark::State& state)
+    {
+        AZ::SettingsRegistryImpl::PathHandle handle(m_path);
+        AZ::s64 value = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_registry->Get(value, handle);
+            benchmark::DoNotOptimize(value);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(SettingsRegistryDeepKeyBenchmarkFixture, BM_SettingsRegistry_GetDeepKeyWithHandle)
+        ->ArgName("Depth")->Arg(2)->Arg(8)->Arg(16);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
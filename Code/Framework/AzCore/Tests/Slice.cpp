@@ -892,5 +892,61 @@ namespace Benchmark
 
     BENCHMARK(BM_Slice_GenerateNewIdsAndFixRefs)->Arg(10)->Arg(1000);
 
+    static void BM_Slice_LoadBinary(benchmark::State& state)
+    {
+        AZ::ComponentApplication componentApp;
+
+        AZ::ComponentApplication::Descriptor desc;
+        desc.m_useExistingAllocator = true;
+
+        AZ::ComponentApplication::StartupParameters startupParams;
+        startupParams.m_allocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+
+        componentApp.Create(desc, startupParams);
+
+        AZ::SerializeContext* serializeContext = componentApp.GetSerializeContext();
+        UnitTest::MyTestComponent1::Reflect(serializeContext);
+        UnitTest::MyTestComponent2::Reflect(serializeContext);
+
+        // build a large slice, every entity has a handful of small components
+        AZ::SliceComponent::InstantiatedContainer container;
+        for (int64_t entityI = 0; entityI < state.range(0); ++entityI)
+        {
+            auto entity = aznew AZ::Entity();
+            for (int componentI = 0; componentI < 3; ++componentI)
+            {
+                auto component1 = entity->CreateComponent<UnitTest::MyTestComponent1>();
+                component1->m_float = static_cast<float>(entityI);
+                component1->m_int = componentI;
+            }
+            auto component2 = entity->CreateComponent<UnitTest::MyTestComponent2>();
+            if (entityI != 0)
+            {
+                component2->m_entityId = container.m_entities.back()->GetId();
+            }
+            container.m_entities.push_back(entity);
+        }
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        AZ::Utils::SaveObjectToStream(stream, AZ::ObjectStream::ST_BINARY, &container, serializeContext);
+
+        // compare loading with and without the compiled load plans of the SerializeContext
+        serializeContext->SetLoadPlansEnabled(state.range(1) != 0);
+        while (state.KeepRunning())
+        {
+            AZ::SliceComponent::InstantiatedContainer* loadedContainer =
+                AZ::Utils::LoadObjectFromBuffer<AZ::SliceComponent::InstantiatedContainer>(buffer.data(), buffer.size(), serializeContext);
+
+            state.PauseTiming();
+            delete loadedContainer;
+            state.ResumeTiming();
+        }
+        state.SetBytesProcessed(state.iterations() * buffer.size());
+        serializeContext->SetLoadPlansEnabled(true);
+    }
+
+    BENCHMARK(BM_Slice_LoadBinary)->ArgNames({ "Entities", "LoadPlans" })->Args({ 10000, 0 })->Args({ 10000, 1 })->Unit(benchmark::kMillisecond);
+
 } // namespace Benchmark
 #endif // HAVE_BENCHMARK
@@ -14,6 +14,7 @@
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <Tests/Streamer/StreamStackEntryConformityTests.h>
@@ -56,6 +57,7 @@ namespace AZ::IO
         {
             Uncompressed,
             Compressed,
+            CompressedWithDelay, // Compressed, but decompression takes a few milliseconds so jobs overlap.
             Corrupted
         };
 
@@ -94,13 +96,13 @@ namespace AZ::IO
             UnitTest::AllocatorsFixture::TearDown();
         }
 
-        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs)
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs, u32 maxNumBlockJobs = 0, u64 blockReadSize = 0)
         {
             m_buffer = new u32[m_fakeFileLength >> 2];
 
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_decompressor = AZStd::make_shared<FullFileDecompressor>(maxNumReads, maxNumJobs,
-                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment, maxNumBlockJobs, blockReadSize);
 
             m_context = new StreamerContext();
             m_decompressor->SetContext(*m_context);
@@ -112,7 +114,7 @@ namespace AZ::IO
             SetupEnvironment(1, 1);
         }
 
-        void MockReadCalls(ReadResult mockResult)
+        void MockReadCalls(ReadResult mockResult, int numReads = 1)
         {
             using ::testing::_;
             using ::testing::AnyNumber;
@@ -121,7 +123,7 @@ namespace AZ::IO
             EXPECT_CALL(*m_mock, ExecuteRequests())
                 .WillOnce(Return(true))
                 .WillRepeatedly(Return(false));
-            EXPECT_CALL(*m_mock, QueueRequest(_));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).Times(numReads);
             EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
                     
             switch (mockResult)
@@ -186,17 +188,45 @@ namespace AZ::IO
             return false;
         }
 
-        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult)
+        // Copies the data like Decompressor, but takes a few milliseconds and keeps track of how many decompressions overlap.
+        static bool DelayedDecompressor(const CompressionInfo&, const void* compressed, size_t compressedSize, void* uncompressed,
+            [[maybe_unused]] size_t uncompressedBufferSize)
+        {
+            u32 running = ++s_numRunningDecompressions;
+            u32 peak = s_peakRunningDecompressions.load();
+            while (running > peak && !s_peakRunningDecompressions.compare_exchange_weak(peak, running))
+            {
+            }
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+            memcpy(uncompressed, compressed, compressedSize);
+            --s_numRunningDecompressions;
+            return true;
+        }
+
+        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult,
+            size_t blockSize = 0)
         {
             CompressionInfo compressionInfo;
             compressionInfo.m_compressedSize = m_fakeFileLength;
-            compressionInfo.m_isCompressed = (compressionState == CompressionState::Compressed || compressionState == CompressionState::Corrupted);
+            compressionInfo.m_isCompressed = (compressionState != CompressionState::Uncompressed);
             compressionInfo.m_offset = 0;
             compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            if (blockSize > 0)
+            {
+                // The fake decompressor copies the data, so the compressed and uncompressed blocks are the same size.
+                for (size_t blockOffset = 0; blockOffset < m_fakeFileLength; blockOffset += blockSize)
+                {
+                    compressionInfo.m_seekPoints.push_back(CompressionSeekPoint{ blockOffset, blockOffset });
+                }
+            }
             if (compressionState == CompressionState::Corrupted)
             {
                 compressionInfo.m_decompressor = &Streamer_FullDecompressorTest::CorruptedDecompressor;
             }
+            else if (compressionState == CompressionState::CompressedWithDelay)
+            {
+                compressionInfo.m_decompressor = &Streamer_FullDecompressorTest::DelayedDecompressor;
+            }
             else
             {
                 compressionInfo.m_decompressor = [](const CompressionInfo&, const void* compressed,
@@ -316,6 +346,9 @@ namespace AZ::IO
         AZStd::shared_ptr<FullFileDecompressor> m_decompressor;
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
         u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+
+        inline static AZStd::atomic<u32> s_numRunningDecompressions{ 0 };
+        inline static AZStd::atomic<u32> s_peakRunningDecompressions{ 0 };
     };
 
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
@@ -394,4 +427,193 @@ namespace AZ::IO
         SetupEnvironment(4, 4);
         ProcessMultipleCompressedReads();
     }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_FullReadAndDecompressData_ReadsAreSplitAndDataIsDecompressed)
+    {
+        SetupEnvironment(1, 1, 4, 256 * 1024);
+        MockReadCalls(ReadResult::Success, 4);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed, 64 * 1024);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_PartialReadAndDecompressData_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 1, 4, 256 * 1024);
+        MockReadCalls(ReadResult::Success, 4);
+        ProcessCompressedRead(256, m_fakeFileLength - 512, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed, 64 * 1024);
+        VerifyReadBuffer(256, m_fakeFileLength - 512);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_ReadWithinSingleBlock_OnlyOverlappingBlockIsRead)
+    {
+        SetupEnvironment(1, 1, 4, 256 * 1024);
+        MockReadCalls(ReadResult::Success, 1);
+        ProcessCompressedRead(300 * 1024, 8 * 1024, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed, 64 * 1024);
+        VerifyReadBuffer(300 * 1024, 8 * 1024);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_SingleReadForAllBlocks_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 1, 4, 0);
+        MockReadCalls(ReadResult::Success, 1);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed, 64 * 1024);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_MoreBlocksThanBlockJobs_RunningJobsAreCapped)
+    {
+        constexpr u32 maxNumBlockJobs = 2;
+        s_peakRunningDecompressions = 0;
+        SetupEnvironment(1, 1, maxNumBlockJobs, 0);
+        MockReadCalls(ReadResult::Success, 1);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::CompressedWithDelay, IStreamerTypes::RequestStatus::Completed, 64 * 1024);
+        VerifyReadBuffer(0, m_fakeFileLength);
+        EXPECT_GE(maxNumBlockJobs, s_peakRunningDecompressions.load());
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_FailedRead_FailureIsDetectedAndReported)
+    {
+        SetupEnvironment(1, 1, 4, 256 * 1024);
+        MockReadCalls(ReadResult::Failed, 4);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Compressed, IStreamerTypes::RequestStatus::Failed, 64 * 1024);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_CorruptedArchiveRead_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment(1, 1, 4, 256 * 1024);
+        MockReadCalls(ReadResult::Success, 4);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Corrupted, IStreamerTypes::RequestStatus::Failed, 64 * 1024);
+    }
 } // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Decompresses a large file through the FullFileDecompressor, either as a single unit or split in independently compressed
+    // blocks. The first argument is the file size in megabytes, the second argument the block size in kilobytes or 0 for no blocks.
+    class FullDecompressorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        // Completes reads immediately. The content of the data isn't relevant for the benchmark.
+        class ImmediateReadEntry
+            : public AZ::IO::StreamStackEntry
+        {
+        public:
+            ImmediateReadEntry()
+                : AZ::IO::StreamStackEntry("Immediate read")
+            {
+            }
+
+            void QueueRequest(AZ::IO::FileRequest* request) override
+            {
+                request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+        };
+
+        static constexpr AZ::u32 Alignment = 4096;
+        static constexpr AZ::u64 ReadSize = 8 * 1024 * 1024;
+
+        // Stand-in for a real codec. Every byte depends on the previous one, so like zstd or zlib the cost scales with the amount of
+        // data and a single stream can't be sped up by more than one core.
+        static bool SyntheticDecompressor(const AZ::IO::CompressionInfo&, const void* compressed, size_t compressedSize,
+            void* uncompressed, [[maybe_unused]] size_t uncompressedBufferSize)
+        {
+            AZ_Assert(compressedSize == uncompressedBufferSize, "Synthetic decompressor requires matching buffer sizes.");
+            const AZ::u8* input = reinterpret_cast<const AZ::u8*>(compressed);
+            AZ::u8* output = reinterpret_cast<AZ::u8*>(uncompressed);
+            AZ::u32 state = 2166136261u;
+            for (size_t i = 0; i < compressedSize; ++i)
+            {
+                state = (state ^ input[i]) * 16777619u;
+                output[i] = aznumeric_cast<AZ::u8>(state >> 24);
+            }
+            return true;
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            const size_t fileSize = aznumeric_cast<size_t>(state.range(0)) * 1024 * 1024;
+            const size_t blockSize = aznumeric_cast<size_t>(state.range(1)) * 1024;
+
+            m_compressionInfo.m_compressedSize = fileSize;
+            m_compressionInfo.m_uncompressedSize = fileSize;
+            m_compressionInfo.m_isCompressed = true;
+            m_compressionInfo.m_decompressor = &SyntheticDecompressor;
+            if (blockSize > 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += blockSize)
+                {
+                    m_compressionInfo.m_seekPoints.push_back(AZ::IO::CompressionSeekPoint{ offset, offset });
+                }
+            }
+            m_output.resize_no_construct(fileSize);
+
+            m_context = new AZ::IO::StreamerContext();
+            m_decompressor = AZStd::make_shared<AZ::IO::FullFileDecompressor>(2, 2, Alignment, 0, ReadSize);
+            m_decompressor->SetNext(AZStd::make_shared<ImmediateReadEntry>());
+            m_decompressor->SetContext(*m_context);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_decompressor.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            AZStd::vector<AZ::u8>().swap(m_output);
+            m_compressionInfo = AZ::IO::CompressionInfo{};
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void ProcessRead()
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, m_compressionInfo, m_output.data(), 0, m_output.size());
+            m_decompressor->QueueRequest(request);
+
+            bool isIdle = false;
+            while (!isIdle)
+            {
+                m_decompressor->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                AZ::IO::StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                isIdle = status.m_isIdle;
+                if (!isIdle)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+
+        AZ::IO::CompressionInfo m_compressionInfo;
+        AZStd::vector<AZ::u8> m_output;
+        AZ::IO::StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<AZ::IO::FullFileDecompressor> m_decompressor;
+    };
+
+    BENCHMARK_DEFINE_F(FullDecompressorBenchmarkFixture, DecompressFile)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            ProcessRead();
+        }
+        state.SetBytesProcessed(state.iterations() * m_output.size());
+    }
+
+    BENCHMARK_REGISTER_F(FullDecompressorBenchmarkFixture, DecompressFile)
+        ->Args({ 64, 0 })->Args({ 64, 1024 })
+        ->Args({ 256, 0 })->Args({ 256, 1024 })
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PrefetchCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class PrefetchCacheTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<PrefetchCache>
+    {
+    public:
+        PrefetchCache CreateInstance() override
+        {
+            return PrefetchCache(1 * 1024 * 1024, 64 * 1024, AZCORE_GLOBAL_NEW_ALIGNMENT, 4, 4);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(Streamer_PrefetchCacheConformityTests, StreamStackEntryConformityTests, PrefetchCacheTestDescription);
+
+    class Streamer_PrefetchCacheTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        static constexpr u32 BlockSize = 4 * 1024;
+        static constexpr u64 ReadSize = 1024;
+        static constexpr u64 FileSize = 1024 * 1024;
+
+        void SetUp() override
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+
+            SetupAllocator();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_path.InitFromAbsolutePath("Test");
+            m_context = new StreamerContext();
+
+            m_cache = AZStd::make_shared<PrefetchCache>(8 * BlockSize, BlockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, 2, 4);
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_cache->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
+            m_cache->SetContext(*m_context);
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(::testing::Return(false));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, QueueRequest(_)).WillRepeatedly(Invoke(this, &Streamer_PrefetchCacheTest::QueueRequest));
+        }
+
+        void TearDown() override
+        {
+            m_cache = nullptr;
+            m_mock = nullptr;
+
+            delete m_context;
+            m_context = nullptr;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            TeardownAllocator();
+        }
+
+        void QueueRequest(FileRequest* request)
+        {
+            if (auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand()); data)
+            {
+                u8* output = reinterpret_cast<u8*>(data->m_output);
+                for (u64 i = 0; i < data->m_size; ++i)
+                {
+                    output[i] = aznumeric_cast<u8>((data->m_offset + i) & 0xff);
+                }
+                m_numDeviceReads++;
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            }
+            else if (auto metaData = AZStd::get_if<FileRequest::FileMetaDataRetrievalData>(&request->GetCommand()); metaData)
+            {
+                metaData->m_found = true;
+                metaData->m_fileSize = FileSize;
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            }
+            else
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            }
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void RunProcessLoop()
+        {
+            do
+            {
+                while (m_context->FinalizeCompletedRequests());
+                StreamStackEntry::Status status;
+                m_cache->UpdateStatus(status);
+            } while (m_cache->ExecuteRequests());
+        }
+
+        void ProcessRead(u64 offset)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, m_buffer, ReadSize, m_path, offset, ReadSize);
+            IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+            request->SetCompletionCallback([&result](const FileRequest& request)
+            {
+                result = request.GetStatus();
+            });
+
+            m_cache->QueueRequest(request);
+            RunProcessLoop();
+
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+            for (u64 i = 0; i < ReadSize; ++i)
+            {
+                ASSERT_EQ(aznumeric_cast<u8>((offset + i) & 0xff), m_buffer[i]);
+            }
+        }
+
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<PrefetchCache> m_cache;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        RequestPath m_path;
+        u8 m_buffer[ReadSize];
+        u64 m_numDeviceReads{ 0 };
+    };
+
+    TEST_F(Streamer_PrefetchCacheTest, ReadFile_SequentialReads_LaterReadsServicedFromReadAhead)
+    {
+        for (u64 i = 0; i < 16; ++i)
+        {
+            ProcessRead(i * ReadSize);
+        }
+
+        // The first reads are needed to detect the pattern, after which every block that's read ahead covers 4 reads.
+        EXPECT_LE(m_cache->GetNumMisses(), 3);
+        EXPECT_EQ(16, m_cache->GetNumHits() + m_cache->GetNumLateHits() + m_cache->GetNumMisses());
+        EXPECT_LT(m_numDeviceReads, 16);
+        EXPECT_EQ(0, m_cache->GetNumWastedBlocks());
+    }
+
+    TEST_F(Streamer_PrefetchCacheTest, ReadFile_StridedReads_LaterReadsServicedFromReadAhead)
+    {
+        constexpr u64 Stride = 8 * BlockSize;
+        for (u64 i = 0; i < 8; ++i)
+        {
+            ProcessRead(i * Stride);
+        }
+
+        // The first reads are needed to detect the stride, after which every read is predicted.
+        EXPECT_LE(m_cache->GetNumMisses(), 4);
+        EXPECT_GE(m_cache->GetNumHits() + m_cache->GetNumLateHits(), 4);
+        EXPECT_EQ(0, m_cache->GetNumWastedBlocks());
+    }
+
+    TEST_F(Streamer_PrefetchCacheTest, ReadFile_RandomReads_NothingIsReadAhead)
+    {
+        constexpr u64 offsets[] = { 9 * BlockSize, 2 * BlockSize, 31 * BlockSize, 17 * BlockSize, 5 * BlockSize, 60 * BlockSize };
+        for (u64 offset : offsets)
+        {
+            ProcessRead(offset);
+        }
+
+        EXPECT_EQ(0, m_cache->GetNumPrefetchedBlocks());
+        EXPECT_EQ(AZ_ARRAY_SIZE(offsets), m_cache->GetNumMisses());
+    }
+
+    TEST_F(Streamer_PrefetchCacheTest, ReadFile_PatternBreaks_UnusedReadAheadIsCountedAsWaste)
+    {
+        for (u64 i = 0; i < 3; ++i)
+        {
+            ProcessRead(i * ReadSize);
+        }
+        ASSERT_GT(m_cache->GetNumPrefetchedBlocks(), 0);
+
+        ProcessRead(100 * BlockSize);
+        EXPECT_EQ(m_cache->GetNumPrefetchedBlocks(), m_cache->GetNumWastedBlocks());
+    }
+
+    TEST_F(Streamer_PrefetchCacheTest, CollectStatistics_AfterReads_CountersAreReported)
+    {
+        using ::testing::_;
+
+        for (u64 i = 0; i < 8; ++i)
+        {
+            ProcessRead(i * ReadSize);
+        }
+
+        EXPECT_CALL(*m_mock, CollectStatistics(_)).Times(1);
+        AZStd::vector<Statistic> statistics;
+        m_cache->CollectStatistics(statistics);
+
+        bool foundHits = false;
+        for (const Statistic& statistic : statistics)
+        {
+            if (statistic.GetName() == "Hits")
+            {
+                foundHits = true;
+                EXPECT_EQ(aznumeric_cast<s64>(m_cache->GetNumHits()), statistic.GetIntegerValue());
+            }
+        }
+        EXPECT_TRUE(foundHits);
+    }
+} // namespace AZ::IO
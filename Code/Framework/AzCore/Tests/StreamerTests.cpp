@@ -10,6 +10,8 @@
 #include <FileIOBaseTestTypes.h>
 #include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
 #include <AzCore/IO/Streamer/Streamer.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
@@ -17,6 +19,7 @@
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/string.h>
 #include <AzTest/GemTestEnvironment.h>
 
@@ -572,6 +575,94 @@ namespace AZ
             delete[] buffer;
         }
 
+        // Reads a set of ranges from a file in a single request. The ranges are deliberately provided out of order and
+        // include adjacent ranges, ranges separated by small gaps and ranges far apart.
+        TYPED_TEST_P(StreamerTest, ReadRanges_ReadScatteredPieces_AllRangesRead)
+        {
+            constexpr size_t fileSize = 2_mib;
+            constexpr size_t rangeSize = 4_kib;
+            constexpr u64 rangeOffsets[] = { 1_mib, 0, rangeSize, 3 * rangeSize, 4 * rangeSize + 256, 512_kib, fileSize - rangeSize };
+            constexpr size_t numRanges = AZ_ARRAY_SIZE(rangeOffsets);
+
+            auto testFile = this->CreateTestFile(fileSize, PadArchive::No);
+
+            AZStd::unique_ptr<u8[]> buffer(new u8[numRanges * rangeSize]);
+            AZStd::vector<IStreamerTypes::ReadRange> ranges;
+            for (size_t i = 0; i < numRanges; ++i)
+            {
+                ranges.push_back(IStreamerTypes::ReadRange{ buffer.get() + i * rangeSize, rangeOffsets[i], rangeSize });
+            }
+
+            AZStd::binary_semaphore sync;
+            AZStd::atomic_bool readSuccessful = false;
+            auto callback = [&readSuccessful, &sync](FileRequestHandle request)
+            {
+                readSuccessful = AZ::Interface<IStreamer>::Get()->GetRequestStatus(request) == IStreamerTypes::RequestStatus::Completed;
+                sync.release();
+            };
+
+            FileRequestPtr request = this->m_streamer->ReadRanges(testFile->GetFileName(), AZStd::move(ranges));
+            this->m_streamer->SetRequestCompleteCallback(request, AZStd::move(callback));
+            this->m_streamer->QueueRequest(request);
+
+            bool hasTimedOut = !sync.try_acquire_for(AZStd::chrono::seconds(5));
+            ASSERT_FALSE(hasTimedOut);
+            ASSERT_TRUE(readSuccessful);
+
+            void* output = nullptr;
+            u64 numBytesRead = 0;
+            EXPECT_TRUE(this->m_streamer->GetReadRequestResult(request, output, numBytesRead));
+            EXPECT_EQ(buffer.get(), output);
+            EXPECT_EQ(numRanges * rangeSize, numBytesRead);
+
+            for (size_t i = 0; i < numRanges; ++i)
+            {
+                this->AssertTestFile(buffer.get() + i * rangeSize, rangeSize, rangeOffsets[i]);
+            }
+        }
+
+        // Maps part of a file and checks that the view contains the file's data. Compressed files can't be mapped, so the
+        // request is expected to fail for those.
+        TYPED_TEST_P(StreamerTest, MapFile_MapRangeOfFile_ViewContainsFileDataOrFailsWhenCompressed)
+        {
+            constexpr size_t fileSize = 256_kib;
+            constexpr u64 viewOffset = 64_kib;
+            constexpr u64 viewSize = 32_kib;
+            auto testFile = this->CreateTestFile(fileSize, PadArchive::No);
+
+            AZStd::binary_semaphore sync;
+            AZStd::atomic<IStreamerTypes::RequestStatus> status = IStreamerTypes::RequestStatus::Pending;
+            auto callback = [&status, &sync](FileRequestHandle request)
+            {
+                status = AZ::Interface<IStreamer>::Get()->GetRequestStatus(request);
+                sync.release();
+            };
+
+            FileRequestPtr request = this->m_streamer->MapFile(testFile->GetFileName(), viewOffset, viewSize);
+            this->m_streamer->SetRequestCompleteCallback(request, AZStd::move(callback));
+            this->m_streamer->QueueRequest(request);
+
+            bool hasTimedOut = !sync.try_acquire_for(AZStd::chrono::seconds(5));
+            ASSERT_FALSE(hasTimedOut);
+
+            MappedView view;
+            if (this->IsUsingArchive())
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, status.load());
+                EXPECT_FALSE(this->m_streamer->GetMapFileRequestResult(request, view));
+            }
+            else
+            {
+                ASSERT_EQ(IStreamerTypes::RequestStatus::Completed, status.load());
+                ASSERT_TRUE(this->m_streamer->GetMapFileRequestResult(request, view));
+                ASSERT_EQ(viewSize, view.size());
+
+                // The view keeps the mapping alive after the request has been released.
+                request.reset();
+                this->AssertTestFile(view.data(), view.size(), viewOffset);
+            }
+        }
+
         // Queue a request on a suspended device, then resume to see if gets picked up again.
         TYPED_TEST_P(StreamerTest, SuspendProcessing_SuspendWhileFileIsQueued_FileIsNotReadUntilProcessingIsRestarted)
         {
@@ -665,6 +756,8 @@ namespace AZ
             Read_ReadLargeFileEntirely_FileFullyRead,
             Read_ReadMultiplePieces_AllReadRequestWereSuccessful,
             Read_ReadMultiplePiecesWithBatch_AllReadRequestWereSuccessful,
+            ReadRanges_ReadScatteredPieces_AllRangesRead,
+            MapFile_MapRangeOfFile_ViewContainsFileDataOrFailsWhenCompressed,
             SuspendProcessing_SuspendWhileFileIsQueued_FileIsNotReadUntilProcessingIsRestarted,
             FlushCaches_FlushAfterEveryRead_FilesAreReadCorrectly);
 
@@ -675,3 +768,141 @@ namespace AZ
 
     } // namespace IO
 } // namespace AZ
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Reads a number of small scattered ranges from a single file, either with one read request per range or with a
+    // single ranges request. The range size is the benchmark argument.
+    class StreamerBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t FileSize = 4 * 1024 * 1024;
+        static constexpr size_t NumRanges = 64;
+        static constexpr AZ::u64 RangeGap = 512;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            m_fileIO = new UnitTest::TestFileIOBase();
+            AZ::IO::FileIOBase::SetInstance(m_fileIO);
+
+#if AZ_TRAIT_TEST_APPEND_ROOT_FOLDER_TO_PATH
+            AZ::IO::Path testFullPath(AZ_TRAIT_TEST_ROOT_FOLDER);
+#else
+            AZ::IO::Path testFullPath;
+#endif
+            testFullPath /= "StreamerBenchmark.test";
+            m_testFileName = testFullPath.Native();
+            AZ::IO::Utils::CreateTestFile(m_testFileName, FileSize, 0);
+
+            m_streamer = new AZ::IO::Streamer(AZStd::thread_desc{},
+                AZStd::make_unique<AZ::IO::Scheduler>(AZStd::make_shared<AZ::IO::StorageDrive>(1024)));
+
+            const size_t rangeSize = aznumeric_cast<size_t>(state.range(0));
+            m_buffer.resize_no_construct(NumRanges * rangeSize);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_streamer;
+            m_streamer = nullptr;
+
+            AZ::IO::FileIOBase::GetInstance()->DestroyPath(m_testFileName.c_str());
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+            delete m_fileIO;
+            m_fileIO = nullptr;
+
+            AZStd::vector<AZ::u8>().swap(m_buffer);
+            AZStd::string().swap(m_testFileName);
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Offset of a range in the file. Ranges are separated by a small gap and wrap around at the end of the file.
+        static AZ::u64 GetRangeOffset(size_t index, size_t rangeSize)
+        {
+            return (index * (rangeSize + RangeGap)) % (FileSize - rangeSize);
+        }
+
+        void WaitForRequests(AZStd::vector<AZ::IO::FileRequestPtr>& requests)
+        {
+            AZStd::binary_semaphore sync;
+            AZStd::atomic_int remaining = aznumeric_cast<int>(requests.size());
+            auto callback = [&sync, &remaining](AZ::IO::FileRequestHandle)
+            {
+                if (--remaining == 0)
+                {
+                    sync.release();
+                }
+            };
+            for (AZ::IO::FileRequestPtr& request : requests)
+            {
+                m_streamer->SetRequestCompleteCallback(request, callback);
+            }
+            m_streamer->QueueRequestBatch(requests);
+            sync.acquire();
+        }
+
+        void SetCounters(::benchmark::State& state)
+        {
+            const size_t rangeSize = aznumeric_cast<size_t>(state.range(0));
+            state.SetItemsProcessed(state.iterations() * NumRanges);
+            state.SetBytesProcessed(state.iterations() * NumRanges * rangeSize);
+        }
+
+        AZ::IO::Streamer* m_streamer{ nullptr };
+        AZ::IO::FileIOBase* m_prevFileIO{ nullptr };
+        UnitTest::TestFileIOBase* m_fileIO{ nullptr };
+        AZStd::string m_testFileName;
+        AZStd::vector<AZ::u8> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(StreamerBenchmarkFixture, IndividualReads)(benchmark::State& state)
+    {
+        const size_t rangeSize = aznumeric_cast<size_t>(state.range(0));
+        AZStd::vector<AZ::IO::FileRequestPtr> requests;
+        for (auto _ : state)
+        {
+            m_streamer->CreateRequestBatch(requests, NumRanges);
+            for (size_t i = 0; i < NumRanges; ++i)
+            {
+                m_streamer->Read(requests[i], m_testFileName, m_buffer.data() + i * rangeSize, rangeSize, rangeSize,
+                    AZ::IO::IStreamerTypes::s_noDeadline, AZ::IO::IStreamerTypes::s_priorityMedium, GetRangeOffset(i, rangeSize));
+            }
+            WaitForRequests(requests);
+            requests.clear();
+        }
+        SetCounters(state);
+    }
+
+    BENCHMARK_DEFINE_F(StreamerBenchmarkFixture, ReadRanges)(benchmark::State& state)
+    {
+        const size_t rangeSize = aznumeric_cast<size_t>(state.range(0));
+        AZStd::vector<AZ::IO::FileRequestPtr> requests;
+        for (auto _ : state)
+        {
+            AZStd::vector<AZ::IO::IStreamerTypes::ReadRange> ranges;
+            ranges.reserve(NumRanges);
+            for (size_t i = 0; i < NumRanges; ++i)
+            {
+                ranges.push_back(AZ::IO::IStreamerTypes::ReadRange{ m_buffer.data() + i * rangeSize, GetRangeOffset(i, rangeSize), rangeSize });
+            }
+            requests.push_back(m_streamer->ReadRanges(m_testFileName, AZStd::move(ranges)));
+            WaitForRequests(requests);
+            requests.clear();
+        }
+        SetCounters(state);
+    }
+
+    BENCHMARK_REGISTER_F(StreamerBenchmarkFixture, IndividualReads)->RangeMultiplier(4)->Range(256, 64 * 1024)->UseRealTime();
+    BENCHMARK_REGISTER_F(StreamerBenchmarkFixture, ReadRanges)->RangeMultiplier(4)->Range(256, 64 * 1024)->UseRealTime();
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
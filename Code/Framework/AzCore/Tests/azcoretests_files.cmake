@@ -51,6 +51,7 @@ set(FILES
     OrderedEventBenchmarks.cpp
     OrderedEventTests.cpp
     Outcome.cpp
+    ParallelTickBusTest.cpp
     Patching.cpp
     RemappableId.cpp
     Rtti.cpp
@@ -71,6 +72,7 @@ set(FILES
     XML.cpp
     Debug/AssetTracking.cpp
     Debug/LocalFileEventLoggerTests.cpp
+    Debug/TimelineRecorderTests.cpp
     Debug/Trace.cpp
     Name/NameJsonSerializerTests.cpp
     Name/NameTests.cpp
@@ -83,6 +85,7 @@ set(FILES
     Streamer/BlockCacheTests.cpp
     Streamer/DedicatedCacheTests.cpp
     Streamer/FullDecompressorTests.cpp
+    Streamer/PrefetchCacheTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
     Streamer/ReadSplitterTests.cpp
@@ -154,6 +157,9 @@ set(FILES
     Math/ShapeIntersectionPerformanceTests.cpp
     Math/ShapeIntersectionTests.cpp
     Math/SfmtTests.cpp
+    Math/SimdMathBatchBenchmarks.h
+    Math/SimdMathBatchPerformanceTests.cpp
+    Math/SimdMathBatchTests.cpp
     Math/SimdMathTests.cpp
     Math/SphereTests.cpp
     Math/SplineTests.cpp
@@ -166,6 +172,7 @@ set(FILES
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameArenaSchema.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
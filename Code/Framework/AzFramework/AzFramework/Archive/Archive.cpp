@@ -2545,6 +2545,20 @@ namespace AZ::IO
                     break;
                 }
 
+                // Large zstd compressed files are stored as independent frames with a seek table at the end, which lets the
+                // streamer decompress their blocks in parallel. The table is read through the archive's mapping, so the
+                // archive's file handle doesn't need to be locked and moved.
+                info.m_seekPoints.clear();
+                if (info.m_isCompressed && info.m_uncompressedSize > ZipDir::ZSTDSeekableFrameSize)
+                {
+                    AZStd::shared_ptr<const AZ::IO::MemoryMappedFile> mappedArchive = archive->GetMappedFile();
+                    if (mappedArchive && info.m_offset + info.m_compressedSize <= mappedArchive->GetSize())
+                    {
+                        ZipDir::ZipReadSeekTableZSTD(mappedArchive->GetData() + info.m_offset, info.m_compressedSize, info.m_uncompressedSize, info.m_seekPoints);
+                    }
+                }
+
+                // With seek points this is called once per frame, each frame is a complete zstd frame of its own.
                 info.m_decompressor = []([[maybe_unused]] const AZ::IO::CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)->bool
                 {
                     size_t nSizeUncompressed = uncompressedBufferSize;
@@ -2554,6 +2568,48 @@ namespace AZ::IO
         }
     }
 
+    AZ::IO::MappedView Archive::MapFileView(AZStd::string_view filename)
+    {
+        auto correctedFilename = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(filename);
+        if (!correctedFilename)
+        {
+            AZ_Assert(false, "Unable to resolve path for filepath %.*s", aznumeric_cast<int>(filename.size()), filename.data());
+            return {};
+        }
+
+        CheckFileAccess(correctedFilename->Native());
+
+        uint32_t archiveFlags = 0;
+        ZipDir::CachePtr archive;
+        CCachedFileDataPtr pFileData = GetFileData(correctedFilename->Native(), archiveFlags, &archive);
+        if (!pFileData || !archive)
+        {
+            return {};
+        }
+
+        // Only data that's stored as-is can be used in place. Encrypted data needs to be decrypted even if it's not compressed.
+        ZipDir::FileEntry* entry = pFileData->GetFileEntry();
+        if (!entry || !entry->IsInitialized() || entry->nMethod != ZipFile::METHOD_STORE || entry->desc.lSizeUncompressed == 0)
+        {
+            return {};
+        }
+
+        AZStd::shared_ptr<const AZ::IO::MemoryMappedFile> mappedArchive = archive->GetMappedFile();
+        if (!mappedArchive)
+        {
+            return {};
+        }
+
+        uint64_t offset = pFileData->GetFileDataOffset();
+        uint64_t size = entry->desc.lSizeUncompressed;
+        if (offset + size > mappedArchive->GetSize())
+        {
+            AZ_Error("Archive", false, "File '%s' extends beyond the end of archive '%s'.", correctedFilename->c_str(), archive->GetFilePath());
+            return {};
+        }
+        return AZ::IO::MappedView(AZStd::move(mappedArchive), offset, size);
+    }
+
     // return offset in archive file (ideally has to return offset on DVD)
     uint64_t Archive::GetFileOffsetOnMedia(AZStd::string_view sFilename) const
     {
@@ -297,6 +297,8 @@ namespace AZ::IO
 
         uint64_t GetFileOffsetOnMedia(AZStd::string_view szName) const override;
 
+        MappedView MapFileView(AZStd::string_view szName) override;
+
         EStreamSourceMediaType GetFileMediaType(AZStd::string_view szName) const override;
 
         // [LYN-2376] Remove once legacy slice support is removed
@@ -11,6 +11,7 @@
 
 #include <AzCore/EBus/Event.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MemoryMappedFile.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
@@ -417,6 +418,13 @@ namespace AZ::IO
         // Return offset in archive file (ideally has to return offset on DVD) for streaming requests sorting
         virtual uint64_t GetFileOffsetOnMedia(AZStd::string_view szName) const = 0;
 
+        // Summary:
+        //   Returns a read-only view of the data of a file in an archive that's backed by a memory mapping of the archive,
+        //   so the data can be used in place without being copied. The view keeps the mapping alive after the archive is closed.
+        //   Only files that are stored uncompressed and unencrypted in archives that are opened read-only can be mapped.
+        //   For any other file an invalid view is returned and the file should be read instead.
+        virtual MappedView MapFileView(AZStd::string_view szName) = 0;
+
         // Summary:
         // Return media type for the file
         virtual EStreamSourceMediaType GetFileMediaType(AZStd::string_view szName) const = 0;
@@ -9,6 +9,7 @@
 
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/string/conversions.h>
 
@@ -25,7 +26,6 @@
 #include <random>
 #include <cinttypes>
 #include <lz4frame.h>
-#include <zstd.h>
 #include <zlib.h>
 
 namespace AZ::IO::ZipDir
@@ -181,10 +181,33 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        {
+            AZStd::scoped_lock lock(m_mappedFileMutex);
+            m_mappedFile.reset();
+            m_mappingAttempted = true;
+        }
         m_allocator = nullptr;
         m_treeDir.Clear();
     }
 
+    AZStd::shared_ptr<const AZ::IO::MemoryMappedFile> Cache::GetMappedFile()
+    {
+        AZStd::scoped_lock lock(m_mappedFileMutex);
+        if (!m_mappingAttempted)
+        {
+            // Only archives that can't be modified are mapped, as writes would invalidate the offsets of files in existing views.
+            m_mappingAttempted = true;
+            if ((m_nFlags & FLAGS_READ_ONLY) && !m_strFilePath.empty())
+            {
+                if (auto resolvedPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(AZ::IO::PathView(m_strFilePath)); resolvedPath)
+                {
+                    m_mappedFile = AZ::IO::MemoryMappedFile::Map(resolvedPath->c_str());
+                }
+            }
+        }
+        return m_mappedFile;
+    }
+
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
     {
         if (size == 0)
@@ -245,7 +268,7 @@ namespace AZ::IO::ZipDir
         case CompressionCodec::Codec::ZLIB:
             return (uncompressedSize + (uncompressedSize >> 3) + 32);
         case CompressionCodec::Codec::ZSTD:
-            return ZSTD_compressBound(uncompressedSize);
+            return ZipRawCompressBoundZSTD(uncompressedSize);
         case CompressionCodec::Codec::LZ4:
             return LZ4F_compressFrameBound(uncompressedSize, nullptr);
         default:
@@ -16,7 +16,9 @@
 #pragma once
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MemoryMappedFile.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
@@ -105,6 +107,11 @@ namespace AZ::IO::ZipDir
             return m_strFilePath.c_str();
         }
 
+        // returns a read-only memory mapping of the whole zip file, which is created on first use.
+        // returns null if the zip file is opened for writing or couldn't be mapped
+        // MT-safe
+        AZStd::shared_ptr<const AZ::IO::MemoryMappedFile> GetMappedFile();
+
         FileEntryTree* GetRoot()
         {
             return &m_treeDir;
@@ -137,6 +144,11 @@ namespace AZ::IO::ZipDir
         AZ::IAllocatorAllocate* m_allocator;
         AZStd::string m_strFilePath;
 
+        // Lazily created mapping of the zip file. Views into the mapping keep it alive after the cache is closed.
+        AZStd::mutex m_mappedFileMutex;
+        AZStd::shared_ptr<const AZ::IO::MemoryMappedFile> m_mappedFile;
+        bool m_mappingAttempted{ false };
+
         // String Pool for persistently storing paths as long as they reside in the cache
         AZStd::unordered_set<AZStd::string> m_relativePathPool;
 
@@ -9,6 +9,7 @@
 
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzFramework/Archive/Codec.h>
@@ -316,6 +317,38 @@ namespace AZ::IO::ZipDir::ZipDirStructuresInternal
 
         return memoryBlock;
     }
+
+    // Layout of the seek table of the zstd seekable format, which is stored in a skippable frame at the end of the data:
+    // skippable frame header (magic, size), one entry per frame (compressed size, decompressed size, optional checksum),
+    // and a footer (number of frames, descriptor, seekable magic). All values are little endian.
+    static constexpr uint32_t ZSTDSeekTableMagic = 0x184D2A5E;
+    static constexpr uint32_t ZSTDSeekableMagic = 0x8F92EAB1;
+    static constexpr size_t ZSTDSkippableHeaderSize = 8;
+    static constexpr size_t ZSTDSeekTableEntrySize = 8;
+    static constexpr size_t ZSTDSeekTableChecksumSize = 4;
+    static constexpr size_t ZSTDSeekTableFooterSize = 9;
+    static constexpr uint8_t ZSTDSeekTableChecksumFlag = 0x80;
+    static constexpr uint8_t ZSTDSeekTableReservedBits = 0x7C;
+
+    static size_t GetZSTDSeekTableSize(size_t numFrames, size_t entrySize = ZSTDSeekTableEntrySize)
+    {
+        return ZSTDSkippableHeaderSize + numFrames * entrySize + ZSTDSeekTableFooterSize;
+    }
+
+    static uint8_t* WriteLE32(uint8_t* pDest, uint32_t value)
+    {
+        pDest[0] = static_cast<uint8_t>(value);
+        pDest[1] = static_cast<uint8_t>(value >> 8);
+        pDest[2] = static_cast<uint8_t>(value >> 16);
+        pDest[3] = static_cast<uint8_t>(value >> 24);
+        return pDest + 4;
+    }
+
+    static uint32_t ReadLE32(const uint8_t* pSrc)
+    {
+        return static_cast<uint32_t>(pSrc[0]) | (static_cast<uint32_t>(pSrc[1]) << 8) |
+            (static_cast<uint32_t>(pSrc[2]) << 16) | (static_cast<uint32_t>(pSrc[3]) << 24);
+    }
 }
 
 namespace AZ::IO::ZipDir
@@ -613,8 +646,65 @@ namespace AZ::IO::ZipDir
         return err;
     }
 
+    size_t ZipRawCompressBoundZSTD(size_t nSrcSize)
+    {
+        if (nSrcSize <= ZSTDSeekableFrameSize)
+        {
+            return ZSTD_compressBound(nSrcSize);
+        }
+        const size_t numFrames = (nSrcSize + ZSTDSeekableFrameSize - 1) / ZSTDSeekableFrameSize;
+        return numFrames * ZSTD_compressBound(ZSTDSeekableFrameSize) + ZipDirStructuresInternal::GetZSTDSeekTableSize(numFrames);
+    }
+
     int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
     {
+        using namespace ZipDirStructuresInternal;
+
+        if (nSrcSize > ZSTDSeekableFrameSize)
+        {
+            // Compress every frame on its own, so each one can be decompressed without the ones before it.
+            const size_t numFrames = (nSrcSize + ZSTDSeekableFrameSize - 1) / ZSTDSeekableFrameSize;
+            AZStd::vector<uint32_t> frameSizes;
+            frameSizes.reserve(numFrames);
+
+            const uint8_t* pSrc = static_cast<const uint8_t*>(pUncompressed);
+            uint8_t* pDest = static_cast<uint8_t*>(pCompressed);
+            size_t nCompressedSize = 0;
+            for (size_t nOffset = 0; nOffset < nSrcSize; nOffset += ZSTDSeekableFrameSize)
+            {
+                const size_t nFrameSize = AZStd::min(nSrcSize - nOffset, ZSTDSeekableFrameSize);
+                size_t result = ZSTD_compress(pDest + nCompressedSize, *pDestSize - nCompressedSize, pSrc + nOffset, nFrameSize, 1);
+                if (ZSTD_isError(result))
+                {
+                    AZ_Error("ZipDirStructures", false, "Error compressing using zstd: %s", ZSTD_getErrorName(result));
+                    return Z_BUF_ERROR;
+                }
+                frameSizes.push_back(aznumeric_caster(result));
+                nCompressedSize += result;
+            }
+
+            const size_t nSeekTableSize = GetZSTDSeekTableSize(numFrames);
+            if (*pDestSize - nCompressedSize < nSeekTableSize)
+            {
+                return Z_BUF_ERROR;
+            }
+
+            uint8_t* pTable = pDest + nCompressedSize;
+            pTable = WriteLE32(pTable, ZSTDSeekTableMagic);
+            pTable = WriteLE32(pTable, aznumeric_caster(nSeekTableSize - ZSTDSkippableHeaderSize));
+            for (size_t nFrame = 0; nFrame < numFrames; ++nFrame)
+            {
+                pTable = WriteLE32(pTable, frameSizes[nFrame]);
+                pTable = WriteLE32(pTable, aznumeric_caster(AZStd::min(nSrcSize - nFrame * ZSTDSeekableFrameSize, ZSTDSeekableFrameSize)));
+            }
+            pTable = WriteLE32(pTable, aznumeric_caster(numFrames));
+            *pTable++ = 0; // descriptor, no checksums
+            WriteLE32(pTable, ZSTDSeekableMagic);
+
+            *pDestSize = nCompressedSize + nSeekTableSize;
+            return Z_OK;
+        }
+
         size_t result = ZSTD_compress(pCompressed, *pDestSize, pUncompressed, nSrcSize, 1);
 
         int err = Z_OK;
@@ -631,6 +721,57 @@ namespace AZ::IO::ZipDir
         return err;
     }
 
+    bool ZipReadSeekTableZSTD(const void* pCompressed, size_t nSrcSize, size_t nUncompressedSize, AZStd::vector<AZ::IO::CompressionSeekPoint>& seekPoints)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        seekPoints.clear();
+        if (nSrcSize < GetZSTDSeekTableSize(0))
+        {
+            return false;
+        }
+
+        const uint8_t* pData = static_cast<const uint8_t*>(pCompressed);
+        const uint8_t* pFooter = pData + nSrcSize - ZSTDSeekTableFooterSize;
+        const uint8_t descriptor = pFooter[4];
+        if (ReadLE32(pFooter + 5) != ZSTDSeekableMagic || (descriptor & ZSTDSeekTableReservedBits) != 0)
+        {
+            return false;
+        }
+
+        const size_t numFrames = ReadLE32(pFooter);
+        const size_t entrySize = (descriptor & ZSTDSeekTableChecksumFlag) ? ZSTDSeekTableEntrySize + ZSTDSeekTableChecksumSize : ZSTDSeekTableEntrySize;
+        if (numFrames == 0 || numFrames > (nSrcSize - GetZSTDSeekTableSize(0)) / entrySize)
+        {
+            return false;
+        }
+
+        const size_t nSeekTableSize = GetZSTDSeekTableSize(numFrames, entrySize);
+        const uint8_t* pTable = pData + nSrcSize - nSeekTableSize;
+        if (ReadLE32(pTable) != ZSTDSeekTableMagic || ReadLE32(pTable + 4) != nSeekTableSize - ZSTDSkippableHeaderSize)
+        {
+            return false;
+        }
+
+        seekPoints.reserve(numFrames);
+        size_t nCompressedOffset = 0;
+        size_t nUncompressedOffset = 0;
+        for (const uint8_t* pEntry = pTable + ZSTDSkippableHeaderSize; pEntry < pFooter; pEntry += entrySize)
+        {
+            seekPoints.push_back({ nCompressedOffset, nUncompressedOffset });
+            nCompressedOffset += ReadLE32(pEntry);
+            nUncompressedOffset += ReadLE32(pEntry + 4);
+        }
+
+        // The frames have to cover all data in front of the table, and decompress to the full file.
+        if (nCompressedOffset != nSrcSize - nSeekTableSize || nUncompressedOffset != nUncompressedSize)
+        {
+            seekPoints.clear();
+            return false;
+        }
+        return true;
+    }
+
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
     {
         int returnCode = Z_OK;
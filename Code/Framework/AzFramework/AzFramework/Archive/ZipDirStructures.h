@@ -15,6 +15,7 @@
 #include <AzCore/base.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 
@@ -29,6 +30,7 @@ namespace AZ::IO
 {
     class FileIOBase;
     struct MemoryBlock;
+    struct CompressionSeekPoint;
 }
 
 namespace AZ::IO::ZipDir
@@ -146,6 +148,18 @@ namespace AZ::IO::ZipDir
     int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
 
+    // ZipRawCompressZSTD splits data larger than this into independently compressed frames of this size, followed by a seek
+    // table in the zstd seekable format. Plain zstd decompression skips the table, but it allows the frames to be decompressed
+    // in parallel.
+    inline constexpr size_t ZSTDSeekableFrameSize = 1024 * 1024;
+
+    // returns the size of the buffer ZipRawCompressZSTD needs to compress nSrcSize bytes
+    size_t ZipRawCompressBoundZSTD(size_t nSrcSize);
+
+    // reads the seek table at the end of data compressed by ZipRawCompressZSTD (or another zstd seekable format writer)
+    // returns false and leaves seekPoints empty if the data has no seek table, or the table doesn't match the data
+    bool ZipReadSeekTableZSTD(const void* pCompressed, size_t nSrcSize, size_t nUncompressedSize, AZStd::vector<AZ::IO::CompressionSeekPoint>& seekPoints);
+
     // fseek wrapper with memory in file support.
     int64_t FSeek(CZipFile* zipFile, int64_t origin, int command);
 
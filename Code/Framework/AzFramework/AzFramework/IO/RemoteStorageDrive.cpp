@@ -93,6 +93,24 @@ namespace AzFramework
             m_context->PushPreparedRequest(read);
             return;
         }
+        else if (AZStd::holds_alternative<FileRequest::ReadRangesRequestData>(request->GetCommand()))
+        {
+            // Remote files are read through the file io, which has no vectored reads, so read every range individually.
+            auto& rangesRequest = AZStd::get<FileRequest::ReadRangesRequestData>(request->GetCommand());
+            if (rangesRequest.m_ranges.empty())
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+                return;
+            }
+            for (const IStreamerTypes::ReadRange& range : rangesRequest.m_ranges)
+            {
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, range.m_output, range.m_size, rangesRequest.m_path, range.m_offset, range.m_size);
+                m_context->PushPreparedRequest(read);
+            }
+            return;
+        }
         StreamStackEntry::PrepareRequest(request);
     }
 
@@ -113,6 +131,24 @@ namespace AzFramework
                 m_pendingRequests.push_back(request);
                 return;
             }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReadRangesData>)
+            {
+                if (args.m_numRanges == 0)
+                {
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(request);
+                    return;
+                }
+                for (size_t i = 0; i < args.m_numRanges; ++i)
+                {
+                    const IStreamerTypes::ReadRange& range = args.m_ranges[i];
+                    FileRequest* read = m_context->GetNewInternalRequest();
+                    read->CreateRead(request, range.m_output, range.m_size, args.m_path, args.m_baseOffset + range.m_offset,
+                        range.m_size, args.m_sharedRead);
+                    m_pendingRequests.push_back(read);
+                }
+                return;
+            }
             else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
             {
                 if (CancelRequest(request, args.m_target))
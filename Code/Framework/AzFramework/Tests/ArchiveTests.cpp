@@ -23,6 +23,7 @@
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/ArchiveVars.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
 
 namespace UnitTest
 {
@@ -277,6 +278,140 @@ namespace UnitTest
         TestFGetCachedFileData(fileInArchiveFile, dataString.size(), dataString.data());
     }
 
+    TEST_F(ArchiveTestFixture, MapFileView_StoredAndCompressedFiles_OnlyStoredFileIsMappedAndOutlivesPack)
+    {
+        constexpr const char* storedFile = "levels\\mylevel\\stored.dat";
+        constexpr const char* compressedFile = "levels\\mylevel\\compressed.dat";
+        constexpr AZStd::string_view dataString = "HELLO MAPPED WORLD";
+        const char* testArchivePath = "@usercache@/mapfileview.pak";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, nullptr, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(storedFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        EXPECT_EQ(0, pArchive->UpdateFile(compressedFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        pArchive.reset();
+
+        // Only look in the archive so the files can't be found on disk instead.
+        CVarIntValueScope previousLocationPriority{ *console, "sys_pakPriority" };
+        console->PerformCommand("sys_PakPriority", { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::ArchiveLocationPriority::ePakPriorityPakOnly)) });
+
+        ASSERT_TRUE(archive->OpenPack("@assets@", testArchivePath));
+
+        AZ::IO::MappedView storedView = archive->MapFileView(storedFile);
+        ASSERT_TRUE(storedView.IsValid());
+        ASSERT_EQ(dataString.size(), storedView.size());
+        EXPECT_EQ(0, memcmp(dataString.data(), storedView.data(), dataString.size()));
+
+        // Compressed data can't be used in place, so the caller needs to read the file instead.
+        AZ::IO::MappedView compressedView = archive->MapFileView(compressedFile);
+        EXPECT_FALSE(compressedView.IsValid());
+
+        AZ::IO::MappedView missingView = archive->MapFileView("levels\\mylevel\\missing.dat");
+        EXPECT_FALSE(missingView.IsValid());
+
+        // The view keeps the mapping alive after the archive has been closed.
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        ASSERT_TRUE(storedView.IsValid());
+        EXPECT_EQ(0, memcmp(dataString.data(), storedView.data(), dataString.size()));
+
+        storedView.Reset();
+        fileIo->Remove(testArchivePath);
+    }
+
+    TEST_F(ArchiveTestFixture, FindCompressionInfo_LargeZstdFile_ProvidesSeekPointsOfIndependentFrames)
+    {
+        constexpr const char* largeFile = "levels\\mylevel\\large.dat";
+        constexpr const char* smallFile = "levels\\mylevel\\small.dat";
+        const char* testArchivePath = "@usercache@/seekpoints.pak";
+        const size_t largeSize = 2 * AZ::IO::ZipDir::ZSTDSeekableFrameSize + AZ::IO::ZipDir::ZSTDSeekableFrameSize / 2;
+        constexpr size_t smallSize = 4 * 1024;
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        AZStd::vector<uint8_t> data(largeSize);
+        for (size_t i = 0; i < largeSize; ++i)
+        {
+            data[i] = static_cast<uint8_t>((i * 7) ^ (i >> 9));
+        }
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, nullptr, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(largeFile, data.data(), largeSize, AZ::IO::INestedArchive::METHOD_COMPRESS,
+            AZ::IO::INestedArchive::LEVEL_FASTEST, CompressionCodec::Codec::ZSTD));
+        EXPECT_EQ(0, pArchive->UpdateFile(smallFile, data.data(), smallSize, AZ::IO::INestedArchive::METHOD_COMPRESS,
+            AZ::IO::INestedArchive::LEVEL_FASTEST, CompressionCodec::Codec::ZSTD));
+        pArchive.reset();
+
+        CVarIntValueScope previousLocationPriority{ *console, "sys_pakPriority" };
+        console->PerformCommand("sys_PakPriority", { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::ArchiveLocationPriority::ePakPriorityPakOnly)) });
+        ASSERT_TRUE(archive->OpenPack("@assets@", testArchivePath));
+
+        // Files that fit in a single frame don't need seek points.
+        AZ::IO::CompressionInfo smallInfo;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(smallInfo, smallFile));
+        EXPECT_TRUE(smallInfo.m_seekPoints.empty());
+
+        AZ::IO::CompressionInfo info;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(info, largeFile));
+        EXPECT_TRUE(info.m_isCompressed);
+        ASSERT_EQ(3, info.m_seekPoints.size());
+        for (size_t block = 0; block < info.m_seekPoints.size(); ++block)
+        {
+            EXPECT_EQ(block * AZ::IO::ZipDir::ZSTDSeekableFrameSize, info.m_seekPoints[block].m_uncompressedOffset);
+        }
+        EXPECT_EQ(0, info.m_seekPoints[0].m_compressedOffset);
+
+        // Read the compressed file from the archive and decompress every block on its own, in reverse order, the way the
+        // streamer's block decompression calls the decompressor.
+        AZStd::vector<uint8_t> compressed(info.m_compressedSize);
+        AZ::IO::HandleType archiveHandle = AZ::IO::InvalidHandle;
+        ASSERT_EQ(AZ::IO::ResultCode::Success, fileIo->Open(testArchivePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, archiveHandle));
+        EXPECT_EQ(AZ::IO::ResultCode::Success, fileIo->Seek(archiveHandle, info.m_offset, AZ::IO::SeekType::SeekFromStart));
+        EXPECT_EQ(AZ::IO::ResultCode::Success, fileIo->Read(archiveHandle, compressed.data(), compressed.size(), true));
+        fileIo->Close(archiveHandle);
+
+        AZStd::vector<uint8_t> decompressed(largeSize);
+        for (size_t block = info.m_seekPoints.size(); block-- > 0;)
+        {
+            const bool isLast = block + 1 == info.m_seekPoints.size();
+            const AZ::IO::CompressionSeekPoint& start = info.m_seekPoints[block];
+            const size_t compressedEnd = isLast ? info.m_compressedSize : info.m_seekPoints[block + 1].m_compressedOffset;
+            const size_t uncompressedEnd = isLast ? info.m_uncompressedSize : info.m_seekPoints[block + 1].m_uncompressedOffset;
+            EXPECT_TRUE(info.m_decompressor(info, compressed.data() + start.m_compressedOffset, compressedEnd - start.m_compressedOffset,
+                decompressed.data() + start.m_uncompressedOffset, uncompressedEnd - start.m_uncompressedOffset));
+        }
+        EXPECT_TRUE(data == decompressed);
+
+        // The archive itself still reads the file as a whole, skipping the seek table.
+        AZStd::vector<uint8_t> readBack(largeSize);
+        AZ::IO::HandleType fileHandle = archive->FOpen(largeFile, "rb");
+        ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+        EXPECT_EQ(largeSize, archive->FReadRawAll(readBack.data(), largeSize, fileHandle));
+        archive->FClose(fileHandle);
+        EXPECT_TRUE(data == readBack);
+
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        fileIo->Remove(testArchivePath);
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_FindsMultiplePaks_Works)
     {
         AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AzNetworking
+{
+    //! @class SpscRingBuffer
+    //! @brief Lock-free queue of variable sized records, for handing data from exactly one producer thread to exactly one consumer thread.
+    //!
+    //! Records are written and read in place, so a record is always contiguous in memory. A record that doesn't fit before the
+    //! end of the buffer is written at the start instead, which may waste up to one record worth of space.
+    template <uint32_t SIZE>
+    class SpscRingBuffer
+    {
+    public:
+
+        static_assert((SIZE & (SIZE - 1)) == 0, "SpscRingBuffer size must be a power of 2");
+
+        //! Records are aligned so their contents can hold any trivially copyable type.
+        static constexpr uint32_t RecordAlignment = 8;
+
+        //! The largest record the buffer can ever hold.
+        static constexpr uint32_t MaxRecordSize = SIZE / 2 - RecordAlignment;
+
+        SpscRingBuffer() = default;
+        ~SpscRingBuffer() = default;
+
+        //! Producer only, reserves space for a record of up to maxSize bytes.
+        //! @param maxSize the maximum number of bytes that will be written to the record
+        //! @return pointer to write the record to, or nullptr if there is currently insufficient free space
+        uint8_t* BeginWrite(uint32_t maxSize);
+
+        //! Producer only, publishes the record reserved by the last call to BeginWrite to the consumer.
+        //! @param size the number of bytes actually written to the record, at most the maxSize passed to BeginWrite
+        void EndWrite(uint32_t size);
+
+        //! Producer only, copies a record into the buffer.
+        //! @param data pointer to the record to copy
+        //! @param size size of the record in bytes
+        //! @return boolean true on success, false if there was insufficient free space
+        bool Write(const void* data, uint32_t size);
+
+        //! Consumer only, retrieves the oldest record published by the producer.
+        //! @param outSize on success, the size of the record in bytes
+        //! @return pointer to the record, or nullptr if the buffer is empty
+        const uint8_t* BeginRead(uint32_t& outSize);
+
+        //! Consumer only, releases the record returned by the last call to BeginRead so the producer can reuse its space.
+        void EndRead();
+
+        //! Returns true if the buffer contains no published records, only a hint when called concurrently with the producer.
+        //! @return boolean true if the buffer contains no published records
+        bool IsEmpty() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(SpscRingBuffer);
+
+        static constexpr uint32_t HeaderSize = RecordAlignment;
+        static constexpr uint32_t WrapMarker = 0xFFFFFFFF;
+        static constexpr uint64_t OffsetMask = SIZE - 1;
+
+        static constexpr uint32_t GetRecordSize(uint32_t size);
+
+        // Offsets increase monotonically and are masked on access, so full and empty are never ambiguous
+        alignas(64) AZStd::atomic<uint64_t> m_writeOffset = 0;
+        alignas(64) AZStd::atomic<uint64_t> m_readOffset = 0;
+
+        // Producer owned state for the record currently being written
+        alignas(64) uint64_t m_reservedOffset = 0;
+        uint32_t m_reservedSize = 0;
+
+        // Consumer owned state for the record currently being read
+        alignas(64) uint32_t m_readRecordSize = 0;
+
+        alignas(RecordAlignment) uint8_t m_buffer[SIZE];
+    };
+}
+
+#include <AzNetworking/DataStructures/SpscRingBuffer.inl>
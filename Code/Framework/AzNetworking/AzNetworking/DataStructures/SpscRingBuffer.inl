@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    template <uint32_t SIZE>
+    inline uint8_t* SpscRingBuffer<SIZE>::BeginWrite(uint32_t maxSize)
+    {
+        AZ_Assert(maxSize <= MaxRecordSize, "Record size %u exceeds the maximum record size %u", maxSize, MaxRecordSize);
+
+        const uint32_t recordSize = GetRecordSize(maxSize);
+        const uint64_t writeOffset = m_writeOffset.load(AZStd::memory_order_relaxed);
+        const uint32_t tailSize = SIZE - aznumeric_cast<uint32_t>(writeOffset & OffsetMask);
+        const uint32_t skipSize = (tailSize < recordSize) ? tailSize : 0;
+
+        const uint64_t readOffset = m_readOffset.load(AZStd::memory_order_acquire);
+        if (writeOffset + skipSize + recordSize - readOffset > SIZE)
+        {
+            return nullptr;
+        }
+
+        if (skipSize > 0)
+        {
+            // The record doesn't fit before the end of the buffer, leave a marker telling the consumer to continue from the start
+            const uint32_t wrapMarker = WrapMarker;
+            memcpy(m_buffer + (writeOffset & OffsetMask), &wrapMarker, sizeof(wrapMarker));
+        }
+
+        m_reservedOffset = writeOffset + skipSize;
+        m_reservedSize = maxSize;
+        return m_buffer + (m_reservedOffset & OffsetMask) + HeaderSize;
+    }
+
+    template <uint32_t SIZE>
+    inline void SpscRingBuffer<SIZE>::EndWrite(uint32_t size)
+    {
+        AZ_Assert(size <= m_reservedSize, "Record size %u exceeds the reserved size %u", size, m_reservedSize);
+        memcpy(m_buffer + (m_reservedOffset & OffsetMask), &size, sizeof(size));
+        m_writeOffset.store(m_reservedOffset + GetRecordSize(size), AZStd::memory_order_release);
+        m_reservedSize = 0;
+    }
+
+    template <uint32_t SIZE>
+    inline bool SpscRingBuffer<SIZE>::Write(const void* data, uint32_t size)
+    {
+        uint8_t* record = BeginWrite(size);
+        if (record == nullptr)
+        {
+            return false;
+        }
+        memcpy(record, data, size);
+        EndWrite(size);
+        return true;
+    }
+
+    template <uint32_t SIZE>
+    inline const uint8_t* SpscRingBuffer<SIZE>::BeginRead(uint32_t& outSize)
+    {
+        uint64_t readOffset = m_readOffset.load(AZStd::memory_order_relaxed);
+        const uint64_t writeOffset = m_writeOffset.load(AZStd::memory_order_acquire);
+        if (readOffset == writeOffset)
+        {
+            return nullptr;
+        }
+
+        uint32_t recordSize = 0;
+        memcpy(&recordSize, m_buffer + (readOffset & OffsetMask), sizeof(recordSize));
+        if (recordSize == WrapMarker)
+        {
+            // A wrap marker is always published together with the record that follows it
+            readOffset += SIZE - (readOffset & OffsetMask);
+            m_readOffset.store(readOffset, AZStd::memory_order_release);
+            memcpy(&recordSize, m_buffer, sizeof(recordSize));
+        }
+
+        m_readRecordSize = GetRecordSize(recordSize);
+        outSize = recordSize;
+        return m_buffer + (readOffset & OffsetMask) + HeaderSize;
+    }
+
+    template <uint32_t SIZE>
+    inline void SpscRingBuffer<SIZE>::EndRead()
+    {
+        AZ_Assert(m_readRecordSize > 0, "EndRead called without a matching BeginRead");
+        const uint64_t readOffset = m_readOffset.load(AZStd::memory_order_relaxed);
+        m_readOffset.store(readOffset + m_readRecordSize, AZStd::memory_order_release);
+        m_readRecordSize = 0;
+    }
+
+    template <uint32_t SIZE>
+    inline bool SpscRingBuffer<SIZE>::IsEmpty() const
+    {
+        return m_readOffset.load(AZStd::memory_order_acquire) == m_writeOffset.load(AZStd::memory_order_acquire);
+    }
+
+    template <uint32_t SIZE>
+    inline constexpr uint32_t SpscRingBuffer<SIZE>::GetRecordSize(uint32_t size)
+    {
+        return (HeaderSize + size + RecordAlignment - 1) & ~(RecordAlignment - 1);
+    }
+}
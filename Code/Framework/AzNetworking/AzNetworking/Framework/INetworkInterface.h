@@ -74,6 +74,10 @@ namespace AzNetworking
         //! @param deltaTimeMs milliseconds since update was last invoked
         virtual void Update(AZ::TimeMs deltaTimeMs) = 0;
 
+        //! Transmits any packets the network interface has queued for a batched send.
+        //! Update flushes on its own, this is for callers that send a burst of packets between updates and want them on the wire immediately.
+        virtual void Flush() = 0;
+
         //! A helper function that transmits a packet on this connection reliably.
         //! Note that a packetId is not returned here, since retransmits may cause the packetId to change
         //! @param connectionId identifier of the connection to send to
@@ -46,6 +46,15 @@ namespace AzNetworking
         //! @return pointer to the instantiated network interface, or nullptr on error
         virtual INetworkInterface* CreateNetworkInterface(AZ::Name name, ProtocolType protocolType, TrustZone trustZone, IConnectionListener& listener) = 0;
 
+        //! Creates a new Udp network interface that spreads its connections across shardCount worker threads.
+        //! Caller does not assume ownership, instance should be destroyed by calling DestroyNetworkInterface
+        //! @param name       the name to assign to this network interface
+        //! @param trustZone  the trust level associated with this network interface (client to server or server to server)
+        //! @param listener   the connection listener responsible for handling connection events
+        //! @param shardCount the number of worker threads, each owning its own socket and subset of connections
+        //! @return pointer to the instantiated network interface, or nullptr on error
+        virtual INetworkInterface* CreateShardedNetworkInterface(AZ::Name name, TrustZone trustZone, IConnectionListener& listener, uint32_t shardCount) = 0;
+
         //! Retrieves a network interface instance by name.
         //! @param name the name of the network interface to retrieve
         //! @return pointer to the requested network interface, or nullptr on error
@@ -9,6 +9,7 @@
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
+#include <AzNetworking/UdpTransport/UdpShardedNetworkInterface.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -107,6 +108,17 @@ namespace AzNetworking
         return returnResult;
     }
 
+    INetworkInterface* NetworkingSystemComponent::CreateShardedNetworkInterface(AZ::Name name, TrustZone trustZone, IConnectionListener& listener, uint32_t shardCount)
+    {
+        AZ_Assert(RetrieveNetworkInterface(name) == nullptr, "A network interface with this name already exists");
+
+        // Shards own their reader threads, so unlike CreateNetworkInterface the shared reader thread isn't used here
+        AZStd::unique_ptr<INetworkInterface> result = AZStd::make_unique<UdpShardedNetworkInterface>(name, listener, trustZone, shardCount);
+        INetworkInterface* returnResult = result.get();
+        m_networkInterfaces.emplace(name, AZStd::move(result));
+        return returnResult;
+    }
+
     INetworkInterface* NetworkingSystemComponent::RetrieveNetworkInterface(AZ::Name name)
     {
         auto networkInterface = m_networkInterfaces.find(name);
@@ -54,6 +54,7 @@ namespace AzNetworking
         //! INetworking overrides.
         //! @{
         INetworkInterface* CreateNetworkInterface(AZ::Name name, ProtocolType protocolType, TrustZone trustZone, IConnectionListener& listener) override;
+        INetworkInterface* CreateShardedNetworkInterface(AZ::Name name, TrustZone trustZone, IConnectionListener& listener, uint32_t shardCount) override;
         INetworkInterface* RetrieveNetworkInterface(AZ::Name name) override;
         bool DestroyNetworkInterface(AZ::Name name) override;
         void RegisterCompressorFactory(ICompressorFactory* factory) override;
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/SnapshotDelta.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    // Block and byte masks are stored in a uint8_t
+    static_assert(SnapshotDelta::BlockSize <= 8, "SnapshotDelta blocks must fit in a byte mask");
+    static constexpr uint32_t BlocksPerGroup = 8;
+
+    SnapshotDelta::SnapshotDelta(const uint8_t* baseline, uint32_t baselineSize)
+        : m_baseline(baseline)
+        , m_baselineSize((baseline != nullptr) ? baselineSize : 0)
+    {
+        ;
+    }
+
+    bool SnapshotDelta::Serialize(ISerializer& serializer, uint8_t* snapshot, uint32_t snapshotCapacity, uint32_t& snapshotSize) const
+    {
+        const bool isEncoding = (serializer.GetSerializerMode() == SerializerMode::ReadFromObject);
+        if (!serializer.Serialize(snapshotSize, "SnapshotSize", 0u, snapshotCapacity) || (snapshotSize > snapshotCapacity))
+        {
+            return false;
+        }
+
+        const uint32_t blockCount = (snapshotSize + BlockSize - 1) / BlockSize;
+        for (uint32_t groupStart = 0; groupStart < blockCount; groupStart += BlocksPerGroup)
+        {
+            const uint32_t groupEnd = AZStd::min(groupStart + BlocksPerGroup, blockCount);
+
+            // One bit per block, flagging which blocks differ from the baseline
+            uint8_t groupMask = 0;
+            if (isEncoding)
+            {
+                for (uint32_t block = groupStart; block < groupEnd; ++block)
+                {
+                    const uint32_t blockStart = block * BlockSize;
+                    if (CalculateBlockMask(snapshot, blockStart, AZStd::min(blockStart + BlockSize, snapshotSize)) != 0)
+                    {
+                        groupMask |= static_cast<uint8_t>(1 << (block - groupStart));
+                    }
+                }
+            }
+            serializer.Serialize(groupMask, "GroupMask");
+
+            for (uint32_t block = groupStart; block < groupEnd; ++block)
+            {
+                const uint32_t blockStart = block * BlockSize;
+                const uint32_t blockEnd = AZStd::min(blockStart + BlockSize, snapshotSize);
+
+                // One bit per byte within a changed block, flagging which bytes are transmitted
+                uint8_t blockMask = 0;
+                if (groupMask & (1 << (block - groupStart)))
+                {
+                    if (isEncoding)
+                    {
+                        blockMask = CalculateBlockMask(snapshot, blockStart, blockEnd);
+                    }
+                    serializer.Serialize(blockMask, "BlockMask");
+                }
+
+                for (uint32_t index = blockStart; index < blockEnd; ++index)
+                {
+                    if (blockMask & (1 << (index - blockStart)))
+                    {
+                        serializer.Serialize(snapshot[index], "Byte");
+                    }
+                    else if (!isEncoding)
+                    {
+                        snapshot[index] = GetBaselineByte(index);
+                    }
+                }
+            }
+        }
+
+        return serializer.IsValid();
+    }
+
+    uint8_t SnapshotDelta::GetBaselineByte(uint32_t index) const
+    {
+        // Anything past the end of the baseline is treated as zero, so snapshots are free to grow
+        return (index < m_baselineSize) ? m_baseline[index] : 0;
+    }
+
+    uint8_t SnapshotDelta::CalculateBlockMask(const uint8_t* snapshot, uint32_t blockStart, uint32_t blockEnd) const
+    {
+        uint8_t blockMask = 0;
+        for (uint32_t index = blockStart; index < blockEnd; ++index)
+        {
+            if (snapshot[index] != GetBaselineByte(index))
+            {
+                blockMask |= static_cast<uint8_t>(1 << (index - blockStart));
+            }
+        }
+        return blockMask;
+    }
+}
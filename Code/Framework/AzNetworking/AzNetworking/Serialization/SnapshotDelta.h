@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! @class SnapshotDelta
+    //! @brief Encodes a serialized snapshot as a bit-packed delta against a baseline snapshot both endpoints already hold.
+    //! The snapshot is split into blocks of BlockSize bytes, and a bit per block flags which blocks differ from the baseline.
+    //! Each changed block carries a byte mask followed by only the bytes that changed. State that changes slightly every
+    //! tick, such as quantized positions, typically only touches the low order bytes of a value, so unchanged regions of the
+    //! snapshot cost a single bit per block.
+    //! NOTE: Snapshots should be serialized with a stable layout, shifting data within the snapshot defeats the delta
+    class SnapshotDelta
+    {
+    public:
+
+        static constexpr uint32_t BlockSize = 8;
+
+        //! Constructs a delta against the provided baseline, the baseline must outlive this instance.
+        //! @param baseline     the baseline snapshot, or nullptr to encode the full snapshot
+        //! @param baselineSize the size of the baseline snapshot in bytes
+        SnapshotDelta(const uint8_t* baseline, uint32_t baselineSize);
+
+        //! Serializes a snapshot as a delta against the baseline.
+        //! Reading from the object encodes the snapshot, writing to the object reconstructs the snapshot from the baseline.
+        //! @param serializer       ISerializer instance to use for serialization
+        //! @param snapshot         the snapshot to encode, or the buffer to reconstruct the snapshot into
+        //! @param snapshotCapacity the capacity of the snapshot buffer in bytes
+        //! @param snapshotSize     the size of the snapshot in bytes, set to the reconstructed size when writing to the object
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer, uint8_t* snapshot, uint32_t snapshotCapacity, uint32_t& snapshotSize) const;
+
+    private:
+
+        uint8_t GetBaselineByte(uint32_t index) const;
+        uint8_t CalculateBlockMask(const uint8_t* snapshot, uint32_t blockStart, uint32_t blockEnd) const;
+
+        const uint8_t* m_baseline = nullptr;
+        uint32_t m_baselineSize = 0;
+    };
+}
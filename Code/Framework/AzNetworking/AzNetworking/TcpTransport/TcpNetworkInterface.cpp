@@ -128,6 +128,11 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void TcpNetworkInterface::Flush()
+    {
+        // TCP sends are written straight to the socket, nothing is ever queued
+    }
+
     bool TcpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
@@ -331,6 +331,9 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Put anything queued for a batched send during this update on the wire before sampling metrics
+        m_socket->FlushSends();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -343,6 +346,14 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void UdpNetworkInterface::Flush()
+    {
+        if (m_socket->IsOpen())
+        {
+            m_socket->FlushSends();
+        }
+    }
+
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
@@ -397,6 +408,11 @@ namespace AzNetworking
         return connection->Disconnect(reason, TerminationEndpoint::Local);
     }
 
+    void UdpNetworkInterface::SetPortSharing(bool portSharing)
+    {
+        m_socket->SetPortSharing(portSharing);
+    }
+
     bool UdpNetworkInterface::IsEncrypted() const
     {
         return m_socket->IsEncrypted();
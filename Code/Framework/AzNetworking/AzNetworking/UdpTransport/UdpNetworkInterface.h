@@ -99,6 +99,7 @@ namespace AzNetworking
         bool Listen(uint16_t port) override;
         ConnectionId Connect(const IpAddress& remoteAddress) override;
         void Update(AZ::TimeMs deltaTimeMs) override;
+        void Flush() override;
         bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
@@ -106,6 +107,11 @@ namespace AzNetworking
         bool Disconnect(ConnectionId connectionId, DisconnectReason reason) override;
         //! @}
 
+        //! Allows the socket of this network interface to share its listen port with other network interfaces, see UdpSocket::SetPortSharing.
+        //! Must be called before Listen.
+        //! @param portSharing if true, the listen port will be shared with other network interfaces that also enable port sharing
+        void SetPortSharing(bool portSharing);
+
         //! Returns true if this is an encrypted socket, false if not.
         //! @return boolean true if this is an encrypted socket, false if not
         bool IsEncrypted() const;
@@ -11,12 +11,16 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AzNetworking
 {
     static constexpr AZ::TimeMs ReaderThreadUpdateRateMs{ 10 };
 
     AZ_CVAR(AZ::TimeMs, net_UdpMaxReadTimeMs, ReaderThreadUpdateRateMs, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The amount of time to allow the reader thread to read data off registered sockets");
+    AZ_CVAR(uint32_t, net_UdpReceiveBatchSize, UdpSocket::MaxBatchedDatagrams, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The maximum number of datagrams the reader thread reads off a socket per system call, on platforms that support batched receives");
 
     UdpReaderThread::UdpReaderThread()
         : TimedThread("UdpReaderThread", ReaderThreadUpdateRateMs)
@@ -158,6 +162,7 @@ namespace AzNetworking
         AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
         ReaderBuffer& back = m_readerBuffers[m_backIndex];
         ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer = back.m_receiveBuffer;
+        AZStd::array<UdpSocket::ReceivedDatagram, UdpSocket::MaxBatchedDatagrams> datagrams;
         for (auto& socketEntry : back.m_entries)
         {
             UdpSocket* socket = socketEntry.m_socket;
@@ -176,27 +181,50 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = receiveBuffer.GetSize();
-                if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
+                const uint32_t bufferSlots = aznumeric_cast<uint32_t>((receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit);
+                if (bufferSlots == 0)
                 {
                     AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
                         aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
                     break;
                 }
 
+                const uint32_t packetSlots = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t maxBatchSize = AZStd::clamp(static_cast<uint32_t>(net_UdpReceiveBatchSize), 1u, UdpSocket::MaxBatchedDatagrams);
+                const uint32_t batchSize = AZStd::min(AZStd::min(maxBatchSize, bufferSlots), packetSlots);
+                if (batchSize == 0)
+                {
+                    break;
+                }
+
+                // Each datagram in the batch is received into its own MTU sized slot
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + batchSize * MaxUdpTransmissionUnit);
+
+                const int32_t receivedCount = socket->ReceiveBatch(datagrams.data(), dstData, batchSize);
+                if (receivedCount <= 0)
+                {
+                    receiveBuffer.Resize(bufferHead);
+                    break;
+                }
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                for (int32_t index = 0; index < receivedCount; ++index)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    const UdpSocket::ReceivedDatagram& datagram = datagrams[index];
+                    if (datagram.m_receivedBytes > 0)
+                    {
+                        receivedPackets.push_back(ReceivedPacket(datagram.m_address, datagram.m_data, datagram.m_receivedBytes));
+                    }
                 }
-                else
+
+                // Release the unused space following the last datagram received
+                const UdpSocket::ReceivedDatagram& lastDatagram = datagrams[receivedCount - 1];
+                receiveBuffer.Resize(bufferHead + (receivedCount - 1) * MaxUdpTransmissionUnit + AZStd::max(lastDatagram.m_receivedBytes, 0));
+
+                if (aznumeric_cast<uint32_t>(receivedCount) < batchSize)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained
                     break;
                 }
             }
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpShardedConnection.h>
+#include <AzNetworking/UdpTransport/UdpShardedNetworkInterface.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    UdpShardedConnection::UdpShardedConnection
+    (
+        ConnectionId connectionId,
+        const IpAddress& remoteAddress,
+        UdpShardedNetworkInterface& networkInterface,
+        uint32_t shardIndex,
+        ConnectionRole connectionRole
+    )
+        : IConnection(connectionId, remoteAddress)
+        , m_networkInterface(networkInterface)
+        , m_shardIndex(shardIndex)
+        , m_connectionRole(connectionRole)
+    {
+        m_ackedPacketIds.fill(InvalidPacketId);
+    }
+
+    UdpShardedConnection::~UdpShardedConnection()
+    {
+        if (m_state == ConnectionState::Connected)
+        {
+            m_networkInterface.GetConnectionListener().OnDisconnect(this, DisconnectReason::ConnectionDeleted, TerminationEndpoint::Local);
+        }
+    }
+
+    bool UdpShardedConnection::SendReliablePacket(const IPacket& packet)
+    {
+        return m_networkInterface.SendPacket(*this, packet, ReliabilityType::Reliable, InvalidPacketId);
+    }
+
+    PacketId UdpShardedConnection::SendUnreliablePacket(const IPacket& packet)
+    {
+        const PacketId packetId = m_nextPacketId;
+        m_nextPacketId = PacketId((aznumeric_cast<uint32_t>(packetId) + 1) % aznumeric_cast<uint32_t>(InvalidPacketId)); // Never hand out InvalidPacketId
+        return m_networkInterface.SendPacket(*this, packet, ReliabilityType::Unreliable, packetId) ? packetId : InvalidPacketId;
+    }
+
+    bool UdpShardedConnection::WasPacketAcked(PacketId packetId) const
+    {
+        return (packetId != InvalidPacketId) && (m_ackedPacketIds[aznumeric_cast<uint32_t>(packetId) % AckWindowSize] == packetId);
+    }
+
+    ConnectionState UdpShardedConnection::GetConnectionState() const
+    {
+        return m_state;
+    }
+
+    ConnectionRole UdpShardedConnection::GetConnectionRole() const
+    {
+        return m_connectionRole;
+    }
+
+    bool UdpShardedConnection::Disconnect(DisconnectReason reason, TerminationEndpoint endpoint)
+    {
+        if (m_state == ConnectionState::Disconnected)
+        {
+            return true;
+        }
+        if (m_state == ConnectionState::Disconnecting)
+        {
+            AZStd::string reasonString = ToString(reason);
+            AZLOG_ERROR("Disconnecting an already disconnecting connection due to %s", reasonString.c_str());
+            return false;
+        }
+        m_state = ConnectionState::Disconnecting;
+
+        // The shard worker owns the real connection, it notifies the remote endpoint and publishes the disconnect once complete
+        m_networkInterface.RequestDisconnect(*this, reason, endpoint);
+        return true;
+    }
+
+    void UdpShardedConnection::SetConnectionMtu(uint32_t connectionMtu)
+    {
+        m_connectionMtu = connectionMtu;
+        m_networkInterface.RequestConnectionMtu(*this, connectionMtu);
+    }
+
+    uint32_t UdpShardedConnection::GetConnectionMtu() const
+    {
+        return m_connectionMtu;
+    }
+
+    uint32_t UdpShardedConnection::GetShardIndex() const
+    {
+        return m_shardIndex;
+    }
+
+    void UdpShardedConnection::SetPacketAcked(PacketId packetId)
+    {
+        m_ackedPacketIds[aznumeric_cast<uint32_t>(packetId) % AckWindowSize] = packetId;
+    }
+}
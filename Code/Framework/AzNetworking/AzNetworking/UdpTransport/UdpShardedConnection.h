@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/containers/array.h>
+
+namespace AzNetworking
+{
+    class UdpShardedNetworkInterface;
+
+    //! @class UdpShardedConnection
+    //! @brief Proxy for a connection owned by one of the shards of a UdpShardedNetworkInterface.
+    //!
+    //! Sends and disconnects are queued for the worker thread of the owning shard, while connection state, mtu, metrics and
+    //! unreliable packet acks are mirrored from the events that worker publishes.
+    class UdpShardedConnection final
+        : public IConnection
+    {
+    public:
+
+        //! Number of unreliable packet ids WasPacketAcked can report on, older packets are reported as not acked.
+        static constexpr uint32_t AckWindowSize = 1024;
+
+        //! Constructor.
+        //! @param connectionId     the connection identifier to use for this connection
+        //! @param remoteAddress    the remote address this connection
+        //! @param networkInterface reference to the sharded network interface this connection belongs to
+        //! @param shardIndex       index of the shard that owns this connection
+        //! @param connectionRole   whether this connection was initiated or accepted
+        UdpShardedConnection(ConnectionId connectionId, const IpAddress& remoteAddress, UdpShardedNetworkInterface& networkInterface, uint32_t shardIndex, ConnectionRole connectionRole);
+        ~UdpShardedConnection() override;
+
+        //! IConnection interface.
+        //! @{
+        bool SendReliablePacket(const IPacket& packet) override;
+        PacketId SendUnreliablePacket(const IPacket& packet) override;
+        bool WasPacketAcked(PacketId packetId) const override;
+        ConnectionState GetConnectionState() const override;
+        ConnectionRole GetConnectionRole() const override;
+        bool Disconnect(DisconnectReason reason, TerminationEndpoint endpoint) override;
+        void SetConnectionMtu(uint32_t connectionMtu) override;
+        uint32_t GetConnectionMtu() const override;
+        //! @}
+
+        //! Returns the index of the shard that owns this connection.
+        //! @return the index of the shard that owns this connection
+        uint32_t GetShardIndex() const;
+
+    private:
+
+        //! Records that the remote endpoint acknowledged the given unreliable packet.
+        //! @param packetId the proxy packet id returned by SendUnreliablePacket
+        void SetPacketAcked(PacketId packetId);
+
+        AZ_DISABLE_COPY_MOVE(UdpShardedConnection);
+
+        UdpShardedNetworkInterface& m_networkInterface;
+        uint32_t m_shardIndex = 0;
+        ConnectionRole m_connectionRole = ConnectionRole::Connector;
+        ConnectionState m_state = ConnectionState::Connecting;
+        uint32_t m_connectionMtu = MaxUdpTransmissionUnit;
+        PacketId m_nextPacketId = PacketId{ 0 };
+        AZStd::array<PacketId, AckWindowSize> m_ackedPacketIds;
+
+        friend class UdpShardedNetworkInterface;
+    };
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpShardedConnectionSet.h>
+#include <AzNetworking/UdpTransport/UdpShardedConnection.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    UdpShardedConnectionSet::~UdpShardedConnectionSet() = default;
+
+    bool UdpShardedConnectionSet::AddConnection(AZStd::unique_ptr<UdpShardedConnection> connection)
+    {
+        AZ_Assert(connection, "Adding a nullptr UdpShardedConnection instance to the connection set");
+        if (!connection)
+        {
+            return false;
+        }
+
+        AZLOG(UdpConnectionSet, "Adding new sharded Udp connection (%u : %s)",
+            aznumeric_cast<uint32_t>(connection->GetConnectionId()),
+            connection->GetRemoteAddress().GetString().c_str()
+        );
+
+        AZ_Assert(GetConnection(connection->GetConnectionId()) == nullptr, "ConnectionId already exists in connection set");
+        m_connectionIdMap[connection->GetConnectionId()] = AZStd::move(connection);
+        return true;
+    }
+
+    UdpShardedConnection* UdpShardedConnectionSet::GetShardedConnection(ConnectionId connectionId) const
+    {
+        ConnectionIdMap::const_iterator lookup = m_connectionIdMap.find(connectionId);
+        if (lookup != m_connectionIdMap.end())
+        {
+            return lookup->second.get();
+        }
+        return nullptr;
+    }
+
+    void UdpShardedConnectionSet::VisitConnections(const ConnectionVisitor& visitor)
+    {
+        for (auto& connection : m_connectionIdMap)
+        {
+            visitor(*connection.second);
+        }
+    }
+
+    bool UdpShardedConnectionSet::DeleteConnection(ConnectionId connectionId)
+    {
+        AZLOG(UdpConnectionSet, "Deleting sharded Udp connection by connectionId (%u)", aznumeric_cast<uint32_t>(connectionId));
+        return m_connectionIdMap.erase(connectionId) > 0;
+    }
+
+    IConnection* UdpShardedConnectionSet::GetConnection(ConnectionId connectionId) const
+    {
+        return GetShardedConnection(connectionId);
+    }
+
+    ConnectionId UdpShardedConnectionSet::GetNextConnectionId()
+    {
+        // Shards allocate identifiers for the connections they accept on their own threads, so the in-use check done by
+        // UdpConnectionSet isn't possible here, wrapping around would take billions of connections
+        ConnectionId connectionId = ConnectionId(m_nextConnectionId.fetch_add(1));
+        if (connectionId == InvalidConnectionId)
+        {
+            connectionId = ConnectionId(m_nextConnectionId.fetch_add(1));
+        }
+        return connectionId;
+    }
+
+    uint32_t UdpShardedConnectionSet::GetConnectionCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_connectionIdMap.size());
+    }
+
+    uint32_t UdpShardedConnectionSet::GetActiveConnectionCount() const
+    {
+        uint32_t activeConnections = 0;
+        for (auto iter = m_connectionIdMap.begin(); iter != m_connectionIdMap.end(); ++iter)
+        {
+            const ConnectionState state = iter->second->GetConnectionState();
+            if (state == ConnectionState::Connected || state == ConnectionState::Connecting)
+            {
+                ++activeConnections;
+            }
+        }
+
+        return activeConnections;
+    }
+}
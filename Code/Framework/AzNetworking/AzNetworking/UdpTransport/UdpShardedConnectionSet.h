@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/ConnectionLayer/IConnectionSet.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    class UdpShardedConnection;
+
+    //! @class UdpShardedConnectionSet
+    //! @brief Tracks the proxies for all connections of a UdpShardedNetworkInterface.
+    //!
+    //! Connection identifiers are shared by all shards, so GetNextConnectionId may be called from any thread. Every other
+    //! method must only be called from the thread updating the network interface.
+    class UdpShardedConnectionSet final
+        : public IConnectionSet
+    {
+    public:
+
+        using ConnectionIdMap = AZStd::unordered_map<ConnectionId, AZStd::unique_ptr<UdpShardedConnection>>;
+
+        UdpShardedConnectionSet() = default;
+        ~UdpShardedConnectionSet() override;
+
+        //! Adds a new connection to this connection set instance.
+        //! @param connection pointer to the connection instance to add
+        //! @return boolean true on success
+        bool AddConnection(AZStd::unique_ptr<UdpShardedConnection> connection);
+
+        //! Retrieves a connection from this connection set instance by connection identifier.
+        //! @param connectionId identifier of the connection to retrieve
+        //! @return pointer to the requested connection instance on success, nullptr on failure
+        UdpShardedConnection* GetShardedConnection(ConnectionId connectionId) const;
+
+        //! IConnectionSet interface.
+        //! @{
+        void VisitConnections(const ConnectionVisitor& visitor) override;
+        bool DeleteConnection(ConnectionId connectionId) override;
+        IConnection* GetConnection(ConnectionId connectionId) const override;
+        ConnectionId GetNextConnectionId() override;
+        uint32_t GetConnectionCount() const override;
+        uint32_t GetActiveConnectionCount() const override;
+        //! @}
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(UdpShardedConnectionSet);
+
+        AZStd::atomic<uint32_t> m_nextConnectionId = 0;
+        ConnectionIdMap m_connectionIdMap;
+    };
+}
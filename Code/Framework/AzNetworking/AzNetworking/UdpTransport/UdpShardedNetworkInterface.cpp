@@ -0,0 +1,1123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpShardedNetworkInterface.h>
+#include <AzNetworking/UdpTransport/UdpShardedConnection.h>
+#include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpPacketHeader.h>
+#include <AzNetworking/DataStructures/SpscRingBuffer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzNetworking/Utilities/TimedThread.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR(AZ::TimeMs, net_UdpShardUpdateRateMs, AZ::TimeMs{ 5 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Update rate in milliseconds of the worker threads of sharded Udp network interfaces, applies to interfaces created after setting this");
+    AZ_CVAR(AZ::TimeMs, net_UdpShardStatusIntervalMs, AZ::TimeMs{ 250 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Interval in milliseconds at which sharded Udp network interface workers publish connection and interface metrics");
+    AZ_CVAR(uint32_t, net_UdpShardMaxPendingAcks, 256, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Maximum number of unreliable packets per connection a sharded Udp network interface tracks acknowledgement of");
+
+    // Each queue must fit a packet of MaxPacketSize, beyond that it only needs to absorb a few worker updates worth of traffic
+    static constexpr uint32_t ShardQueueSize = 512 * 1024;
+    using ShardQueue = SpscRingBuffer<ShardQueueSize>;
+    static_assert(ShardQueue::MaxRecordSize >= MaxPacketSize * 2, "Shard queues must be able to hold any packet");
+
+    // Metrics are published by copying them through the shard queues
+    static_assert(AZStd::is_trivially_copyable_v<ConnectionMetrics>, "ConnectionMetrics must be trivially copyable");
+    static_assert(AZStd::is_trivially_copyable_v<NetworkInterfaceMetrics>, "NetworkInterfaceMetrics must be trivially copyable");
+
+    enum class ShardMessageType : uint8_t
+    {
+        // Commands, queued by the thread updating the interface for a shard worker
+        Connect,
+        SendReliable,
+        SendUnreliable,
+        Disconnect,
+        SetMtu,
+
+        // Events, published by a shard worker for the thread updating the interface
+        Connected,
+        PacketReceived,
+        PacketLost,
+        PacketAcked,
+        ConnectionStatus,
+        Disconnected,
+        InterfaceMetrics
+    };
+
+    //! Fixed size portion of every command and event, any payload immediately follows it in the queue record.
+    struct UdpShardedNetworkInterface::ShardMessage
+    {
+        ShardMessageType m_type = ShardMessageType::Connect;
+        ConnectionId m_connectionId = InvalidConnectionId;
+        uint32_t m_address = 0;
+        uint16_t m_port = 0;
+        PacketType m_packetType = PacketType{ 0 };
+        PacketId m_packetId = InvalidPacketId;
+        ConnectionRole m_role = ConnectionRole::Connector;
+        ConnectionState m_state = ConnectionState::Disconnected;
+        DisconnectReason m_reason = DisconnectReason::None;
+        TerminationEndpoint m_endpoint = TerminationEndpoint::Local;
+        uint32_t m_mtu = 0;
+
+        void SetRemoteAddress(const IpAddress& address)
+        {
+            m_address = address.GetAddress(ByteOrder::Host);
+            m_port = address.GetPort(ByteOrder::Host);
+        }
+
+        IpAddress GetRemoteAddress() const
+        {
+            return IpAddress(ByteOrder::Host, m_address, m_port);
+        }
+    };
+
+    //! Packet serialized by the thread updating the interface, which a shard worker writes to the wire verbatim.
+    class ShardPacket final
+        : public IPacket
+    {
+    public:
+
+        ShardPacket(PacketType packetType, const uint8_t* data, uint32_t size)
+            : m_packetType(packetType)
+            , m_data(data)
+            , m_size(size)
+        {
+            ;
+        }
+
+        PacketType GetPacketType() const override
+        {
+            return m_packetType;
+        }
+
+        AZStd::unique_ptr<IPacket> Clone() const override
+        {
+            // Reliable packets are cloned into the reliable queue and outlive the queue record they were read from
+            AZStd::unique_ptr<ShardPacket> clone = AZStd::make_unique<ShardPacket>(m_packetType, nullptr, m_size);
+            clone->m_ownedData.assign(m_data, m_data + m_size);
+            clone->m_data = clone->m_ownedData.data();
+            return clone;
+        }
+
+        bool Serialize(ISerializer& serializer) override
+        {
+            // Packets are only serialized for transmission by UdpNetworkInterface::SendPacket, which always uses a NetworkInputSerializer
+            return static_cast<NetworkInputSerializer&>(serializer).CopyToBuffer(m_data, m_size);
+        }
+
+    private:
+
+        PacketType m_packetType;
+        const uint8_t* m_data = nullptr;
+        uint32_t m_size = 0;
+        AZStd::vector<uint8_t> m_ownedData;
+    };
+
+    //! Packet header handed to the connection listener for packets decoded by a shard worker.
+    class ShardPacketHeader final
+        : public IPacketHeader
+    {
+    public:
+
+        ShardPacketHeader(PacketType packetType, PacketId packetId)
+            : m_packetType(packetType)
+            , m_packetId(packetId)
+        {
+            ;
+        }
+
+        PacketType GetPacketType() const override
+        {
+            return m_packetType;
+        }
+
+        PacketId GetPacketId() const override
+        {
+            return m_packetId;
+        }
+
+        bool IsPacketFlagSet(PacketFlag) const override
+        {
+            // The shard worker has already decompressed the payload
+            return false;
+        }
+
+        void SetPacketFlag(PacketFlag, bool) override
+        {
+            ;
+        }
+
+    private:
+
+        PacketType m_packetType;
+        PacketId m_packetId;
+    };
+
+    static void AccumulateMetrics(NetworkInterfaceMetrics& total, const NetworkInterfaceMetrics& metrics)
+    {
+        total.m_updateTimeMs += metrics.m_updateTimeMs;
+        total.m_sendTimeMs += metrics.m_sendTimeMs;
+        total.m_sendPackets += metrics.m_sendPackets;
+        total.m_sendPacketsEncrypted += metrics.m_sendPacketsEncrypted;
+        total.m_sendBytes += metrics.m_sendBytes;
+        total.m_sendBytesUncompressed += metrics.m_sendBytesUncompressed;
+        total.m_sendCompressedPacketsNoGain += metrics.m_sendCompressedPacketsNoGain;
+        total.m_sendBytesCompressedDelta += metrics.m_sendBytesCompressedDelta;
+        total.m_sendBytesEncryptionInflation += metrics.m_sendBytesEncryptionInflation;
+        total.m_resentPackets += metrics.m_resentPackets;
+        total.m_recvTimeMs += metrics.m_recvTimeMs;
+        total.m_recvPackets += metrics.m_recvPackets;
+        total.m_recvBytes += metrics.m_recvBytes;
+        total.m_recvBytesUncompressed += metrics.m_recvBytesUncompressed;
+        total.m_discardedPackets += metrics.m_discardedPackets;
+    }
+
+    //! A single shard, owning a UdpNetworkInterface that is only ever updated by the shard's worker thread.
+    //! The shard is the connection listener of its network interface, and forwards every connection event to the thread
+    //! updating the UdpShardedNetworkInterface.
+    class UdpShardedNetworkInterface::Shard final
+        : public TimedThread
+        , public IConnectionListener
+    {
+    public:
+
+        Shard(UdpShardedNetworkInterface& owner, uint32_t shardIndex, AZ::TimeMs updateRateMs);
+        ~Shard() override = default;
+
+        //! Returns the network interface owned by this shard, which must only be accessed while the worker isn't running.
+        //! @return the network interface owned by this shard
+        UdpNetworkInterface& GetNetworkInterface();
+
+        //! Processes the commands still queued for the worker and disconnects every connection of the shard's network interface,
+        //! publishing the resulting events as usual. Must only be called while the worker isn't running.
+        //! @param reason reason for the disconnects
+        void DisconnectAll(DisconnectReason reason);
+
+        //! IConnectionListener interface, invoked on the worker thread by the network interface owned by this shard.
+        //! @{
+        ConnectResult ValidateConnect(const IpAddress& remoteAddress, const IPacketHeader& packetHeader, ISerializer& serializer) override;
+        void OnConnect(IConnection* connection) override;
+        bool OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer) override;
+        void OnPacketLost(IConnection* connection, PacketId packetId) override;
+        void OnDisconnect(IConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint) override;
+        //! @}
+
+        //! Copies a message and its payload into a queue. If the queue is full the message is held in an overflow buffer, and
+        //! every later message is appended to the overflow buffer as well until it has drained, so ordering is preserved.
+        static void WriteMessage(ShardQueue& queue, AZStd::vector<uint8_t>& overflow, const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize);
+
+        //! Moves as many overflowed messages into the queue as currently fit, must be called by the producer of the queue.
+        static void FlushOverflow(ShardQueue& queue, AZStd::vector<uint8_t>& overflow);
+
+        //! Invokes the handler for every message currently in the queue, must be called by the consumer of the queue.
+        template <typename HANDLER>
+        static void ReadMessages(ShardQueue& queue, const HANDLER& handler);
+
+        //! Commands queued by the thread updating the interface, and messages that didn't fit in the queue yet.
+        ShardQueue m_commands;
+        AZStd::vector<uint8_t> m_commandOverflow;
+
+        //! Events published by the worker thread, and events that didn't fit in the queue yet.
+        ShardQueue m_events;
+        AZStd::vector<uint8_t> m_eventOverflow;
+
+        //! The most recent metrics published by the worker, owned by the thread updating the interface.
+        NetworkInterfaceMetrics m_metrics;
+
+    private:
+
+        //! TimedThread interface.
+        //! @{
+        void OnStart() override;
+        void OnStop() override;
+        void OnUpdate(AZ::TimeMs updateRateMs) override;
+        //! @}
+
+        void ProcessCommand(const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize);
+        void UpdatePendingAcks();
+        void PublishStatus();
+        void PublishEvent(const ShardMessage& message, const uint8_t* payload = nullptr, uint32_t payloadSize = 0);
+
+        AZ_DISABLE_COPY_MOVE(Shard);
+
+        struct PendingAck
+        {
+            PacketId m_proxyPacketId;
+            PacketId m_packetId;
+        };
+
+        struct ConnectionEntry
+        {
+            ConnectionId m_proxyConnectionId = InvalidConnectionId;
+            ConnectionState m_state = ConnectionState::Disconnected;
+            uint32_t m_mtu = 0;
+            AZStd::vector<PendingAck> m_pendingAcks;
+        };
+
+        UdpShardedNetworkInterface& m_owner;
+
+        //! Connections keyed by the connection identifiers of the shard's own network interface.
+        AZStd::unordered_map<ConnectionId, ConnectionEntry> m_connections;
+
+        //! Maps the connection identifiers of the proxies to those of the shard's own network interface.
+        AZStd::unordered_map<ConnectionId, ConnectionId> m_shardConnectionIds;
+
+        //! The connect packet of the connection being accepted, kept from ValidateConnect for the following OnConnect.
+        AZStd::vector<uint8_t> m_connectPacket;
+
+        //! The proxy connection identifier of an outbound connect in progress.
+        ConnectionId m_connectingId = InvalidConnectionId;
+
+        AZ::TimeMs m_lastStatusTimeMs = AZ::TimeMs{ 0 };
+        UdpReaderThread m_readerThread;
+
+        // Declared last so that it's destroyed first, its connections still raise events on this shard as they're deleted
+        AZStd::unique_ptr<UdpNetworkInterface> m_networkInterface;
+    };
+
+    UdpShardedNetworkInterface::Shard::Shard(UdpShardedNetworkInterface& owner, uint32_t shardIndex, AZ::TimeMs updateRateMs)
+        : TimedThread("UdpShardedNetworkInterface::Shard", updateRateMs)
+        , m_owner(owner)
+    {
+        const AZStd::string name = AZStd::string::format("%s_Shard%u", owner.GetName().GetCStr(), shardIndex);
+        m_networkInterface = AZStd::make_unique<UdpNetworkInterface>(AZ::Name(name), *this, owner.GetTrustZone(), m_readerThread);
+    }
+
+    UdpNetworkInterface& UdpShardedNetworkInterface::Shard::GetNetworkInterface()
+    {
+        AZ_Assert(!IsRunning(), "Shard network interfaces can only be accessed while the shard worker is stopped");
+        return *m_networkInterface;
+    }
+
+    void UdpShardedNetworkInterface::Shard::DisconnectAll(DisconnectReason reason)
+    {
+        AZ_Assert(!IsRunning(), "Shard connections can only be disconnected while the shard worker is stopped");
+
+        // Process whatever the worker didn't get to, so queued packets and disconnects still go out ahead of the teardown
+        do
+        {
+            FlushOverflow(m_commands, m_commandOverflow);
+            ReadMessages(m_commands, [this](const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize)
+            {
+                ProcessCommand(message, payload, payloadSize);
+            });
+        } while (!m_commandOverflow.empty());
+
+        m_networkInterface->GetConnectionSet().VisitConnections([reason](IConnection& connection)
+        {
+            const ConnectionState state = connection.GetConnectionState();
+            if (state != ConnectionState::Disconnecting && state != ConnectionState::Disconnected)
+            {
+                connection.Disconnect(reason, TerminationEndpoint::Local);
+            }
+        });
+
+        // A final update deletes the disconnected connections, which raises OnDisconnect on this shard for each of them
+        m_readerThread.SwapBuffers();
+        m_networkInterface->Update(AZ::TimeMs{ 0 });
+    }
+
+    ConnectResult UdpShardedNetworkInterface::Shard::ValidateConnect(const IpAddress&, const IPacketHeader&, ISerializer& serializer)
+    {
+        // Validation is up to the application layer, which only runs on the thread updating the interface
+        // Keep the connect packet so that it can be validated there once the connection has been published
+        const NetworkOutputSerializer& networkSerializer = static_cast<const NetworkOutputSerializer&>(serializer);
+        const uint8_t* packetData = networkSerializer.GetBuffer();
+        m_connectPacket.assign(packetData, packetData + networkSerializer.GetReadSize() + networkSerializer.GetUnreadSize());
+        return ConnectResult::Accepted;
+    }
+
+    void UdpShardedNetworkInterface::Shard::OnConnect(IConnection* connection)
+    {
+        // Outbound connections already have a proxy, accepted connections get a new identifier shared by all shards
+        const ConnectionId proxyConnectionId = (m_connectingId != InvalidConnectionId) ? m_connectingId : m_owner.m_connectionSet.GetNextConnectionId();
+
+        ConnectionEntry& entry = m_connections[connection->GetConnectionId()];
+        entry.m_proxyConnectionId = proxyConnectionId;
+        entry.m_state = connection->GetConnectionState();
+        entry.m_mtu = connection->GetConnectionMtu();
+        m_shardConnectionIds[proxyConnectionId] = connection->GetConnectionId();
+
+        ShardMessage message;
+        message.m_type = ShardMessageType::Connected;
+        message.m_connectionId = proxyConnectionId;
+        message.SetRemoteAddress(connection->GetRemoteAddress());
+        message.m_role = connection->GetConnectionRole();
+        message.m_state = entry.m_state;
+        message.m_mtu = entry.m_mtu;
+        PublishEvent(message, m_connectPacket.data(), aznumeric_cast<uint32_t>(m_connectPacket.size()));
+        m_connectPacket.clear();
+    }
+
+    bool UdpShardedNetworkInterface::Shard::OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
+    {
+        auto entry = m_connections.find(connection->GetConnectionId());
+        if (entry == m_connections.end())
+        {
+            return false;
+        }
+
+        // UdpNetworkInterface and UdpFragmentQueue always hand over a NetworkOutputSerializer positioned at the start of the payload
+        const NetworkOutputSerializer& networkSerializer = static_cast<const NetworkOutputSerializer&>(serializer);
+
+        ShardMessage message;
+        message.m_type = ShardMessageType::PacketReceived;
+        message.m_connectionId = entry->second.m_proxyConnectionId;
+        message.m_packetType = packetHeader.GetPacketType();
+        message.m_packetId = packetHeader.GetPacketId();
+        PublishEvent(message, networkSerializer.GetUnreadData(), networkSerializer.GetUnreadSize());
+        return true;
+    }
+
+    void UdpShardedNetworkInterface::Shard::OnPacketLost(IConnection* connection, PacketId packetId)
+    {
+        auto entry = m_connections.find(connection->GetConnectionId());
+        if (entry == m_connections.end())
+        {
+            return;
+        }
+
+        // Only unreliable packets the proxy handed out an identifier for are of interest to the application layer
+        AZStd::vector<PendingAck>& pendingAcks = entry->second.m_pendingAcks;
+        for (auto pendingAck = pendingAcks.begin(); pendingAck != pendingAcks.end(); ++pendingAck)
+        {
+            if (pendingAck->m_packetId == packetId)
+            {
+                ShardMessage message;
+                message.m_type = ShardMessageType::PacketLost;
+                message.m_connectionId = entry->second.m_proxyConnectionId;
+                message.m_packetId = pendingAck->m_proxyPacketId;
+                PublishEvent(message);
+                pendingAcks.erase(pendingAck);
+                return;
+            }
+        }
+    }
+
+    void UdpShardedNetworkInterface::Shard::OnDisconnect(IConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint)
+    {
+        auto entry = m_connections.find(connection->GetConnectionId());
+        if (entry == m_connections.end())
+        {
+            return;
+        }
+
+        ShardMessage message;
+        message.m_type = ShardMessageType::Disconnected;
+        message.m_connectionId = entry->second.m_proxyConnectionId;
+        message.m_reason = reason;
+        message.m_endpoint = endpoint;
+        PublishEvent(message);
+
+        m_shardConnectionIds.erase(entry->second.m_proxyConnectionId);
+        m_connections.erase(entry);
+    }
+
+    void UdpShardedNetworkInterface::Shard::WriteMessage
+    (
+        ShardQueue& queue,
+        AZStd::vector<uint8_t>& overflow,
+        const ShardMessage& message,
+        const uint8_t* payload,
+        uint32_t payloadSize
+    )
+    {
+        const uint32_t recordSize = aznumeric_cast<uint32_t>(sizeof(ShardMessage)) + payloadSize;
+        if (overflow.empty())
+        {
+            if (uint8_t* record = queue.BeginWrite(recordSize))
+            {
+                memcpy(record, &message, sizeof(ShardMessage));
+                if (payloadSize > 0)
+                {
+                    memcpy(record + sizeof(ShardMessage), payload, payloadSize);
+                }
+                queue.EndWrite(recordSize);
+                return;
+            }
+        }
+
+        // The consumer has fallen behind, overflowed records are prefixed by their size
+        const size_t offset = overflow.size();
+        overflow.resize(offset + sizeof(recordSize) + recordSize);
+        uint8_t* record = overflow.data() + offset;
+        memcpy(record, &recordSize, sizeof(recordSize));
+        memcpy(record + sizeof(recordSize), &message, sizeof(ShardMessage));
+        if (payloadSize > 0)
+        {
+            memcpy(record + sizeof(recordSize) + sizeof(ShardMessage), payload, payloadSize);
+        }
+    }
+
+    void UdpShardedNetworkInterface::Shard::FlushOverflow(ShardQueue& queue, AZStd::vector<uint8_t>& overflow)
+    {
+        size_t offset = 0;
+        while (offset < overflow.size())
+        {
+            uint32_t recordSize = 0;
+            memcpy(&recordSize, overflow.data() + offset, sizeof(recordSize));
+            if (!queue.Write(overflow.data() + offset + sizeof(recordSize), recordSize))
+            {
+                break;
+            }
+            offset += sizeof(recordSize) + recordSize;
+        }
+        overflow.erase(overflow.begin(), overflow.begin() + offset);
+    }
+
+    template <typename HANDLER>
+    void UdpShardedNetworkInterface::Shard::ReadMessages(ShardQueue& queue, const HANDLER& handler)
+    {
+        uint32_t recordSize = 0;
+        while (const uint8_t* record = queue.BeginRead(recordSize))
+        {
+            ShardMessage message;
+            memcpy(&message, record, sizeof(ShardMessage));
+            handler(message, record + sizeof(ShardMessage), recordSize - aznumeric_cast<uint32_t>(sizeof(ShardMessage)));
+            queue.EndRead();
+        }
+    }
+
+    void UdpShardedNetworkInterface::Shard::OnStart()
+    {
+        ;
+    }
+
+    void UdpShardedNetworkInterface::Shard::OnStop()
+    {
+        ;
+    }
+
+    void UdpShardedNetworkInterface::Shard::OnUpdate(AZ::TimeMs updateRateMs)
+    {
+        FlushOverflow(m_events, m_eventOverflow);
+        ReadMessages(m_commands, [this](const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize)
+        {
+            ProcessCommand(message, payload, payloadSize);
+        });
+
+        m_readerThread.SwapBuffers();
+        m_networkInterface->Update(updateRateMs);
+
+        UpdatePendingAcks();
+        PublishStatus();
+    }
+
+    void UdpShardedNetworkInterface::Shard::ProcessCommand(const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize)
+    {
+        if (message.m_type == ShardMessageType::Connect)
+        {
+            // OnConnect is invoked from within Connect, and picks up the proxy connection identifier from m_connectingId
+            m_connectingId = message.m_connectionId;
+            const ConnectionId shardConnectionId = m_networkInterface->Connect(message.GetRemoteAddress());
+            m_connectingId = InvalidConnectionId;
+
+            if (shardConnectionId == InvalidConnectionId)
+            {
+                ShardMessage event;
+                event.m_type = ShardMessageType::Disconnected;
+                event.m_connectionId = message.m_connectionId;
+                event.m_reason = DisconnectReason::TransportError;
+                event.m_endpoint = TerminationEndpoint::Local;
+                PublishEvent(event);
+            }
+            return;
+        }
+
+        auto shardConnectionId = m_shardConnectionIds.find(message.m_connectionId);
+        if (shardConnectionId == m_shardConnectionIds.end())
+        {
+            // The connection has already been removed, and its disconnect event is on the way to the owner
+            return;
+        }
+
+        IConnection* connection = m_networkInterface->GetConnectionSet().GetConnection(shardConnectionId->second);
+        if (connection == nullptr)
+        {
+            return;
+        }
+
+        switch (message.m_type)
+        {
+        case ShardMessageType::SendReliable:
+            connection->SendReliablePacket(ShardPacket(message.m_packetType, payload, payloadSize));
+            break;
+
+        case ShardMessageType::SendUnreliable:
+        {
+            const PacketId packetId = connection->SendUnreliablePacket(ShardPacket(message.m_packetType, payload, payloadSize));
+            ConnectionEntry& entry = m_connections[shardConnectionId->second];
+            if (packetId == InvalidPacketId)
+            {
+                ShardMessage event;
+                event.m_type = ShardMessageType::PacketLost;
+                event.m_connectionId = message.m_connectionId;
+                event.m_packetId = message.m_packetId;
+                PublishEvent(event);
+            }
+            else
+            {
+                if (entry.m_pendingAcks.size() >= net_UdpShardMaxPendingAcks)
+                {
+                    // Stop tracking the oldest packet, the proxy will simply never report it as acked
+                    entry.m_pendingAcks.erase(entry.m_pendingAcks.begin());
+                }
+                entry.m_pendingAcks.push_back(PendingAck{ message.m_packetId, packetId });
+            }
+            break;
+        }
+
+        case ShardMessageType::Disconnect:
+        {
+            const ConnectionState state = connection->GetConnectionState();
+            if (state != ConnectionState::Disconnecting && state != ConnectionState::Disconnected)
+            {
+                connection->Disconnect(message.m_reason, message.m_endpoint);
+            }
+            break;
+        }
+
+        case ShardMessageType::SetMtu:
+            connection->SetConnectionMtu(message.m_mtu);
+            break;
+
+        default:
+            AZ_Assert(false, "Unexpected shard command type %u", aznumeric_cast<uint32_t>(message.m_type));
+            break;
+        }
+    }
+
+    void UdpShardedNetworkInterface::Shard::UpdatePendingAcks()
+    {
+        for (auto& connectionEntry : m_connections)
+        {
+            AZStd::vector<PendingAck>& pendingAcks = connectionEntry.second.m_pendingAcks;
+            if (pendingAcks.empty())
+            {
+                continue;
+            }
+
+            IConnection* connection = m_networkInterface->GetConnectionSet().GetConnection(connectionEntry.first);
+            if (connection == nullptr)
+            {
+                continue;
+            }
+
+            size_t remaining = 0;
+            for (const PendingAck& pendingAck : pendingAcks)
+            {
+                if (connection->WasPacketAcked(pendingAck.m_packetId))
+                {
+                    ShardMessage message;
+                    message.m_type = ShardMessageType::PacketAcked;
+                    message.m_connectionId = connectionEntry.second.m_proxyConnectionId;
+                    message.m_packetId = pendingAck.m_proxyPacketId;
+                    PublishEvent(message);
+                }
+                else
+                {
+                    pendingAcks[remaining++] = pendingAck;
+                }
+            }
+            pendingAcks.resize(remaining);
+        }
+    }
+
+    void UdpShardedNetworkInterface::Shard::PublishStatus()
+    {
+        // State and mtu changes are published as soon as they happen, metrics only periodically
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        const bool publishMetrics = (currentTimeMs - m_lastStatusTimeMs) >= net_UdpShardStatusIntervalMs;
+
+        for (auto& connectionEntry : m_connections)
+        {
+            IConnection* connection = m_networkInterface->GetConnectionSet().GetConnection(connectionEntry.first);
+            if (connection == nullptr)
+            {
+                continue;
+            }
+
+            ConnectionEntry& entry = connectionEntry.second;
+            const ConnectionState state = connection->GetConnectionState();
+            const uint32_t mtu = connection->GetConnectionMtu();
+            if (publishMetrics || state != entry.m_state || mtu != entry.m_mtu)
+            {
+                entry.m_state = state;
+                entry.m_mtu = mtu;
+
+                ShardMessage message;
+                message.m_type = ShardMessageType::ConnectionStatus;
+                message.m_connectionId = entry.m_proxyConnectionId;
+                message.m_state = state;
+                message.m_mtu = mtu;
+                const ConnectionMetrics& metrics = connection->GetMetrics();
+                PublishEvent(message, reinterpret_cast<const uint8_t*>(&metrics), aznumeric_cast<uint32_t>(sizeof(ConnectionMetrics)));
+            }
+        }
+
+        if (publishMetrics)
+        {
+            m_lastStatusTimeMs = currentTimeMs;
+
+            ShardMessage message;
+            message.m_type = ShardMessageType::InterfaceMetrics;
+            const NetworkInterfaceMetrics& metrics = m_networkInterface->GetMetrics();
+            PublishEvent(message, reinterpret_cast<const uint8_t*>(&metrics), aznumeric_cast<uint32_t>(sizeof(NetworkInterfaceMetrics)));
+        }
+    }
+
+    void UdpShardedNetworkInterface::Shard::PublishEvent(const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize)
+    {
+        WriteMessage(m_events, m_eventOverflow, message, payload, payloadSize);
+    }
+
+    UdpShardedNetworkInterface::UdpShardedNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, uint32_t shardCount)
+        : m_name(name)
+        , m_trustZone(trustZone)
+        , m_connectionListener(connectionListener)
+    {
+#if !AZ_TRAIT_USE_SOCKET_REUSEPORT
+        if (shardCount > 1)
+        {
+            AZLOG_WARN("Port sharing is not supported on this platform, network interface %s will use a single shard", m_name.GetCStr());
+            shardCount = 1;
+        }
+#endif
+        shardCount = AZStd::max(shardCount, 1u);
+
+        const AZ::TimeMs updateRateMs = net_UdpShardUpdateRateMs;
+        m_shards.reserve(shardCount);
+        for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            m_shards.emplace_back(AZStd::make_unique<Shard>(*this, shardIndex, updateRateMs));
+        }
+    }
+
+    UdpShardedNetworkInterface::~UdpShardedNetworkInterface()
+    {
+        StopShards();
+        m_shards.clear();
+    }
+
+    AZ::Name UdpShardedNetworkInterface::GetName() const
+    {
+        return m_name;
+    }
+
+    ProtocolType UdpShardedNetworkInterface::GetType() const
+    {
+        return ProtocolType::Udp;
+    }
+
+    TrustZone UdpShardedNetworkInterface::GetTrustZone() const
+    {
+        return m_trustZone;
+    }
+
+    uint16_t UdpShardedNetworkInterface::GetPort() const
+    {
+        return m_port;
+    }
+
+    IConnectionSet& UdpShardedNetworkInterface::GetConnectionSet()
+    {
+        return m_connectionSet;
+    }
+
+    IConnectionListener& UdpShardedNetworkInterface::GetConnectionListener()
+    {
+        return m_connectionListener;
+    }
+
+    bool UdpShardedNetworkInterface::Listen(uint16_t port)
+    {
+        if (m_listening || m_shardsRunning)
+        {
+            AZ_Assert(false, "Listen cannot be invoked on an already opened network interface");
+            return false;
+        }
+
+        const bool portSharing = (m_shards.size() > 1);
+        if (portSharing && (port == 0))
+        {
+            AZLOG_ERROR("Sharded network interface %s must listen on an explicit port", m_name.GetCStr());
+            return false;
+        }
+
+        // The workers aren't running yet, so the shard network interfaces can be opened from this thread
+        for (uint32_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+        {
+            UdpNetworkInterface& networkInterface = m_shards[shardIndex]->GetNetworkInterface();
+            networkInterface.SetPortSharing(portSharing);
+            if (!networkInterface.Listen(port))
+            {
+                for (uint32_t openedIndex = 0; openedIndex < shardIndex; ++openedIndex)
+                {
+                    m_shards[openedIndex]->GetNetworkInterface().StopListening();
+                }
+                return false;
+            }
+        }
+
+        m_port = port;
+        m_listening = true;
+        StartShards();
+        return true;
+    }
+
+    ConnectionId UdpShardedNetworkInterface::Connect(const IpAddress& remoteAddress)
+    {
+        if (m_listening)
+        {
+            AZLOG_ERROR("Outbound connections are not supported on listening sharded network interface %s", m_name.GetCStr());
+            return InvalidConnectionId;
+        }
+
+        const uint32_t shardIndex = aznumeric_cast<uint32_t>(AZStd::hash<IpAddress>()(remoteAddress) % m_shards.size());
+        const ConnectionId connectionId = m_connectionSet.GetNextConnectionId();
+
+        AZStd::unique_ptr<UdpShardedConnection> connection = AZStd::make_unique<UdpShardedConnection>(connectionId, remoteAddress, *this, shardIndex, ConnectionRole::Connector);
+        connection->m_state = ConnectionState::Connecting;
+
+        ShardMessage message;
+        message.m_type = ShardMessageType::Connect;
+        message.m_connectionId = connectionId;
+        message.SetRemoteAddress(remoteAddress);
+        PushCommand(shardIndex, message);
+        StartShards();
+
+        m_connectionListener.OnConnect(connection.get());
+        m_connectionSet.AddConnection(AZStd::move(connection));
+        return connectionId;
+    }
+
+    void UdpShardedNetworkInterface::Update([[maybe_unused]] AZ::TimeMs deltaTimeMs)
+    {
+        NetworkInterfaceMetrics metrics;
+        for (uint32_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+        {
+            Shard& shard = *m_shards[shardIndex];
+            Shard::FlushOverflow(shard.m_commands, shard.m_commandOverflow);
+            Shard::ReadMessages(shard.m_events, [this, shardIndex](const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize)
+            {
+                HandleEvent(shardIndex, message, payload, payloadSize);
+            });
+            AccumulateMetrics(metrics, shard.m_metrics);
+        }
+
+        // Per shard metrics are totals maintained by the workers, the connection count is tracked here
+        metrics.m_connectionCount = m_connectionSet.GetConnectionCount();
+        GetMetrics() = metrics;
+    }
+
+    void UdpShardedNetworkInterface::Flush()
+    {
+        // Shard workers transmit on their next update, the most that can be done here is to hand over anything that overflowed
+        for (AZStd::unique_ptr<Shard>& shard : m_shards)
+        {
+            Shard::FlushOverflow(shard->m_commands, shard->m_commandOverflow);
+        }
+    }
+
+    bool UdpShardedNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
+    {
+        IConnection* connection = m_connectionSet.GetConnection(connectionId);
+        if (connection == nullptr)
+        {
+            return false;
+        }
+        return connection->SendReliablePacket(packet);
+    }
+
+    PacketId UdpShardedNetworkInterface::SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet)
+    {
+        IConnection* connection = m_connectionSet.GetConnection(connectionId);
+        if (connection == nullptr)
+        {
+            return InvalidPacketId;
+        }
+        return connection->SendUnreliablePacket(packet);
+    }
+
+    bool UdpShardedNetworkInterface::WasPacketAcked(ConnectionId connectionId, PacketId packetId)
+    {
+        IConnection* connection = m_connectionSet.GetConnection(connectionId);
+        if (connection == nullptr)
+        {
+            return false;
+        }
+        return connection->WasPacketAcked(packetId);
+    }
+
+    bool UdpShardedNetworkInterface::StopListening()
+    {
+        if (!m_listening)
+        {
+            return false;
+        }
+
+        StopShards();
+
+        // Nothing drains the queues once the workers are stopped, so every connection is torn down here rather than left to
+        // accumulate sends that never go out. The listener sees a disconnect for each of them before this returns.
+        for (uint32_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+        {
+            Shard& shard = *m_shards[shardIndex];
+            shard.DisconnectAll(DisconnectReason::TerminatedByServer);
+            do
+            {
+                Shard::FlushOverflow(shard.m_events, shard.m_eventOverflow);
+                Shard::ReadMessages(shard.m_events, [this, shardIndex](const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize)
+                {
+                    HandleEvent(shardIndex, message, payload, payloadSize);
+                });
+            } while (!shard.m_eventOverflow.empty());
+
+            // Commands queued while handling the events can only refer to connections that are gone by now
+            Shard::ReadMessages(shard.m_commands, [](const ShardMessage&, const uint8_t*, uint32_t) {});
+            shard.m_commandOverflow.clear();
+
+            shard.GetNetworkInterface().StopListening();
+        }
+
+        // Proxies without a connection on any shard, such as outbound connects that were never processed
+        AZStd::vector<ConnectionId> remainingConnectionIds;
+        m_connectionSet.VisitConnections([&remainingConnectionIds](IConnection& connection)
+        {
+            remainingConnectionIds.push_back(connection.GetConnectionId());
+        });
+        for (ConnectionId connectionId : remainingConnectionIds)
+        {
+            UdpShardedConnection* connection = m_connectionSet.GetShardedConnection(connectionId);
+            connection->m_state = ConnectionState::Disconnecting;
+            m_connectionListener.OnDisconnect(connection, DisconnectReason::TerminatedByServer, TerminationEndpoint::Local);
+            connection->m_state = ConnectionState::Disconnected;
+            m_connectionSet.DeleteConnection(connectionId); // Will delete the connection
+        }
+
+        m_port = 0;
+        m_listening = false;
+        return true;
+    }
+
+    bool UdpShardedNetworkInterface::Disconnect(ConnectionId connectionId, DisconnectReason reason)
+    {
+        IConnection* connection = m_connectionSet.GetConnection(connectionId);
+        if (connection == nullptr)
+        {
+            return false;
+        }
+        return connection->Disconnect(reason, TerminationEndpoint::Local);
+    }
+
+    uint32_t UdpShardedNetworkInterface::GetShardCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_shards.size());
+    }
+
+    bool UdpShardedNetworkInterface::SendPacket(UdpShardedConnection& connection, const IPacket& packet, ReliabilityType reliability, PacketId proxyPacketId)
+    {
+        // Serialize here so the caller's packet doesn't need to outlive this call, the worker transmits the bytes verbatim
+        m_sendBuffer.Resize(m_sendBuffer.GetCapacity());
+        NetworkInputSerializer networkSerializer(m_sendBuffer.GetBuffer(), m_sendBuffer.GetCapacity());
+        ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+        if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+        {
+            AZLOG_ERROR("Packet type %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(packet.GetPacketType()));
+            return false;
+        }
+
+        ShardMessage message;
+        message.m_type = (reliability == ReliabilityType::Reliable) ? ShardMessageType::SendReliable : ShardMessageType::SendUnreliable;
+        message.m_connectionId = connection.GetConnectionId();
+        message.m_packetType = packet.GetPacketType();
+        message.m_packetId = proxyPacketId;
+        PushCommand(connection.GetShardIndex(), message, m_sendBuffer.GetBuffer(), serializer.GetSize());
+        return true;
+    }
+
+    void UdpShardedNetworkInterface::RequestDisconnect(UdpShardedConnection& connection, DisconnectReason reason, TerminationEndpoint endpoint)
+    {
+        ShardMessage message;
+        message.m_type = ShardMessageType::Disconnect;
+        message.m_connectionId = connection.GetConnectionId();
+        message.m_reason = reason;
+        message.m_endpoint = endpoint;
+        PushCommand(connection.GetShardIndex(), message);
+    }
+
+    void UdpShardedNetworkInterface::RequestConnectionMtu(UdpShardedConnection& connection, uint32_t connectionMtu)
+    {
+        ShardMessage message;
+        message.m_type = ShardMessageType::SetMtu;
+        message.m_connectionId = connection.GetConnectionId();
+        message.m_mtu = connectionMtu;
+        PushCommand(connection.GetShardIndex(), message);
+    }
+
+    void UdpShardedNetworkInterface::PushCommand(uint32_t shardIndex, const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize)
+    {
+        Shard& shard = *m_shards[shardIndex];
+        Shard::WriteMessage(shard.m_commands, shard.m_commandOverflow, message, payload, payloadSize);
+    }
+
+    void UdpShardedNetworkInterface::HandleEvent(uint32_t shardIndex, const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize)
+    {
+        if (message.m_type == ShardMessageType::InterfaceMetrics)
+        {
+            memcpy(&m_shards[shardIndex]->m_metrics, payload, sizeof(NetworkInterfaceMetrics));
+            return;
+        }
+
+        UdpShardedConnection* connection = m_connectionSet.GetShardedConnection(message.m_connectionId);
+        if (connection == nullptr)
+        {
+            if (message.m_type == ShardMessageType::Connected)
+            {
+                AcceptConnection(shardIndex, message, payload, payloadSize);
+            }
+            // Anything else belongs to a connection that was rejected or has already been removed
+            return;
+        }
+
+        switch (message.m_type)
+        {
+        case ShardMessageType::Connected:
+            // An outbound connection has been opened by the worker
+            if (connection->m_state == ConnectionState::Connecting)
+            {
+                connection->m_state = message.m_state;
+            }
+            break;
+
+        case ShardMessageType::PacketReceived:
+        {
+            const ConnectionState state = connection->GetConnectionState();
+            if (state == ConnectionState::Disconnecting || state == ConnectionState::Disconnected)
+            {
+                // Skip packets from disconnected connections
+                break;
+            }
+
+            ShardPacketHeader header(message.m_packetType, message.m_packetId);
+            NetworkOutputSerializer packetSerializer(payload, payloadSize);
+            if (!m_connectionListener.OnPacketReceived(connection, header, packetSerializer)
+                && connection->GetConnectionState() != ConnectionState::Disconnecting)
+            {
+                connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+            }
+            break;
+        }
+
+        case ShardMessageType::PacketLost:
+            m_connectionListener.OnPacketLost(connection, message.m_packetId);
+            break;
+
+        case ShardMessageType::PacketAcked:
+            connection->SetPacketAcked(message.m_packetId);
+            break;
+
+        case ShardMessageType::ConnectionStatus:
+            if (connection->m_state != ConnectionState::Disconnecting)
+            {
+                connection->m_state = message.m_state;
+            }
+            connection->m_connectionMtu = message.m_mtu;
+            memcpy(&connection->GetMetrics(), payload, sizeof(ConnectionMetrics));
+            break;
+
+        case ShardMessageType::Disconnected:
+            connection->m_state = ConnectionState::Disconnecting;
+            m_connectionListener.OnDisconnect(connection, message.m_reason, message.m_endpoint);
+            connection->m_state = ConnectionState::Disconnected;
+            m_connectionSet.DeleteConnection(message.m_connectionId); // Will delete the connection
+            break;
+
+        default:
+            AZ_Assert(false, "Unexpected shard event type %u", aznumeric_cast<uint32_t>(message.m_type));
+            break;
+        }
+    }
+
+    void UdpShardedNetworkInterface::AcceptConnection(uint32_t shardIndex, const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize)
+    {
+        // Replay validation of the connect packet the worker accepted the connection with
+        ConnectResult connectResult = ConnectResult::Rejected;
+        {
+            NetworkOutputSerializer networkSerializer(payload, payloadSize);
+            UdpPacketHeader header;
+            if (header.SerializePacketFlags(networkSerializer) && static_cast<ISerializer&>(networkSerializer).Serialize(header, "Header"))
+            {
+                connectResult = m_connectionListener.ValidateConnect(message.GetRemoteAddress(), header, networkSerializer);
+            }
+        }
+
+        if (connectResult == ConnectResult::Rejected)
+        {
+            // The worker has already established the connection, so it has to be torn down rather than ignored
+            ShardMessage command;
+            command.m_type = ShardMessageType::Disconnect;
+            command.m_connectionId = message.m_connectionId;
+            command.m_reason = DisconnectReason::ConnectionRejected;
+            command.m_endpoint = TerminationEndpoint::Local;
+            PushCommand(shardIndex, command);
+            return;
+        }
+
+        AZLOG(Debug_UdpConnect, "Accepted new sharded Udp Connection");
+        AZStd::unique_ptr<UdpShardedConnection> connection =
+            AZStd::make_unique<UdpShardedConnection>(message.m_connectionId, message.GetRemoteAddress(), *this, shardIndex, message.m_role);
+        connection->m_state = message.m_state;
+        connection->m_connectionMtu = message.m_mtu;
+        m_connectionListener.OnConnect(connection.get());
+        m_connectionSet.AddConnection(AZStd::move(connection));
+    }
+
+    void UdpShardedNetworkInterface::StartShards()
+    {
+        if (m_shardsRunning)
+        {
+            return;
+        }
+
+        for (AZStd::unique_ptr<Shard>& shard : m_shards)
+        {
+            shard->Start();
+        }
+        m_shardsRunning = true;
+    }
+
+    void UdpShardedNetworkInterface::StopShards()
+    {
+        if (!m_shardsRunning)
+        {
+            return;
+        }
+
+        // Signal every worker first so they wind down in parallel
+        for (AZStd::unique_ptr<Shard>& shard : m_shards)
+        {
+            shard->Stop();
+        }
+        for (AZStd::unique_ptr<Shard>& shard : m_shards)
+        {
+            shard->Join();
+        }
+        m_shardsRunning = false;
+    }
+}
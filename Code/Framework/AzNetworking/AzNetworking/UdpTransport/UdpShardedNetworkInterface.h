@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/UdpTransport/UdpShardedConnectionSet.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
+#include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    class IConnectionListener;
+    class UdpShardedConnection;
+
+    //! @class UdpShardedNetworkInterface
+    //! @brief A UDP network interface that spreads its connections across several worker threads.
+    //!
+    //! Each shard owns a complete UdpNetworkInterface with its own socket, reader thread and worker thread, so packet tracking,
+    //! reliable queues, fragment reassembly, compression and encryption for a connection all run on the worker of the shard that
+    //! owns it. When listening, every shard binds the same port with port sharing enabled and the kernel distributes incoming
+    //! datagrams between the shard sockets by address hash, so all traffic from a remote endpoint lands on the same shard.
+    //!
+    //! Workers only communicate with the thread updating this interface through lock-free single producer, single consumer queues.
+    //! Connection events and decoded packets are raised on the IConnectionListener during Update, so listener callbacks never
+    //! happen on a worker thread. Sends, disconnects and outbound connects are queued for the owning worker and transmitted on its
+    //! next update, so this interface and its connections must only be used from the thread that updates the interface.
+    //!
+    //! Compared to UdpNetworkInterface:
+    //! * ValidateConnect is deferred to Update, by which point the worker has already accepted the connection. A rejected
+    //!   endpoint is disconnected with DisconnectReason::ConnectionRejected rather than silently ignored.
+    //! * Outbound connects are only supported while not listening, since replies to a shard socket that shares its port may be
+    //!   delivered to a different shard.
+    //! * StopListening disconnects every connection with DisconnectReason::TerminatedByServer, since it stops the workers that
+    //!   service them. OnDisconnect is raised for each connection before StopListening returns.
+    //! * Packet ids returned by SendUnreliablePacket are local to the connection proxy, and are only meaningful to WasPacketAcked
+    //!   and OnPacketLost. They never match the ids the remote endpoint sees in packet headers, so protocols must not rely on
+    //!   sender and receiver packet ids being equal.
+    class UdpShardedNetworkInterface final
+        : public INetworkInterface
+    {
+    public:
+
+        //! Constructor.
+        //! @param name               the name of this network interface instance
+        //! @param connectionListener reference to the connection listener responsible for handling all connection events
+        //! @param trustZone          the trust level assigned to this network interface, server to server or client to server
+        //! @param shardCount         the number of shards, each with its own socket and worker thread
+        UdpShardedNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, uint32_t shardCount);
+        ~UdpShardedNetworkInterface() override;
+
+        //! INetworkInterface interface.
+        //! @{
+        AZ::Name GetName() const override;
+        ProtocolType GetType() const override;
+        TrustZone GetTrustZone() const override;
+        uint16_t GetPort() const override;
+        IConnectionSet& GetConnectionSet() override;
+        IConnectionListener& GetConnectionListener() override;
+        bool Listen(uint16_t port) override;
+        ConnectionId Connect(const IpAddress& remoteAddress) override;
+        void Update(AZ::TimeMs deltaTimeMs) override;
+        void Flush() override;
+        bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
+        PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
+        bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
+        bool StopListening() override;
+        bool Disconnect(ConnectionId connectionId, DisconnectReason reason) override;
+        //! @}
+
+        //! Returns the number of shards, which may be lower than requested on platforms that can't share a port between sockets.
+        //! @return the number of shards
+        uint32_t GetShardCount() const;
+
+    private:
+
+        class Shard;
+        struct ShardMessage;
+
+        //! Serializes a packet and queues it for transmission by the worker of the shard that owns the connection.
+        //! @param connection    the proxy of the connection to send the packet on
+        //! @param packet        serializable object to transmit
+        //! @param reliability   whether or not to guarantee delivery
+        //! @param proxyPacketId for unreliable packets, the packet id returned to the caller
+        //! @return boolean true if the packet was queued
+        bool SendPacket(UdpShardedConnection& connection, const IPacket& packet, ReliabilityType reliability, PacketId proxyPacketId);
+
+        //! Queues a disconnect for the worker of the shard that owns the connection.
+        //! @param connection the proxy of the connection to disconnect
+        //! @param reason     reason for the disconnect
+        //! @param endpoint   whether the disconnection was initiated locally or remotely
+        void RequestDisconnect(UdpShardedConnection& connection, DisconnectReason reason, TerminationEndpoint endpoint);
+
+        //! Queues an mtu change for the worker of the shard that owns the connection.
+        //! @param connection    the proxy of the connection to change the mtu of
+        //! @param connectionMtu the max transmission unit for the connection
+        void RequestConnectionMtu(UdpShardedConnection& connection, uint32_t connectionMtu);
+
+        //! Queues a message for the worker of the given shard.
+        //! @param shardIndex  index of the shard to queue the message for
+        //! @param message     the message to queue
+        //! @param payload     pointer to the payload following the message, may be nullptr if payloadSize is 0
+        //! @param payloadSize size of the payload in bytes
+        void PushCommand(uint32_t shardIndex, const ShardMessage& message, const uint8_t* payload = nullptr, uint32_t payloadSize = 0);
+
+        //! Handles a single event published by a shard worker.
+        //! @param shardIndex  index of the shard that published the event
+        //! @param message     the event
+        //! @param payload     pointer to the payload following the event
+        //! @param payloadSize size of the payload in bytes
+        void HandleEvent(uint32_t shardIndex, const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize);
+
+        //! Accepts a connection a shard worker has accepted, once the connection listener has validated it.
+        //! @param shardIndex  index of the shard that owns the connection
+        //! @param message     the connect event
+        //! @param payload     the raw connect packet received from the remote endpoint
+        //! @param payloadSize size of the connect packet in bytes
+        void AcceptConnection(uint32_t shardIndex, const ShardMessage& message, const uint8_t* payload, uint32_t payloadSize);
+
+        //! Starts the worker threads of all shards if they aren't running yet.
+        void StartShards();
+
+        //! Stops and joins the worker threads of all shards.
+        void StopShards();
+
+        AZ_DISABLE_COPY_MOVE(UdpShardedNetworkInterface);
+
+        AZ::Name m_name;
+        TrustZone m_trustZone;
+        uint16_t m_port = 0;
+        bool m_listening = false;
+        bool m_shardsRunning = false;
+        IConnectionListener& m_connectionListener;
+        UdpShardedConnectionSet m_connectionSet;
+        AZStd::vector<AZStd::unique_ptr<Shard>> m_shards;
+        UdpPacketEncodingBuffer m_sendBuffer;
+
+        friend class UdpShardedConnection;
+    };
+}
@@ -17,12 +17,50 @@
 #include <AzCore/EBus/IEventScheduler.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/array.h>
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+#   include <netinet/udp.h>
+#   ifndef UDP_SEGMENT
+#       define UDP_SEGMENT 103
+#   endif
+#endif
 
 namespace AzNetworking
 {
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSends, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, UDP sockets opened after setting this queue outgoing datagrams and transmit them in batches when flushed, on platforms that support batched sends");
+    AZ_CVAR(bool, net_UdpSegmentationOffload, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, batched UDP sends coalesce equally sized datagrams to the same address into a single segmentation offload send where the kernel supports it");
+
+    struct UdpSocket::SendBatch
+    {
+        struct QueuedDatagram
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
+        AZStd::fixed_vector<QueuedDatagram, MaxBatchedDatagrams> m_datagrams;
+        ByteBuffer<MaxBatchedDatagrams * MaxUdpTransmissionUnit> m_buffer;
+        bool m_useSegmentation = false;
+    };
+
+    static int32_t SendTo(SocketFd socketFd, const IpAddress& address, const uint8_t* data, uint32_t size)
+    {
+        sockaddr_in destAddr;
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin_family = AF_INET;
+        destAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
+        destAddr.sin_port = address.GetPort(ByteOrder::Network);
+        return sendto(static_cast<int32_t>(socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr));
+    }
+
+    UdpSocket::UdpSocket() = default;
 
     UdpSocket::~UdpSocket()
     {
@@ -68,6 +106,22 @@ namespace AzNetworking
             }
         }
 
+        if (m_portSharing)
+        {
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+            int32_t enable = 1;
+            if (::setsockopt(static_cast<int32_t>(m_socketFd), SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) != SocketOpResultSuccess)
+            {
+                const int32_t error = GetLastNetworkError();
+                AZLOG_ERROR("Failed to enable port sharing for UDP socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                return false;
+            }
+#else
+            AZLOG_ERROR("UDP port sharing is not supported on this platform");
+            return false;
+#endif
+        }
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -93,11 +147,35 @@ namespace AzNetworking
             return false;
         }
 
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (net_UdpBatchSends)
+        {
+            m_sendBatch = AZStd::make_unique<SendBatch>();
+            if (net_UdpSegmentationOffload)
+            {
+                // Segmentation offload is only available on newer kernels, the option is readable wherever it's supported
+                int32_t segmentSize = 0;
+                socklen_t optionLength = sizeof(segmentSize);
+                m_sendBatch->m_useSegmentation = (::getsockopt(static_cast<int32_t>(m_socketFd), SOL_UDP, UDP_SEGMENT, &segmentSize, &optionLength) == 0);
+            }
+        }
+#endif
+
         return true;
     }
 
     void UdpSocket::Close()
     {
+        if (IsOpen())
+        {
+            FlushSends();
+        }
+        if (m_sendBatch != nullptr)
+        {
+            // Anything the socket is still too backed up to take is lost with it
+            DropQueuedSends(0, aznumeric_cast<uint32_t>(m_sendBatch->m_datagrams.size()));
+        }
+        m_sendBatch.reset();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -227,15 +305,268 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(ReceivedDatagram* outDatagrams, uint8_t* outData, uint32_t count) const
+    {
+        AZ_Assert((count > 0) && (count <= MaxBatchedDatagrams), "Invalid datagram count for batched receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        AZStd::array<mmsghdr, MaxBatchedDatagrams> messages;
+        AZStd::array<iovec, MaxBatchedDatagrams> buffers;
+        AZStd::array<sockaddr_in, MaxBatchedDatagrams> fromAddresses;
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            buffers[index].iov_base = outData + index * MaxUdpTransmissionUnit;
+            buffers[index].iov_len = MaxUdpTransmissionUnit;
+            memset(&messages[index], 0, sizeof(mmsghdr));
+            messages[index].msg_hdr.msg_name = &fromAddresses[index];
+            messages[index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[index].msg_hdr.msg_iov = &buffers[index];
+            messages[index].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int32_t receivedCount = ::recvmmsg(static_cast<int32_t>(m_socketFd), messages.data(), count, MSG_DONTWAIT, nullptr);
+        if (receivedCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+
+            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                return 0;
+            }
+
+            bool ignoreForciblyClosedError = false;
+            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            {
+                if (ignoreForciblyClosedError)
+                {
+                    return 0;
+                }
+                else
+                {
+                    return SocketOpResultError;
+                }
+            }
+
+            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return 0;
+        }
+
+        for (int32_t index = 0; index < receivedCount; ++index)
+        {
+            const sockaddr_in& from = fromAddresses[index];
+            outDatagrams[index].m_address = IpAddress(ByteOrder::Network, from.sin_addr.s_addr, from.sin_port);
+            outDatagrams[index].m_data = outData + index * MaxUdpTransmissionUnit;
+            outDatagrams[index].m_receivedBytes = aznumeric_cast<int32_t>(messages[index].msg_len);
+            m_recvPackets++;
+            m_recvBytes += messages[index].msg_len;
+        }
+        return receivedCount;
+#else
+        // No batched receive support, fall back to a receive per datagram
+        int32_t receivedCount = 0;
+        for (; receivedCount < aznumeric_cast<int32_t>(count); ++receivedCount)
+        {
+            ReceivedDatagram& datagram = outDatagrams[receivedCount];
+            uint8_t* datagramData = outData + receivedCount * MaxUdpTransmissionUnit;
+            const int32_t receivedBytes = Receive(datagram.m_address, datagramData, MaxUdpTransmissionUnit);
+            if (receivedBytes <= 0)
+            {
+                return (receivedCount > 0) ? receivedCount : receivedBytes;
+            }
+            datagram.m_data = datagramData;
+            datagram.m_receivedBytes = receivedBytes;
+        }
+        return receivedCount;
+#endif
+    }
+
+    void UdpSocket::FlushSends() const
+    {
+        if ((m_sendBatch == nullptr) || m_sendBatch->m_datagrams.empty())
+        {
+            return;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        // The kernel limits how many segments and bytes a single segmentation offload send may carry
+        static constexpr uint32_t MaxSegmentsPerSend = 64;
+        static constexpr uint32_t MaxSegmentedSendSize = 65507;
+
+        union SegmentControl
+        {
+            cmsghdr m_header;
+            char m_buffer[CMSG_SPACE(sizeof(uint16_t))];
+        };
+
+        SendBatch& batch = *m_sendBatch;
+        const uint32_t datagramCount = aznumeric_cast<uint32_t>(batch.m_datagrams.size());
+
+        AZStd::array<mmsghdr, MaxBatchedDatagrams> messages;
+        AZStd::array<iovec, MaxBatchedDatagrams> buffers;
+        AZStd::array<sockaddr_in, MaxBatchedDatagrams> destAddresses;
+        AZStd::array<SegmentControl, MaxBatchedDatagrams> controls;
+        AZStd::array<uint32_t, MaxBatchedDatagrams> messageEnds;
+
+        uint32_t nextDatagram = 0;
+        while (nextDatagram < datagramCount)
+        {
+            // Build a message per datagram, or per run of datagrams that can be sent with segmentation offload
+            uint32_t messageCount = 0;
+            for (uint32_t datagram = nextDatagram; datagram < datagramCount; ++messageCount)
+            {
+                const SendBatch::QueuedDatagram& first = batch.m_datagrams[datagram];
+                uint32_t runEnd = datagram + 1;
+                uint32_t runSize = first.m_size;
+                if (batch.m_useSegmentation)
+                {
+                    // Every segment but the last must be exactly the segment size
+                    while ((runEnd < datagramCount)
+                        && (runEnd - datagram < MaxSegmentsPerSend)
+                        && (batch.m_datagrams[runEnd - 1].m_size == first.m_size)
+                        && (batch.m_datagrams[runEnd].m_size <= first.m_size)
+                        && (batch.m_datagrams[runEnd].m_address == first.m_address)
+                        && (runSize + batch.m_datagrams[runEnd].m_size <= MaxSegmentedSendSize))
+                    {
+                        runSize += batch.m_datagrams[runEnd].m_size;
+                        ++runEnd;
+                    }
+                }
+
+                sockaddr_in& destAddr = destAddresses[messageCount];
+                memset(&destAddr, 0, sizeof(destAddr));
+                destAddr.sin_family = AF_INET;
+                destAddr.sin_addr.s_addr = first.m_address.GetAddress(ByteOrder::Network);
+                destAddr.sin_port = first.m_address.GetPort(ByteOrder::Network);
+
+                // Queued datagrams are packed back to back, so a run is contiguous in the batch buffer
+                buffers[messageCount].iov_base = batch.m_buffer.GetBuffer() + first.m_offset;
+                buffers[messageCount].iov_len = runSize;
+
+                mmsghdr& message = messages[messageCount];
+                memset(&message, 0, sizeof(mmsghdr));
+                message.msg_hdr.msg_name = &destAddr;
+                message.msg_hdr.msg_namelen = sizeof(destAddr);
+                message.msg_hdr.msg_iov = &buffers[messageCount];
+                message.msg_hdr.msg_iovlen = 1;
+                if (runEnd - datagram > 1)
+                {
+                    message.msg_hdr.msg_control = controls[messageCount].m_buffer;
+                    message.msg_hdr.msg_controllen = sizeof(controls[messageCount].m_buffer);
+                    cmsghdr* control = CMSG_FIRSTHDR(&message.msg_hdr);
+                    control->cmsg_level = SOL_UDP;
+                    control->cmsg_type = UDP_SEGMENT;
+                    control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                    const uint16_t segmentSize = aznumeric_cast<uint16_t>(first.m_size);
+                    memcpy(CMSG_DATA(control), &segmentSize, sizeof(segmentSize));
+                }
+
+                messageEnds[messageCount] = runEnd;
+                datagram = runEnd;
+            }
+
+            const int32_t sentCount = ::sendmmsg(static_cast<int32_t>(m_socketFd), messages.data(), messageCount, 0);
+            if (sentCount > 0)
+            {
+                nextDatagram = messageEnds[sentCount - 1];
+                continue;
+            }
+
+            const int32_t error = GetLastNetworkError();
+            if ((sentCount < 0) && batch.m_useSegmentation && ((error == EIO) || (error == EINVAL)))
+            {
+                // The outgoing device can't offload segmentation, fall back to a message per datagram
+                AZLOG_WARN("UDP segmentation offload unavailable (%d:%s), disabling it for this socket", error, GetNetworkErrorDesc(error));
+                batch.m_useSegmentation = false;
+                continue;
+            }
+
+            if ((sentCount == 0) || ErrorIsWouldBlock(error))
+            {
+                // The send buffer is full, keep the unsent datagrams queued for the next flush
+                const uint32_t unsentOffset = batch.m_datagrams[nextDatagram].m_offset;
+                const uint32_t unsentSize = batch.m_buffer.GetSize() - unsentOffset;
+                memmove(batch.m_buffer.GetBuffer(), batch.m_buffer.GetBuffer() + unsentOffset, unsentSize);
+                batch.m_buffer.Resize(unsentSize);
+                batch.m_datagrams.erase(batch.m_datagrams.begin(), batch.m_datagrams.begin() + nextDatagram);
+                for (SendBatch::QueuedDatagram& queued : batch.m_datagrams)
+                {
+                    queued.m_offset -= unsentOffset;
+                }
+                return;
+            }
+
+            // Drop the datagrams of the message that failed, the rest may be headed elsewhere and can still be sent
+            AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            DropQueuedSends(nextDatagram, messageEnds[0]);
+            nextDatagram = messageEnds[0];
+        }
+#endif
+
+        m_sendBatch->m_datagrams.clear();
+        m_sendBatch->m_buffer.Resize(0);
+    }
+
+    void UdpSocket::DropQueuedSends(uint32_t firstDropped, uint32_t endDropped) const
+    {
+        if (firstDropped >= endDropped)
+        {
+            return;
+        }
+
+        // Queued datagrams were counted as sent by Send, so take them back out of the metrics
+        const SendBatch& batch = *m_sendBatch;
+        uint32_t droppedBytes = 0;
+        for (uint32_t datagram = firstDropped; datagram < endDropped; ++datagram)
+        {
+            droppedBytes += batch.m_datagrams[datagram].m_size;
+        }
+        const uint32_t droppedCount = endDropped - firstDropped;
+        m_sentPackets -= droppedCount;
+        m_sentBytes -= droppedBytes;
+        AZLOG_WARN("Dropped %u queued datagrams (%u bytes) that failed to send", droppedCount, droppedBytes);
+    }
+
+    int32_t UdpSocket::QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const
+    {
+        SendBatch& batch = *m_sendBatch;
+        const auto canQueue = [&batch, size]()
+        {
+            return !batch.m_datagrams.full() && (batch.m_buffer.GetSize() + size <= batch.m_buffer.GetCapacity());
+        };
+
+        if (!canQueue())
+        {
+            FlushSends();
+        }
+
+        if (!canQueue())
+        {
+            // The socket is still backed up, so send directly and report would block failures the same way as unbatched sends
+            return SendTo(m_socketFd, address, data, size);
+        }
+
+        const uint32_t offset = batch.m_buffer.GetSize();
+        batch.m_buffer.Resize(offset + size);
+        memcpy(batch.m_buffer.GetBuffer() + offset, data, size);
+        batch.m_datagrams.push_back(SendBatch::QueuedDatagram{ address, offset, size });
+        return aznumeric_cast<int32_t>(size);
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
-        sockaddr_in destAddr;
-        memset(&destAddr, 0, sizeof(destAddr));
-        destAddr.sin_family = AF_INET;
-        destAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
-        destAddr.sin_port = address.GetPort(ByteOrder::Network);
-        return sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr));
+        if ((m_sendBatch != nullptr) && (size <= MaxUdpTransmissionUnit))
+        {
+            return QueueSend(address, data, size);
+        }
+
+        return SendTo(m_socketFd, address, data, size);
     }
 
 #ifdef ENABLE_LATENCY_DEBUG
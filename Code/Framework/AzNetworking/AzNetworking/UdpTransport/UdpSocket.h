@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,7 +43,18 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
-        UdpSocket() = default;
+        //! Maximum number of datagrams transferred by a single batched receive or send.
+        static constexpr uint32_t MaxBatchedDatagrams = 64;
+
+        //! A single datagram received by ReceiveBatch.
+        struct ReceivedDatagram
+        {
+            IpAddress m_address;
+            const uint8_t* m_data = nullptr;
+            int32_t m_receivedBytes = 0;
+        };
+
+        UdpSocket();
         virtual ~UdpSocket();
 
         //! Returns true if this is an encrypted socket, false if not.
@@ -62,6 +74,11 @@ namespace AzNetworking
         //! @return a connect result specifying whether the connection is still pending, failed, or complete
         virtual DtlsEndpoint::ConnectResult AcceptDtlsEndpoint(DtlsEndpoint& dtlsEndpoint, const IpAddress& address) const;
 
+        //! Allows several sockets to bind the same port, with the kernel distributing incoming datagrams between them by address hash.
+        //! Must be called before Open, and is only supported on platforms with AZ_TRAIT_USE_SOCKET_REUSEPORT.
+        //! @param portSharing if true, the socket will share its port with other sockets that also enable port sharing
+        void SetPortSharing(bool portSharing);
+
         //! Opens the UDP socket on the given port.
         //! @param port      the port number to open the UDP socket on, 0 will bind to any available port
         //! @param canAccept if true, the socket will be opened in a way that allows accepting incoming connections
@@ -93,6 +110,23 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives up to count payloads from the UDP socket, using a single system call on platforms that support batched receives.
+        //! Payload i is written to outData + i * MaxUdpTransmissionUnit, so outData must have room for count * MaxUdpTransmissionUnit bytes.
+        //! @param outDatagrams on success, the address, location and size of each received payload
+        //! @param outData      address to write the received data to
+        //! @param count        maximum number of payloads to receive, at most MaxBatchedDatagrams
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(ReceivedDatagram* outDatagrams, uint8_t* outData, uint32_t count) const;
+
+        //! Returns true if sends are queued and transmitted in batches by FlushSends.
+        //! @return boolean true if sends are queued and transmitted in batches by FlushSends
+        bool IsBatchingSends() const;
+
+        //! Transmits any payloads queued by Send, using as few system calls as the platform supports.
+        //! Payloads the socket would block on stay queued for the next flush, payloads that fail to send are dropped and
+        //! removed from the sent metrics. This is a no-op unless the socket is batching sends.
+        void FlushSends() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -130,12 +164,21 @@ namespace AzNetworking
 
     private:
 
+        struct SendBatch;
+
+        int32_t QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+        void DropQueuedSends(uint32_t firstDropped, uint32_t endDropped) const;
+
         SocketFd m_socketFd = InvalidSocketFd;
+        bool m_portSharing = false;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
 
+        //! Payloads queued for a batched send, only allocated if the socket batches sends
+        AZStd::unique_ptr<SendBatch> m_sendBatch;
+
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
         {
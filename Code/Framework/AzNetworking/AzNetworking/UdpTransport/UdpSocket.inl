@@ -15,6 +15,17 @@ namespace AzNetworking
         return (m_socketFd > SocketFd{ 0 });
     }
 
+    inline void UdpSocket::SetPortSharing(bool portSharing)
+    {
+        AZ_Assert(!IsOpen(), "Port sharing must be configured before opening the socket");
+        m_portSharing = portSharing;
+    }
+
+    inline bool UdpSocket::IsBatchingSends() const
+    {
+        return (m_sendBatch != nullptr);
+    }
+
     inline SocketFd UdpSocket::GetSocketFd() const
     {
         return m_socketFd;
@@ -36,6 +36,8 @@ set(FILES
     DataStructures/IBitset.h
     DataStructures/RingBufferBitset.h
     DataStructures/RingBufferBitset.inl
+    DataStructures/SpscRingBuffer.h
+    DataStructures/SpscRingBuffer.inl
     DataStructures/TimeoutQueue.cpp
     DataStructures/TimeoutQueue.h
     DataStructures/TimeoutQueue.inl
@@ -62,6 +64,8 @@ set(FILES
     Serialization/NetworkOutputSerializer.cpp
     Serialization/NetworkOutputSerializer.h
     Serialization/NetworkOutputSerializer.inl
+    Serialization/SnapshotDelta.cpp
+    Serialization/SnapshotDelta.h
     Serialization/StringifySerializer.cpp
     Serialization/StringifySerializer.h
     Serialization/TrackChangedSerializer.h
@@ -118,6 +122,12 @@ set(FILES
     UdpTransport/UdpReaderThread.h
     UdpTransport/UdpReliableQueue.cpp
     UdpTransport/UdpReliableQueue.h
+    UdpTransport/UdpShardedConnection.cpp
+    UdpTransport/UdpShardedConnection.h
+    UdpTransport/UdpShardedConnectionSet.cpp
+    UdpTransport/UdpShardedConnectionSet.h
+    UdpTransport/UdpShardedNetworkInterface.cpp
+    UdpTransport/UdpShardedNetworkInterface.h
     UdpTransport/UdpSocket.cpp
     UdpTransport/UdpSocket.h
     UdpTransport/UdpSocket.inl
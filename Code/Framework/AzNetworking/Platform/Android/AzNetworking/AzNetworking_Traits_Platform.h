@@ -14,4 +14,6 @@
 #define AZ_TRAIT_USE_SOCKET_SERVER_SELECT 0
 #define AZ_TRAIT_USE_OPENSSL 0
 #define AZ_TRAIT_NEEDS_HTONLL 1
+#define AZ_TRAIT_USE_SOCKET_BATCHED_IO 0
+#define AZ_TRAIT_USE_SOCKET_REUSEPORT 0
 
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/SpscRingBuffer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    TEST(SpscRingBuffer, TestEmpty)
+    {
+        SpscRingBuffer<256> ringBuffer;
+        uint32_t size = 0;
+        EXPECT_TRUE(ringBuffer.IsEmpty());
+        EXPECT_EQ(ringBuffer.BeginRead(size), nullptr);
+    }
+
+    TEST(SpscRingBuffer, TestWriteRead)
+    {
+        SpscRingBuffer<256> ringBuffer;
+        const uint32_t first = 0x12345678;
+        const uint8_t second[3] = { 1, 2, 3 };
+        EXPECT_TRUE(ringBuffer.Write(&first, sizeof(first)));
+        EXPECT_TRUE(ringBuffer.Write(second, sizeof(second)));
+        EXPECT_FALSE(ringBuffer.IsEmpty());
+
+        uint32_t size = 0;
+        const uint8_t* record = ringBuffer.BeginRead(size);
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(size, sizeof(first));
+        EXPECT_EQ(memcmp(record, &first, sizeof(first)), 0);
+        ringBuffer.EndRead();
+
+        record = ringBuffer.BeginRead(size);
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(size, sizeof(second));
+        EXPECT_EQ(memcmp(record, second, sizeof(second)), 0);
+        ringBuffer.EndRead();
+
+        EXPECT_TRUE(ringBuffer.IsEmpty());
+    }
+
+    TEST(SpscRingBuffer, TestPartialWrite)
+    {
+        SpscRingBuffer<256> ringBuffer;
+        uint8_t* record = ringBuffer.BeginWrite(100);
+        ASSERT_NE(record, nullptr);
+        record[0] = 42;
+        ringBuffer.EndWrite(1);
+
+        uint32_t size = 0;
+        const uint8_t* readRecord = ringBuffer.BeginRead(size);
+        ASSERT_NE(readRecord, nullptr);
+        EXPECT_EQ(size, 1u);
+        EXPECT_EQ(readRecord[0], 42);
+        ringBuffer.EndRead();
+    }
+
+    TEST(SpscRingBuffer, TestFullAndWrap)
+    {
+        // Each 40 byte record takes 48 bytes including its header, so only five fit in 256 bytes
+        SpscRingBuffer<256> ringBuffer;
+        uint8_t payload[40] = {};
+        for (uint8_t i = 0; i < 5; ++i)
+        {
+            payload[0] = i;
+            EXPECT_TRUE(ringBuffer.Write(payload, sizeof(payload)));
+        }
+        EXPECT_FALSE(ringBuffer.Write(payload, sizeof(payload)));
+
+        // Releasing two records frees 96 bytes at the start, but only 16 bytes remain at the end, so the next record wraps
+        // to the start and the 16 bytes are skipped, leaving room for exactly one more record
+        uint32_t size = 0;
+        for (uint8_t i = 0; i < 2; ++i)
+        {
+            const uint8_t* record = ringBuffer.BeginRead(size);
+            ASSERT_NE(record, nullptr);
+            EXPECT_EQ(record[0], i);
+            ringBuffer.EndRead();
+        }
+        for (uint8_t i = 5; i < 7; ++i)
+        {
+            payload[0] = i;
+            EXPECT_TRUE(ringBuffer.Write(payload, sizeof(payload)));
+        }
+        EXPECT_FALSE(ringBuffer.Write(payload, sizeof(payload)));
+
+        for (uint8_t i = 2; i < 7; ++i)
+        {
+            const uint8_t* record = ringBuffer.BeginRead(size);
+            ASSERT_NE(record, nullptr);
+            EXPECT_EQ(size, sizeof(payload));
+            EXPECT_EQ(record[0], i);
+            ringBuffer.EndRead();
+        }
+        EXPECT_TRUE(ringBuffer.IsEmpty());
+    }
+
+    TEST(SpscRingBuffer, TestConcurrentProducerConsumer)
+    {
+        constexpr uint32_t RecordCount = 100000;
+        auto ringBuffer = AZStd::make_unique<SpscRingBuffer<4096>>();
+
+        AZStd::thread producer([&ringBuffer]()
+        {
+            for (uint32_t i = 0; i < RecordCount; ++i)
+            {
+                // Vary the record size so records regularly straddle the end of the buffer
+                const uint32_t size = sizeof(uint32_t) * (1 + i % 37);
+                uint8_t* record = nullptr;
+                while ((record = ringBuffer->BeginWrite(size)) == nullptr)
+                {
+                    AZStd::this_thread::yield();
+                }
+                for (uint32_t offset = 0; offset < size; offset += sizeof(uint32_t))
+                {
+                    memcpy(record + offset, &i, sizeof(i));
+                }
+                ringBuffer->EndWrite(size);
+            }
+        });
+
+        uint32_t expected = 0;
+        while (expected < RecordCount)
+        {
+            uint32_t size = 0;
+            const uint8_t* record = ringBuffer->BeginRead(size);
+            if (record == nullptr)
+            {
+                AZStd::this_thread::yield();
+                continue;
+            }
+
+            EXPECT_EQ(size, sizeof(uint32_t) * (1 + expected % 37));
+            uint32_t last = 0;
+            memcpy(&last, record + size - sizeof(uint32_t), sizeof(last));
+            EXPECT_EQ(last, expected);
+            ringBuffer->EndRead();
+            ++expected;
+        }
+
+        producer.join();
+        EXPECT_TRUE(ringBuffer->IsEmpty());
+    }
+}
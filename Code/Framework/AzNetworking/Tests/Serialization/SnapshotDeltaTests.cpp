@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/SnapshotDelta.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    static constexpr uint32_t TestSnapshotCapacity = 256;
+    using TestSnapshot = AZStd::array<uint8_t, TestSnapshotCapacity>;
+
+    //! Encodes snapshot against baseline, decodes the result against the same baseline and returns the encoded size.
+    uint32_t RoundTripSnapshot(const uint8_t* baseline, uint32_t baselineSize, TestSnapshot& snapshot, uint32_t snapshotSize)
+    {
+        const SnapshotDelta delta(baseline, baselineSize);
+
+        AZStd::array<uint8_t, 1024> encoded;
+        NetworkInputSerializer inputSerializer(encoded.data(), static_cast<uint32_t>(encoded.size()));
+        EXPECT_TRUE(delta.Serialize(inputSerializer, snapshot.data(), TestSnapshotCapacity, snapshotSize));
+
+        TestSnapshot decoded = {};
+        uint32_t decodedSize = 0;
+        NetworkOutputSerializer outputSerializer(encoded.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(delta.Serialize(outputSerializer, decoded.data(), TestSnapshotCapacity, decodedSize));
+
+        EXPECT_EQ(decodedSize, snapshotSize);
+        EXPECT_EQ(memcmp(decoded.data(), snapshot.data(), snapshotSize), 0);
+        return inputSerializer.GetSize();
+    }
+
+    TEST(SnapshotDelta, TestFullSnapshot)
+    {
+        TestSnapshot snapshot;
+        for (uint32_t i = 0; i < TestSnapshotCapacity; ++i)
+        {
+            snapshot[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+        RoundTripSnapshot(nullptr, 0, snapshot, 100);
+    }
+
+    TEST(SnapshotDelta, TestUnchangedSnapshot)
+    {
+        TestSnapshot snapshot;
+        for (uint32_t i = 0; i < TestSnapshotCapacity; ++i)
+        {
+            snapshot[i] = static_cast<uint8_t>(i);
+        }
+        const TestSnapshot baseline = snapshot;
+
+        // 2 bytes of size, and one empty group mask per 64 bytes
+        EXPECT_EQ(RoundTripSnapshot(baseline.data(), TestSnapshotCapacity, snapshot, TestSnapshotCapacity), 2u + TestSnapshotCapacity / 64);
+    }
+
+    TEST(SnapshotDelta, TestSparseChanges)
+    {
+        TestSnapshot snapshot;
+        for (uint32_t i = 0; i < TestSnapshotCapacity; ++i)
+        {
+            snapshot[i] = static_cast<uint8_t>(i);
+        }
+        const TestSnapshot baseline = snapshot;
+        snapshot[3] = 0xFF;
+        snapshot[4] = 0xFE;
+        snapshot[200] = 0xFD;
+
+        // 2 bytes of size, 4 group masks, 2 block masks and 3 changed bytes
+        EXPECT_EQ(RoundTripSnapshot(baseline.data(), TestSnapshotCapacity, snapshot, TestSnapshotCapacity), 11u);
+    }
+
+    TEST(SnapshotDelta, TestResizedSnapshot)
+    {
+        TestSnapshot baseline;
+        TestSnapshot snapshot;
+        for (uint32_t i = 0; i < TestSnapshotCapacity; ++i)
+        {
+            baseline[i] = static_cast<uint8_t>(i);
+            snapshot[i] = static_cast<uint8_t>(i + 1);
+        }
+
+        // Grow past the end of the baseline, and shrink below it
+        RoundTripSnapshot(baseline.data(), 37, snapshot, 150);
+        RoundTripSnapshot(baseline.data(), 150, snapshot, 37);
+    }
+
+    TEST(SnapshotDelta, TestTruncatedSnapshot)
+    {
+        TestSnapshot snapshot;
+        for (uint32_t i = 0; i < TestSnapshotCapacity; ++i)
+        {
+            snapshot[i] = static_cast<uint8_t>(i);
+        }
+        const SnapshotDelta delta(nullptr, 0);
+
+        AZStd::array<uint8_t, 1024> encoded;
+        NetworkInputSerializer inputSerializer(encoded.data(), static_cast<uint32_t>(encoded.size()));
+        uint32_t snapshotSize = TestSnapshotCapacity;
+        EXPECT_TRUE(delta.Serialize(inputSerializer, snapshot.data(), TestSnapshotCapacity, snapshotSize));
+
+        // Decoding a truncated delta must fail rather than produce a partial snapshot
+        TestSnapshot decoded = {};
+        uint32_t decodedSize = 0;
+        NetworkOutputSerializer outputSerializer(encoded.data(), inputSerializer.GetSize() - 1);
+        EXPECT_FALSE(delta.Serialize(outputSerializer, decoded.data(), TestSnapshotCapacity, decodedSize));
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Replicated state of a single entity in the trace, laid out like a typical networked character.
+    struct TraceEntityState
+    {
+        QuantizedValues<3, 2, -1024, 1024> m_position;
+        QuantizedValues<1, 1, -4, 4> m_heading;
+        QuantizedValues<3, 1, -16, 16> m_velocity;
+        uint16_t m_health = 100;
+        uint8_t m_animationState = 0;
+
+        bool Serialize(ISerializer& serializer)
+        {
+            m_position.Serialize(serializer);
+            m_heading.Serialize(serializer);
+            m_velocity.Serialize(serializer);
+            serializer.Serialize(m_health, "Health");
+            serializer.Serialize(m_animationState, "AnimationState");
+            return serializer.IsValid();
+        }
+    };
+
+    //! Records a trace of state.range(0) wandering entities over TraceTickCount ticks, serializing every entity snapshot.
+    //! Benchmarks then replay the trace, encoding every snapshot either in full, or as a delta against the snapshot sent
+    //! state.range(1) ticks earlier, which models the last baseline acknowledged by a client at that round trip time.
+    class SnapshotDeltaTraceFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t TraceTickCount = 300;
+        static constexpr uint32_t TraceSnapshotCapacity = 64;
+
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        struct TraceSnapshot
+        {
+            AZStd::array<uint8_t, TraceSnapshotCapacity> m_data;
+            uint32_t m_size = 0;
+        };
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            const uint32_t entityCount = aznumeric_cast<uint32_t>(state.range(0));
+            m_trace.resize(TraceTickCount * entityCount);
+
+            uint32_t seed = 0x1234567;
+            auto random = [&seed](float range)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                return (static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 2.0f - 1.0f) * range;
+            };
+
+            for (uint32_t entity = 0; entity < entityCount; ++entity)
+            {
+                AZ::Vector3 position(random(500.0f), random(500.0f), 0.0f);
+                AZ::Vector3 velocity(random(5.0f), random(5.0f), 0.0f);
+                TraceEntityState entityState;
+                for (uint32_t tick = 0; tick < TraceTickCount; ++tick)
+                {
+                    // Steer a little every tick, and occasionally take damage or change animation
+                    velocity += AZ::Vector3(random(0.25f), random(0.25f), 0.0f);
+                    velocity = velocity.GetClamp(AZ::Vector3(-8.0f), AZ::Vector3(8.0f));
+                    position += velocity * 0.05f;
+                    entityState.m_position = position;
+                    entityState.m_velocity = velocity;
+                    entityState.m_heading = AZ::Atan2(velocity.GetY(), velocity.GetX());
+                    if (random(1.0f) > 0.95f)
+                    {
+                        entityState.m_health = static_cast<uint16_t>(AZStd::max(0, entityState.m_health - 5));
+                        entityState.m_animationState = static_cast<uint8_t>((entityState.m_animationState + 1) % 8);
+                    }
+
+                    TraceSnapshot& snapshot = GetSnapshot(tick, entity, entityCount);
+                    NetworkInputSerializer serializer(snapshot.m_data.data(), TraceSnapshotCapacity);
+                    entityState.Serialize(serializer);
+                    snapshot.m_size = serializer.GetSize();
+                }
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_trace = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        TraceSnapshot& GetSnapshot(uint32_t tick, uint32_t entity, uint32_t entityCount)
+        {
+            return m_trace[tick * entityCount + entity];
+        }
+
+        void EncodeTrace(::benchmark::State& state, bool useBaseline)
+        {
+            const uint32_t entityCount = aznumeric_cast<uint32_t>(state.range(0));
+            const uint32_t ackLatencyTicks = aznumeric_cast<uint32_t>(state.range(1));
+
+            AZStd::array<uint8_t, TraceSnapshotCapacity * 2> encoded;
+            uint64_t totalBytes = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                totalBytes = 0;
+                for (uint32_t tick = 0; tick < TraceTickCount; ++tick)
+                {
+                    for (uint32_t entity = 0; entity < entityCount; ++entity)
+                    {
+                        TraceSnapshot& snapshot = GetSnapshot(tick, entity, entityCount);
+                        const TraceSnapshot* baseline = (useBaseline && (tick >= ackLatencyTicks))
+                            ? &GetSnapshot(tick - ackLatencyTicks, entity, entityCount)
+                            : nullptr;
+
+                        const SnapshotDelta delta(baseline ? baseline->m_data.data() : nullptr, baseline ? baseline->m_size : 0);
+                        NetworkInputSerializer serializer(encoded.data(), static_cast<uint32_t>(encoded.size()));
+                        uint32_t snapshotSize = snapshot.m_size;
+                        delta.Serialize(serializer, snapshot.m_data.data(), TraceSnapshotCapacity, snapshotSize);
+                        totalBytes += serializer.GetSize();
+                    }
+                }
+                ::benchmark::DoNotOptimize(totalBytes);
+            }
+
+            state.counters["BytesPerTick"] = static_cast<double>(totalBytes) / TraceTickCount;
+            state.counters["BytesPerEntityUpdate"] = static_cast<double>(totalBytes) / (TraceTickCount * entityCount);
+            state.SetItemsProcessed(state.iterations() * TraceTickCount * entityCount);
+        }
+
+        AZStd::vector<TraceSnapshot> m_trace;
+    };
+
+    void SnapshotDeltaTraceArguments(::benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t ackLatencyTicks : { 1, 4, 10 })
+        {
+            benchmark->Args({ 256, ackLatencyTicks });
+        }
+        benchmark->ArgNames({ "Entities", "AckLatencyTicks" });
+    }
+
+    BENCHMARK_DEFINE_F(SnapshotDeltaTraceFixture, FullSnapshots)(::benchmark::State& state)
+    {
+        EncodeTrace(state, false);
+    }
+    BENCHMARK_REGISTER_F(SnapshotDeltaTraceFixture, FullSnapshots)->Apply(SnapshotDeltaTraceArguments);
+
+    BENCHMARK_DEFINE_F(SnapshotDeltaTraceFixture, DeltaAgainstAckedBaseline)(::benchmark::State& state)
+    {
+        EncodeTrace(state, true);
+    }
+    BENCHMARK_REGISTER_F(SnapshotDeltaTraceFixture, DeltaAgainstAckedBaseline)->Apply(SnapshotDeltaTraceArguments);
+}
+#endif
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <ctime>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    static constexpr uint16_t TestReceivePort = 12350;
+    static constexpr uint32_t TestDatagramCount = 16;
+
+    class UdpSocketTests
+        : public AllocatorsFixture
+    {
+    public:
+
+        void SetUp() override
+        {
+            SetupAllocator();
+
+            m_console = AZStd::make_unique<AZ::Console>();
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            SocketLayerInit();
+        }
+
+        void TearDown() override
+        {
+            SocketLayerShutdown();
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console = nullptr;
+
+            TeardownAllocator();
+        }
+
+        //! Sends TestDatagramCount payloads of the given size, each filled with its own index.
+        void SendDatagrams(const UdpSocket& socket, uint32_t size)
+        {
+            const IpAddress address(127, 0, 0, 1, TestReceivePort);
+            AZStd::array<uint8_t, MaxUdpTransmissionUnit> payload;
+            for (uint32_t i = 0; i < TestDatagramCount; ++i)
+            {
+                memset(payload.data(), static_cast<int>(i), size);
+                EXPECT_EQ(socket.Send(address, payload.data(), size, false, m_dtlsEndpoint, m_connectionQuality), static_cast<int32_t>(size));
+            }
+        }
+
+        //! Receives and validates the payloads written by SendDatagrams.
+        void ReceiveDatagrams(const UdpSocket& socket, uint32_t size)
+        {
+            AZStd::array<UdpSocket::ReceivedDatagram, UdpSocket::MaxBatchedDatagrams> datagrams;
+            AZStd::vector<uint8_t> buffer(UdpSocket::MaxBatchedDatagrams * MaxUdpTransmissionUnit);
+
+            const int32_t received = socket.ReceiveBatch(datagrams.data(), buffer.data(), UdpSocket::MaxBatchedDatagrams);
+            ASSERT_EQ(received, static_cast<int32_t>(TestDatagramCount));
+            for (uint32_t i = 0; i < TestDatagramCount; ++i)
+            {
+                EXPECT_EQ(datagrams[i].m_data, buffer.data() + i * MaxUdpTransmissionUnit);
+                EXPECT_EQ(datagrams[i].m_receivedBytes, static_cast<int32_t>(size));
+                EXPECT_EQ(datagrams[i].m_data[0], static_cast<uint8_t>(i));
+                EXPECT_EQ(datagrams[i].m_data[size - 1], static_cast<uint8_t>(i));
+            }
+
+            // The socket has been drained
+            EXPECT_EQ(socket.ReceiveBatch(datagrams.data(), buffer.data(), UdpSocket::MaxBatchedDatagrams), 0);
+        }
+
+        AZStd::unique_ptr<AZ::Console> m_console;
+        DtlsEndpoint m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+    };
+
+    TEST_F(UdpSocketTests, ReceiveBatch)
+    {
+        UdpSocket receiveSocket;
+        UdpSocket sendSocket;
+        ASSERT_TRUE(receiveSocket.Open(TestReceivePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sendSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_FALSE(sendSocket.IsBatchingSends());
+
+        SendDatagrams(sendSocket, 100);
+        ReceiveDatagrams(receiveSocket, 100);
+        EXPECT_EQ(receiveSocket.GetRecvPackets(), TestDatagramCount);
+        EXPECT_EQ(receiveSocket.GetRecvBytes(), TestDatagramCount * 100);
+    }
+
+    TEST_F(UdpSocketTests, BatchedSends)
+    {
+        m_console->PerformCommand("net_UdpBatchSends true");
+
+        UdpSocket receiveSocket;
+        UdpSocket sendSocket;
+        ASSERT_TRUE(receiveSocket.Open(TestReceivePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sendSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        EXPECT_TRUE(sendSocket.IsBatchingSends());
+
+        // Nothing is transmitted until the queue is flushed, and equally sized payloads must still arrive as separate datagrams
+        SendDatagrams(sendSocket, MaxUdpTransmissionUnit);
+        AZStd::array<UdpSocket::ReceivedDatagram, 1> datagram;
+        AZStd::array<uint8_t, MaxUdpTransmissionUnit> buffer;
+        EXPECT_EQ(receiveSocket.ReceiveBatch(datagram.data(), buffer.data(), 1), 0);
+        sendSocket.FlushSends();
+        ReceiveDatagrams(receiveSocket, MaxUdpTransmissionUnit);
+#else
+        EXPECT_FALSE(sendSocket.IsBatchingSends());
+#endif
+
+        // Closing the socket flushes anything still queued
+        SendDatagrams(sendSocket, 37);
+        sendSocket.Close();
+        ReceiveDatagrams(receiveSocket, 37);
+
+        m_console->PerformCommand("net_UdpBatchSends false");
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Pushes bursts of datagrams through a pair of loopback sockets.
+    //! state.range(0) selects per datagram system calls (0) or batched sends and receives (1), state.range(1) is the payload size.
+    class UdpSocketLoopbackFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint16_t BenchmarkReceivePort = 12351;
+        static constexpr uint32_t BurstDatagramCount = UdpSocket::MaxBatchedDatagrams;
+
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_console = AZStd::make_unique<AZ::Console>();
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            m_console->PerformCommand(state.range(0) != 0 ? "net_UdpBatchSends true" : "net_UdpBatchSends false");
+            SocketLayerInit();
+
+            m_receiveSocket = AZStd::make_unique<UdpSocket>();
+            m_sendSocket = AZStd::make_unique<UdpSocket>();
+            m_receiveSocket->Open(BenchmarkReceivePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            m_sendSocket->Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_buffer.resize(BurstDatagramCount * MaxUdpTransmissionUnit);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_sendSocket = nullptr;
+            m_receiveSocket = nullptr;
+            m_buffer = {};
+
+            SocketLayerShutdown();
+            m_console->PerformCommand("net_UdpBatchSends false");
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console = nullptr;
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::Console> m_console;
+        AZStd::unique_ptr<UdpSocket> m_receiveSocket;
+        AZStd::unique_ptr<UdpSocket> m_sendSocket;
+        AZStd::vector<uint8_t> m_buffer;
+        DtlsEndpoint m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+    };
+
+    void UdpSocketLoopbackArguments(::benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t batched : { 0, 1 })
+        {
+            for (int64_t payloadBytes : { int64_t{ 64 }, int64_t{ 512 }, static_cast<int64_t>(MaxUdpTransmissionUnit) })
+            {
+                benchmark->Args({ batched, payloadBytes });
+            }
+        }
+        benchmark->ArgNames({ "Batched", "PayloadBytes" });
+    }
+
+    BENCHMARK_DEFINE_F(UdpSocketLoopbackFixture, SendReceive)(::benchmark::State& state)
+    {
+        if (!m_receiveSocket->IsOpen() || !m_sendSocket->IsOpen())
+        {
+            state.SkipWithError("Failed to open loopback sockets");
+            return;
+        }
+
+        const bool batched = (state.range(0) != 0);
+        const uint32_t payloadSize = aznumeric_cast<uint32_t>(state.range(1));
+        const IpAddress address(127, 0, 0, 1, BenchmarkReceivePort);
+        AZStd::array<uint8_t, MaxUdpTransmissionUnit> payload = {};
+        AZStd::array<UdpSocket::ReceivedDatagram, BurstDatagramCount> datagrams;
+
+        uint64_t receivedCount = 0;
+        const std::clock_t startCpuTime = std::clock();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (uint32_t i = 0; i < BurstDatagramCount; ++i)
+            {
+                m_sendSocket->Send(address, payload.data(), payloadSize, false, m_dtlsEndpoint, m_connectionQuality);
+            }
+            m_sendSocket->FlushSends();
+
+            // Stop draining on the first empty read, anything the kernel dropped is simply not counted
+            for (uint32_t burstReceived = 0; burstReceived < BurstDatagramCount;)
+            {
+                int32_t received = 0;
+                if (batched)
+                {
+                    received = m_receiveSocket->ReceiveBatch(datagrams.data(), m_buffer.data(), BurstDatagramCount - burstReceived);
+                }
+                else
+                {
+                    IpAddress fromAddress;
+                    received = (m_receiveSocket->Receive(fromAddress, m_buffer.data(), MaxUdpTransmissionUnit) > 0) ? 1 : 0;
+                }
+
+                if (received <= 0)
+                {
+                    break;
+                }
+                burstReceived += static_cast<uint32_t>(received);
+                receivedCount += static_cast<uint32_t>(received);
+            }
+        }
+        const std::clock_t endCpuTime = std::clock();
+
+        const double cpuSeconds = static_cast<double>(endCpuTime - startCpuTime) / CLOCKS_PER_SEC;
+        state.counters["CpuNsPerPacket"] = (receivedCount > 0) ? cpuSeconds * 1.0e9 / static_cast<double>(receivedCount) : 0.0;
+        state.counters["DropRate"] = 1.0 - static_cast<double>(receivedCount) / static_cast<double>(state.iterations() * BurstDatagramCount);
+        state.SetItemsProcessed(receivedCount);
+    }
+    BENCHMARK_REGISTER_F(UdpSocketLoopbackFixture, SendReceive)->Apply(UdpSocketLoopbackArguments)->UseRealTime();
+}
+#endif
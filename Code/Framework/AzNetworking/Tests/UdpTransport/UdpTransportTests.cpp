@@ -9,49 +9,130 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpShardedConnection.h>
+#include <AzNetworking/UdpTransport/UdpShardedNetworkInterface.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystemComponent.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR_EXTERNED(uint32_t, net_UdpShardMaxPendingAcks);
+}
 
 namespace UnitTest
 {
     using namespace AzNetworking;
 
+    static constexpr uint16_t TestServerPort = 12345;
+
+    //! Application level packet, which unlike the core packets is handed to the connection listener.
+    class TestPayloadPacket
+        : public IPacket
+    {
+    public:
+        static constexpr PacketType Type = static_cast<PacketType>(static_cast<uint16_t>(CorePackets::PacketType::MAX) + 1);
+
+        TestPayloadPacket(uint32_t value = 0)
+            : m_value(value)
+        {
+            ;
+        }
+
+        PacketType GetPacketType() const override
+        {
+            return Type;
+        }
+
+        AZStd::unique_ptr<IPacket> Clone() const override
+        {
+            return AZStd::make_unique<TestPayloadPacket>(m_value);
+        }
+
+        bool Serialize(ISerializer& serializer) override
+        {
+            return serializer.Serialize(m_value, "Value");
+        }
+
+        uint32_t m_value = 0;
+    };
+
     class TestUdpConnectionListener
         : public IConnectionListener
     {
     public:
         ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer)
         {
-            return ConnectResult::Accepted;
+            return m_connectResult;
         }
 
         void OnConnect([[maybe_unused]] IConnection* connection)
         {
-            ;
+            ++m_connectCount;
         }
 
         bool OnPacketReceived([[maybe_unused]] IConnection* connection, const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer)
         {
+            if (packetHeader.GetPacketType() == TestPayloadPacket::Type)
+            {
+                TestPayloadPacket packet;
+                if (!serializer.Serialize(packet, "Packet"))
+                {
+                    return false;
+                }
+                m_receivedValues.push_back(packet.m_value);
+                return true;
+            }
+
             EXPECT_TRUE((packetHeader.GetPacketType() == static_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket))
                      || (packetHeader.GetPacketType() == static_cast<PacketType>(CorePackets::PacketType::HeartbeatPacket)));
             return false;
         }
 
-        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId)
+        void OnPacketLost([[maybe_unused]] IConnection* connection, PacketId packetId)
         {
+            m_lostPacketIds.push_back(packetId);
+        }
 
+        void OnDisconnect([[maybe_unused]] IConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint)
+        {
+            ++m_disconnectCount;
+            m_disconnectReason = reason;
+            m_disconnectEndpoint = endpoint;
         }
 
-        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint)
+        bool WasPacketLost(PacketId packetId) const
         {
+            return AZStd::find(m_lostPacketIds.begin(), m_lostPacketIds.end(), packetId) != m_lostPacketIds.end();
+        }
 
+        bool WasValueReceived(uint32_t value) const
+        {
+            return AZStd::find(m_receivedValues.begin(), m_receivedValues.end(), value) != m_receivedValues.end();
         }
+
+        ConnectResult m_connectResult = ConnectResult::Accepted;
+        uint32_t m_connectCount = 0;
+        uint32_t m_disconnectCount = 0;
+        DisconnectReason m_disconnectReason = DisconnectReason::None;
+        TerminationEndpoint m_disconnectEndpoint = TerminationEndpoint::Local;
+        AZStd::vector<uint32_t> m_receivedValues;
+        AZStd::vector<PacketId> m_lostPacketIds;
     };
 
     class TestUdpClient
@@ -62,7 +143,7 @@ namespace UnitTest
             AZStd::string name = AZStd::string::format("UdpClient%d", ++s_numClients);
             m_name = name;
             m_clientNetworkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(m_name, ProtocolType::Udp, TrustZone::ExternalClientToServer, m_connectionListener);
-            m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, 12345));
+            m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, TestServerPort));
         }
 
         ~TestUdpClient()
@@ -82,7 +163,7 @@ namespace UnitTest
         TestUdpServer()
         {
             m_serverNetworkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(m_name, ProtocolType::Udp, TrustZone::ExternalClientToServer, m_connectionListener);
-            m_serverNetworkInterface->Listen(12345);
+            m_serverNetworkInterface->Listen(TestServerPort);
         }
 
         ~TestUdpServer()
@@ -95,6 +176,81 @@ namespace UnitTest
         INetworkInterface* m_serverNetworkInterface;
     };
 
+    class TestShardedUdpServer
+    {
+    public:
+        TestShardedUdpServer(uint32_t shardCount)
+        {
+            m_serverNetworkInterface = AZ::Interface<INetworking>::Get()->CreateShardedNetworkInterface(m_name, TrustZone::ExternalClientToServer, m_connectionListener, shardCount);
+            m_serverNetworkInterface->Listen(TestServerPort);
+        }
+
+        ~TestShardedUdpServer()
+        {
+            AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(m_name);
+        }
+
+        AZ::Name m_name = AZ::Name(AZStd::string_view("ShardedUdpServer"));
+        TestUdpConnectionListener m_connectionListener;
+        INetworkInterface* m_serverNetworkInterface;
+    };
+
+    //! Client that speaks the Udp protocol directly on a socket, so tests can choose which packets it acknowledges.
+    class TestRawUdpClient
+    {
+    public:
+        TestRawUdpClient()
+        {
+            m_socket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            CorePackets::InitiateConnectionPacket packet;
+            SendPacket(packet);
+        }
+
+        //! Sends a packet to the test server, acknowledging all packets passed to ProcessReceived so far.
+        void SendPacket(IPacket& packet)
+        {
+            UdpPacketHeader header(m_packetTracker, packet.GetPacketType(), InvalidSequenceId);
+            UdpPacketEncodingBuffer buffer;
+            buffer.Resize(buffer.GetCapacity());
+            NetworkInputSerializer networkSerializer(buffer.GetBuffer(), buffer.GetCapacity());
+            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+            EXPECT_TRUE(header.SerializePacketFlags(serializer));
+            EXPECT_TRUE(serializer.Serialize(header, "Header"));
+            EXPECT_TRUE(serializer.Serialize(packet, "Packet"));
+            m_socket.Send(IpAddress(127, 0, 0, 1, TestServerPort), buffer.GetBuffer(), networkSerializer.GetSize(), false, m_dtlsEndpoint, m_connectionQuality);
+        }
+
+        //! Reads the headers of all packets waiting on the socket, without acknowledging them.
+        AZStd::vector<UdpPacketHeader> ReceivePackets()
+        {
+            AZStd::vector<UdpPacketHeader> headers;
+            AZStd::array<uint8_t, MaxUdpTransmissionUnit> buffer;
+            IpAddress address;
+            for (int32_t receivedBytes = m_socket.Receive(address, buffer.data(), MaxUdpTransmissionUnit); receivedBytes > 0;
+                receivedBytes = m_socket.Receive(address, buffer.data(), MaxUdpTransmissionUnit))
+            {
+                NetworkOutputSerializer networkSerializer(buffer.data(), aznumeric_cast<uint32_t>(receivedBytes));
+                UdpPacketHeader header;
+                if (header.SerializePacketFlags(networkSerializer) && static_cast<ISerializer&>(networkSerializer).Serialize(header, "Header"))
+                {
+                    headers.push_back(header);
+                }
+            }
+            return headers;
+        }
+
+        //! Marks a received packet as delivered, so the next packet sent acknowledges it.
+        void ProcessReceived(UdpPacketHeader& header)
+        {
+            m_packetTracker.ProcessReceived(nullptr, header);
+        }
+
+        UdpSocket m_socket;
+        UdpPacketTracker m_packetTracker;
+        DtlsEndpoint m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+    };
+
     class UdpTransportTests
         : public AllocatorsFixture
     {
@@ -120,6 +276,48 @@ namespace UnitTest
             TeardownAllocator();
         }
 
+        //! Updates all network interfaces until the condition holds or the test times out.
+        //! @param condition the condition to wait for
+        //! @return boolean true if the condition holds
+        bool UpdateUntil(const AZStd::function<bool()>& condition)
+        {
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+                if (condition())
+                {
+                    return true;
+                }
+                if (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs)
+                {
+                    return false;
+                }
+            }
+        }
+
+        //! Returns the first connection of the network interface, or nullptr if it has none.
+        static IConnection* GetFirstConnection(INetworkInterface& networkInterface)
+        {
+            IConnection* result = nullptr;
+            networkInterface.GetConnectionSet().VisitConnections([&result](IConnection& connection)
+            {
+                result = (result != nullptr) ? result : &connection;
+            });
+            return result;
+        }
+
+        //! Returns true if the network interface has a single connection, and it is connected.
+        static bool IsConnected(INetworkInterface& networkInterface)
+        {
+            IConnection* connection = GetFirstConnection(networkInterface);
+            return (networkInterface.GetConnectionSet().GetConnectionCount() == 1)
+                && (connection != nullptr)
+                && (connection->GetConnectionState() == ConnectionState::Connected);
+        }
+
         AZ::LoggerSystemComponent* m_loggerComponent;
         AZ::TimeSystemComponent* m_timeComponent;
         AzNetworking::NetworkingSystemComponent* m_networkingSystemComponent;
@@ -299,4 +497,251 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestShardedMultipleClients)
+    {
+        constexpr uint32_t NumTestShards = 4;
+        constexpr uint32_t NumTestClients = 50;
+
+        TestShardedUdpServer testServer(NumTestShards);
+        TestUdpClient testClient[NumTestClients];
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        for (;;)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+            bool canTerminate = testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                canTerminate &= testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+            }
+            if (canTerminate || timeExpired)
+            {
+                break;
+            }
+        }
+
+        EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+        for (uint32_t i = 0; i < NumTestClients; ++i)
+        {
+            EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+        }
+
+        // The kernel spreads the clients across the shard sockets, so more than one shard must own connections
+        const uint32_t shardCount = static_cast<UdpShardedNetworkInterface*>(testServer.m_serverNetworkInterface)->GetShardCount();
+        AZStd::vector<uint32_t> shardConnectionCounts(shardCount, 0);
+        testServer.m_serverNetworkInterface->GetConnectionSet().VisitConnections([&shardConnectionCounts](IConnection& connection)
+        {
+            ++shardConnectionCounts[static_cast<UdpShardedConnection&>(connection).GetShardIndex()];
+        });
+        const auto usedShardCount = AZStd::count_if(shardConnectionCounts.begin(), shardConnectionCounts.end(), [](uint32_t count) { return count > 0; });
+        if (shardCount > 1)
+        {
+            EXPECT_GT(usedShardCount, 1);
+        }
+    }
+
+    TEST_F(UdpTransportTests, TestShardedPacketRoundTrip)
+    {
+        TestShardedUdpServer testServer(2);
+        TestUdpClient testClient;
+
+        ASSERT_TRUE(UpdateUntil([&]() { return IsConnected(*testServer.m_serverNetworkInterface) && IsConnected(*testClient.m_clientNetworkInterface); }));
+        IConnection* serverConnection = GetFirstConnection(*testServer.m_serverNetworkInterface);
+        IConnection* clientConnection = GetFirstConnection(*testClient.m_clientNetworkInterface);
+
+        // Client to server packets are decoded by a shard worker and handed over as a ShardPacket
+        EXPECT_TRUE(clientConnection->SendReliablePacket(TestPayloadPacket(1)));
+        EXPECT_NE(clientConnection->SendUnreliablePacket(TestPayloadPacket(2)), InvalidPacketId);
+
+        // Server to client packets are serialized by the proxy and written to the wire by a shard worker
+        EXPECT_TRUE(serverConnection->SendReliablePacket(TestPayloadPacket(3)));
+        EXPECT_NE(serverConnection->SendUnreliablePacket(TestPayloadPacket(4)), InvalidPacketId);
+
+        EXPECT_TRUE(UpdateUntil([&]()
+        {
+            return (testServer.m_connectionListener.m_receivedValues.size() == 2) && (testClient.m_connectionListener.m_receivedValues.size() == 2);
+        }));
+        EXPECT_TRUE(testServer.m_connectionListener.WasValueReceived(1));
+        EXPECT_TRUE(testServer.m_connectionListener.WasValueReceived(2));
+        EXPECT_TRUE(testClient.m_connectionListener.WasValueReceived(3));
+        EXPECT_TRUE(testClient.m_connectionListener.WasValueReceived(4));
+        EXPECT_EQ(serverConnection->GetConnectionState(), ConnectionState::Connected);
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectCount, 0);
+    }
+
+    TEST_F(UdpTransportTests, TestShardedPacketAcked)
+    {
+        TestShardedUdpServer testServer(2);
+        TestUdpClient testClient;
+
+        ASSERT_TRUE(UpdateUntil([&]() { return IsConnected(*testServer.m_serverNetworkInterface) && IsConnected(*testClient.m_clientNetworkInterface); }));
+        IConnection* serverConnection = GetFirstConnection(*testServer.m_serverNetworkInterface);
+        IConnection* clientConnection = GetFirstConnection(*testClient.m_clientNetworkInterface);
+
+        const PacketId packetId = serverConnection->SendUnreliablePacket(TestPayloadPacket(1));
+        ASSERT_NE(packetId, InvalidPacketId);
+        EXPECT_FALSE(serverConnection->WasPacketAcked(packetId));
+
+        // Acks are carried by the next packet the client sends
+        ASSERT_TRUE(UpdateUntil([&]() { return testClient.m_connectionListener.WasValueReceived(1); }));
+        clientConnection->SendUnreliablePacket(TestPayloadPacket(2));
+
+        EXPECT_TRUE(UpdateUntil([&]() { return serverConnection->WasPacketAcked(packetId); }));
+        EXPECT_TRUE(testServer.m_serverNetworkInterface->WasPacketAcked(serverConnection->GetConnectionId(), packetId));
+        EXPECT_TRUE(testServer.m_connectionListener.m_lostPacketIds.empty());
+    }
+
+    TEST_F(UdpTransportTests, TestShardedPacketLost)
+    {
+        TestShardedUdpServer testServer(2);
+        TestRawUdpClient testClient;
+
+        ASSERT_TRUE(UpdateUntil([&]() { return IsConnected(*testServer.m_serverNetworkInterface); }));
+        IConnection* serverConnection = GetFirstConnection(*testServer.m_serverNetworkInterface);
+
+        const PacketId lostPacketId = serverConnection->SendUnreliablePacket(TestPayloadPacket(1));
+        const PacketId ackedPacketId = serverConnection->SendUnreliablePacket(TestPayloadPacket(2));
+        ASSERT_NE(lostPacketId, InvalidPacketId);
+        ASSERT_NE(ackedPacketId, InvalidPacketId);
+
+        // Drop the first payload packet on the floor and only acknowledge the second one
+        uint32_t payloadPacketCount = 0;
+        ASSERT_TRUE(UpdateUntil([&]()
+        {
+            for (UdpPacketHeader& header : testClient.ReceivePackets())
+            {
+                const bool isPayload = (header.GetPacketType() == TestPayloadPacket::Type);
+                payloadPacketCount += isPayload ? 1 : 0;
+                if (!isPayload || (payloadPacketCount > 1))
+                {
+                    testClient.ProcessReceived(header);
+                }
+            }
+            return payloadPacketCount == 2;
+        }));
+        CorePackets::HeartbeatPacket heartbeatPacket;
+        testClient.SendPacket(heartbeatPacket);
+
+        // The shard reports loss and acks using the identifiers the proxy handed out
+        EXPECT_TRUE(UpdateUntil([&]()
+        {
+            return testServer.m_connectionListener.WasPacketLost(lostPacketId) && serverConnection->WasPacketAcked(ackedPacketId);
+        }));
+        EXPECT_FALSE(serverConnection->WasPacketAcked(lostPacketId));
+        EXPECT_FALSE(testServer.m_connectionListener.WasPacketLost(ackedPacketId));
+    }
+
+    TEST_F(UdpTransportTests, TestShardedPendingAckEviction)
+    {
+        TestShardedUdpServer testServer(2);
+        TestUdpClient testClient;
+
+        ASSERT_TRUE(UpdateUntil([&]() { return IsConnected(*testServer.m_serverNetworkInterface) && IsConnected(*testClient.m_clientNetworkInterface); }));
+        IConnection* serverConnection = GetFirstConnection(*testServer.m_serverNetworkInterface);
+        IConnection* clientConnection = GetFirstConnection(*testClient.m_clientNetworkInterface);
+
+        // Both packets are queued before the client can acknowledge either, so tracking the second evicts the first
+        const uint32_t maxPendingAcks = net_UdpShardMaxPendingAcks;
+        net_UdpShardMaxPendingAcks = 1;
+        const PacketId evictedPacketId = serverConnection->SendUnreliablePacket(TestPayloadPacket(1));
+        const PacketId trackedPacketId = serverConnection->SendUnreliablePacket(TestPayloadPacket(2));
+
+        EXPECT_TRUE(UpdateUntil([&]() { return testClient.m_connectionListener.m_receivedValues.size() == 2; }));
+        clientConnection->SendUnreliablePacket(TestPayloadPacket(3));
+        EXPECT_TRUE(UpdateUntil([&]() { return serverConnection->WasPacketAcked(trackedPacketId); }));
+        net_UdpShardMaxPendingAcks = maxPendingAcks;
+
+        // The evicted packet was delivered, but is neither reported as acked nor as lost
+        EXPECT_FALSE(serverConnection->WasPacketAcked(evictedPacketId));
+        EXPECT_FALSE(testServer.m_connectionListener.WasPacketLost(evictedPacketId));
+    }
+
+    TEST_F(UdpTransportTests, TestShardedRejectedConnect)
+    {
+        TestShardedUdpServer testServer(2);
+        testServer.m_connectionListener.m_connectResult = ConnectResult::Rejected;
+        TestUdpClient testClient;
+
+        // The worker has already accepted the connection, so the rejection has to tear it down on both ends
+        EXPECT_TRUE(UpdateUntil([&]() { return testClient.m_connectionListener.m_disconnectCount == 1; }));
+        EXPECT_EQ(testClient.m_connectionListener.m_disconnectReason, DisconnectReason::ConnectionRejected);
+        EXPECT_EQ(testClient.m_connectionListener.m_disconnectEndpoint, TerminationEndpoint::Remote);
+
+        // A rejected connection never gets a proxy, so the server listener isn't told about it at all
+        EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), 0);
+        EXPECT_EQ(testServer.m_connectionListener.m_connectCount, 0);
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectCount, 0);
+    }
+
+    TEST_F(UdpTransportTests, TestShardedLocalDisconnect)
+    {
+        TestShardedUdpServer testServer(2);
+        TestUdpClient testClient;
+
+        ASSERT_TRUE(UpdateUntil([&]() { return IsConnected(*testServer.m_serverNetworkInterface) && IsConnected(*testClient.m_clientNetworkInterface); }));
+        const ConnectionId connectionId = GetFirstConnection(*testServer.m_serverNetworkInterface)->GetConnectionId();
+        EXPECT_TRUE(testServer.m_serverNetworkInterface->Disconnect(connectionId, DisconnectReason::TerminatedByServer));
+
+        EXPECT_TRUE(UpdateUntil([&]()
+        {
+            return (testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == 0)
+                && (testClient.m_connectionListener.m_disconnectCount == 1);
+        }));
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectCount, 1);
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectReason, DisconnectReason::TerminatedByServer);
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectEndpoint, TerminationEndpoint::Local);
+        EXPECT_EQ(testClient.m_connectionListener.m_disconnectReason, DisconnectReason::TerminatedByServer);
+        EXPECT_EQ(testClient.m_connectionListener.m_disconnectEndpoint, TerminationEndpoint::Remote);
+    }
+
+    TEST_F(UdpTransportTests, TestShardedRemoteDisconnect)
+    {
+        TestShardedUdpServer testServer(2);
+        TestUdpClient testClient;
+
+        ASSERT_TRUE(UpdateUntil([&]() { return IsConnected(*testServer.m_serverNetworkInterface) && IsConnected(*testClient.m_clientNetworkInterface); }));
+        const ConnectionId connectionId = GetFirstConnection(*testClient.m_clientNetworkInterface)->GetConnectionId();
+        EXPECT_TRUE(testClient.m_clientNetworkInterface->Disconnect(connectionId, DisconnectReason::TerminatedByClient));
+
+        EXPECT_TRUE(UpdateUntil([&]()
+        {
+            return (testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == 0)
+                && (testServer.m_connectionListener.m_disconnectCount == 1);
+        }));
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectReason, DisconnectReason::TerminatedByClient);
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectEndpoint, TerminationEndpoint::Remote);
+        EXPECT_EQ(testClient.m_connectionListener.m_disconnectCount, 1);
+        EXPECT_EQ(testClient.m_connectionListener.m_disconnectEndpoint, TerminationEndpoint::Local);
+    }
+
+    TEST_F(UdpTransportTests, TestShardedStopListening)
+    {
+        TestShardedUdpServer testServer(2);
+        TestUdpClient testClient;
+
+        ASSERT_TRUE(UpdateUntil([&]() { return IsConnected(*testServer.m_serverNetworkInterface) && IsConnected(*testClient.m_clientNetworkInterface); }));
+        const ConnectionId connectionId = GetFirstConnection(*testServer.m_serverNetworkInterface)->GetConnectionId();
+
+        // A packet that is still queued for the worker goes out ahead of the disconnect
+        EXPECT_TRUE(testServer.m_serverNetworkInterface->SendReliablePacket(connectionId, TestPayloadPacket(1)));
+        EXPECT_TRUE(testServer.m_serverNetworkInterface->StopListening());
+
+        // No worker is left to service the connection, so it's disconnected and deleted before StopListening returns
+        EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), 0);
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectCount, 1);
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectReason, DisconnectReason::TerminatedByServer);
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectEndpoint, TerminationEndpoint::Local);
+        EXPECT_FALSE(testServer.m_serverNetworkInterface->SendReliablePacket(connectionId, TestPayloadPacket(2)));
+
+        // The client is told about the disconnect rather than having to wait for a timeout
+        EXPECT_TRUE(UpdateUntil([&]() { return testClient.m_connectionListener.m_disconnectCount == 1; }));
+        EXPECT_EQ(testClient.m_connectionListener.m_disconnectReason, DisconnectReason::TerminatedByServer);
+        EXPECT_EQ(testClient.m_connectionListener.m_disconnectEndpoint, TerminationEndpoint::Remote);
+        EXPECT_TRUE(testClient.m_connectionListener.WasValueReceived(1));
+        EXPECT_EQ(testServer.m_connectionListener.m_disconnectCount, 1);
+    }
 }
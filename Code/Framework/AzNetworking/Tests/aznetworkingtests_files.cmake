@@ -14,13 +14,16 @@ set(FILES
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
+    DataStructures/SpscRingBufferTests.cpp
     DataStructures/TimeoutQueueTests.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
     Serialization/NetworkInputSerializerTests.cpp
     Serialization/NetworkOutputSerializerTests.cpp
+    Serialization/SnapshotDeltaTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpSocketTests.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
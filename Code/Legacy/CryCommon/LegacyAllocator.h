@@ -71,6 +71,7 @@ namespace AZ
             pointer_type ptr = m_schema->Allocate(byteSize, alignment, flags, name, fileName, lineNum, suppressStackRecord);
             AZ_PROFILE_MEMORY_ALLOC_EX(AZ::Debug::ProfileCategory::MemoryReserved, fileName, lineNum, ptr, byteSize, name ? name : GetName());
             AZ_MEMORY_PROFILE(ProfileAllocation(ptr, byteSize, alignment, name, fileName, lineNum, suppressStackRecord));
+            SampleAllocation(ptr, byteSize, suppressStackRecord);
             AZ_Assert(ptr || byteSize == 0, "OOM - Failed to allocate %zu bytes from LegacyAllocator", byteSize);
             return ptr;
         }
@@ -80,6 +81,7 @@ namespace AZ
         {
             AZ_PROFILE_MEMORY_FREE_EX(AZ::Debug::ProfileCategory::MemoryReserved, file, line, ptr);
             AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
+            SampleDeallocation(ptr);
             m_schema->DeAllocate(ptr, byteSize, alignment);
         }
 
@@ -98,6 +100,7 @@ namespace AZ
             pointer_type newPtr = m_schema->ReAllocate(ptr, newSize, newAlignment);
             AZ_PROFILE_MEMORY_ALLOC_EX(AZ::Debug::ProfileCategory::MemoryReserved, file, line, newPtr, newSize, "LegacyAllocator Realloc");
             AZ_MEMORY_PROFILE(ProfileReallocationEnd(ptr, newPtr, newSize, newAlignment));
+            SampleReallocation(ptr, newPtr, newSize);
             AZ_Assert(newPtr || newSize == 0, "OOM - Failed to reallocate %zu bytes from LegacyAllocator", newSize);
             return newPtr;
         }
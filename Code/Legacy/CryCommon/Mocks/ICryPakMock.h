@@ -90,6 +90,7 @@ struct CryPakMock
     MOCK_METHOD1(SetRenderThreadId, void(AZStd::thread_id renderThreadId));
     MOCK_CONST_METHOD0(GetPakPriority, AZ::IO::ArchiveLocationPriority());
     MOCK_CONST_METHOD1(GetFileOffsetOnMedia, uint64_t(AZStd::string_view szName));
+    MOCK_METHOD1(MapFileView, AZ::IO::MappedView(AZStd::string_view szName));
     MOCK_CONST_METHOD1(GetFileMediaType, EStreamSourceMediaType(AZStd::string_view szName));
     MOCK_METHOD0(GetLevelPackOpenEvent, auto()->LevelPackOpenEvent*);
     MOCK_METHOD0(GetLevelPackCloseEvent, auto()->LevelPackCloseEvent*);
@@ -13,6 +13,8 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
@@ -153,6 +155,11 @@ namespace Multiplayer
         AZStd::vector<MultiplayerComponent*> m_multiplayerSerializationComponentVector;
         AZStd::vector<MultiplayerComponent*> m_multiplayerInputComponentVector;
 
+        //! Complete replicated state serialized for Client proxies, shared by every connection replicating snapshot deltas
+        //! Built by the first PropertyPublisher that needs it, possibly from a job thread, and cleared whenever the entity changes
+        AZStd::shared_ptr<const AZStd::vector<uint8_t>> m_clientSnapshot;
+        AZStd::mutex m_clientSnapshotMutex;
+
         RpcSendEvent m_sendAuthorityToClientRpcEvent;
         RpcSendEvent m_sendAuthorityToAutonomousRpcEvent;
         RpcSendEvent m_sendServertoAuthorityRpcEvent;
@@ -184,6 +191,7 @@ namespace Multiplayer
 
         friend class NetworkEntityManager;
         friend class EntityReplicationManager;
+        friend class PropertyPublisher;
     };
 
     bool NetworkRoleHasController(NetEntityRole networkRole);
@@ -43,6 +43,11 @@ namespace Multiplayer
         //! @param hostTimeMs current server game time in milliseconds
         virtual void Update(AZ::TimeMs hostTimeMs) = 0;
 
+        //! Performs the part of Update that has to run on the main thread, such as activating entities received from the remote endpoint.
+        //! Callers that update many connections at once can then send the updates through EntityReplicationManager::SendUpdates.
+        //! @return true if updates should be sent to the remote endpoint this frame
+        virtual bool PrepareUpdate() = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
@@ -79,6 +79,14 @@ namespace Multiplayer
         //! @return the current value of HasValidPrefabId
         bool GetHasValidPrefabId() const;
 
+        //! Sets whether Data holds a delta against a previously received entity snapshot rather than a property delta.
+        //! @param value true if Data holds a snapshot delta
+        void SetIsSnapshotDelta(bool value);
+
+        //! Gets whether Data holds a delta against a previously received entity snapshot rather than a property delta.
+        //! @return true if Data holds a snapshot delta
+        bool GetIsSnapshotDelta() const;
+
         //! Sets the current value for PrefabEntityId.
         //! @param value the value to set PrefabEntityId to
         void SetPrefabEntityId(const PrefabEntityId& value);
@@ -112,6 +120,7 @@ namespace Multiplayer
         bool           m_wasMigrated = false;
         bool           m_takeOwnership = false;
         bool           m_hasValidPrefabId = false;
+        bool           m_isSnapshotDelta = false;
         PrefabEntityId m_prefabEntityId;
 
         // Only allocated if we actually have data
@@ -615,6 +615,9 @@ namespace Multiplayer
             component->NetworkAttach(this, m_currentRecord, m_predictableRecord);
         }
         m_totalRecord = m_currentRecord;
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_clientSnapshotMutex);
+        m_clientSnapshot.reset();
     }
 
     void NetBindComponent::HandleMarkedDirty()
@@ -630,6 +633,9 @@ namespace Multiplayer
         }
         m_totalRecord.Append(m_currentRecord);
         m_currentRecord.Clear();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_clientSnapshotMutex);
+        m_clientSnapshot.reset();
     }
 
     void NetBindComponent::HandleLocalServerRpcMessage(NetworkEntityRpcMessage& message)
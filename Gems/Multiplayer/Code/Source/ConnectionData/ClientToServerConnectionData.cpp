@@ -49,8 +49,16 @@ namespace Multiplayer
     }
 
     void ClientToServerConnectionData::Update(AZ::TimeMs hostTimeMs)
+    {
+        if (PrepareUpdate())
+        {
+            m_entityReplicationManager.SendUpdates(hostTimeMs);
+        }
+    }
+
+    bool ClientToServerConnectionData::PrepareUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
-        m_entityReplicationManager.SendUpdates(hostTimeMs);
+        return true;
     }
 }
@@ -22,6 +22,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
@@ -81,6 +82,8 @@ namespace Multiplayer
     AZ_CVAR(bool, sv_isTransient, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether a dedicated server shuts down if all existing connections disconnect.");
     AZ_CVAR(AZ::TimeMs, cl_defaultNetworkEntityActivationTimeSliceMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Max Ms to use to activate entities coming from the network, 0 means instantiate everything");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
+    AZ_CVAR(bool, sv_multithreadedConnectionUpdates, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, the network updates for each connection are built in parallel on the job system, packets are still sent from the main thread");
+    AZ_CVAR(bool, sv_InterestGridEnabled, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, client replication windows are driven by the shared interest grid rather than querying the visibility system per client");
     AZ_CVAR(AZ::CVarFixedString, sv_defaultPlayerSpawnAsset, "prefabs/player.network.spawnable", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The default spawnable to use when a new player connects");
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -189,6 +192,7 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::Deactivate()
     {
+        m_interestGrid.Deactivate();
         AZ::Interface<AzFramework::ISessionHandlingClientRequests>::Unregister(this);
         AZ::Interface<IMultiplayer>::Unregister(this);
         m_consoleCommandHandler.Disconnect();
@@ -342,12 +346,16 @@ namespace Multiplayer
 
         // Send out the game state update to all connections
         {
-            auto sendNetworkUpdates = [hostTimeMs, &stats](IConnection& connection)
+            m_connectionsToUpdate.clear();
+            auto prepareNetworkUpdates = [this, &stats](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update(hostTimeMs);
+                    if (connectionData->PrepareUpdate())
+                    {
+                        m_connectionsToUpdate.push_back(&connectionData->GetReplicationManager());
+                    }
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
                         stats.m_clientConnectionCount++;
@@ -359,7 +367,11 @@ namespace Multiplayer
                 }
             };
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            m_networkInterface->GetConnectionSet().VisitConnections(prepareNetworkUpdates);
+
+            // Entities aren't modified until all updates have been built, so the connections can serialize them concurrently
+            AZ::JobContext* jobContext = sv_multithreadedConnectionUpdates ? AZ::JobContext::GetGlobalContext() : nullptr;
+            EntityReplicationManager::SendUpdates(m_connectionsToUpdate, hostTimeMs, jobContext);
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -389,6 +401,9 @@ namespace Multiplayer
         {
             m_networkInterface->GetConnectionSet().VisitConnections(visitor);
         }
+
+        // Entity updates are sent after the network interface has updated, so push out anything it batched this frame
+        m_networkInterface->Flush();
     }
 
     int MultiplayerSystemComponent::GetTickOrder()
@@ -644,7 +659,8 @@ namespace Multiplayer
                 connection->SetUserData(new ServerToClientConnectionData(connection, *this, controlledEntity));
             }
 
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            InterestGrid* interestGrid = sv_InterestGridEnabled ? &m_interestGrid : nullptr;
+            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, interestGrid);
             reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData())->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
         }
         else
@@ -746,8 +762,13 @@ namespace Multiplayer
                 //const AZ::Aabb worldBounds = AZ::Interface<IPhysics>.Get()->GetWorldBounds();
                 AZStd::unique_ptr<IEntityDomain> newDomain = AZStd::make_unique<FullOwnershipEntityDomain>();
                 m_networkEntityManager.Initialize(InvalidHostId, AZStd::move(newDomain));
+                m_interestGrid.Activate();
             }
         }
+        else if (multiplayerType == MultiplayerAgentType::Uninitialized)
+        {
+            m_interestGrid.Deactivate();
+        }
         m_agentType = multiplayerType;
 
         // Spawn the default player for this host since the host is also a player (not a dedicated server)
@@ -845,6 +866,28 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+
+        if (m_networkInterface != nullptr)
+        {
+            auto dumpConnectionStats = [](IConnection& connection)
+            {
+                if (connection.GetUserData() != nullptr)
+                {
+                    IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
+                    const EntityReplicationManager::EntityUpdateStats& updateStats = connectionData->GetReplicationManager().GetEntityUpdateStats();
+                    AZLOG_INFO
+                    (
+                        "Connection %u entity updates: %.1f bytes/tick recent, %.1f bytes/tick overall, %llu messages (%llu snapshot deltas)",
+                        aznumeric_cast<uint32_t>(connection.GetConnectionId()),
+                        updateStats.GetAverageBytesPerTick(),
+                        (updateStats.m_totalTicks > 0) ? aznumeric_cast<double>(updateStats.m_totalBytes) / aznumeric_cast<double>(updateStats.m_totalTicks) : 0.0,
+                        aznumeric_cast<AZ::u64>(updateStats.m_totalMessages),
+                        aznumeric_cast<AZ::u64>(updateStats.m_snapshotDeltaMessages)
+                    );
+                }
+            };
+            m_networkInterface->GetConnectionSet().VisitConnections(dumpConnectionStats);
+        }
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
@@ -12,6 +12,8 @@
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <NetworkEntity/EntityReplication/EntityReplicationManager.h>
+#include <ReplicationWindows/InterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -139,6 +141,8 @@ namespace Multiplayer
         AZ::ThreadSafeDeque<AZStd::string> m_cvarCommands;
 
         NetworkEntityManager m_networkEntityManager;
+        EntityReplicationManager::EntityReplicationManagerList m_connectionsToUpdate;
+        InterestGrid m_interestGrid;
         NetworkTime m_networkTime;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
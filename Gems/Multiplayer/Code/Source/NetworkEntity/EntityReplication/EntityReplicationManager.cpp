@@ -23,10 +23,13 @@
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/SnapshotDelta.h>
 #include <AzNetworking/Serialization/TrackChangedSerializer.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Transform.h>
 
 namespace Multiplayer
@@ -94,9 +97,20 @@ namespace Multiplayer
     }
 
     void EntityReplicationManager::SendUpdates(AZ::TimeMs hostTimeMs)
+    {
+        BuildUpdates(hostTimeMs);
+        FlushUpdates();
+    }
+
+    void EntityReplicationManager::BuildUpdates(AZ::TimeMs hostTimeMs)
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
-        SendEntityUpdates(hostTimeMs);
+        BuildEntityUpdates(hostTimeMs);
+    }
+
+    void EntityReplicationManager::FlushUpdates()
+    {
+        SendEntityUpdates();
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
@@ -116,17 +130,57 @@ namespace Multiplayer
         );
     }
 
-    void EntityReplicationManager::SendEntityUpdatesPacketHelper
+    void EntityReplicationManager::SendUpdates(const EntityReplicationManagerList& managers, AZ::TimeMs hostTimeMs, AZ::JobContext* jobContext)
+    {
+        if (jobContext != nullptr && managers.size() > 1)
+        {
+            // Each manager only touches its own replicators and connection while building, and only reads the entities
+            AZ::JobCompletion jobCompletion(jobContext);
+            for (EntityReplicationManager* manager : managers)
+            {
+                const auto buildUpdatesLambda = [manager, hostTimeMs]()
+                {
+                    manager->BuildUpdates(hostTimeMs);
+                };
+                AZ::Job* buildUpdatesJob = AZ::CreateJobFunction(buildUpdatesLambda, true, jobContext); // Auto-deletes
+                buildUpdatesJob->SetDependent(&jobCompletion);
+                buildUpdatesJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (EntityReplicationManager* manager : managers)
+            {
+                manager->BuildUpdates(hostTimeMs);
+            }
+        }
+
+        for (EntityReplicationManager* manager : managers)
+        {
+            manager->FlushUpdates();
+        }
+    }
+
+    void EntityReplicationManager::BuildEntityUpdatesPacketHelper
     (
         AZ::TimeMs hostTimeMs,
         EntityReplicatorList& toSendList,
-        uint32_t maxPayloadSize,
-        AzNetworking::IConnection& connection
+        uint32_t maxPayloadSize
     )
     {
+        // Packets are reused between frames, so only construct a new one once we've exhausted the ones we already have
+        if (m_pendingEntityUpdateCount >= m_pendingEntityUpdates.size())
+        {
+            m_pendingEntityUpdates.emplace_back();
+        }
+        PendingEntityUpdates& pendingUpdates = m_pendingEntityUpdates[m_pendingEntityUpdateCount++];
+
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
-        MultiplayerPackets::EntityUpdates entityUpdatePacket;
+        EntityReplicatorList& replicatorUpdatedList = pendingUpdates.m_replicators;
+        replicatorUpdatedList.clear();
+        MultiplayerPackets::EntityUpdates& entityUpdatePacket = pendingUpdates.m_packet;
+        entityUpdatePacket.ModifyEntityMessages().clear();
         entityUpdatePacket.SetHostTimeMs(hostTimeMs);
         entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
         // Serialize everything
@@ -165,14 +219,6 @@ namespace Multiplayer
                 break;
             }
         }
-
-        const AzNetworking::PacketId sentId = connection.SendUnreliablePacket(entityUpdatePacket);
-
-        // Update the sent things with the packet id
-        for (EntityReplicator* replicator : replicatorUpdatedList)
-        {
-            replicator->GetPropertyPublisher()->FinalizeSerialization(sentId);
-        }
     }
 
     EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList()
@@ -246,7 +292,7 @@ namespace Multiplayer
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdates(AZ::TimeMs hostTimeMs)
+    void EntityReplicationManager::BuildEntityUpdates(AZ::TimeMs hostTimeMs)
     {
         EntityReplicatorList toSendList = GenerateEntityUpdateList();
     
@@ -261,10 +307,39 @@ namespace Multiplayer
         // While our to send list is not empty, build up another packet to send
         do
         {
-            SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize, m_connection);
+            BuildEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize);
         } while (!toSendList.empty());
     }
 
+    void EntityReplicationManager::SendEntityUpdates()
+    {
+        uint64_t tickBytes = 0;
+        for (uint32_t i = 0; i < m_pendingEntityUpdateCount; ++i)
+        {
+            PendingEntityUpdates& pendingUpdates = m_pendingEntityUpdates[i];
+            for (const NetworkEntityUpdateMessage& updateMessage : pendingUpdates.m_packet.GetEntityMessages())
+            {
+                tickBytes += updateMessage.GetEstimatedSerializeSize();
+                m_entityUpdateStats.m_snapshotDeltaMessages += updateMessage.GetIsSnapshotDelta() ? 1 : 0;
+                ++m_entityUpdateStats.m_totalMessages;
+            }
+            const AzNetworking::PacketId sentId = m_connection.SendUnreliablePacket(pendingUpdates.m_packet);
+
+            // Update the sent things with the packet id
+            for (EntityReplicator* replicator : pendingUpdates.m_replicators)
+            {
+                replicator->GetPropertyPublisher()->FinalizeSerialization(sentId);
+            }
+            pendingUpdates.m_replicators.clear();
+        }
+        m_pendingEntityUpdateCount = 0;
+
+        ++m_entityUpdateStats.m_totalTicks;
+        m_entityUpdateStats.m_totalBytes += tickBytes;
+        m_entityUpdateStats.m_byteHistory[m_entityUpdateStats.m_historyIndex] = tickBytes;
+        m_entityUpdateStats.m_historyIndex = (m_entityUpdateStats.m_historyIndex + 1) % MultiplayerStats::RingbufferSamples;
+    }
+
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable)
     {
         while (!deferredRpcs.empty())
@@ -331,6 +406,7 @@ namespace Multiplayer
         }
 
         m_entityReplicatorMap.clear();
+        m_receivedSnapshots.clear();
     }
 
     bool EntityReplicationManager::SetEntityRebasing(NetworkEntityHandle& entityHandle)
@@ -766,10 +842,32 @@ namespace Multiplayer
 
         if (updateMessage.GetIsDelete())
         {
+            m_receivedSnapshots.erase(updateMessage.GetEntityId());
             return HandleEntityDeleteMessage(entityReplicator, packetHeader, updateMessage);
         }
 
-        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(updateMessage.GetData()->GetBuffer(), updateMessage.GetData()->GetSize());
+        // Snapshot deltas are only decoded for updates we handle, so we only keep baselines we've applied
+        // Dropped updates are older than one we've handled, so the remote endpoint will rarely pick them as a baseline
+        AzNetworking::PacketEncodingBuffer snapshot;
+        const AzNetworking::PacketEncodingBuffer* updateData = updateMessage.GetData();
+        if (updateMessage.GetIsSnapshotDelta())
+        {
+            switch (DecodeEntitySnapshot(packetHeader.GetPacketId(), updateMessage, snapshot))
+            {
+            case UpdateValidationResult::HandleMessage:
+                break;
+            case UpdateValidationResult::DropMessage:
+                // The remote endpoint will resynchronize us with a complete snapshot
+                return true;
+            case UpdateValidationResult::DropMessageAndDisconnect:
+                return false;
+            default:
+                AZ_Assert(false, "Unhandled case");
+            }
+            updateData = &snapshot;
+        }
+
+        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(updateData->GetBuffer(), updateData->GetSize());
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -800,6 +898,73 @@ namespace Multiplayer
         return handled;
     }
 
+    EntityReplicationManager::UpdateValidationResult EntityReplicationManager::DecodeEntitySnapshot
+    (
+        AzNetworking::PacketId packetId,
+        const NetworkEntityUpdateMessage& updateMessage,
+        AzNetworking::PacketEncodingBuffer& outSnapshot
+    )
+    {
+        const AzNetworking::PacketEncodingBuffer* updateData = updateMessage.GetData();
+        AzNetworking::NetworkOutputSerializer serializer(updateData->GetBuffer(), updateData->GetSize());
+
+        EntitySnapshotId snapshotId = InvalidEntitySnapshotId;
+        EntitySnapshotId baselineId = InvalidEntitySnapshotId;
+        serializer.Serialize(snapshotId, "SnapshotId");
+        serializer.Serialize(baselineId, "BaselineSnapshotId");
+        if (!serializer.IsValid() || (snapshotId == InvalidEntitySnapshotId) || (baselineId >= snapshotId))
+        {
+            AZLOG_ERROR("Malformed snapshot update for entity %u, invalid snapshot ids", aznumeric_cast<uint32_t>(updateMessage.GetEntityId()));
+            return UpdateValidationResult::DropMessageAndDisconnect;
+        }
+
+        auto receivedSnapshotsIter = m_receivedSnapshots.find(updateMessage.GetEntityId());
+        const EntitySnapshot* baseline = nullptr;
+        if (baselineId != InvalidEntitySnapshotId)
+        {
+            baseline = (receivedSnapshotsIter != m_receivedSnapshots.end()) ? receivedSnapshotsIter->second.Find(baselineId) : nullptr;
+            if (baseline == nullptr)
+            {
+                AZLOG
+                (
+                    NET_RepUpdate,
+                    "Dropping snapshot update for entity %u, baseline snapshot %u is no longer available",
+                    aznumeric_cast<uint32_t>(updateMessage.GetEntityId()),
+                    aznumeric_cast<uint32_t>(baselineId)
+                );
+                return UpdateValidationResult::DropMessage;
+            }
+        }
+
+        uint32_t snapshotSize = 0;
+        const AzNetworking::SnapshotDelta snapshotDelta
+        (
+            (baseline != nullptr) ? baseline->m_data->data() : nullptr,
+            (baseline != nullptr) ? aznumeric_cast<uint32_t>(baseline->m_data->size()) : 0
+        );
+        if (!snapshotDelta.Serialize(serializer, outSnapshot.GetBuffer(), MaxEntitySnapshotSize, snapshotSize))
+        {
+            AZLOG_ERROR("Malformed snapshot update for entity %u, failed to decode the delta", aznumeric_cast<uint32_t>(updateMessage.GetEntityId()));
+            return UpdateValidationResult::DropMessageAndDisconnect;
+        }
+        outSnapshot.Resize(snapshotSize);
+
+        // Keep the snapshot around, the remote endpoint uses the most recent one we've acknowledged as the next baseline
+        // Baselines only move forward, so anything older than the baseline the remote endpoint just used is no longer needed
+        // Handled updates arrive in order, so an id that doesn't move forward means the remote endpoint started a new sequence
+        EntitySnapshotHistory& receivedSnapshots = m_receivedSnapshots[updateMessage.GetEntityId()];
+        if (receivedSnapshots.GetMostRecentId() >= snapshotId)
+        {
+            receivedSnapshots.Clear();
+        }
+        else if (baseline != nullptr)
+        {
+            receivedSnapshots.RemoveOlderThan(baselineId);
+        }
+        receivedSnapshots.Add(snapshotId, packetId, outSnapshot.GetBuffer(), snapshotSize);
+        return UpdateValidationResult::HandleMessage;
+    }
+
     bool EntityReplicationManager::HandleEntityRpcMessage(AzNetworking::IConnection* invokingConnection, NetworkEntityRpcMessage& message)
     {
         EntityReplicator* entityReplicator = GetEntityReplicator(message.GetEntityId());
@@ -837,6 +1002,27 @@ namespace Multiplayer
         return aznumeric_cast<AZ::TimeMs>(aznumeric_cast<uint32_t>(m_connection.GetMetrics().m_connectionRtt.GetRoundTripTimeSeconds()) * 1000 * 2);
     }
 
+    const EntityReplicationManager::EntityUpdateStats& EntityReplicationManager::GetEntityUpdateStats() const
+    {
+        return m_entityUpdateStats;
+    }
+
+    float EntityReplicationManager::EntityUpdateStats::GetAverageBytesPerTick() const
+    {
+        const uint64_t sampleCount = AZStd::min<uint64_t>(m_totalTicks, MultiplayerStats::RingbufferSamples);
+        if (sampleCount == 0)
+        {
+            return 0.0f;
+        }
+
+        uint64_t totalBytes = 0;
+        for (uint64_t sample = 0; sample < sampleCount; ++sample)
+        {
+            totalBytes += m_byteHistory[sample];
+        }
+        return aznumeric_cast<float>(totalBytes) / aznumeric_cast<float>(sampleCount);
+    }
+
     void EntityReplicationManager::SetMaxRemoteEntitiesPendingCreationCount(uint32_t maxPendingEntities)
     {
         m_maxRemoteEntitiesPendingCreationCount = maxPendingEntities;
@@ -9,13 +9,16 @@
 #pragma once
 
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshotHistory.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzCore/std/containers/map.h>
@@ -25,6 +28,11 @@
 #include <AzCore/EBus/Event.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 
+namespace AZ
+{
+    class JobContext;
+}
+
 namespace AzNetworking
 {
     class IConnection;
@@ -42,6 +50,7 @@ namespace Multiplayer
     {
     public:
         using EntityReplicatorMap = AZStd::map<NetEntityId, AZStd::unique_ptr<EntityReplicator>>;
+        using EntityReplicationManagerList = AZStd::vector<EntityReplicationManager*>;
 
         enum class Mode
         {
@@ -51,6 +60,22 @@ namespace Multiplayer
             LocalClientToRemoteServer,
         };
 
+        //! Entity update bandwidth sent over this connection.
+        struct EntityUpdateStats
+        {
+            uint64_t m_totalTicks = 0;
+            uint64_t m_totalBytes = 0;
+            uint64_t m_totalMessages = 0;
+            uint64_t m_snapshotDeltaMessages = 0;
+
+            //! Bytes sent per tick over the last MultiplayerStats::RingbufferSamples ticks
+            MultiplayerStats::MetricRingbuffer m_byteHistory = {};
+            uint32_t m_historyIndex = 0;
+
+            //! Returns the average number of entity update bytes sent per tick over the recorded history.
+            float GetAverageBytesPerTick() const;
+        };
+
         EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode mode);
         ~EntityReplicationManager() = default;
 
@@ -59,6 +84,26 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates(AZ::TimeMs hostTimeMs);
+
+        //! Serializes the entity updates for this connection into packets without sending them.
+        //! Managers for different connections can build their updates concurrently, provided that no entities are modified,
+        //! added or removed and no replication windows are applied until every manager has finished.
+        //! @param hostTimeMs current server game time in milliseconds
+        void BuildUpdates(AZ::TimeMs hostTimeMs);
+
+        //! Sends the packets produced by BuildUpdates followed by any deferred rpcs, must be called from the main thread.
+        void FlushUpdates();
+
+        //! Sends updates for several connections, building the packets for each connection on the job system when a job context is provided.
+        //! Packets are always sent from the calling thread, in the order of the managers in the list.
+        //! @param managers    the replication managers to send updates for
+        //! @param hostTimeMs  current server game time in milliseconds
+        //! @param jobContext  the job context to build updates on, or nullptr to build them serially on the calling thread
+        static void SendUpdates(const EntityReplicationManagerList& managers, AZ::TimeMs hostTimeMs, AZ::JobContext* jobContext);
+
+        //! Applies the current replication set of the replication window, adding and removing entity replicators as needed.
+        void UpdateWindow();
+
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -88,6 +133,8 @@ namespace Multiplayer
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
+        const EntityUpdateStats& GetEntityUpdateStats() const;
+
         void SetMaxRemoteEntitiesPendingCreationCount(uint32_t maxPendingEntities);
         void SetEntityActivationTimeSliceMs(AZ::TimeMs timeSliceMs);
         void SetEntityPendingRemovalMs(AZ::TimeMs entityPendingRemovalMs);
@@ -117,9 +164,10 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
+        void BuildEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize);
 
-        void SendEntityUpdates(AZ::TimeMs hostTimeMs);
+        void BuildEntityUpdates(AZ::TimeMs hostTimeMs);
+        void SendEntityUpdates();
         void SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable);
 
         void MigrateEntityInternal(NetEntityId entityId);
@@ -132,7 +180,12 @@ namespace Multiplayer
         EntityReplicator* GetEntityReplicator(NetEntityId entityId);
         EntityReplicator* GetEntityReplicator(const ConstNetworkEntityHandle& entityHandle);
 
-        void UpdateWindow();
+        //! Reconstructs the complete entity snapshot carried by a snapshot delta update, and keeps it as a baseline for later updates.
+        //! @param packetId      the id of the packet the update was received in
+        //! @param updateMessage the snapshot delta update message
+        //! @param outSnapshot   buffer to reconstruct the snapshot into
+        //! @return HandleMessage if the snapshot was reconstructed, DropMessage if the baseline is unknown, and DropMessageAndDisconnect if the update is malformed
+        UpdateValidationResult DecodeEntitySnapshot(AzNetworking::PacketId packetId, const NetworkEntityUpdateMessage& updateMessage, AzNetworking::PacketEncodingBuffer& outSnapshot);
 
         bool HandlePropertyChangeMessage
         (
@@ -184,6 +237,19 @@ namespace Multiplayer
         AZStd::set<NetEntityId> m_replicatorsPendingRemoval;
         AZStd::unordered_set<NetEntityId> m_replicatorsPendingSend;
 
+        //! An entity update packet built by BuildUpdates and the replicators serialized into it, which are finalized once it's sent
+        struct PendingEntityUpdates
+        {
+            MultiplayerPackets::EntityUpdates m_packet;
+            EntityReplicatorList m_replicators;
+        };
+        AZStd::vector<PendingEntityUpdates> m_pendingEntityUpdates;
+        uint32_t m_pendingEntityUpdateCount = 0;
+        EntityUpdateStats m_entityUpdateStats;
+
+        //! Entity snapshots received from the remote endpoint, used as baselines for snapshot delta updates
+        AZStd::unordered_map<NetEntityId, EntitySnapshotHistory> m_receivedSnapshots;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -429,6 +429,7 @@ namespace Multiplayer
         {
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
+        updateMessage.SetIsSnapshotDelta(m_propertyPublisher->IsUsingSnapshots());
 
         AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), updateMessage.ModifyData().GetCapacity());
         m_propertyPublisher->UpdateSerialization(inputSerializer);
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshotHistory.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace Multiplayer
+{
+    EntitySnapshotHistory::EntitySnapshotHistory()
+    {
+        m_snapshots.reserve(MaxEntitySnapshots);
+    }
+
+    EntitySnapshot* EntitySnapshotHistory::Add(EntitySnapshotId snapshotId, AzNetworking::PacketId packetId, const uint8_t* data, uint32_t size)
+    {
+        return Add(snapshotId, packetId, AZStd::make_shared<AZStd::vector<uint8_t>>(data, data + size));
+    }
+
+    EntitySnapshot* EntitySnapshotHistory::Add(EntitySnapshotId snapshotId, AzNetworking::PacketId packetId, EntitySnapshotData data)
+    {
+        EntitySnapshot* snapshot = nullptr;
+        if (m_snapshots.size() < MaxEntitySnapshots)
+        {
+            snapshot = &m_snapshots.emplace_back();
+        }
+        else
+        {
+            // Replace the oldest snapshot, pending snapshots are never evicted since they're about to be sent
+            for (EntitySnapshot& existing : m_snapshots)
+            {
+                if ((existing.m_packetId != AzNetworking::InvalidPacketId)
+                 && ((snapshot == nullptr) || (existing.m_snapshotId < snapshot->m_snapshotId)))
+                {
+                    snapshot = &existing;
+                }
+            }
+
+            if ((snapshot == nullptr) || (snapshotId < snapshot->m_snapshotId))
+            {
+                return nullptr;
+            }
+        }
+
+        snapshot->m_snapshotId = snapshotId;
+        snapshot->m_packetId = packetId;
+        snapshot->m_data = AZStd::move(data);
+        return snapshot;
+    }
+
+    const EntitySnapshot* EntitySnapshotHistory::Find(EntitySnapshotId snapshotId) const
+    {
+        for (const EntitySnapshot& snapshot : m_snapshots)
+        {
+            if (snapshot.m_snapshotId == snapshotId)
+            {
+                return &snapshot;
+            }
+        }
+        return nullptr;
+    }
+
+    EntitySnapshot* EntitySnapshotHistory::Find(EntitySnapshotId snapshotId)
+    {
+        return const_cast<EntitySnapshot*>(static_cast<const EntitySnapshotHistory*>(this)->Find(snapshotId));
+    }
+
+    const EntitySnapshot* EntitySnapshotHistory::FindMostRecentAcked(const AzNetworking::IConnection& connection) const
+    {
+        const EntitySnapshot* result = nullptr;
+        for (const EntitySnapshot& snapshot : m_snapshots)
+        {
+            if ((snapshot.m_packetId != AzNetworking::InvalidPacketId)
+             && ((result == nullptr) || (snapshot.m_snapshotId > result->m_snapshotId))
+             && connection.WasPacketAcked(snapshot.m_packetId))
+            {
+                result = &snapshot;
+            }
+        }
+        return result;
+    }
+
+    EntitySnapshotId EntitySnapshotHistory::GetMostRecentId() const
+    {
+        EntitySnapshotId result = InvalidEntitySnapshotId;
+        for (const EntitySnapshot& snapshot : m_snapshots)
+        {
+            result = AZStd::max(result, snapshot.m_snapshotId);
+        }
+        return result;
+    }
+
+    void EntitySnapshotHistory::Remove(EntitySnapshotId snapshotId)
+    {
+        for (auto iter = m_snapshots.begin(); iter != m_snapshots.end(); ++iter)
+        {
+            if (iter->m_snapshotId == snapshotId)
+            {
+                m_snapshots.erase(iter);
+                return;
+            }
+        }
+    }
+
+    void EntitySnapshotHistory::RemoveOlderThan(EntitySnapshotId snapshotId)
+    {
+        for (auto iter = m_snapshots.begin(); iter != m_snapshots.end();)
+        {
+            if (iter->m_snapshotId < snapshotId)
+            {
+                iter = m_snapshots.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+
+    bool EntitySnapshotHistory::IsFull() const
+    {
+        return m_snapshots.size() >= MaxEntitySnapshots;
+    }
+
+    uint32_t EntitySnapshotHistory::GetSize() const
+    {
+        return aznumeric_cast<uint32_t>(m_snapshots.size());
+    }
+
+    void EntitySnapshotHistory::Clear()
+    {
+        m_snapshots.clear();
+    }
+}
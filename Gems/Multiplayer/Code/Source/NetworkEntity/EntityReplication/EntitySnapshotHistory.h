@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/RTTI/TypeSafeIntegral.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AzNetworking
+{
+    class IConnection;
+}
+
+namespace Multiplayer
+{
+    //! Snapshots are encoded into, and decoded from, regular entity update payloads
+    static constexpr uint32_t MaxEntitySnapshotSize = static_cast<uint32_t>(AzNetworking::PacketEncodingBuffer::GetCapacity());
+
+    //! Identifies a snapshot within the sequence sent by a single PropertyPublisher.
+    //! Snapshot ids are carried in the update itself, so baselines don't depend on the packet ids of either endpoint matching.
+    AZ_TYPE_SAFE_INTEGRAL(EntitySnapshotId, uint32_t);
+    static constexpr EntitySnapshotId InvalidEntitySnapshotId = EntitySnapshotId{ 0 };
+
+    //! The serialized complete replicated state of an entity, immutable so it can be shared between connections.
+    using EntitySnapshotData = AZStd::shared_ptr<const AZStd::vector<uint8_t>>;
+
+    //! A serialized copy of the complete replicated state of an entity, tagged with its id and the packet it was sent or received in.
+    struct EntitySnapshot
+    {
+        EntitySnapshotId m_snapshotId = InvalidEntitySnapshotId;
+        AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+        EntitySnapshotData m_data;
+    };
+
+    //! @class EntitySnapshotHistory
+    //! @brief A small fixed capacity history of entity snapshots, used as baselines for delta compressed entity updates.
+    class EntitySnapshotHistory
+    {
+    public:
+        static constexpr uint32_t MaxEntitySnapshots = 32;
+
+        EntitySnapshotHistory();
+
+        //! Adds a snapshot to the history, evicting the oldest snapshot if the history is full.
+        //! @param snapshotId the id of the snapshot
+        //! @param packetId   the packet id the snapshot was sent or received in, may be InvalidPacketId for a snapshot pending send
+        //! @param data       the serialized snapshot
+        //! @param size       the size of the serialized snapshot in bytes
+        //! @return pointer to the added snapshot, or nullptr if the history is full of snapshots newer than this one
+        EntitySnapshot* Add(EntitySnapshotId snapshotId, AzNetworking::PacketId packetId, const uint8_t* data, uint32_t size);
+
+        //! Adds a snapshot to the history without copying it, evicting the oldest snapshot if the history is full.
+        //! @param snapshotId the id of the snapshot
+        //! @param packetId   the packet id the snapshot was sent or received in, may be InvalidPacketId for a snapshot pending send
+        //! @param data       the serialized snapshot
+        //! @return pointer to the added snapshot, or nullptr if the history is full of snapshots newer than this one
+        EntitySnapshot* Add(EntitySnapshotId snapshotId, AzNetworking::PacketId packetId, EntitySnapshotData data);
+
+        //! Returns the snapshot with the provided id, or nullptr if it's not in the history.
+        const EntitySnapshot* Find(EntitySnapshotId snapshotId) const;
+        EntitySnapshot* Find(EntitySnapshotId snapshotId);
+
+        //! Returns the most recent snapshot the remote endpoint of the connection has acknowledged, or nullptr if there is none.
+        const EntitySnapshot* FindMostRecentAcked(const AzNetworking::IConnection& connection) const;
+
+        //! Returns the id of the most recent snapshot in the history, or InvalidEntitySnapshotId if the history is empty.
+        EntitySnapshotId GetMostRecentId() const;
+
+        //! Removes the snapshot with the provided id.
+        void Remove(EntitySnapshotId snapshotId);
+
+        //! Removes every snapshot older than the snapshot with the provided id.
+        void RemoveOlderThan(EntitySnapshotId snapshotId);
+
+        bool IsFull() const;
+        uint32_t GetSize() const;
+        void Clear();
+
+    private:
+        AZStd::vector<EntitySnapshot> m_snapshots;
+    };
+}
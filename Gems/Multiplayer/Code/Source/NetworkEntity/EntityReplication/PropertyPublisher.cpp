@@ -8,12 +8,19 @@
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/SnapshotDelta.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, sv_EntitySnapshotDeltas, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, client proxies are updated with deltas against the last entity snapshot each client acknowledged");
+    AZ_CVAR(uint32_t, sv_EntitySnapshotKeyframeInterval, 64, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Number of snapshot delta updates sent for an entity before a complete snapshot is sent to resynchronize the client");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, NetBindComponent* netBindComponent, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
@@ -21,6 +28,7 @@ namespace Multiplayer
         , m_connection(connection)
         , m_pendingRecord(remoteNetworkRole)
         , m_sentRecords(net_EntityReplicatorRecordsMax)
+        , m_useSnapshots(sv_EntitySnapshotDeltas && (remoteNetworkRole == NetEntityRole::Client) && (ownsLifetime == OwnsLifetime::True))
     {
         if ( ownsLifetime == OwnsLifetime::False )
         {
@@ -64,6 +72,11 @@ namespace Multiplayer
         return m_remoteReplicatorEstablished;
     }
 
+    bool PropertyPublisher::IsUsingSnapshots() const
+    {
+        return m_useSnapshots;
+    }
+
     PropertyPublisher::EntityReplicatorState PropertyPublisher::GetReplicatorState() const
     {
         return m_replicatorState;
@@ -106,6 +119,24 @@ namespace Multiplayer
         return true;
     }
 
+    bool PropertyPublisher::HasUpdateEntitySnapshot()
+    {
+        const EntitySnapshot* mostRecentAcked = m_sentSnapshots.FindMostRecentAcked(m_connection);
+        if (mostRecentAcked != nullptr)
+        {
+            // Only the most recently acked snapshot and anything sent after it can be used as a baseline
+            m_remoteReplicatorEstablished = true;
+            m_sentSnapshots.RemoveOlderThan(mostRecentAcked->m_snapshotId);
+        }
+
+        // Nothing to send if nothing changed and the remote endpoint already has our latest snapshot
+        if (!m_pendingRecord.HasChanges() && (mostRecentAcked != nullptr) && (m_sentSnapshots.GetSize() == 1) && m_remoteReplicatorEstablished)
+        {
+            return false;
+        }
+        return true;
+    }
+
     bool PropertyPublisher::PrepareAddEntityRecord()
     {
         m_sentRecords.clear();
@@ -163,10 +194,82 @@ namespace Multiplayer
     bool PropertyPublisher::PrepareDeleteEntityRecord()
     {
         m_sentRecords.clear();
+        m_sentSnapshots.Clear();
         m_pendingRecord.Clear();
         return !IsDeleted();
     }
 
+    bool PropertyPublisher::PrepareEntitySnapshot()
+    {
+        AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
+
+        EntitySnapshotData snapshot = GetClientSnapshot();
+        if (snapshot == nullptr)
+        {
+            return false;
+        }
+
+        // Send a complete snapshot if the remote endpoint has no baseline, if too many snapshots are outstanding,
+        // or periodically so a client that lost its copy of the baseline can resynchronize
+        const EntitySnapshot* baseline = m_sentSnapshots.FindMostRecentAcked(m_connection);
+        if ((baseline == nullptr) || m_sentSnapshots.IsFull() || (++m_snapshotsSinceKeyframe >= sv_EntitySnapshotKeyframeInterval))
+        {
+            if (m_sentSnapshots.IsFull())
+            {
+                m_sentSnapshots.Clear();
+            }
+            baseline = nullptr;
+            m_snapshotsSinceKeyframe = 0;
+        }
+        m_snapshotBaselineId = (baseline != nullptr) ? baseline->m_snapshotId : InvalidEntitySnapshotId;
+
+        // Snapshot ids only ever increase for the lifetime of this publisher, so the remote endpoint can order them
+        ++m_pendingSnapshotId;
+        if (m_pendingSnapshotId == InvalidEntitySnapshotId)
+        {
+            ++m_pendingSnapshotId;
+        }
+
+        // The snapshot is tagged with its packet id once sent
+        return m_sentSnapshots.Add(m_pendingSnapshotId, AzNetworking::InvalidPacketId, AZStd::move(snapshot)) != nullptr;
+    }
+
+    EntitySnapshotData PropertyPublisher::GetClientSnapshot()
+    {
+        // Snapshots are only used for Client proxies, so every connection replicating this entity sends the same state
+        // Connections may be updated on several job threads at once, but the entity itself isn't modified while they are
+        AZStd::lock_guard<AZStd::mutex> lock(m_netBindComponent->m_clientSnapshotMutex);
+
+        // Changes that haven't been logged yet aren't covered by the shared snapshot, and clear it once they are
+        const bool hasUnloggedChanges = m_netBindComponent->m_currentRecord.HasChanges();
+        if ((m_netBindComponent->m_clientSnapshot != nullptr) && !hasUnloggedChanges)
+        {
+            return m_netBindComponent->m_clientSnapshot;
+        }
+
+        // Serialize the complete replicated state of the entity, the delta against the baseline takes care of sending only what changed
+        AZStd::vector<uint8_t> buffer(MaxEntitySnapshotSize);
+        ReplicationRecord totalRecord(NetEntityRole::Client);
+        m_netBindComponent->FillTotalReplicationRecord(totalRecord);
+        AzNetworking::NetworkInputSerializer serializer(buffer.data(), MaxEntitySnapshotSize);
+        totalRecord.Serialize(serializer);
+        m_netBindComponent->SerializeStateDeltaMessage(totalRecord, serializer);
+        if (!serializer.IsValid())
+        {
+            AZLOG_ERROR("EntityReplicator: Failed to serialize entity snapshot");
+            return nullptr;
+        }
+        buffer.resize(serializer.GetSize());
+        buffer.shrink_to_fit();
+
+        EntitySnapshotData snapshot = AZStd::make_shared<AZStd::vector<uint8_t>>(AZStd::move(buffer));
+        if (!hasUnloggedChanges)
+        {
+            m_netBindComponent->m_clientSnapshot = snapshot;
+        }
+        return snapshot;
+    }
+
     bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::ISerializer &serializer)
     {
         AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
@@ -181,6 +284,24 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    bool PropertyPublisher::SerializeEntitySnapshot(AzNetworking::ISerializer& serializer)
+    {
+        EntitySnapshot* snapshot = m_sentSnapshots.Find(m_pendingSnapshotId);
+        AZ_Assert(snapshot != nullptr, "Assumed we added a pending snapshot in PrepareSerialization");
+        const EntitySnapshot* baseline = (m_snapshotBaselineId != InvalidEntitySnapshotId) ? m_sentSnapshots.Find(m_snapshotBaselineId) : nullptr;
+
+        serializer.Serialize(m_pendingSnapshotId, "SnapshotId");
+        serializer.Serialize(m_snapshotBaselineId, "BaselineSnapshotId");
+        uint32_t snapshotSize = aznumeric_cast<uint32_t>(snapshot->m_data->size());
+        const AzNetworking::SnapshotDelta snapshotDelta
+        (
+            (baseline != nullptr) ? baseline->m_data->data() : nullptr,
+            (baseline != nullptr) ? aznumeric_cast<uint32_t>(baseline->m_data->size()) : 0
+        );
+        // Encoding only reads from the snapshot, which may be shared with other connections
+        return snapshotDelta.Serialize(serializer, const_cast<uint8_t*>(snapshot->m_data->data()), snapshotSize, snapshotSize);
+    }
+
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
         // Fill in the packet id for the last sent update
@@ -197,6 +318,23 @@ namespace Multiplayer
         m_pendingRecord.Clear();
     }
 
+    void PropertyPublisher::FinalizeEntitySnapshot(AzNetworking::PacketId packetId)
+    {
+        AZ_Assert(packetId != AzNetworking::InvalidPacketId, "Got a bad packet id");
+        if (packetId == AzNetworking::InvalidPacketId)
+        {
+            // The packet failed to be generated, drop the snapshot and leave our pending changes to be sent again
+            m_sentSnapshots.Remove(m_pendingSnapshotId);
+            return;
+        }
+
+        // Fill in the packet id for the last sent snapshot, which is only used to check whether it was acked
+        EntitySnapshot* lastSentSnapshot = m_sentSnapshots.Find(m_pendingSnapshotId);
+        AZ_Assert(lastSentSnapshot != nullptr, "Assumed we added a pending snapshot in PrepareSerialization");
+        lastSentSnapshot->m_packetId = packetId;
+        m_pendingRecord.Clear();
+    }
+
     void PropertyPublisher::FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId)
     {
         // If we have more than our max records, just clear it and restart tracking again
@@ -223,7 +361,7 @@ namespace Multiplayer
             return true;
 
         case PropertyPublisher::EntityReplicatorState::Updating:
-            return HasUpdateEntityRecord();
+            return m_useSnapshots ? HasUpdateEntitySnapshot() : HasUpdateEntityRecord();
 
         case PropertyPublisher::EntityReplicatorState::Deleting:
             if (m_ownsLifetime == PropertyPublisher::OwnsLifetime::True)
@@ -253,7 +391,7 @@ namespace Multiplayer
         case PropertyPublisher::EntityReplicatorState::Creating:
             if (m_ownsLifetime == PropertyPublisher::OwnsLifetime::True)
             {
-                needsUpdate = PrepareAddEntityRecord();
+                needsUpdate = m_useSnapshots ? PrepareEntitySnapshot() : PrepareAddEntityRecord();
             }
             m_replicatorState = PropertyPublisher::EntityReplicatorState::Updating;
             break;
@@ -265,7 +403,7 @@ namespace Multiplayer
             break;
 
         case PropertyPublisher::EntityReplicatorState::Updating:
-            needsUpdate = PrepareUpdateEntityRecord();
+            needsUpdate = m_useSnapshots ? PrepareEntitySnapshot() : PrepareUpdateEntityRecord();
             break;
 
         case PropertyPublisher::EntityReplicatorState::Deleting:
@@ -297,7 +435,7 @@ namespace Multiplayer
         case PropertyPublisher::EntityReplicatorState::Updating:
         {
             AZ_Assert(m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
-            success = SerializeUpdateEntityRecord(serializer);
+            success = m_useSnapshots ? SerializeEntitySnapshot(serializer) : SerializeUpdateEntityRecord(serializer);
         }
         break;
         case PropertyPublisher::EntityReplicatorState::Deleting:
@@ -329,7 +467,14 @@ namespace Multiplayer
         case PropertyPublisher::EntityReplicatorState::Updating:
         {
             AZ_Assert(m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
-            FinalizeUpdateEntityRecord(sentId);
+            if (m_useSnapshots)
+            {
+                FinalizeEntitySnapshot(sentId);
+            }
+            else
+            {
+                FinalizeUpdateEntityRecord(sentId);
+            }
             m_replicatorState = PropertyPublisher::EntityReplicatorState::Updating;
         }
         break;
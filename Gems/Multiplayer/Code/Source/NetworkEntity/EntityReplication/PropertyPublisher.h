@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshotHistory.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <AzCore/std/containers/ring_buffer.h>
 
@@ -37,6 +38,9 @@ namespace Multiplayer
 
         bool IsRemoteReplicatorEstablished() const;
 
+        //! Returns true if updates are sent as deltas against the last entity snapshot acknowledged by the remote endpoint.
+        bool IsUsingSnapshots() const;
+
         void GenerateRecord();
 
         //! Interface for ReplicationManager to manage serialization of entities
@@ -67,21 +71,29 @@ namespace Multiplayer
 
         //! Check if we have data to send
         bool HasUpdateEntityRecord();
+        bool HasUpdateEntitySnapshot();
 
         //! Phase 1, setup of the record
         bool PrepareAddEntityRecord();
         bool PrepareRebaseEntityRecord();
         bool PrepareUpdateEntityRecord();
         bool PrepareDeleteEntityRecord();
+        bool PrepareEntitySnapshot();
 
         //! Phase 2, serialize the record
         //! No add, they share the update path
         bool SerializeUpdateEntityRecord(AzNetworking::ISerializer& serializer);
         bool SerializeDeleteEntityRecord(AzNetworking::ISerializer& serializer);
+        bool SerializeEntitySnapshot(AzNetworking::ISerializer& serializer);
 
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
+        void FinalizeEntitySnapshot(AzNetworking::PacketId packetId);
+
+        //! Returns the complete replicated state of the entity for Client proxies, serialized once and shared until the entity changes.
+        //! @return the serialized snapshot, or nullptr if the entity failed to serialize
+        EntitySnapshotData GetClientSnapshot();
 
         EntityReplicatorState m_replicatorState = EntityReplicatorState::Creating;
         EntityReplicatorSerializationPhase m_serializationPhase = EntityReplicatorSerializationPhase::Ready;
@@ -96,5 +108,13 @@ namespace Multiplayer
         AZStd::ring_buffer<ReplicationRecord> m_sentRecords;
         AZStd::vector<AzNetworking::PacketId> m_deletePacketIds;
         bool m_remoteReplicatorEstablished = false;
+
+        //! Snapshots of the entity state sent to the remote endpoint, only used if m_useSnapshots is set
+        //! In snapshot mode m_pendingRecord only tracks whether anything has changed since the last send
+        EntitySnapshotHistory m_sentSnapshots;
+        EntitySnapshotId m_snapshotBaselineId = InvalidEntitySnapshotId;
+        EntitySnapshotId m_pendingSnapshotId = InvalidEntitySnapshotId;
+        uint32_t m_snapshotsSinceKeyframe = 0;
+        bool m_useSnapshots = false;
     };
 }
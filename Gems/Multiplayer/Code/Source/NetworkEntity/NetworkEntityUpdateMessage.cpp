@@ -20,6 +20,7 @@ namespace Multiplayer
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_takeOwnership(rhs.m_takeOwnership)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isSnapshotDelta(rhs.m_isSnapshotDelta)
         , m_prefabEntityId(rhs.m_prefabEntityId)
         , m_data(AZStd::move(rhs.m_data))
     {
@@ -33,6 +34,7 @@ namespace Multiplayer
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_takeOwnership(rhs.m_takeOwnership)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isSnapshotDelta(rhs.m_isSnapshotDelta)
         , m_prefabEntityId(rhs.m_prefabEntityId)
     {
         if (rhs.m_data != nullptr)
@@ -75,6 +77,7 @@ namespace Multiplayer
         m_wasMigrated = rhs.m_wasMigrated;
         m_takeOwnership = rhs.m_takeOwnership;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isSnapshotDelta = rhs.m_isSnapshotDelta;
         m_prefabEntityId = rhs.m_prefabEntityId;
         m_data = AZStd::move(rhs.m_data);
         return *this;
@@ -88,6 +91,7 @@ namespace Multiplayer
         m_wasMigrated = rhs.m_wasMigrated;
         m_takeOwnership = rhs.m_takeOwnership;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isSnapshotDelta = rhs.m_isSnapshotDelta;
         m_prefabEntityId = rhs.m_prefabEntityId;
         if (rhs.m_data != nullptr)
         {
@@ -106,6 +110,7 @@ namespace Multiplayer
              && (m_wasMigrated == rhs.m_wasMigrated)
              && (m_takeOwnership == rhs.m_takeOwnership)
              && (m_hasValidPrefabId == rhs.m_hasValidPrefabId)
+             && (m_isSnapshotDelta == rhs.m_isSnapshotDelta)
              && (m_prefabEntityId == rhs.m_prefabEntityId));
     }
 
@@ -170,6 +175,16 @@ namespace Multiplayer
         return m_hasValidPrefabId;
     }
 
+    void NetworkEntityUpdateMessage::SetIsSnapshotDelta(bool value)
+    {
+        m_isSnapshotDelta = value;
+    }
+
+    bool NetworkEntityUpdateMessage::GetIsSnapshotDelta() const
+    {
+        return m_isSnapshotDelta;
+    }
+
     void NetworkEntityUpdateMessage::SetPrefabEntityId(const PrefabEntityId& value)
     {
         m_hasValidPrefabId = true;
@@ -209,11 +224,12 @@ namespace Multiplayer
         // Always serialize the entityId
         serializer.Serialize(m_entityId, "EntityId");
 
-        // Use the upper 4 bits for boolean flags, and the lower 4 bits for the network role
+        // Use the upper 5 bits for boolean flags, and the lower 3 bits for the network role
         uint8_t networkTypeAndFlags = (m_isDelete ? 0x80 : 0x00)
                                     | (m_wasMigrated ? 0x40 : 0x00)
                                     | (m_takeOwnership ? 0x20 : 0x00)
                                     | (m_hasValidPrefabId ? 0x10 : 0x00)
+                                    | (m_isSnapshotDelta ? 0x08 : 0x00)
                                     | static_cast<uint8_t>(m_networkRole);
 
         if (serializer.Serialize(networkTypeAndFlags, "TypeAndFlags"))
@@ -222,7 +238,8 @@ namespace Multiplayer
             m_wasMigrated = (networkTypeAndFlags & 0x40) == 0x40;
             m_takeOwnership = (networkTypeAndFlags & 0x20) == 0x20;
             m_hasValidPrefabId = (networkTypeAndFlags & 0x10) == 0x10;
-            m_networkRole = static_cast<NetEntityRole>(networkTypeAndFlags & 0x0F);
+            m_isSnapshotDelta = (networkTypeAndFlags & 0x08) == 0x08;
+            m_networkRole = static_cast<NetEntityRole>(networkTypeAndFlags & 0x07);
         }
 
         if (!m_isDelete)
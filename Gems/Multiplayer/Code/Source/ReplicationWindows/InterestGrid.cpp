@@ -0,0 +1,432 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+#include <cmath>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_InterestGridCellSize, 100.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The width of a single interest grid cell, applied when the interest grid activates");
+    AZ_CVAR(float, sv_InterestHysteresisDistance, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null, "The fraction of sv_ClientAwarenessRadius an already relevant entity can move past the radius before it stops being relevant");
+    AZ_CVAR(float, sv_InterestHysteresisPriorityBonus, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The fraction of priority added to entities that are already relevant to a client, so similarly scored entities don't keep swapping in and out");
+    AZ_CVAR(bool, sv_multithreadedInterestUpdates, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, client relevancy is scored in parallel on the job system. Always serial when an entity filter is set");
+
+    AZ_CVAR_EXTERNED(bool, sv_ReplicateServerProxies);
+    AZ_CVAR_EXTERNED(uint32_t, sv_MaxEntitiesToTrackReplication);
+    AZ_CVAR_EXTERNED(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs);
+    AZ_CVAR_EXTERNED(float, sv_ClientAwarenessRadius);
+
+    // Kept well inside the range of int32_t, so the cell loops in ScoreObserver can step past the last cell without overflowing
+    static constexpr int32_t MaxCellCoordinate = 1 << 30;
+
+    static int32_t GetCellCoordinate(float position, float inverseCellSize)
+    {
+        // Converting NaN or a float outside the range of int32_t is undefined, so entities at invalid or extreme positions
+        // are clamped into the outermost cells
+        const float cell = AZStd::floor(position * inverseCellSize);
+        if (std::isnan(cell))
+        {
+            return 0;
+        }
+        constexpr float MaxCell = static_cast<float>(MaxCellCoordinate);
+        return static_cast<int32_t>(AZStd::clamp(cell, -MaxCell, MaxCell));
+    }
+
+    static uint64_t MakeCellKey(int32_t cellX, int32_t cellY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+    }
+
+    InterestGrid::InterestGrid()
+        : m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
+        , m_updateRelevancyEvent([this]()
+            {
+                UpdateRelevancy(sv_multithreadedInterestUpdates ? AZ::JobContext::GetGlobalContext() : nullptr);
+            }, AZ::Name("Interest grid relevancy update event"))
+    {
+        ;
+    }
+
+    InterestGrid::~InterestGrid()
+    {
+        Deactivate();
+    }
+
+    void InterestGrid::Activate()
+    {
+        if (m_isActive)
+        {
+            return;
+        }
+        m_isActive = true;
+
+        m_cellSize = AZStd::max<float>(sv_InterestGridCellSize, 1.0f);
+        m_inverseCellSize = 1.0f / m_cellSize;
+
+        if (AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+
+        // Pick up any networked entities that activated before we started listening
+        if (NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker())
+        {
+            for (auto& [netEntityId, entity] : *networkEntityTracker)
+            {
+                if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active))
+                {
+                    AddEntity(entity);
+                }
+            }
+        }
+
+        m_updateRelevancyEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+    }
+
+    void InterestGrid::Deactivate()
+    {
+        if (!m_isActive)
+        {
+            return;
+        }
+        m_isActive = false;
+
+        m_updateRelevancyEvent.RemoveFromQueue();
+        m_entityActivatedEventHandler.Disconnect();
+        m_entityDeactivatedEventHandler.Disconnect();
+
+        for (auto& [netEntityId, trackedEntity] : m_entities)
+        {
+            trackedEntity.m_transformChangedHandler.Disconnect();
+        }
+        m_entities.clear();
+        m_cells.clear();
+
+        for (auto& [observerId, observer] : m_observers)
+        {
+            observer->m_relevantEntities.clear();
+            observer->m_results.clear();
+        }
+    }
+
+    bool InterestGrid::IsActive() const
+    {
+        return m_isActive;
+    }
+
+    InterestObserverId InterestGrid::AddObserver(const ConstNetworkEntityHandle& controlledEntity, AzNetworking::ConnectionId connectionId, RelevancyUpdatedCallback callback)
+    {
+        const InterestObserverId observerId = ++m_nextObserverId;
+        AZStd::unique_ptr<Observer> observer = AZStd::make_unique<Observer>();
+        observer->m_controlledEntity = controlledEntity;
+        observer->m_connectionId = connectionId;
+        observer->m_callback = AZStd::move(callback);
+        m_observers.emplace(observerId, AZStd::move(observer));
+        return observerId;
+    }
+
+    void InterestGrid::RemoveObserver(InterestObserverId observerId)
+    {
+        m_observers.erase(observerId);
+    }
+
+    void InterestGrid::UpdateRelevancy(AZ::JobContext* jobContext)
+    {
+        const float awarenessRadius = sv_ClientAwarenessRadius;
+        ScoringSettings settings;
+        settings.m_radiusSq = awarenessRadius * awarenessRadius;
+        settings.m_hysteresisRadius = awarenessRadius * (1.0f + AZStd::max<float>(sv_InterestHysteresisDistance, 0.0f));
+        settings.m_hysteresisRadiusSq = settings.m_hysteresisRadius * settings.m_hysteresisRadius;
+        settings.m_hysteresisPriorityScale = 1.0f + AZStd::max<float>(sv_InterestHysteresisPriorityBonus, 0.0f);
+        settings.m_maxRelevantEntities = sv_MaxEntitiesToTrackReplication;
+        settings.m_replicateServerProxies = sv_ReplicateServerProxies;
+
+        // Resolve every observer's position up front, so scoring only reads grid state
+        m_observersToUpdate.clear();
+        m_observersToUpdate.reserve(m_observers.size());
+        for (auto& [observerId, observer] : m_observers)
+        {
+            const AZ::Entity* entity = observer->m_controlledEntity.GetEntity();
+            AZ::TransformInterface* transformInterface = (entity != nullptr) ? entity->GetTransform() : nullptr;
+            observer->m_isValid = (transformInterface != nullptr);
+            if (observer->m_isValid)
+            {
+                observer->m_position = transformInterface->GetWorldTranslation();
+            }
+            m_observersToUpdate.push_back(observer.get());
+        }
+
+        // Entity filters are user code with no thread safety guarantees, so filtered servers always score on this thread
+        IFilterEntityManager* filterEntityManager = GetMultiplayer()->GetFilterEntityManager();
+        if ((jobContext == nullptr) || (filterEntityManager != nullptr) || (m_observersToUpdate.size() <= 1))
+        {
+            for (Observer* observer : m_observersToUpdate)
+            {
+                ScoreObserver(*observer, settings, filterEntityManager);
+            }
+        }
+        else
+        {
+            AZ::JobCompletion jobCompletion(jobContext);
+            for (Observer* observer : m_observersToUpdate)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([this, observer, &settings]()
+                {
+                    ScoreObserver(*observer, settings, nullptr);
+                }, true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        for (Observer* observer : m_observersToUpdate)
+        {
+            if (observer->m_callback)
+            {
+                observer->m_callback(observer->m_results);
+            }
+        }
+    }
+
+    uint32_t InterestGrid::GetTrackedEntityCount() const
+    {
+        uint32_t trackedEntityCount = 0;
+        for (const auto& [cellKey, cell] : m_cells)
+        {
+            trackedEntityCount += aznumeric_cast<uint32_t>(cell.size());
+        }
+        return trackedEntityCount;
+    }
+
+    void InterestGrid::OnEntityActivated(AZ::Entity* entity)
+    {
+        AddEntity(entity);
+    }
+
+    void InterestGrid::OnEntityDeactivated(AZ::Entity* entity)
+    {
+        NetBindComponent* netBindComponent = entity->FindComponent<NetBindComponent>();
+        if (netBindComponent != nullptr)
+        {
+            RemoveEntity(netBindComponent->GetNetEntityId());
+        }
+    }
+
+    void InterestGrid::AddEntity(AZ::Entity* entity)
+    {
+        NetBindComponent* netBindComponent = entity->FindComponent<NetBindComponent>();
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if ((netBindComponent == nullptr) || (transformInterface == nullptr))
+        {
+            // Entities without a transform can't be located, so they are never relevant by distance
+            return;
+        }
+
+        auto [iter, inserted] = m_entities.try_emplace(netBindComponent->GetNetEntityId());
+        if (!inserted)
+        {
+            return;
+        }
+
+        TrackedEntity& trackedEntity = iter->second;
+        trackedEntity.m_entityHandle = ConstNetworkEntityHandle(netBindComponent, GetNetworkEntityTracker());
+        trackedEntity.m_entity = entity;
+        trackedEntity.m_netBindComponent = netBindComponent;
+        trackedEntity.m_position = transformInterface->GetWorldTranslation();
+
+        // Node hash map elements never relocate, so the handler can hold on to the tracked entity
+        trackedEntity.m_transformChangedHandler = AZ::TransformChangedEvent::Handler([this, &trackedEntity]
+            ([[maybe_unused]] const AZ::Transform& localTm, const AZ::Transform& worldTm)
+            {
+                OnEntityMoved(trackedEntity, worldTm.GetTranslation());
+            });
+        transformInterface->BindTransformChangedEventHandler(trackedEntity.m_transformChangedHandler);
+
+        AddToCell(trackedEntity);
+    }
+
+    void InterestGrid::RemoveEntity(NetEntityId netEntityId)
+    {
+        auto iter = m_entities.find(netEntityId);
+        if (iter == m_entities.end())
+        {
+            return;
+        }
+
+        TrackedEntity& trackedEntity = iter->second;
+        trackedEntity.m_transformChangedHandler.Disconnect();
+        RemoveFromCell(trackedEntity);
+        m_entities.erase(iter);
+    }
+
+    void InterestGrid::OnEntityMoved(TrackedEntity& trackedEntity, const AZ::Vector3& position)
+    {
+        trackedEntity.m_position = position;
+        if (GetCellKey(position) != trackedEntity.m_cellKey)
+        {
+            RemoveFromCell(trackedEntity);
+            AddToCell(trackedEntity);
+        }
+    }
+
+    InterestGrid::CellKey InterestGrid::GetCellKey(const AZ::Vector3& position) const
+    {
+        return MakeCellKey
+        (
+            GetCellCoordinate(position.GetX(), m_inverseCellSize),
+            GetCellCoordinate(position.GetY(), m_inverseCellSize)
+        );
+    }
+
+    void InterestGrid::AddToCell(TrackedEntity& trackedEntity)
+    {
+        trackedEntity.m_cellKey = GetCellKey(trackedEntity.m_position);
+        AZStd::vector<TrackedEntity*>& cell = m_cells[trackedEntity.m_cellKey];
+        trackedEntity.m_cellIndex = aznumeric_cast<uint32_t>(cell.size());
+        cell.push_back(&trackedEntity);
+    }
+
+    void InterestGrid::RemoveFromCell(TrackedEntity& trackedEntity)
+    {
+        auto iter = m_cells.find(trackedEntity.m_cellKey);
+        AZ_Assert(iter != m_cells.end(), "Tracked entity is missing from its interest grid cell");
+        if (iter == m_cells.end())
+        {
+            return;
+        }
+
+        // Swap remove, patching up the index of whichever entity fills the gap
+        AZStd::vector<TrackedEntity*>& cell = iter->second;
+        TrackedEntity* lastEntity = cell.back();
+        cell[trackedEntity.m_cellIndex] = lastEntity;
+        lastEntity->m_cellIndex = trackedEntity.m_cellIndex;
+        cell.pop_back();
+
+        if (cell.empty())
+        {
+            m_cells.erase(trackedEntity.m_cellKey);
+        }
+    }
+
+    void InterestGrid::ScoreObserver(Observer& observer, const ScoringSettings& settings, IFilterEntityManager* filterEntityManager) const
+    {
+        observer.m_results.clear();
+        if (!observer.m_isValid)
+        {
+            observer.m_relevantEntities.clear();
+            return;
+        }
+
+        const NetEntityId controlledNetEntityId = observer.m_controlledEntity.GetNetEntityId();
+        auto scoreCell = [&observer, &settings, filterEntityManager, controlledNetEntityId](const AZStd::vector<TrackedEntity*>& cell)
+        {
+            for (TrackedEntity* trackedEntity : cell)
+            {
+                const NetEntityId netEntityId = trackedEntity->m_entityHandle.GetNetEntityId();
+                if (netEntityId == controlledNetEntityId)
+                {
+                    // The controlled entity is always replicated as autonomous by the replication window
+                    continue;
+                }
+
+                const float distanceSquared = observer.m_position.GetDistanceSq(trackedEntity->m_position);
+                if (!(distanceSquared <= settings.m_hysteresisRadiusSq))
+                {
+                    // Also skips entities at NaN positions, which every comparison fails for
+                    continue;
+                }
+
+                const bool wasRelevant = observer.m_relevantEntities.find(netEntityId) != observer.m_relevantEntities.end();
+                if (!wasRelevant && (distanceSquared > settings.m_radiusSq))
+                {
+                    continue;
+                }
+
+                if (!settings.m_replicateServerProxies && (trackedEntity->m_netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
+                {
+                    // Proxy replication disabled
+                    continue;
+                }
+
+                if (filterEntityManager && filterEntityManager->IsEntityFiltered(trackedEntity->m_entity, observer.m_controlledEntity, observer.m_connectionId))
+                {
+                    continue;
+                }
+
+                float priority = 1.0f / AZStd::max(distanceSquared, 1.0f);
+                if (wasRelevant)
+                {
+                    priority *= settings.m_hysteresisPriorityScale;
+                }
+                observer.m_results.push_back({ trackedEntity->m_entityHandle, priority });
+            }
+        };
+
+        const int32_t minCellX = GetCellCoordinate(observer.m_position.GetX() - settings.m_hysteresisRadius, m_inverseCellSize);
+        const int32_t maxCellX = GetCellCoordinate(observer.m_position.GetX() + settings.m_hysteresisRadius, m_inverseCellSize);
+        const int32_t minCellY = GetCellCoordinate(observer.m_position.GetY() - settings.m_hysteresisRadius, m_inverseCellSize);
+        const int32_t maxCellY = GetCellCoordinate(observer.m_position.GetY() + settings.m_hysteresisRadius, m_inverseCellSize);
+        const uint64_t cellsInRange = static_cast<uint64_t>(int64_t(maxCellX) - minCellX + 1) * static_cast<uint64_t>(int64_t(maxCellY) - minCellY + 1);
+
+        if (cellsInRange >= m_cells.size())
+        {
+            // Sparse grid, or a very large radius, walking the occupied cells is cheaper than probing every cell in range
+            for (const auto& [cellKey, cell] : m_cells)
+            {
+                scoreCell(cell);
+            }
+        }
+        else
+        {
+            for (int32_t cellX = minCellX; cellX <= maxCellX; ++cellX)
+            {
+                for (int32_t cellY = minCellY; cellY <= maxCellY; ++cellY)
+                {
+                    auto iter = m_cells.find(MakeCellKey(cellX, cellY));
+                    if (iter != m_cells.end())
+                    {
+                        scoreCell(iter->second);
+                    }
+                }
+            }
+        }
+
+        auto higherPriority = [](const RelevantEntity& lhs, const RelevantEntity& rhs)
+        {
+            return lhs.m_priority > rhs.m_priority;
+        };
+        if (observer.m_results.size() > settings.m_maxRelevantEntities)
+        {
+            AZStd::partial_sort(observer.m_results.begin(), observer.m_results.begin() + settings.m_maxRelevantEntities, observer.m_results.end(), higherPriority);
+            observer.m_results.resize(settings.m_maxRelevantEntities);
+        }
+        else
+        {
+            AZStd::sort(observer.m_results.begin(), observer.m_results.end(), higherPriority);
+        }
+
+        observer.m_relevantEntities.clear();
+        for (const RelevantEntity& relevantEntity : observer.m_results)
+        {
+            observer.m_relevantEntities.insert(relevantEntity.m_entityHandle.GetNetEntityId());
+        }
+    }
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
+#include <AzCore/std/containers/node_hash_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class JobContext;
+}
+
+namespace Multiplayer
+{
+    class IFilterEntityManager;
+    class NetBindComponent;
+
+    AZ_TYPE_SAFE_INTEGRAL(InterestObserverId, uint32_t);
+    static constexpr InterestObserverId InvalidInterestObserverId = static_cast<InterestObserverId>(0);
+
+    //! @class InterestGrid
+    //! @brief Server side interest management for all client connections.
+    //! Networked entities are bucketed into a uniform grid on the horizontal plane, which is kept up to date as entities move.
+    //! Periodically the grid scores the entities around every observer in a single batched pass, and hands each observer the
+    //! highest priority entities it should replicate. Entities that were already relevant to an observer get a priority
+    //! bonus and a slightly larger radius, so entities near the edge of the awareness radius don't flicker in and out.
+    class InterestGrid
+    {
+    public:
+        struct RelevantEntity
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            float m_priority = 0.0f;
+        };
+        //! Relevant entities of one observer, sorted from highest to lowest priority.
+        using RelevantEntityList = AZStd::vector<RelevantEntity>;
+        using RelevancyUpdatedCallback = AZStd::function<void(const RelevantEntityList&)>;
+
+        InterestGrid();
+        ~InterestGrid();
+
+        //! Starts tracking networked entities as they activate, along with any that are already active.
+        //! Only hosts need to track entities, so this is called once the host starts.
+        void Activate();
+
+        //! Stops tracking networked entities and stops updating observers.
+        void Deactivate();
+
+        //! Returns whether the grid is tracking entities.
+        bool IsActive() const;
+
+        //! Adds an observer that's interested in the entities around the given entity.
+        //! Observer callbacks must not add or remove observers.
+        //! @param controlledEntity the entity the observer is centred on
+        //! @param connectionId     the connection of the observer, used for entity filtering
+        //! @param callback         invoked after every relevancy update with the relevant entities of the observer
+        //! @return the id of the new observer
+        InterestObserverId AddObserver(const ConstNetworkEntityHandle& controlledEntity, AzNetworking::ConnectionId connectionId, RelevancyUpdatedCallback callback);
+
+        //! Removes an observer added with AddObserver.
+        //! @param observerId the id of the observer to remove
+        void RemoveObserver(InterestObserverId observerId);
+
+        //! Recomputes the relevant entities of every observer and invokes their callbacks.
+        //! This runs automatically every sv_ClientReplicationWindowUpdateMs while the grid is active.
+        //! @param jobContext the job context to score observers on, or nullptr to score them on the calling thread
+        void UpdateRelevancy(AZ::JobContext* jobContext);
+
+        //! Returns the number of entities that are currently tracked.
+        uint32_t GetTrackedEntityCount() const;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(InterestGrid);
+
+        using CellKey = uint64_t;
+
+        //! Cvar values for a relevancy update, read once on the main thread before observers are scored.
+        struct ScoringSettings
+        {
+            float m_radiusSq = 0.0f;
+            float m_hysteresisRadius = 0.0f;
+            float m_hysteresisRadiusSq = 0.0f;
+            float m_hysteresisPriorityScale = 1.0f;
+            uint32_t m_maxRelevantEntities = 0;
+            bool m_replicateServerProxies = true;
+        };
+
+        //! A networked entity with a transform, tracked from the time it activates until it deactivates.
+        struct TrackedEntity
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::Entity* m_entity = nullptr;
+            NetBindComponent* m_netBindComponent = nullptr;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            CellKey m_cellKey = 0;
+            uint32_t m_cellIndex = 0;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+        };
+
+        struct Observer
+        {
+            ConstNetworkEntityHandle m_controlledEntity;
+            AzNetworking::ConnectionId m_connectionId;
+            RelevancyUpdatedCallback m_callback;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            bool m_isValid = false;
+            AZStd::flat_hash_set<NetEntityId> m_relevantEntities;
+            RelevantEntityList m_results;
+        };
+
+        void OnEntityActivated(AZ::Entity* entity);
+        void OnEntityDeactivated(AZ::Entity* entity);
+        void AddEntity(AZ::Entity* entity);
+        void RemoveEntity(NetEntityId netEntityId);
+        void OnEntityMoved(TrackedEntity& trackedEntity, const AZ::Vector3& position);
+
+        CellKey GetCellKey(const AZ::Vector3& position) const;
+        void AddToCell(TrackedEntity& trackedEntity);
+        void RemoveFromCell(TrackedEntity& trackedEntity);
+
+        void ScoreObserver(Observer& observer, const ScoringSettings& settings, IFilterEntityManager* filterEntityManager) const;
+
+        AZStd::node_hash_map<NetEntityId, TrackedEntity> m_entities;
+        AZStd::flat_hash_map<CellKey, AZStd::vector<TrackedEntity*>> m_cells;
+        AZStd::flat_hash_map<InterestObserverId, AZStd::unique_ptr<Observer>> m_observers;
+        AZStd::vector<Observer*> m_observersToUpdate;
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+        AZ::ScheduledEvent m_updateRelevancyEvent;
+
+        InterestObserverId m_nextObserverId = InvalidInterestObserverId;
+        float m_cellSize = 1.0f;
+        float m_inverseCellSize = 1.0f;
+        bool m_isActive = false;
+    };
+}
@@ -50,11 +50,12 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection, InterestGrid* interestGrid)
         : m_controlledEntity(controlledEntity)
         , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
         , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
         , m_connection(connection)
+        , m_interestGrid(interestGrid)
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
         , m_updateWindowEvent([this]() { UpdateWindow(); }, AZ::Name("Server to client replication window update event"))
@@ -64,12 +65,29 @@ namespace Multiplayer
         m_controlledEntityTransform = entity ? entity->GetTransform() : nullptr;
         AZ_Assert(m_controlledEntityTransform, "Controlled player entity must have a transform");
 
-        m_updateWindowEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        if (m_interestGrid != nullptr)
+        {
+            // The interest grid batches relevancy for every client, so it drives our updates instead of our own timer
+            m_interestObserverId = m_interestGrid->AddObserver(m_controlledEntity, m_connection->GetConnectionId(),
+                [this](const InterestGrid::RelevantEntityList& relevantEntities) { OnRelevancyUpdated(relevantEntities); });
+        }
+        else
+        {
+            m_updateWindowEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        }
 
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
     }
 
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow()
+    {
+        if (m_interestGrid != nullptr)
+        {
+            m_interestGrid->RemoveObserver(m_interestObserverId);
+        }
+    }
+
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
     {
         // if we don't have a controlled entity anymore, don't send updates (validate this)
@@ -106,6 +124,12 @@ namespace Multiplayer
 
     void ServerToClientReplicationWindow::UpdateWindow()
     {
+        if (m_interestGrid != nullptr)
+        {
+            // Relevancy is pushed to us by the interest grid, see OnRelevancyUpdated
+            return;
+        }
+
         // clear the candidate queue, we're going to rebuild it
         ReplicationCandidateQueue clearQueue;
         clearQueue.get_container().reserve(sv_MaxEntitiesToTrackReplication);
@@ -243,6 +267,35 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::OnRelevancyUpdated(const InterestGrid::RelevantEntityList& relevantEntities)
+    {
+        // clear the candidate queue, we're going to rebuild it
+        ReplicationCandidateQueue clearQueue;
+        clearQueue.get_container().reserve(sv_MaxEntitiesToTrackReplication);
+        m_candidateQueue.swap(clearQueue);
+        m_replicationSet.clear();
+
+        NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
+        if (!netBindComponent || !netBindComponent->HasController())
+        {
+            // if we don't have a controlled entity, or we no longer have control of the entity, don't run the update
+            return;
+        }
+
+        EvaluateConnection();
+
+        // The grid has already filtered, scored and capped the entities, highest priority first
+        for (const InterestGrid::RelevantEntity& relevantEntity : relevantEntities)
+        {
+            ConstNetworkEntityHandle entityHandle = relevantEntity.m_entityHandle;
+            AddEntityToReplicationSet(entityHandle, relevantEntity.m_priority, 0.0f);
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f };  // Always replicate autonomous entities
+    }
+
     void ServerToClientReplicationWindow::EvaluateConnection()
     {
         const uint32_t newPacketsSent = m_connection->GetMetrics().m_packetsSent;
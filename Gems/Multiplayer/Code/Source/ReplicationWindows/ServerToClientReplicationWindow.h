@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/InterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -38,7 +39,11 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection);
+        //! @param controlledEntity the entity controlled by the client, the window is centred on it
+        //! @param connection       the connection to the client
+        //! @param interestGrid     optional shared interest grid that drives the window, if nullptr the window queries the visibility system itself
+        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection, InterestGrid* interestGrid = nullptr);
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
@@ -53,6 +58,7 @@ namespace Multiplayer
     private:
         void OnEntityActivated(AZ::Entity* entity);
         void OnEntityDeactivated(AZ::Entity* entity);
+        void OnRelevancyUpdated(const InterestGrid::RelevantEntityList& relevantEntities);
 
         //void CollectControlledEntitiesRecursive(ReplicationSet& replicationSet, EntityHierarchyComponent::Authority& hierarchyController);
 
@@ -76,6 +82,8 @@ namespace Multiplayer
         //NetBindComponent* m_controlledNetBindComponent = nullptr;
 
         const AzNetworking::IConnection* m_connection = nullptr;
+        InterestGrid* m_interestGrid = nullptr; // non-owning pointer
+        InterestObserverId m_interestObserverId = InvalidInterestObserverId;
         float m_minPriorityReplicated = 0.0f; ///< Lowest replicated entity priority in last update
 
         // Cached values to detect a poor network connection
@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzTest/AzTest.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <MultiplayerSystemComponent.h>
+#include <ReplicationWindows/InterestGrid.h>
+#include <limits>
+
+namespace Multiplayer
+{
+    AZ_CVAR_EXTERNED(float, sv_ClientAwarenessRadius);
+    AZ_CVAR_EXTERNED(uint32_t, sv_MaxEntitiesToTrackReplication);
+    AZ_CVAR_EXTERNED(float, sv_InterestGridCellSize);
+    AZ_CVAR_EXTERNED(float, sv_InterestHysteresisDistance);
+    AZ_CVAR_EXTERNED(float, sv_InterestHysteresisPriorityBonus);
+
+    //! Sets up a host with networked entities that have a transform, which the interest grid tracks once activated.
+    //! Requires the system, pool and thread pool allocators and the name dictionary.
+    class InterestGridHost
+    {
+    public:
+        InterestGridHost()
+        {
+            m_transformDescriptor.reset(AzFramework::TransformComponent::CreateDescriptor());
+            m_netBindDescriptor.reset(NetBindComponent::CreateDescriptor());
+
+            m_netComponent = AZStd::make_unique<AzNetworking::NetworkingSystemComponent>();
+            m_mpComponent = AZStd::make_unique<MultiplayerSystemComponent>();
+            m_mpComponent->Activate();
+        }
+
+        ~InterestGridHost()
+        {
+            m_interestGrid.Deactivate();
+            m_entities.clear();
+
+            m_mpComponent->Deactivate();
+            m_mpComponent.reset();
+            m_netComponent.reset();
+
+            m_netBindDescriptor.reset();
+            m_transformDescriptor.reset();
+        }
+
+        //! Creates and activates a networked entity at the given position.
+        AZ::Entity* CreateEntity(const AZ::Vector3& position)
+        {
+            AZ::Entity* entity = aznew AZ::Entity();
+            entity->CreateComponent<AzFramework::TransformComponent>();
+            entity->CreateComponent<NetBindComponent>();
+            GetNetworkEntityManager()->SetupNetEntity(entity, PrefabEntityId(), NetEntityRole::Authority);
+            entity->Init();
+            entity->Activate();
+            entity->GetTransform()->SetWorldTranslation(position);
+            m_entities.emplace_back(entity);
+            return entity;
+        }
+
+        static NetEntityId GetNetEntityId(const AZ::Entity* entity)
+        {
+            return entity->FindComponent<NetBindComponent>()->GetNetEntityId();
+        }
+
+        static ConstNetworkEntityHandle GetEntityHandle(const AZ::Entity* entity)
+        {
+            return entity->FindComponent<NetBindComponent>()->GetEntityHandle();
+        }
+
+        InterestGrid m_interestGrid;
+
+    private:
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_transformDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_netBindDescriptor;
+        AZStd::unique_ptr<AzNetworking::NetworkingSystemComponent> m_netComponent;
+        AZStd::unique_ptr<MultiplayerSystemComponent> m_mpComponent;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+    };
+
+    class InterestGridTests
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SetupAllocator();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+            AZ::NameDictionary::Create();
+
+            m_awarenessRadius = sv_ClientAwarenessRadius;
+            m_maxEntitiesToTrackReplication = sv_MaxEntitiesToTrackReplication;
+            m_interestGridCellSize = sv_InterestGridCellSize;
+            m_interestHysteresisDistance = sv_InterestHysteresisDistance;
+            m_interestHysteresisPriorityBonus = sv_InterestHysteresisPriorityBonus;
+
+            // Observers see 10 units, already relevant entities stay relevant up to 11 units and grid cells are 4 units wide
+            sv_ClientAwarenessRadius = 10.0f;
+            sv_MaxEntitiesToTrackReplication = 64;
+            sv_InterestGridCellSize = 4.0f;
+            sv_InterestHysteresisDistance = 0.1f;
+            sv_InterestHysteresisPriorityBonus = 0.25f;
+
+            m_host = AZStd::make_unique<InterestGridHost>();
+            m_observerEntity = m_host->CreateEntity(AZ::Vector3::CreateZero());
+        }
+
+        void TearDown() override
+        {
+            m_host.reset();
+
+            sv_InterestHysteresisPriorityBonus = m_interestHysteresisPriorityBonus;
+            sv_InterestHysteresisDistance = m_interestHysteresisDistance;
+            sv_InterestGridCellSize = m_interestGridCellSize;
+            sv_MaxEntitiesToTrackReplication = m_maxEntitiesToTrackReplication;
+            sv_ClientAwarenessRadius = m_awarenessRadius;
+
+            AZ::NameDictionary::Destroy();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            TeardownAllocator();
+        }
+
+        //! Activates the grid with a single observer centred on m_observerEntity.
+        void ActivateGrid()
+        {
+            m_host->m_interestGrid.Activate();
+            m_host->m_interestGrid.AddObserver(InterestGridHost::GetEntityHandle(m_observerEntity), AzNetworking::ConnectionId{ 1 },
+                [this](const InterestGrid::RelevantEntityList& relevantEntities)
+                {
+                    m_relevantEntities.clear();
+                    for (const InterestGrid::RelevantEntity& relevantEntity : relevantEntities)
+                    {
+                        m_relevantEntities.push_back(relevantEntity.m_entityHandle.GetNetEntityId());
+                    }
+                });
+        }
+
+        //! Updates the grid and returns the entities relevant to the observer, from highest to lowest priority.
+        const AZStd::vector<NetEntityId>& UpdateRelevancy()
+        {
+            m_host->m_interestGrid.UpdateRelevancy(nullptr);
+            return m_relevantEntities;
+        }
+
+        //! Returns whether the entity was relevant to the observer after the last update.
+        bool IsRelevant(const AZ::Entity* entity) const
+        {
+            return AZStd::find(m_relevantEntities.begin(), m_relevantEntities.end(), InterestGridHost::GetNetEntityId(entity)) != m_relevantEntities.end();
+        }
+
+        //! Moves the entity and updates the grid, then returns whether the entity is relevant to the observer.
+        bool MoveAndUpdate(AZ::Entity* entity, const AZ::Vector3& position)
+        {
+            entity->GetTransform()->SetWorldTranslation(position);
+            UpdateRelevancy();
+            return IsRelevant(entity);
+        }
+
+        AZStd::unique_ptr<InterestGridHost> m_host;
+        AZ::Entity* m_observerEntity = nullptr;
+        AZStd::vector<NetEntityId> m_relevantEntities;
+
+        float m_awarenessRadius = 0.0f;
+        uint32_t m_maxEntitiesToTrackReplication = 0;
+        float m_interestGridCellSize = 0.0f;
+        float m_interestHysteresisDistance = 0.0f;
+        float m_interestHysteresisPriorityBonus = 0.0f;
+    };
+
+    TEST_F(InterestGridTests, UpdateRelevancy_EntitiesAroundObserver_NearestEntitiesFirstAndDistantEntitiesExcluded)
+    {
+        AZ::Entity* farEntity = m_host->CreateEntity(AZ::Vector3(0.0f, 8.0f, 0.0f));
+        AZ::Entity* nearEntity = m_host->CreateEntity(AZ::Vector3(-3.0f, 0.0f, 0.0f));
+        m_host->CreateEntity(AZ::Vector3(20.0f, 0.0f, 0.0f));
+        ActivateGrid();
+
+        EXPECT_EQ(4u, m_host->m_interestGrid.GetTrackedEntityCount());
+        const AZStd::vector<NetEntityId>& relevantEntities = UpdateRelevancy();
+        ASSERT_EQ(2u, relevantEntities.size());
+        EXPECT_EQ(InterestGridHost::GetNetEntityId(nearEntity), relevantEntities[0]);
+        EXPECT_EQ(InterestGridHost::GetNetEntityId(farEntity), relevantEntities[1]);
+    }
+
+    TEST_F(InterestGridTests, UpdateRelevancy_RelevantEntityMovesPastRadius_StaysRelevantWithinHysteresisDistance)
+    {
+        AZ::Entity* entity = m_host->CreateEntity(AZ::Vector3(9.0f, 0.0f, 0.0f));
+        ActivateGrid();
+        UpdateRelevancy();
+        EXPECT_TRUE(IsRelevant(entity));
+
+        EXPECT_TRUE(MoveAndUpdate(entity, AZ::Vector3(10.5f, 0.0f, 0.0f)));
+        EXPECT_FALSE(MoveAndUpdate(entity, AZ::Vector3(11.5f, 0.0f, 0.0f)));
+
+        // Entities that aren't relevant only become relevant once they're inside the awareness radius
+        EXPECT_FALSE(MoveAndUpdate(entity, AZ::Vector3(10.5f, 0.0f, 0.0f)));
+        EXPECT_TRUE(MoveAndUpdate(entity, AZ::Vector3(9.5f, 0.0f, 0.0f)));
+    }
+
+    TEST_F(InterestGridTests, UpdateRelevancy_MoreEntitiesThanCap_OnlyHighestPriorityEntitiesRelevant)
+    {
+        sv_MaxEntitiesToTrackReplication = 2;
+        AZ::Entity* entity1 = m_host->CreateEntity(AZ::Vector3(1.0f, 0.0f, 0.0f));
+        m_host->CreateEntity(AZ::Vector3(3.0f, 0.0f, 0.0f));
+        AZ::Entity* entity2 = m_host->CreateEntity(AZ::Vector3(0.0f, -2.0f, 0.0f));
+        m_host->CreateEntity(AZ::Vector3(0.0f, 5.0f, 0.0f));
+        ActivateGrid();
+
+        const AZStd::vector<NetEntityId>& relevantEntities = UpdateRelevancy();
+        ASSERT_EQ(2u, relevantEntities.size());
+        EXPECT_EQ(InterestGridHost::GetNetEntityId(entity1), relevantEntities[0]);
+        EXPECT_EQ(InterestGridHost::GetNetEntityId(entity2), relevantEntities[1]);
+    }
+
+    TEST_F(InterestGridTests, UpdateRelevancy_EntityMovesCloserAtCap_RelevantEntityKeptUnlessMuchFurther)
+    {
+        sv_MaxEntitiesToTrackReplication = 1;
+        AZ::Entity* relevantEntity = m_host->CreateEntity(AZ::Vector3(2.0f, 0.0f, 0.0f));
+        AZ::Entity* approachingEntity = m_host->CreateEntity(AZ::Vector3(50.0f, 0.0f, 0.0f));
+        ActivateGrid();
+        UpdateRelevancy();
+        EXPECT_TRUE(IsRelevant(relevantEntity));
+
+        // Slightly closer, but not by enough to beat the priority bonus of the relevant entity
+        EXPECT_FALSE(MoveAndUpdate(approachingEntity, AZ::Vector3(1.9f, 0.0f, 0.0f)));
+        EXPECT_TRUE(IsRelevant(relevantEntity));
+
+        EXPECT_TRUE(MoveAndUpdate(approachingEntity, AZ::Vector3(1.0f, 0.0f, 0.0f)));
+        EXPECT_FALSE(IsRelevant(relevantEntity));
+    }
+
+    TEST_F(InterestGridTests, UpdateRelevancy_EntityMovesBetweenCells_GridFollowsEntity)
+    {
+        AZ::Entity* entity = m_host->CreateEntity(AZ::Vector3(2.0f, 2.0f, 0.0f));
+        ActivateGrid();
+        UpdateRelevancy();
+        EXPECT_TRUE(IsRelevant(entity));
+
+        // Crosses a cell boundary on each axis, into negative cells
+        EXPECT_TRUE(MoveAndUpdate(entity, AZ::Vector3(-5.0f, 6.0f, 0.0f)));
+        EXPECT_FALSE(MoveAndUpdate(entity, AZ::Vector3(1000.0f, -1000.0f, 0.0f)));
+
+        // The observer moving next to the entity finds it in its new cell
+        m_observerEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(1003.0f, -1001.0f, 0.0f));
+        UpdateRelevancy();
+        EXPECT_TRUE(IsRelevant(entity));
+
+        EXPECT_FALSE(MoveAndUpdate(entity, AZ::Vector3::CreateZero()));
+        EXPECT_EQ(2u, m_host->m_interestGrid.GetTrackedEntityCount());
+    }
+
+    TEST_F(InterestGridTests, UpdateRelevancy_EntityAtInvalidPosition_NotRelevantUntilItMovesBack)
+    {
+        AZ::Entity* entity = m_host->CreateEntity(AZ::Vector3(1.0f, 0.0f, 0.0f));
+        ActivateGrid();
+        UpdateRelevancy();
+        EXPECT_TRUE(IsRelevant(entity));
+
+        EXPECT_FALSE(MoveAndUpdate(entity, AZ::Vector3(std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), 0.0f)));
+        EXPECT_TRUE(MoveAndUpdate(entity, AZ::Vector3(1.0f, 0.0f, 0.0f)));
+        EXPECT_FALSE(MoveAndUpdate(entity, AZ::Vector3(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f)));
+        EXPECT_EQ(2u, m_host->m_interestGrid.GetTrackedEntityCount());
+
+        EXPECT_TRUE(MoveAndUpdate(entity, AZ::Vector3(1.0f, 0.0f, 0.0f)));
+    }
+
+#if defined(HAVE_BENCHMARK)
+    namespace Benchmark
+    {
+        //! Scores state.range(0) observers against state.range(1) entities spread over a square four awareness radii wide,
+        //! so each observer sees about a fifth of the entities. Uses the default awareness radius, cap and cell size.
+        class InterestGridBenchmarkFixture
+            : public UnitTest::AllocatorsBenchmarkFixture
+        {
+        public:
+            using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+            using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+            void SetUp(::benchmark::State& state) override
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+                AZ::NameDictionary::Create();
+
+                AZ::JobManagerDesc jobDesc;
+                AZ::JobManagerThreadDesc threadDesc;
+                const uint32_t workerCount = AZStd::max(AZStd::thread::hardware_concurrency(), 2u) - 1;
+                for (uint32_t i = 0; i < workerCount; ++i)
+                {
+                    jobDesc.m_workerThreads.push_back(threadDesc);
+                }
+                m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+                m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+
+                m_host = AZStd::make_unique<InterestGridHost>();
+
+                // Deterministic positions, so runs are comparable
+                const float areaSize = 4.0f * sv_ClientAwarenessRadius;
+                uint32_t seed = 1;
+                auto randomCoordinate = [&seed, areaSize]()
+                {
+                    seed = seed * 1664525u + 1013904223u;
+                    return (aznumeric_cast<float>(seed >> 8) / aznumeric_cast<float>(1u << 24) - 0.5f) * areaSize;
+                };
+                for (int64_t i = 0; i < state.range(1); ++i)
+                {
+                    m_host->CreateEntity(AZ::Vector3(randomCoordinate(), randomCoordinate(), 0.0f));
+                }
+
+                m_host->m_interestGrid.Activate();
+                for (int64_t i = 0; i < state.range(0); ++i)
+                {
+                    AZ::Entity* observerEntity = m_host->CreateEntity(AZ::Vector3(randomCoordinate(), randomCoordinate(), 0.0f));
+                    m_host->m_interestGrid.AddObserver(InterestGridHost::GetEntityHandle(observerEntity),
+                        aznumeric_cast<AzNetworking::ConnectionId>(i), [](const InterestGrid::RelevantEntityList&) {});
+                }
+            }
+
+            void TearDown(::benchmark::State& state) override
+            {
+                m_host.reset();
+                m_jobContext.reset();
+                m_jobManager.reset();
+
+                AZ::NameDictionary::Destroy();
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+
+        protected:
+            void UpdateRelevancy(::benchmark::State& state, AZ::JobContext* jobContext)
+            {
+                for ([[maybe_unused]] auto _ : state)
+                {
+                    m_host->m_interestGrid.UpdateRelevancy(jobContext);
+                }
+                state.SetItemsProcessed(state.iterations() * state.range(0));
+            }
+
+            AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+            AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+            AZStd::unique_ptr<InterestGridHost> m_host;
+        };
+
+        void InterestGridBenchmarkArguments(::benchmark::internal::Benchmark* benchmark)
+        {
+            for (int64_t entityCount : { 10000, 20000 })
+            {
+                benchmark->Args({ 200, entityCount });
+            }
+            benchmark->ArgNames({ "Observers", "Entities" });
+            benchmark->Unit(::benchmark::kMillisecond);
+        }
+
+        BENCHMARK_DEFINE_F(InterestGridBenchmarkFixture, UpdateRelevancySerial)(::benchmark::State& state)
+        {
+            UpdateRelevancy(state, nullptr);
+        }
+        BENCHMARK_REGISTER_F(InterestGridBenchmarkFixture, UpdateRelevancySerial)->Apply(InterestGridBenchmarkArguments);
+
+        BENCHMARK_DEFINE_F(InterestGridBenchmarkFixture, UpdateRelevancyParallel)(::benchmark::State& state)
+        {
+            UpdateRelevancy(state, m_jobContext.get());
+        }
+        BENCHMARK_REGISTER_F(InterestGridBenchmarkFixture, UpdateRelevancyParallel)->Apply(InterestGridBenchmarkArguments);
+    } // namespace Benchmark
+#endif // HAVE_BENCHMARK
+} // namespace Multiplayer
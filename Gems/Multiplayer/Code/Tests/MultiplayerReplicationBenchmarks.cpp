@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Serialization/HashSerializer.h>
+#include <AzTest/AzTest.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <MultiplayerSystemComponent.h>
+#include <IMultiplayerConnectionMock.h>
+
+namespace Multiplayer
+{
+    using ::testing::_;
+    using ::testing::Invoke;
+    using ::testing::NiceMock;
+    using ::testing::Return;
+
+    //! Replication window that keeps every entity it's given relevant to the connection.
+    class FullReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+        explicit FullReplicationWindow(const ReplicationSet& replicationSet)
+            : m_replicationSet(replicationSet)
+        {
+        }
+
+        bool ReplicationSetUpdateReady() override
+        {
+            return true;
+        }
+
+        const ReplicationSet& GetReplicationSet() const override
+        {
+            return m_replicationSet;
+        }
+
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override
+        {
+            return AZStd::numeric_limits<uint32_t>::max();
+        }
+
+        bool IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const override
+        {
+            auto iter = m_replicationSet.find(entityHandle);
+            if (iter != m_replicationSet.end())
+            {
+                outNetworkRole = iter->second.m_netEntityRole;
+                return true;
+            }
+            return false;
+        }
+
+        void UpdateWindow() override
+        {
+        }
+
+        void DebugDraw() const override
+        {
+        }
+
+    private:
+        const ReplicationSet& m_replicationSet;
+    };
+
+    //! Simulates a dedicated server replicating entityCount entities with a NetworkTransformComponent to each of
+    //! connectionCount clients. The mock connections never acknowledge a packet, so every entity is serialized for every
+    //! client on every update, which is the worst case for a server frame.
+    //! Requires the system, pool and thread pool allocators and the name dictionary.
+    class ReplicationServer
+    {
+    public:
+        ReplicationServer(int64_t connectionCount, int64_t entityCount, bool recordPackets)
+            : m_recordPackets(recordPackets)
+        {
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            const uint32_t workerCount = AZStd::max(AZStd::thread::hardware_concurrency(), 2u) - 1;
+            for (uint32_t i = 0; i < workerCount; ++i)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+
+            m_netComponent = new AzNetworking::NetworkingSystemComponent();
+            m_mpComponent = new MultiplayerSystemComponent();
+            m_mpComponent->Activate();
+
+            INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
+            for (int64_t i = 0; i < entityCount; ++i)
+            {
+                AZ::Entity* entity = aznew AZ::Entity();
+                NetBindComponent* netBindComponent = entity->CreateComponent<NetBindComponent>();
+                NetworkTransformComponent* networkTransform = entity->CreateComponent<NetworkTransformComponent>();
+                networkEntityManager->SetupNetEntity(entity, PrefabEntityId(), NetEntityRole::Authority);
+                // Initializing the entity constructs the controllers, which are needed to modify the network properties
+                entity->Init();
+
+                m_replicationSet[netBindComponent->GetEntityHandle()].m_netEntityRole = NetEntityRole::Client;
+                m_transformControllers.push_back(static_cast<NetworkTransformComponentController*>(networkTransform->GetController()));
+                m_entities.emplace_back(entity);
+            }
+
+            m_lastPacketIds.resize(aznumeric_cast<size_t>(connectionCount), PacketId{ 0 });
+            m_sentPacketHashes.resize(aznumeric_cast<size_t>(connectionCount));
+            for (int64_t i = 0; i < connectionCount; ++i)
+            {
+                const size_t connectionIndex = aznumeric_cast<size_t>(i);
+                auto connection = AZStd::make_unique<NiceMock<IMultiplayerConnectionMock>>(
+                    aznumeric_cast<ConnectionId>(i), IpAddress(), ConnectionRole::Acceptor);
+                ON_CALL(*connection, GetConnectionMtu()).WillByDefault(Return(MaxUdpTransmissionUnit));
+                ON_CALL(*connection, SendReliablePacket(_)).WillByDefault(Invoke([this, connectionIndex](const IPacket& packet)
+                {
+                    RecordPacket(connectionIndex, packet);
+                    return true;
+                }));
+                ON_CALL(*connection, SendUnreliablePacket(_)).WillByDefault(Invoke([this, connectionIndex](const IPacket& packet)
+                {
+                    RecordPacket(connectionIndex, packet);
+                    return ++m_lastPacketIds[connectionIndex];
+                }));
+
+                auto manager = AZStd::make_unique<EntityReplicationManager>(
+                    *connection, *m_mpComponent, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+                manager->SetReplicationWindow(AZStd::make_unique<FullReplicationWindow>(m_replicationSet));
+                manager->UpdateWindow();
+
+                m_managerList.push_back(manager.get());
+                m_managers.emplace_back(AZStd::move(manager));
+                m_connections.emplace_back(AZStd::move(connection));
+            }
+        }
+
+        ~ReplicationServer()
+        {
+            m_managerList = EntityReplicationManager::EntityReplicationManagerList();
+            m_managers = {};
+            m_connections = {};
+            m_replicationSet = {};
+            m_transformControllers = {};
+            m_entities = {};
+
+            m_mpComponent->Deactivate();
+            delete m_mpComponent;
+            delete m_netComponent;
+
+            delete m_jobContext;
+            delete m_jobManager;
+        }
+
+        //! Moves every entity and dispatches the dirtied events, like the game simulation between two network updates.
+        void MoveEntities(uint32_t frame)
+        {
+            const float offset = aznumeric_cast<float>(frame);
+            for (size_t i = 0; i < m_transformControllers.size(); ++i)
+            {
+                m_transformControllers[i]->SetTranslation(AZ::Vector3(aznumeric_cast<float>(i), offset, 0.0f));
+            }
+            GetNetworkEntityManager()->NotifyEntitiesDirtied();
+        }
+
+        //! Builds and sends the updates for all connections the way MultiplayerSystemComponent does.
+        //! @param hostTimeMs                        the host time to send the updates with
+        //! @param multithreadedConnectionUpdates    the value of sv_multithreadedConnectionUpdates
+        void SendUpdates(AZ::TimeMs hostTimeMs, bool multithreadedConnectionUpdates)
+        {
+            EntityReplicationManager::SendUpdates(m_managerList, hostTimeMs, multithreadedConnectionUpdates ? m_jobContext : nullptr);
+        }
+
+        //! Returns the hashes of the packets sent on each connection, in the order they were sent.
+        const AZStd::vector<AZStd::vector<AZ::HashValue32>>& GetSentPacketHashes() const
+        {
+            return m_sentPacketHashes;
+        }
+
+    private:
+        void RecordPacket(size_t connectionIndex, const IPacket& packet)
+        {
+            if (m_recordPackets)
+            {
+                // The hash serializer only reads from the packet
+                AzNetworking::HashSerializer serializer;
+                const_cast<IPacket&>(packet).Serialize(serializer);
+                m_sentPacketHashes[connectionIndex].push_back(serializer.GetHash());
+            }
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+        AzNetworking::NetworkingSystemComponent* m_netComponent = nullptr;
+        MultiplayerSystemComponent* m_mpComponent = nullptr;
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        AZStd::vector<NetworkTransformComponentController*> m_transformControllers;
+        ReplicationSet m_replicationSet;
+        AZStd::vector<AZStd::unique_ptr<NiceMock<IMultiplayerConnectionMock>>> m_connections;
+        AZStd::vector<AZStd::unique_ptr<EntityReplicationManager>> m_managers;
+        EntityReplicationManager::EntityReplicationManagerList m_managerList;
+        AZStd::vector<PacketId> m_lastPacketIds;
+        AZStd::vector<AZStd::vector<AZ::HashValue32>> m_sentPacketHashes;
+        bool m_recordPackets = false;
+    };
+
+    class MultiplayerReplicationTests
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SetupAllocator();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+            AZ::NameDictionary::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::NameDictionary::Destroy();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            TeardownAllocator();
+        }
+    };
+
+    TEST_F(MultiplayerReplicationTests, SendUpdates_MultithreadedConnectionUpdatesOnAndOff_SendIdenticalPackets)
+    {
+        constexpr int64_t ConnectionCount = 8;
+        constexpr int64_t EntityCount = 200;
+        constexpr uint32_t FrameCount = 4;
+
+        auto sendFrames = [](bool multithreadedConnectionUpdates)
+        {
+            ReplicationServer server(ConnectionCount, EntityCount, true);
+            for (uint32_t frame = 0; frame < FrameCount; ++frame)
+            {
+                server.MoveEntities(frame);
+                server.SendUpdates(AZ::TimeMs{ frame * 50 }, multithreadedConnectionUpdates);
+            }
+            return server.GetSentPacketHashes();
+        };
+
+        const AZStd::vector<AZStd::vector<AZ::HashValue32>> serialPackets = sendFrames(false);
+        const AZStd::vector<AZStd::vector<AZ::HashValue32>> parallelPackets = sendFrames(true);
+
+        ASSERT_EQ(aznumeric_cast<size_t>(ConnectionCount), serialPackets.size());
+        ASSERT_EQ(aznumeric_cast<size_t>(ConnectionCount), parallelPackets.size());
+        for (size_t i = 0; i < serialPackets.size(); ++i)
+        {
+            EXPECT_FALSE(serialPackets[i].empty());
+            EXPECT_TRUE(serialPackets[i] == parallelPackets[i]) << "Connection " << i << " sent different packets";
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    namespace Benchmark
+    {
+        //! Replicates state.range(1) moving entities to each of state.range(0) clients, see ReplicationServer.
+        class ReplicationBenchmarkFixture
+            : public UnitTest::AllocatorsBenchmarkFixture
+        {
+        public:
+            using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+            using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+            void SetUp(::benchmark::State& state) override
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+                AZ::NameDictionary::Create();
+
+                m_server = AZStd::make_unique<ReplicationServer>(state.range(0), state.range(1), false);
+            }
+
+            void TearDown(::benchmark::State& state) override
+            {
+                m_server.reset();
+
+                AZ::NameDictionary::Destroy();
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+
+        protected:
+            void SendUpdates(::benchmark::State& state, bool multithreadedConnectionUpdates)
+            {
+                uint32_t frame = 0;
+                for ([[maybe_unused]] auto _ : state)
+                {
+                    state.PauseTiming();
+                    m_server->MoveEntities(frame++);
+                    state.ResumeTiming();
+
+                    m_server->SendUpdates(AZ::GetElapsedTimeMs(), multithreadedConnectionUpdates);
+                }
+                state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+            }
+
+            AZStd::unique_ptr<ReplicationServer> m_server;
+        };
+
+        void ReplicationBenchmarkArguments(::benchmark::internal::Benchmark* benchmark)
+        {
+            for (int64_t connectionCount : { 16, 64, 128 })
+            {
+                for (int64_t entityCount : { 100, 1000 })
+                {
+                    benchmark->Args({ connectionCount, entityCount });
+                }
+            }
+            benchmark->ArgNames({ "Connections", "Entities" });
+            benchmark->Unit(::benchmark::kMillisecond);
+        }
+
+        BENCHMARK_DEFINE_F(ReplicationBenchmarkFixture, SendUpdatesSerial)(::benchmark::State& state)
+        {
+            SendUpdates(state, false);
+        }
+        BENCHMARK_REGISTER_F(ReplicationBenchmarkFixture, SendUpdatesSerial)->Apply(ReplicationBenchmarkArguments);
+
+        BENCHMARK_DEFINE_F(ReplicationBenchmarkFixture, SendUpdatesParallel)(::benchmark::State& state)
+        {
+            SendUpdates(state, true);
+        }
+        BENCHMARK_REGISTER_F(ReplicationBenchmarkFixture, SendUpdatesParallel)->Apply(ReplicationBenchmarkArguments);
+    } // namespace Benchmark
+#endif // HAVE_BENCHMARK
+} // namespace Multiplayer
@@ -72,6 +72,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.h
     Source/NetworkEntity/EntityReplication/EntityReplicator.inl
+    Source/NetworkEntity/EntityReplication/EntitySnapshotHistory.cpp
+    Source/NetworkEntity/EntityReplication/EntitySnapshotHistory.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
@@ -105,6 +107,8 @@ set(FILES
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
     Source/Pipeline/NetworkSpawnableHolderComponent.h
     Source/Physics/PhysicsUtils.cpp
+    Source/ReplicationWindows/InterestGrid.cpp
+    Source/ReplicationWindows/InterestGrid.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
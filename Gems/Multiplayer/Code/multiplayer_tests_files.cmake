@@ -9,6 +9,8 @@
 set(FILES
     Tests/Main.cpp
     Tests/IMultiplayerConnectionMock.h
+    Tests/InterestGridTests.cpp
+    Tests/MultiplayerReplicationBenchmarks.cpp
     Tests/MultiplayerSystemTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp